@@ -24,6 +24,9 @@ void CJSScanner::Scan(const std::string& url, int file_name)
 	std::tstring exeDir = ExtractDirectory(exePath);
 	std::tstring htmljsDir = exeDir + TEXT("/htmljs/") + TCSFromMBS(taskId);
 
+	// 🔥 JSSCANNER_REPORT_FORMAT=cbor 이면 결과를 CBOR + LZ4 로 저장
+	m_pJSAnalyzer->setReportFormat(BinaryReport::parseFormat(std::getenv("JSSCANNER_REPORT_FORMAT")));
+
 	std::string analysisJson = m_pJSAnalyzer->analyzeFiles(MBSFromTCS(htmljsDir), taskId);
 
 	auto scan_end = std::chrono::steady_clock::now();
@@ -39,13 +42,21 @@ void CJSScanner::Scan(const std::string& url, int file_name)
 
 void CJSScanner::SaveResult(const std::string& url, const std::string& analysisJson, int file_name, double duration_ms)
 {
+	// 바이너리 보고서를 만들었으면 JSON 대신 저장 (인코딩 실패 시 JSON 유지)
+	const std::string& binaryReport = m_pJSAnalyzer->getLastBinaryReport();
+	const bool binary = m_pJSAnalyzer->getReportFormat() == ReportFormat::CborLz4 && !binaryReport.empty();
+
 	std::string resultDir = GenerateResultDirectory();
-	std::string resultPath = resultDir + "/" + GenerateResultFilename(file_name);
+	std::string resultPath = resultDir + "/" + (binary ? std::to_string(file_name) + BinaryReport::FILE_EXTENSION
+	                                                   : GenerateResultFilename(file_name));
 
-	std::ofstream outFile(resultPath);
+	std::ofstream outFile(resultPath, binary ? std::ios::out | std::ios::binary : std::ios::out);
 	if (outFile.is_open())
 	{
-		outFile << analysisJson;
+		if (binary)
+			outFile.write(binaryReport.data(), static_cast<std::streamsize>(binaryReport.size()));
+		else
+			outFile << analysisJson;
 		outFile.close();
 		Log_Info("HtmlJS Scanner - Result saved: %s", resultPath.c_str());
 	}
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "BuiltinObject.h"
+#include "LazyGlobals.h"
 
 void BuiltinObjects::registerAll(JSContext* ctx, JSValue global_obj) {
     // Core Objects
@@ -19,12 +20,8 @@ void BuiltinObjects::registerAll(JSContext* ctx, JSValue global_obj) {
     FormDataObject::registerFormDataObject(ctx, global_obj);
     BlobObject::registerBlobObject(ctx, global_obj);
     TextDecoderObject::registerTextDecoder(ctx, global_obj);
-    WebSocketObject::registerWebSocketObject(ctx, global_obj);
-    WebAssemblyObject::registerWebAssemblyObject(ctx, global_obj);
-    WorkerObject::registerWorkerObject(ctx, global_obj);
 
-    // Third-party & Extensions
-    JQueryObject::registerJQueryObject(ctx, global_obj);
-    MediumPriorityAPIs::registerMediumPriorityAPIs(ctx, global_obj);
-    LowPriorityAPIs::registerLowPriorityAPIs(ctx, global_obj);
+    // 🔥 WebSocket / WebAssembly / Worker / IndexedDB / jQuery / Medium·Low Priority API
+    //    - 첫 접근 시 생성 (LazyGlobals.cpp)
+    LazyGlobals::install(ctx, global_obj);
 }
\ No newline at end of file
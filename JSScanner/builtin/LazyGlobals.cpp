@@ -0,0 +1,216 @@
+#include "pch.h"
+#include "LazyGlobals.h"
+#include "BuiltinObject.h"
+#include "../core/JSAnalyzer.h"
+#include "../core/MetricsRegistry.h"
+#include "../hooks/HookType.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace LazyGlobals {
+
+namespace {
+
+// 한 번에 등록되는 전역 이름 묶음 (install 이 names 를 모두 정의)
+struct LazyGroup {
+    const char* api;                 // 이벤트/메트릭 라벨
+    const char* const* names;        // nullptr 종료
+    void (*install)(JSContext* ctx, JSValue global_obj);
+};
+
+const char* const JQUERY_NAMES[] = {"$", "jQuery", nullptr};
+const char* const WEBSOCKET_NAMES[] = {"WebSocket", nullptr};
+const char* const WEBASSEMBLY_NAMES[] = {"WebAssembly", nullptr};
+const char* const WORKER_NAMES[] = {"Worker", "SharedWorker", nullptr};
+const char* const INDEXEDDB_NAMES[] = {"indexedDB", nullptr};
+const char* const MEDIUM_NAMES[] = {"Element", "MutationObserver", "sessionStorage", nullptr};
+// navigator.geolocation / navigator.clipboard 는 묶음이 생성될 때 함께 등록됨
+const char* const LOW_NAMES[] = {"Notification", "RTCPeerConnection", "requestAnimationFrame", nullptr};
+
+const LazyGroup LAZY_GROUPS[] = {
+    {"jQuery", JQUERY_NAMES, JQueryObject::registerJQueryObject},
+    {"WebSocket", WEBSOCKET_NAMES, WebSocketObject::registerWebSocketObject},
+    {"WebAssembly", WEBASSEMBLY_NAMES, WebAssemblyObject::registerWebAssemblyObject},
+    {"Worker", WORKER_NAMES, WorkerObject::registerWorkerObject},
+    {"IndexedDB", INDEXEDDB_NAMES, IndexedDBObject::registerIndexedDBObject},
+    {"MediumPriorityAPIs", MEDIUM_NAMES, MediumPriorityAPIs::registerMediumPriorityAPIs},
+    {"LowPriorityAPIs", LOW_NAMES, LowPriorityAPIs::registerLowPriorityAPIs},
+};
+
+constexpr int LAZY_GROUP_COUNT = static_cast<int>(sizeof(LAZY_GROUPS) / sizeof(LAZY_GROUPS[0]));
+
+// 기능 탐지(typeof X) 수준의 신호라 기본 리포트 기준(5) 아래로 발행
+constexpr int FIRST_TOUCH_SEVERITY = 3;
+
+void deleteGlobal(JSContext* ctx, JSValueConst global_obj, const char* name) {
+    JSAtom atom = JS_NewAtom(ctx, name);
+    JS_DeleteProperty(ctx, global_obj, atom, 0);
+    JS_FreeAtom(ctx, atom);
+}
+
+int groupSize(const LazyGroup& group) {
+    int count = 0;
+    while (group.names[count]) ++count;
+    return count;
+}
+
+// 묶음 상태 (getter 의 func_data, 스크립트에서 접근 불가)
+// - [0, n): 설치한 getter (전역 속성이 아직 이 getter 인지 비교용)
+// - [n]: 이미 등록했으면 true
+bool isMaterialized(JSContext* ctx, JSValueConst state, int count) {
+    JSValue done = JS_GetPropertyUint32(ctx, state, static_cast<uint32_t>(count));
+    bool result = JS_ToBool(ctx, done) > 0;
+    JS_FreeValue(ctx, done);
+    return result;
+}
+
+// 등록 전에 스크립트가 바꾼 (대입 / defineProperty / delete) 이름의 상태
+struct SavedGlobal {
+    JSAtom atom;
+    bool present;
+    JSPropertyDescriptor desc;
+};
+
+// 묶음의 getter 중 아직 남은 것만 지우고 실제 객체 등록 (스크립트가 바꾼 이름은 그대로 유지)
+void materialize(JSContext* ctx, int groupIndex, JSValueConst state, const char* touchedName) {
+    const LazyGroup& group = LAZY_GROUPS[groupIndex];
+    const int count = groupSize(group);
+
+    JSValue global_obj = JS_GetGlobalObject(ctx);
+    std::vector<SavedGlobal> saved;
+    for (int i = 0; i < count; ++i) {
+        SavedGlobal entry{JS_NewAtom(ctx, group.names[i]), false, {}};
+        int has = JS_GetOwnProperty(ctx, &entry.desc, global_obj, entry.atom);
+        if (has < 0) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        }
+        entry.present = has > 0;
+
+        bool lazy = false;
+        if (entry.present && (entry.desc.flags & JS_PROP_GETSET)) {
+            JSValue installed = JS_GetPropertyUint32(ctx, state, static_cast<uint32_t>(i));
+            lazy = JS_IsStrictEqual(ctx, entry.desc.getter, installed);
+            JS_FreeValue(ctx, installed);
+        }
+        if (lazy) {
+            JS_FreeValue(ctx, entry.desc.getter);
+            JS_FreeValue(ctx, entry.desc.setter);
+            JS_FreeValue(ctx, entry.desc.value);
+            JS_DeleteProperty(ctx, global_obj, entry.atom, 0);
+            JS_FreeAtom(ctx, entry.atom);
+        } else {
+            saved.push_back(entry);
+        }
+    }
+    JS_SetPropertyUint32(ctx, state, static_cast<uint32_t>(count), JS_TRUE);
+
+    group.install(ctx, global_obj);
+
+    // install 이 덮어쓴 이름은 스크립트가 남긴 상태로 되돌림
+    for (SavedGlobal& entry : saved) {
+        JS_DeleteProperty(ctx, global_obj, entry.atom, 0);
+        if (entry.present) {
+            int flags = entry.desc.flags & (JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE);
+            if (entry.desc.flags & JS_PROP_GETSET) {
+                JS_DefinePropertyGetSet(ctx, global_obj, entry.atom, entry.desc.getter, entry.desc.setter, flags);
+                JS_FreeValue(ctx, entry.desc.value);
+            } else {
+                flags |= entry.desc.flags & JS_PROP_WRITABLE;
+                JS_DefinePropertyValue(ctx, global_obj, entry.atom, entry.desc.value, flags);
+                JS_FreeValue(ctx, entry.desc.getter);
+                JS_FreeValue(ctx, entry.desc.setter);
+            }
+        }
+        JS_FreeAtom(ctx, entry.atom);
+    }
+    JS_FreeValue(ctx, global_obj);
+
+    MetricsRegistry::instance().counter("jsscanner_lazy_globals_materialized_total", {{"api", group.api}},
+        "Lazily registered browser APIs materialized on first access").inc();
+
+    JSAnalyzerContext* a_ctx = static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
+    if (a_ctx && a_ctx->dynamicAnalyzer) {
+        a_ctx->hookBus.emit(HookType::ENVIRONMENT_DETECTION, FIRST_TOUCH_SEVERITY, [&] {
+            HookEvent event;
+            event.name = touchedName;
+            event.reason = std::string("API first touched: ") + touchedName;
+            event.features["api"] = JsValue(std::string(group.api));
+            event.tags.insert("api_first_touch");
+            return event;
+        });
+    }
+}
+
+// func_data[0] = 묶음 안의 이름 index, func_data[1] = 묶음 상태 (getter 만), magic = 묶음 index
+const char* lazyName(JSContext* ctx, int magic, JSValueConst* func_data) {
+    int32_t nameIndex = 0;
+    JS_ToInt32(ctx, &nameIndex, func_data[0]);
+    return LAZY_GROUPS[magic].names[nameIndex];
+}
+
+JSValue js_lazy_global_get(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv,
+                           int magic, JSValueConst* func_data) {
+    const char* name = lazyName(ctx, magic, func_data);
+    // 꺼내 둔 getter 를 나중에 다시 호출해도 두 번 등록하지 않음
+    if (!isMaterialized(ctx, func_data[1], groupSize(LAZY_GROUPS[magic]))) {
+        materialize(ctx, magic, func_data[1], name);
+    }
+
+    JSValue global_obj = JS_GetGlobalObject(ctx);
+    JSValue value = JS_GetPropertyStr(ctx, global_obj, name);
+    JS_FreeValue(ctx, global_obj);
+    return value;
+}
+
+// 첫 접근 전에 스크립트가 대입하면 해당 이름만 일반 속성으로 교체 (묶음은 생성하지 않음)
+JSValue js_lazy_global_set(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv,
+                           int magic, JSValueConst* func_data) {
+    const char* name = lazyName(ctx, magic, func_data);
+
+    JSValue global_obj = JS_GetGlobalObject(ctx);
+    deleteGlobal(ctx, global_obj, name);
+    JS_DefinePropertyValueStr(ctx, global_obj, name,
+        JS_DupValue(ctx, argc > 0 ? argv[0] : JS_UNDEFINED), JS_PROP_C_W_E);
+    JS_FreeValue(ctx, global_obj);
+    return JS_UNDEFINED;
+}
+
+} // namespace
+
+bool eagerMode() {
+    static const bool eager = [] {
+        const char* env = std::getenv("JSSCANNER_EAGER_GLOBALS");
+        return env && *env && std::strcmp(env, "0") != 0;
+    }();
+    return eager;
+}
+
+void install(JSContext* ctx, JSValue global_obj) {
+    if (eagerMode()) {
+        for (const LazyGroup& group : LAZY_GROUPS) {
+            group.install(ctx, global_obj);
+        }
+        return;
+    }
+
+    for (int groupIndex = 0; groupIndex < LAZY_GROUP_COUNT; ++groupIndex) {
+        const LazyGroup& group = LAZY_GROUPS[groupIndex];
+        JSValue state = JS_NewArray(ctx);
+        for (int nameIndex = 0; group.names[nameIndex]; ++nameIndex) {
+            JSValue getterData[2] = {JS_NewInt32(ctx, nameIndex), state};
+            JSValue getter = JS_NewCFunctionData(ctx, js_lazy_global_get, 0, groupIndex, 2, getterData);
+            JSValue setter = JS_NewCFunctionData(ctx, js_lazy_global_set, 1, groupIndex, 1, getterData);
+            JS_SetPropertyUint32(ctx, state, static_cast<uint32_t>(nameIndex), JS_DupValue(ctx, getter));
+
+            // 열거 불가: VariableScanner 의 전역 순회가 getter 를 실행하지 않도록
+            JSAtom atom = JS_NewAtom(ctx, group.names[nameIndex]);
+            JS_DefinePropertyGetSet(ctx, global_obj, atom, getter, setter, JS_PROP_CONFIGURABLE);
+            JS_FreeAtom(ctx, atom);
+        }
+        JS_SetPropertyUint32(ctx, state, static_cast<uint32_t>(groupSize(group)), JS_FALSE);
+        JS_FreeValue(ctx, state);
+    }
+}
+
+} // namespace LazyGlobals
@@ -0,0 +1,22 @@
+#pragma once
+#include "../quickjs.h"
+
+// ========================================
+// 🔥 자주 쓰이지 않는 브라우저 API 의 지연 등록
+// - jQuery, WebSocket, WebAssembly, Worker, IndexedDB, Medium/Low Priority API 는
+//   대부분의 페이지에서 한 번도 접근되지 않으므로 전역에 getter 만 걸어 둠
+// - 첫 접근 시 같은 묶음에서 아직 getter 인 이름만 지우고 실제 객체를 등록한 뒤 값을 반환
+//   (이후 접근은 일반 데이터 속성, 스크립트가 먼저 대입/재정의/삭제한 이름은 그 상태를 유지)
+// - 첫 접근은 ENVIRONMENT_DETECTION 이벤트(tag: api_first_touch)와
+//   jsscanner_lazy_globals_materialized_total{api} 카운터로 기록
+// - JSSCANNER_EAGER_GLOBALS=1 이면 기존처럼 모두 즉시 등록 (비교 측정용)
+// ========================================
+namespace LazyGlobals {
+
+    // 지연 등록 대상 전역 이름에 getter/setter 설치 (eager 모드면 즉시 등록)
+    void install(JSContext* ctx, JSValue global_obj);
+
+    // JSSCANNER_EAGER_GLOBALS 설정 여부 (프로세스 단위 1회 조회)
+    bool eagerMode();
+
+} // namespace LazyGlobals
@@ -1,54 +1,195 @@
 #include "pch.h"
 #include "Base64Utils.h"
 
+#include <array>
+#include <cstdint>
+
 namespace Base64Utils {
-    static const std::string base64_chars =
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-        "abcdefghijklmnopqrstuvwxyz"
-        "0123456789+/";
+    namespace {
+        constexpr char STANDARD_CHARS[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz"
+            "0123456789+/";
+        constexpr char URL_CHARS[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+            "abcdefghijklmnopqrstuvwxyz"
+            "0123456789-_";
+
+        // 알파벳 외 문자 표시 (6bit 값과 겹치지 않는 비트)
+        constexpr uint32_t BAD = 0x80000000u;
+
+        // 4글자 묶음을 OR 한 번으로 24bit 로 합치기 위해 위치별로 미리 shift 한 테이블
+        struct DecodeTables {
+            std::array<uint32_t, 256> shifted[4];
+        };
+
+        constexpr DecodeTables makeDecodeTables(const char* chars) {
+            DecodeTables t{};
+            for (int pos = 0; pos < 4; ++pos) {
+                for (auto& v : t.shifted[pos]) v = BAD;
+            }
+            for (uint32_t v = 0; v < 64; ++v) {
+                unsigned char c = static_cast<unsigned char>(chars[v]);
+                t.shifted[0][c] = v << 18;
+                t.shifted[1][c] = v << 12;
+                t.shifted[2][c] = v << 6;
+                t.shifted[3][c] = v;
+            }
+            return t;
+        }
+
+        constexpr DecodeTables STANDARD_DECODE = makeDecodeTables(STANDARD_CHARS);
+        constexpr DecodeTables URL_DECODE = makeDecodeTables(URL_CHARS);
+
+        const DecodeTables& decodeTables(Alphabet alphabet) {
+            return alphabet == Alphabet::Url ? URL_DECODE : STANDARD_DECODE;
+        }
 
-    bool isBase64Char(unsigned char c) {
-        return (isalnum(c) || (c == '+') || (c == '/'));
+        const char* encodeChars(Alphabet alphabet) {
+            return alphabet == Alphabet::Url ? URL_CHARS : STANDARD_CHARS;
+        }
+
+        // 알파벳 문자가 아닌 첫 위치 (4글자씩 OR 로 검사)
+        size_t alphabetPrefix(std::string_view text, size_t from, const std::array<uint32_t, 256>& table) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(text.data());
+            size_t n = text.size();
+            size_t i = from;
+            while (i + 4 <= n && !((table[p[i]] | table[p[i + 1]] | table[p[i + 2]] | table[p[i + 3]]) & BAD)) {
+                i += 4;
+            }
+            while (i < n && !(table[p[i]] & BAD)) {
+                ++i;
+            }
+            return i;
+        }
     }
 
-    std::string decode(const std::string& encoded_string) {
-        int in_len = encoded_string.size();
-        int i = 0;
-        int j = 0;
-        int in_ = 0;
-        unsigned char char_array_4[4], char_array_3[3];
-        std::string ret;
+    bool isBase64Char(unsigned char c, Alphabet alphabet) {
+        return !(decodeTables(alphabet).shifted[3][c] & BAD);
+    }
 
-        while (in_len-- && (encoded_string[in_] != '=') && isBase64Char(encoded_string[in_])) {
-            char_array_4[i++] = encoded_string[in_]; in_++;
-            if (i == 4) {
-                for (i = 0; i < 4; i++)
-                    char_array_4[i] = base64_chars.find(char_array_4[i]);
+    std::string decode(std::string_view encoded, Alphabet alphabet) {
+        const DecodeTables& t = decodeTables(alphabet);
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(encoded.data());
+        size_t n = encoded.size();
+
+        std::string ret;
+        ret.resize(n / 4 * 3 + 3);
+        char* out = &ret[0];
 
-                char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-                char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-                char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
+        // 완전한 4글자 묶음 (알파벳 외 문자를 만나면 중단)
+        size_t i = 0;
+        while (i + 4 <= n) {
+            uint32_t v = t.shifted[0][in[i]] | t.shifted[1][in[i + 1]] |
+                         t.shifted[2][in[i + 2]] | t.shifted[3][in[i + 3]];
+            if (v & BAD) break;
+            out[0] = static_cast<char>(v >> 16);
+            out[1] = static_cast<char>(v >> 8);
+            out[2] = static_cast<char>(v);
+            out += 3;
+            i += 4;
+        }
 
-                for (i = 0; (i < 3); i++)
-                    ret += char_array_3[i];
-                i = 0;
+        // 남은 글자 (멈춘 묶음 포함): 유효한 부분까지만 모아서 2~3글자면 1~2바이트
+        size_t end = alphabetPrefix(encoded, i, t.shifted[3]);
+        while (i + 4 <= end) {
+            uint32_t v = t.shifted[0][in[i]] | t.shifted[1][in[i + 1]] |
+                         t.shifted[2][in[i + 2]] | t.shifted[3][in[i + 3]];
+            out[0] = static_cast<char>(v >> 16);
+            out[1] = static_cast<char>(v >> 8);
+            out[2] = static_cast<char>(v);
+            out += 3;
+            i += 4;
+        }
+        size_t rest = end - i;
+        if (rest >= 2) {
+            uint32_t v = t.shifted[0][in[i]] | t.shifted[1][in[i + 1]] |
+                         (rest == 3 ? t.shifted[2][in[i + 2]] : 0);
+            *out++ = static_cast<char>(v >> 16);
+            if (rest == 3) {
+                *out++ = static_cast<char>(v >> 8);
             }
         }
 
-        if (i) {
-            for (j = i; j < 4; j++)
-                char_array_4[j] = 0;
+        ret.resize(static_cast<size_t>(out - ret.data()));
+        return ret;
+    }
+
+    std::string encode(std::string_view data, Alphabet alphabet, bool pad) {
+        const char* chars = encodeChars(alphabet);
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(data.data());
+        size_t n = data.size();
 
-            for (j = 0; j < 4; j++)
-                char_array_4[j] = base64_chars.find(char_array_4[j]);
+        std::string ret;
+        ret.resize((n + 2) / 3 * 4);
+        char* out = &ret[0];
 
-            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
-            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
-            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
+        size_t i = 0;
+        for (; i + 3 <= n; i += 3) {
+            uint32_t v = (uint32_t(in[i]) << 16) | (uint32_t(in[i + 1]) << 8) | in[i + 2];
+            out[0] = chars[(v >> 18) & 0x3F];
+            out[1] = chars[(v >> 12) & 0x3F];
+            out[2] = chars[(v >> 6) & 0x3F];
+            out[3] = chars[v & 0x3F];
+            out += 4;
+        }
 
-            for (j = 0; (j < i - 1); j++) ret += char_array_3[j];
+        size_t rest = n - i;
+        if (rest) {
+            uint32_t v = uint32_t(in[i]) << 16;
+            if (rest == 2) v |= uint32_t(in[i + 1]) << 8;
+            *out++ = chars[(v >> 18) & 0x3F];
+            *out++ = chars[(v >> 12) & 0x3F];
+            if (rest == 2) {
+                *out++ = chars[(v >> 6) & 0x3F];
+            } else if (pad) {
+                *out++ = '=';
+            }
+            if (pad) *out++ = '=';
         }
 
+        ret.resize(static_cast<size_t>(out - ret.data()));
         return ret;
     }
+
+    bool isBase64(std::string_view text, size_t maxPadding, Alphabet alphabet) {
+        size_t end = text.size();
+        size_t padding = 0;
+        while (end > 0 && text[end - 1] == '=') {
+            --end;
+            ++padding;
+        }
+        if (end == 0 || padding > maxPadding) {
+            return false;
+        }
+        return alphabetPrefix(text.substr(0, end), 0, decodeTables(alphabet).shifted[3]) == end;
+    }
+
+    bool containsBase64Run(std::string_view text, size_t minRun, Alphabet alphabet) {
+        if (minRun == 0) return true;
+        const std::array<uint32_t, 256>& table = decodeTables(alphabet).shifted[3];
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(text.data());
+        size_t n = text.size();
+
+        // minRun 간격으로 건너뛰며, 걸린 알파벳 문자에서만 앞뒤로 구간 확장
+        size_t i = minRun - 1;
+        size_t scannedFrom = 0;
+        while (i < n) {
+            if (table[p[i]] & BAD) {
+                i += minRun;
+                continue;
+            }
+            size_t start = i;
+            while (start > scannedFrom && !(table[p[start - 1]] & BAD)) {
+                --start;
+            }
+            size_t end = alphabetPrefix(text, i, table);
+            if (end - start >= minRun) {
+                return true;
+            }
+            scannedFrom = end;
+            i = end + minRun;
+        }
+        return false;
+    }
 }
@@ -1,18 +1,50 @@
 #pragma once
 #include <string>
+#include <string_view>
+#include <cstddef>
 
+// 🔥 Base64 / Base64URL 공용 codec
+// - 256 엔트리 lookup table 기반 (문자 검색 없음), 4글자 단위로 묶어 처리
+// - atob hook, 문자열 추적기, 변수 스캐너 등 Base64 판정/디코딩은 모두 여기를 사용
 namespace Base64Utils {
+
+    enum class Alphabet {
+        Standard,   // A-Z a-z 0-9 + /
+        Url         // A-Z a-z 0-9 - _ (RFC 4648 §5)
+    };
+
     /**
      * Base64 디코딩 함수
-     * @param encoded_string Base64로 인코딩된 문자열
-     * @return 디코딩된 문자열
+     * - 첫 번째 '=' 또는 알파벳 외 문자에서 멈추고 그 앞까지만 디코딩 (기존 atob hook 동작)
+     * @param encoded Base64로 인코딩된 문자열
+     * @return 디코딩된 바이트열
+     */
+    std::string decode(std::string_view encoded, Alphabet alphabet = Alphabet::Standard);
+
+    /**
+     * Base64 인코딩 함수
+     * @param data 원본 바이트열
+     * @param pad '=' 패딩 추가 여부 (Base64URL 은 보통 false)
      */
-    std::string decode(const std::string& encoded_string);
-    
+    std::string encode(std::string_view data, Alphabet alphabet = Alphabet::Standard, bool pad = true);
+
     /**
      * 문자가 Base64 문자인지 확인
      * @param c 확인할 문자
      * @return Base64 문자이면 true
      */
-    bool isBase64Char(unsigned char c);
+    bool isBase64Char(unsigned char c, Alphabet alphabet = Alphabet::Standard);
+
+    /**
+     * 문자열 전체가 "알파벳 1글자 이상 + '=' 최대 maxPadding 개" 형태인지
+     * - RE2 "^[A-Za-z0-9+/]+={0,N}$" 판정 대체
+     */
+    bool isBase64(std::string_view text, size_t maxPadding = std::string_view::npos,
+                  Alphabet alphabet = Alphabet::Standard);
+
+    /**
+     * 알파벳 문자가 minRun 개 이상 연속된 구간이 있는지
+     * - RE2 PartialMatch "[A-Za-z0-9+/]{N,}" 판정 대체
+     */
+    bool containsBase64Run(std::string_view text, size_t minRun, Alphabet alphabet = Alphabet::Standard);
 }
@@ -4,6 +4,8 @@
 #include "../../core/DynamicStringTracker.h"
 #include "../../core/ChainTrackerManager.h"
 #include "../../core/JSAnalyzer.h"
+#include "../../core/Sha256.h"
+#include <cstdio>
 
 const std::set<std::string> ActiveXObject::DANGEROUS_PROGIDS = {
     "WScript.Shell",
@@ -48,6 +50,205 @@ static JSClassID getActiveXClassID(JSContext* ctx) {
     return classIDs ? classIDs->activex_class_id : 0;
 }
 
+// ============================================
+// 🔥 VFS 연동 (FileSystemObject / TextStream / ADODB.Stream / WScript.Shell)
+// ============================================
+namespace {
+
+// OpenTextFile iomode
+constexpr int FOR_READING = 1;
+constexpr int FOR_WRITING = 2;
+
+// ADODB.Stream 상수
+constexpr int AD_TYPE_BINARY = 1;
+constexpr int AD_SAVE_CREATE_OVERWRITE = 2;
+constexpr int AD_READ_ALL = -1;
+constexpr int AD_READ_LINE = -2;
+constexpr int AD_WRITE_LINE = 1;
+
+enum VfsOp {
+    // Scripting.FileSystemObject
+    VFS_FSO_FILE_EXISTS,
+    VFS_FSO_FOLDER_EXISTS,
+    VFS_FSO_CREATE_FOLDER,
+    VFS_FSO_COPY_FILE,
+    VFS_FSO_MOVE_FILE,
+    VFS_FSO_GET_SPECIAL_FOLDER,
+    VFS_FSO_GET_TEMP_NAME,
+    VFS_FSO_BUILD_PATH,
+    VFS_FSO_GET_FILE_NAME,
+    // Scripting.TextStream
+    VFS_TS_WRITE,
+    VFS_TS_WRITE_LINE,
+    VFS_TS_WRITE_BLANK_LINES,
+    VFS_TS_READ,
+    VFS_TS_READ_LINE,
+    VFS_TS_READ_ALL,
+    VFS_TS_CLOSE,
+    // ADODB.Stream
+    VFS_STREAM_WRITE,
+    VFS_STREAM_WRITE_TEXT,
+    VFS_STREAM_READ,
+    VFS_STREAM_READ_TEXT,
+    VFS_STREAM_SAVE_TO_FILE,
+    VFS_STREAM_LOAD_FROM_FILE,
+    VFS_STREAM_SET_EOS,
+    VFS_STREAM_CLOSE,
+    // WScript.Shell
+    VFS_SHELL_EXPAND_ENVIRONMENT,
+};
+
+enum VfsProp {
+    VFS_PROP_AT_END_OF_STREAM,
+    VFS_PROP_TYPE,
+    VFS_PROP_POSITION,
+    VFS_PROP_SIZE,
+    VFS_PROP_CHARSET,
+    VFS_PROP_EOS,
+    VFS_PROP_STATE,
+};
+
+const JSCFunctionListEntry vfs_fso_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("FileExists", 1, ActiveXObject::js_vfs_method, VFS_FSO_FILE_EXISTS),
+    JS_CFUNC_MAGIC_DEF("FolderExists", 1, ActiveXObject::js_vfs_method, VFS_FSO_FOLDER_EXISTS),
+    JS_CFUNC_MAGIC_DEF("CreateFolder", 1, ActiveXObject::js_vfs_method, VFS_FSO_CREATE_FOLDER),
+    JS_CFUNC_MAGIC_DEF("CopyFile", 3, ActiveXObject::js_vfs_method, VFS_FSO_COPY_FILE),
+    JS_CFUNC_MAGIC_DEF("MoveFile", 2, ActiveXObject::js_vfs_method, VFS_FSO_MOVE_FILE),
+    JS_CFUNC_MAGIC_DEF("GetSpecialFolder", 1, ActiveXObject::js_vfs_method, VFS_FSO_GET_SPECIAL_FOLDER),
+    JS_CFUNC_MAGIC_DEF("GetTempName", 0, ActiveXObject::js_vfs_method, VFS_FSO_GET_TEMP_NAME),
+    JS_CFUNC_MAGIC_DEF("BuildPath", 2, ActiveXObject::js_vfs_method, VFS_FSO_BUILD_PATH),
+    JS_CFUNC_MAGIC_DEF("GetFileName", 1, ActiveXObject::js_vfs_method, VFS_FSO_GET_FILE_NAME),
+};
+
+const JSCFunctionListEntry vfs_text_stream_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("Write", 1, ActiveXObject::js_vfs_method, VFS_TS_WRITE),
+    JS_CFUNC_MAGIC_DEF("WriteLine", 1, ActiveXObject::js_vfs_method, VFS_TS_WRITE_LINE),
+    JS_CFUNC_MAGIC_DEF("WriteBlankLines", 1, ActiveXObject::js_vfs_method, VFS_TS_WRITE_BLANK_LINES),
+    JS_CFUNC_MAGIC_DEF("Read", 1, ActiveXObject::js_vfs_method, VFS_TS_READ),
+    JS_CFUNC_MAGIC_DEF("ReadLine", 0, ActiveXObject::js_vfs_method, VFS_TS_READ_LINE),
+    JS_CFUNC_MAGIC_DEF("ReadAll", 0, ActiveXObject::js_vfs_method, VFS_TS_READ_ALL),
+    JS_CFUNC_MAGIC_DEF("Close", 0, ActiveXObject::js_vfs_method, VFS_TS_CLOSE),
+    JS_CGETSET_MAGIC_DEF("AtEndOfStream", ActiveXObject::js_vfs_get, nullptr, VFS_PROP_AT_END_OF_STREAM),
+};
+
+const JSCFunctionListEntry vfs_stream_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("Write", 1, ActiveXObject::js_vfs_method, VFS_STREAM_WRITE),
+    JS_CFUNC_MAGIC_DEF("WriteText", 2, ActiveXObject::js_vfs_method, VFS_STREAM_WRITE_TEXT),
+    JS_CFUNC_MAGIC_DEF("Read", 1, ActiveXObject::js_vfs_method, VFS_STREAM_READ),
+    JS_CFUNC_MAGIC_DEF("ReadText", 1, ActiveXObject::js_vfs_method, VFS_STREAM_READ_TEXT),
+    JS_CFUNC_MAGIC_DEF("SaveToFile", 2, ActiveXObject::js_vfs_method, VFS_STREAM_SAVE_TO_FILE),
+    JS_CFUNC_MAGIC_DEF("LoadFromFile", 1, ActiveXObject::js_vfs_method, VFS_STREAM_LOAD_FROM_FILE),
+    JS_CFUNC_MAGIC_DEF("SetEOS", 0, ActiveXObject::js_vfs_method, VFS_STREAM_SET_EOS),
+    JS_CFUNC_MAGIC_DEF("Close", 0, ActiveXObject::js_vfs_method, VFS_STREAM_CLOSE),
+    JS_CGETSET_MAGIC_DEF("Type", ActiveXObject::js_vfs_get, ActiveXObject::js_vfs_set, VFS_PROP_TYPE),
+    JS_CGETSET_MAGIC_DEF("Position", ActiveXObject::js_vfs_get, ActiveXObject::js_vfs_set, VFS_PROP_POSITION),
+    JS_CGETSET_MAGIC_DEF("Size", ActiveXObject::js_vfs_get, nullptr, VFS_PROP_SIZE),
+    JS_CGETSET_MAGIC_DEF("Charset", ActiveXObject::js_vfs_get, ActiveXObject::js_vfs_set, VFS_PROP_CHARSET),
+    JS_CGETSET_MAGIC_DEF("EOS", ActiveXObject::js_vfs_get, nullptr, VFS_PROP_EOS),
+    JS_CGETSET_MAGIC_DEF("State", ActiveXObject::js_vfs_get, nullptr, VFS_PROP_STATE),
+};
+
+const JSCFunctionListEntry vfs_shell_funcs[] = {
+    JS_CFUNC_MAGIC_DEF("ExpandEnvironmentStrings", 1, ActiveXObject::js_vfs_method, VFS_SHELL_EXPAND_ENVIRONMENT),
+};
+
+std::string argString(JSContext* ctx, int argc, JSValueConst* argv, int index) {
+    if (index >= argc) return {};
+    size_t len = 0;
+    const char* str = JS_ToCStringLen(ctx, &len, argv[index]);
+    if (!str) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return {};
+    }
+    std::string out(str, len);
+    JS_FreeCString(ctx, str);
+    return out;
+}
+
+int32_t argInt(JSContext* ctx, int argc, JSValueConst* argv, int index, int32_t fallback) {
+    int32_t value = fallback;
+    if (index >= argc || JS_IsUndefined(argv[index])) return fallback;
+    if (JS_ToInt32(ctx, &value, argv[index]) < 0) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return fallback;
+    }
+    return value;
+}
+
+// JS 문자열 → 파일 바이트
+// utf8 이 아니면 코드 포인트가 모두 256 미만일 때 latin1 (바이너리를 문자열로 다루는 dropper), 아니면 UTF-8
+std::string textToBytes(const std::string& utf8Text, bool utf8) {
+    if (utf8) return utf8Text;
+    std::string latin;
+    latin.reserve(utf8Text.size());
+    for (size_t i = 0; i < utf8Text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(utf8Text[i]);
+        if (c < 0x80) {
+            latin.push_back(static_cast<char>(c));
+        } else if ((c == 0xC2 || c == 0xC3) && i + 1 < utf8Text.size()) {
+            latin.push_back(static_cast<char>(((c & 0x1F) << 6) | (utf8Text[++i] & 0x3F)));
+        } else {
+            return utf8Text;
+        }
+    }
+    return latin;
+}
+
+JSValue bytesToText(JSContext* ctx, std::string_view bytes, bool utf8) {
+    if (utf8) return JS_NewStringLen(ctx, bytes.data(), bytes.size());
+    std::string out;
+    out.reserve(bytes.size());
+    for (unsigned char c : bytes) {
+        if (c < 0x80) {
+            out.push_back(static_cast<char>(c));
+        } else {
+            out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+    return JS_NewStringLen(ctx, out.data(), out.size());
+}
+
+// ArrayBuffer / TypedArray 는 바이트 그대로, 그 외는 문자열 (latin1)
+std::string binaryToBytes(JSContext* ctx, JSValueConst val) {
+    size_t len = 0;
+    if (JS_IsArrayBuffer(val)) {
+        uint8_t* data = JS_GetArrayBuffer(ctx, &len, val);
+        return data ? std::string(reinterpret_cast<char*>(data), len) : std::string();
+    }
+    if (JS_IsObject(val)) {
+        size_t byteOffset = 0, byteLength = 0, bytesPerElement = 0;
+        JSValue buffer = JS_GetTypedArrayBuffer(ctx, val, &byteOffset, &byteLength, &bytesPerElement);
+        if (!JS_IsException(buffer)) {
+            std::string out;
+            uint8_t* data = JS_GetArrayBuffer(ctx, &len, buffer);
+            if (data && byteOffset + byteLength <= len) {
+                out.assign(reinterpret_cast<char*>(data) + byteOffset, byteLength);
+            }
+            JS_FreeValue(ctx, buffer);
+            return out;
+        }
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    JSValueConst args[] = { val };
+    return textToBytes(argString(ctx, 1, args, 0), false);
+}
+
+bool isUtf8Charset(const std::string& charset) {
+    std::string lower = charset;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    return lower == "utf-8" || lower == "utf8";
+}
+
+// CopyFile / MoveFile 대상이 폴더 ('\\' 로 끝남) 면 원본 파일 이름을 붙임
+std::string resolveTarget(const std::string& from, const std::string& to) {
+    if (to.empty() || (to.back() != '\\' && to.back() != '/')) return to;
+    size_t slash = from.find_last_of("\\/");
+    return to + (slash == std::string::npos ? from : from.substr(slash + 1));
+}
+
+}  // namespace
+
 ActiveXObject* ActiveXObject::getThis(JSValueConst this_val) {
     // 🔥 deprecated - context 없이는 Class ID를 알 수 없음
     return nullptr;
@@ -60,10 +261,27 @@ ActiveXObject* ActiveXObject::getThis(JSContext* ctx, JSValueConst this_val) {
     return static_cast<ActiveXObject*>(JS_GetOpaque(this_val, classID));
 }
 
-ActiveXObject::ActiveXObject(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID)
+ActiveXObject::ActiveXObject(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID, bool track)
     : ctx(ctx), a_ctx(a_ctx), progID(progID) {
     rt = JS_GetRuntime(ctx);
-    analyzeActiveXSecurity(progID);
+    role = roleOf(progID);
+    if (role == Role::Stream || role == Role::TextStream) {
+        stream = std::make_unique<StreamState>();
+    }
+    // 내부에서 만드는 객체 (TextStream 등) 는 생성 이벤트를 남기지 않음
+    if (track) {
+        analyzeActiveXSecurity(progID);
+    }
+}
+
+ActiveXObject::Role ActiveXObject::roleOf(const std::string& progID) {
+    std::string lower = progID;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+    if (lower == "scripting.filesystemobject") return Role::FileSystem;
+    if (lower == "adodb.stream") return Role::Stream;
+    if (lower == "scripting.textstream") return Role::TextStream;
+    if (lower == "wscript.shell") return Role::Shell;
+    return Role::Generic;
 }
 
 ActiveXObject::~ActiveXObject() {
@@ -112,24 +330,18 @@ void ActiveXObject::analyzeActiveXSecurity(const std::string& progID) {
     }
 
     if (a_ctx->dynamicAnalyzer) {
-        std::map<std::string, JsValue> metadata;
-        metadata["progID"] = JsValue(progID);
-        metadata["category"] = JsValue(category);
-        metadata["message"] = JsValue(message);
-
-        HookEvent event(
-            HookType::ACTIVEX_OBJECT_CREATION,
-            "ActiveXObject",
-            {JsValue(progID)},
-            JsValue(std::monostate()),
-            metadata,
-            severity
-        );
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::ACTIVEX_OBJECT_CREATION, severity, [&] {
+            std::map<std::string, JsValue> metadata;
+            metadata["progID"] = JsValue(progID);
+            metadata["category"] = JsValue(category);
+            metadata["message"] = JsValue(message);
+            return HookPayload{"ActiveXObject", {JsValue(progID)}, JsValue(std::monostate()), metadata};
+        });
     }
 }
 
-void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::vector<std::string>& args) {
+void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::vector<std::string>& args,
+                                      const std::vector<std::string>& droppedFiles) {
     if (!a_ctx) return;
 
     int severity = 3;  // default medium
@@ -209,6 +421,12 @@ void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::
                     }
                 }
             }
+
+            // 🔥 같은 Task 에서 떨어뜨린 파일을 실행
+            if (!droppedFiles.empty()) {
+                detectionTags.push_back("dropped_file_execution");
+                riskScore += 5;
+            }
             
             // 위험도에 따라 severity 재계산
             if (riskScore >= 15) {
@@ -226,7 +444,8 @@ void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::
     if (FILE_SYSTEM_PROGIDS.find(progID) != FILE_SYSTEM_PROGIDS.end()) {
         if (methodName == "DeleteFile" || methodName == "DeleteFolder" ||
             methodName == "CopyFile" || methodName == "MoveFile" ||
-            methodName == "CreateTextFile" || methodName == "OpenTextFile") {
+            methodName == "CreateTextFile" || methodName == "OpenTextFile" ||
+            methodName == "SaveToFile" || methodName == "LoadFromFile") {
             severity = 4;  // high
             category = "file_operation";
         }
@@ -255,36 +474,37 @@ void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::
     }
 
     if (a_ctx->dynamicAnalyzer) {
-        std::map<std::string, JsValue> metadata;
-        metadata["progID"] = JsValue(progID);
-        metadata["method"] = JsValue(methodName);
-        metadata["category"] = JsValue(category);
-        metadata["message"] = JsValue(message);
-        
-        // 탐지 태그 추가
-        if (!detectionTags.empty()) {
-            std::string tagsStr = "";
-            for (size_t i = 0; i < detectionTags.size(); ++i) {
-                if (i > 0) tagsStr += ", ";
-                tagsStr += detectionTags[i];
+        a_ctx->hookBus.emit(HookType::ACTIVEX_METHOD_CALL, severity, [&] {
+            std::map<std::string, JsValue> metadata;
+            metadata["progID"] = JsValue(progID);
+            metadata["method"] = JsValue(methodName);
+            metadata["category"] = JsValue(category);
+            metadata["message"] = JsValue(message);
+
+            // 탐지 태그 추가
+            if (!detectionTags.empty()) {
+                std::string tagsStr = "";
+                for (size_t i = 0; i < detectionTags.size(); ++i) {
+                    if (i > 0) tagsStr += ", ";
+                    tagsStr += detectionTags[i];
+                }
+                metadata["detection_tags"] = JsValue(tagsStr);
+            }
+            if (!droppedFiles.empty()) {
+                std::string files;
+                for (size_t i = 0; i < droppedFiles.size(); ++i) {
+                    if (i > 0) files += ", ";
+                    files += droppedFiles[i];
+                }
+                metadata["dropped_files"] = JsValue(files);
             }
-            metadata["detection_tags"] = JsValue(tagsStr);
-        }
-        
-        std::vector<JsValue> jsArgs;
-        for (const auto& arg : args) {
-            jsArgs.push_back(JsValue(arg));
-        }
 
-        HookEvent event(
-            HookType::ACTIVEX_METHOD_CALL,
-            progID + "." + methodName,
-            jsArgs,
-            JsValue(std::monostate()),
-            metadata,
-            severity
-        );
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+            std::vector<JsValue> jsArgs;
+            for (const auto& arg : args) {
+                jsArgs.push_back(JsValue(arg));
+            }
+            return HookPayload{progID + "." + methodName, jsArgs, JsValue(std::monostate()), metadata};
+        });
         
         // 위험한 패턴이 감지되면 별도 Detection 생성
         if (!detectionTags.empty() && a_ctx->findings) {
@@ -317,6 +537,14 @@ void ActiveXObject::analyzeMethodCall(const std::string& methodName, const std::
             detection.features["progID"] = progID;
             detection.features["method"] = methodName;
             detection.features["risk_score"] = std::to_string(riskScore);
+            if (!droppedFiles.empty()) {
+                // 첫 번째 실행 파일의 경로와 hash
+                detection.features["dropped_file"] = droppedFiles[0];
+                if (auto data = a_ctx->fileSystem.readFile(droppedFiles[0])) {
+                    detection.features["dropped_sha256"] = Sha256::hex(*data);
+                    detection.features["dropped_type"] = VirtualFileSystem::sniffType(*data);
+                }
+            }
             
             // Severity 레벨 텍스트 변환
             std::string severityLevel;
@@ -374,8 +602,12 @@ JSValue ActiveXObject::js_constructor(JSContext* ctx, JSValueConst new_target, i
     std::string progID(progID_str);
     JS_FreeCString(ctx, progID_str);
 
+    return newInstance(ctx, a_ctx, progID, true);
+}
+
+JSValue ActiveXObject::newInstance(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID, bool track) {
     // Create the ActiveXObject instance
-    ActiveXObject* axObj = new ActiveXObject(ctx, a_ctx, progID);
+    ActiveXObject* axObj = new ActiveXObject(ctx, a_ctx, progID, track);
 
     // 🔥 런타임에서 Class ID 가져오기
     JSClassID classID = getActiveXClassID(ctx);
@@ -411,6 +643,24 @@ JSValue ActiveXObject::js_constructor(JSContext* ctx, JSValueConst new_target, i
             JS_NewCFunction(ctx, js_open, "Open", 2));
     }
 
+    // 🔥 VFS 를 쓰는 역할별 메서드 / 속성
+    switch (axObj->role) {
+    case Role::FileSystem:
+        JS_SetPropertyFunctionList(ctx, obj, vfs_fso_funcs, sizeof(vfs_fso_funcs) / sizeof(vfs_fso_funcs[0]));
+        break;
+    case Role::Stream:
+        JS_SetPropertyFunctionList(ctx, obj, vfs_stream_funcs, sizeof(vfs_stream_funcs) / sizeof(vfs_stream_funcs[0]));
+        break;
+    case Role::TextStream:
+        JS_SetPropertyFunctionList(ctx, obj, vfs_text_stream_funcs, sizeof(vfs_text_stream_funcs) / sizeof(vfs_text_stream_funcs[0]));
+        break;
+    case Role::Shell:
+        JS_SetPropertyFunctionList(ctx, obj, vfs_shell_funcs, sizeof(vfs_shell_funcs) / sizeof(vfs_shell_funcs[0]));
+        break;
+    default:
+        break;
+    }
+
     return obj;
 }
 
@@ -532,7 +782,12 @@ JSValue ActiveXObject::js_run(JSContext* ctx, JSValueConst this_val, int argc, J
         }
     }
     
-    axObj->analyzeMethodCall("Run", args);
+    // 🔥 명령줄에 나온 가상 파일을 실행된 산출물로 기록
+    std::vector<std::string> dropped;
+    if (axObj->role == Role::Shell && axObj->a_ctx && !args.empty()) {
+        dropped = axObj->a_ctx->fileSystem.recordCommand("WScript.Shell.Run", args[0]);
+    }
+    axObj->analyzeMethodCall("Run", args, dropped);
     return JS_NewString(ctx, axObj->generateMockResponse("Run").c_str());
 }
 
@@ -549,7 +804,12 @@ JSValue ActiveXObject::js_exec(JSContext* ctx, JSValueConst this_val, int argc,
         }
     }
     
-    axObj->analyzeMethodCall("Exec", args);
+    // 🔥 명령줄에 나온 가상 파일을 실행된 산출물로 기록
+    std::vector<std::string> dropped;
+    if (axObj->role == Role::Shell && axObj->a_ctx && !args.empty()) {
+        dropped = axObj->a_ctx->fileSystem.recordCommand("WScript.Shell.Exec", args[0]);
+    }
+    axObj->analyzeMethodCall("Exec", args, dropped);
     return JS_NewString(ctx, axObj->generateMockResponse("Exec").c_str());
 }
 
@@ -567,6 +827,11 @@ JSValue ActiveXObject::js_createTextFile(JSContext* ctx, JSValueConst this_val,
     }
     
     axObj->analyzeMethodCall("CreateTextFile", args);
+    // 🔥 FileSystemObject 는 VFS 파일에 연결된 TextStream 반환
+    if (axObj->role == Role::FileSystem && axObj->a_ctx && argc > 0) {
+        bool overwrite = argc < 2 || JS_IsUndefined(argv[1]) || JS_ToBool(ctx, argv[1]) > 0;
+        return axObj->openTextStream(ctx, argString(ctx, argc, argv, 0), FOR_WRITING, true, overwrite);
+    }
     return JS_NewString(ctx, axObj->generateMockResponse("CreateTextFile").c_str());
 }
 
@@ -584,6 +849,11 @@ JSValue ActiveXObject::js_openTextFile(JSContext* ctx, JSValueConst this_val, in
     }
     
     axObj->analyzeMethodCall("OpenTextFile", args);
+    if (axObj->role == Role::FileSystem && axObj->a_ctx && argc > 0) {
+        int ioMode = argInt(ctx, argc, argv, 1, FOR_READING);
+        bool create = argc > 2 && JS_ToBool(ctx, argv[2]) > 0;
+        return axObj->openTextStream(ctx, argString(ctx, argc, argv, 0), ioMode, create, true);
+    }
     return JS_NewString(ctx, axObj->generateMockResponse("OpenTextFile").c_str());
 }
 
@@ -601,6 +871,9 @@ JSValue ActiveXObject::js_deleteFile(JSContext* ctx, JSValueConst this_val, int
     }
     
     axObj->analyzeMethodCall("DeleteFile", args);
+    if (axObj->role == Role::FileSystem && axObj->a_ctx && !args.empty()) {
+        axObj->a_ctx->fileSystem.deleteFile(args[0]);
+    }
     return JS_NewString(ctx, axObj->generateMockResponse("DeleteFile").c_str());
 }
 
@@ -635,9 +908,309 @@ JSValue ActiveXObject::js_open(JSContext* ctx, JSValueConst this_val, int argc,
     }
     
     axObj->analyzeMethodCall("Open", args);
+    // 🔥 ADODB.Stream.Open - 빈 버퍼로 시작
+    if (axObj->stream && axObj->role == Role::Stream) {
+        axObj->stream->data = VirtualFileSystem::makeBuffer({});
+        axObj->stream->position = 0;
+        axObj->stream->open = true;
+        return JS_UNDEFINED;
+    }
     return JS_NewString(ctx, axObj->generateMockResponse("Open").c_str());
 }
 
+// ============================================
+// 🔥 VFS 연동 구현
+// ============================================
+
+JSValue ActiveXObject::openTextStream(JSContext* ctx, const std::string& path, int ioMode, bool create, bool overwrite) {
+    VirtualFileSystem& vfs = a_ctx->fileSystem;
+    bool exists = vfs.exists(path);
+    if (ioMode == FOR_READING) {
+        if (!exists) return JS_ThrowPlainError(ctx, "File not found");
+    } else if (ioMode == FOR_WRITING || !exists) {
+        if (exists && !overwrite) return JS_ThrowPlainError(ctx, "File already exists");
+        if (!exists && !create) return JS_ThrowPlainError(ctx, "File not found");
+        if (!vfs.writeFile(path, VirtualFileSystem::makeBuffer({}), "FileSystemObject.CreateTextFile")) {
+            return JS_ThrowPlainError(ctx, "Too many files have been created");
+        }
+    }
+
+    JSValue obj = newInstance(ctx, a_ctx, "Scripting.TextStream", false);
+    ActiveXObject* textStream = JS_IsException(obj) ? nullptr : getThis(ctx, obj);
+    if (textStream && textStream->stream) {
+        StreamState& state = *textStream->stream;
+        state.path = path;
+        state.open = true;
+        state.writable = ioMode != FOR_READING;
+        // 읽기는 열 때의 내용을 공유 (이후 쓰기는 copy-on-write 로 분리)
+        if (!state.writable) state.data = vfs.readFile(path);
+    }
+    return obj;
+}
+
+void ActiveXObject::reportFileWritten(const std::string& path, const char* writer) {
+    if (!a_ctx || !a_ctx->dynamicAnalyzer) return;
+    VirtualFileSystem::Buffer data = a_ctx->fileSystem.readFile(path);
+    if (!data) return;
+
+    std::string type = VirtualFileSystem::sniffType(*data);
+    int severity = (type == "pe" || type == "elf" || type == "script" || type == "ole") ? 8 : 5;
+    a_ctx->hookBus.emit(HookType::FILE_CREATE, severity, [&] {
+        std::map<std::string, JsValue> metadata;
+        metadata["progID"] = JsValue(progID);
+        metadata["writer"] = JsValue(std::string(writer));
+        metadata["path"] = JsValue(VirtualFileSystem::normalizePath(path));
+        metadata["sha256"] = JsValue(Sha256::hex(*data));
+        metadata["type"] = JsValue(type);
+        metadata["size"] = JsValue(static_cast<double>(data->size()));
+        return HookPayload{"vfs.file_written", {JsValue(path)}, JsValue(std::monostate()), metadata};
+    });
+}
+
+JSValue ActiveXObject::js_vfs_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic) {
+    ActiveXObject* axObj = getThis(ctx, this_val);
+    if (!axObj) return JS_EXCEPTION;
+    JSAnalyzerContext* a_ctx = axObj->a_ctx;
+    StreamState* state = axObj->stream.get();
+
+    switch (magic) {
+    // ---- Scripting.FileSystemObject ----
+    case VFS_FSO_FILE_EXISTS:
+        return JS_NewBool(ctx, a_ctx && a_ctx->fileSystem.exists(argString(ctx, argc, argv, 0)));
+    case VFS_FSO_FOLDER_EXISTS:
+        // 폴더는 따로 두지 않음 - 생성 분기를 타지 않도록 항상 존재
+        return JS_TRUE;
+    case VFS_FSO_CREATE_FOLDER:
+        return JS_NewString(ctx, argString(ctx, argc, argv, 0).c_str());
+    case VFS_FSO_COPY_FILE:
+    case VFS_FSO_MOVE_FILE: {
+        bool copy = magic == VFS_FSO_COPY_FILE;
+        std::string from = argString(ctx, argc, argv, 0);
+        std::string to = resolveTarget(from, argString(ctx, argc, argv, 1));
+        axObj->analyzeMethodCall(copy ? "CopyFile" : "MoveFile", {from, to});
+        if (!a_ctx) return JS_UNDEFINED;
+        if (!a_ctx->fileSystem.exists(from)) return JS_ThrowPlainError(ctx, "File not found");
+        bool overwrite = !copy || argc < 3 || JS_IsUndefined(argv[2]) || JS_ToBool(ctx, argv[2]) > 0;
+        bool done = copy ? a_ctx->fileSystem.copyFile(from, to, overwrite)
+                         : a_ctx->fileSystem.moveFile(from, to);
+        if (!done) return JS_ThrowPlainError(ctx, "File already exists");
+        axObj->reportFileWritten(to, copy ? "FileSystemObject.CopyFile" : "FileSystemObject.MoveFile");
+        return JS_UNDEFINED;
+    }
+    case VFS_FSO_GET_SPECIAL_FOLDER: {
+        int folder = argInt(ctx, argc, argv, 0, 2);
+        std::string path = folder == 0 ? VirtualFileSystem::expandEnvironment("%WINDIR%")
+                         : folder == 1 ? VirtualFileSystem::expandEnvironment("%WINDIR%\\System32")
+                         : VirtualFileSystem::tempFolder();
+        return JS_NewString(ctx, path.c_str());
+    }
+    case VFS_FSO_GET_TEMP_NAME: {
+        char name[16];
+        std::snprintf(name, sizeof(name), "rad%05X.tmp", (0x1A2B3 + axObj->tempNames++ * 0x3F1) & 0xFFFFF);
+        return JS_NewString(ctx, name);
+    }
+    case VFS_FSO_BUILD_PATH: {
+        std::string path = argString(ctx, argc, argv, 0);
+        std::string name = argString(ctx, argc, argv, 1);
+        if (!path.empty() && path.back() != '\\' && path.back() != '/') path += '\\';
+        return JS_NewString(ctx, (path + name).c_str());
+    }
+    case VFS_FSO_GET_FILE_NAME: {
+        std::string path = argString(ctx, argc, argv, 0);
+        size_t slash = path.find_last_of("\\/");
+        return JS_NewString(ctx, slash == std::string::npos ? path.c_str() : path.c_str() + slash + 1);
+    }
+
+    // ---- Scripting.TextStream ----
+    case VFS_TS_WRITE:
+    case VFS_TS_WRITE_LINE:
+    case VFS_TS_WRITE_BLANK_LINES: {
+        if (!state || !a_ctx) return JS_UNDEFINED;
+        if (!state->open || !state->writable) return JS_ThrowPlainError(ctx, "Bad file mode");
+        std::string text;
+        if (magic == VFS_TS_WRITE_BLANK_LINES) {
+            int lines = std::clamp(argInt(ctx, argc, argv, 0, 0), 0, 4096);
+            for (int i = 0; i < lines; ++i) text += "\r\n";
+        } else {
+            text = textToBytes(argString(ctx, argc, argv, 0), false);
+            if (magic == VFS_TS_WRITE_LINE) text += "\r\n";
+        }
+        a_ctx->fileSystem.appendFile(state->path, text, "TextStream.Write");
+        state->dirty = true;
+        return JS_UNDEFINED;
+    }
+    case VFS_TS_READ:
+    case VFS_TS_READ_LINE:
+    case VFS_TS_READ_ALL: {
+        if (!state) return JS_UNDEFINED;
+        if (!state->open || state->writable) return JS_ThrowPlainError(ctx, "Bad file mode");
+        std::string_view rest = state->data ? std::string_view(*state->data) : std::string_view();
+        rest.remove_prefix(std::min(state->position, rest.size()));
+        if (rest.empty() && magic != VFS_TS_READ) return JS_ThrowPlainError(ctx, "Input past end of file");
+
+        size_t take = rest.size();
+        size_t consumed = take;
+        if (magic == VFS_TS_READ) {
+            take = consumed = std::min(rest.size(), static_cast<size_t>(std::max(argInt(ctx, argc, argv, 0, 0), 0)));
+        } else if (magic == VFS_TS_READ_LINE) {
+            size_t newline = rest.find('\n');
+            take = newline == std::string_view::npos ? rest.size() : newline;
+            consumed = newline == std::string_view::npos ? rest.size() : newline + 1;
+            if (take > 0 && rest[take - 1] == '\r') --take;
+        }
+        state->position += consumed;
+        return bytesToText(ctx, rest.substr(0, take), false);
+    }
+    case VFS_TS_CLOSE:
+        if (state && state->open) {
+            if (state->writable && state->dirty) axObj->reportFileWritten(state->path, "TextStream.Close");
+            state->open = false;
+            state->data.reset();
+        }
+        return JS_UNDEFINED;
+
+    // ---- ADODB.Stream ----
+    case VFS_STREAM_WRITE:
+    case VFS_STREAM_WRITE_TEXT: {
+        if (!state) return JS_UNDEFINED;
+        if (!state->open) return JS_ThrowPlainError(ctx, "Operation is not allowed when the object is closed.");
+        std::string bytes;
+        if (magic == VFS_STREAM_WRITE) {
+            bytes = argc > 0 ? binaryToBytes(ctx, argv[0]) : std::string();
+        } else {
+            bytes = textToBytes(argString(ctx, argc, argv, 0), isUtf8Charset(state->charset));
+            if (argInt(ctx, argc, argv, 1, 0) == AD_WRITE_LINE) bytes += "\r\n";
+        }
+        // Position 이 끝이 아니면 그 뒤를 버리고 이어 씀
+        size_t size = state->data ? state->data->size() : 0;
+        if (state->position < size) {
+            state->data = VirtualFileSystem::makeBuffer(state->data->substr(0, state->position));
+            size = state->position;
+        }
+        if (size + bytes.size() > VirtualFileSystem::MAX_FILE_BYTES) {
+            bytes.resize(VirtualFileSystem::MAX_FILE_BYTES - std::min(size, VirtualFileSystem::MAX_FILE_BYTES));
+        }
+        VirtualFileSystem::appendTo(state->data, bytes);
+        state->position = state->data->size();
+        return JS_UNDEFINED;
+    }
+    case VFS_STREAM_READ:
+    case VFS_STREAM_READ_TEXT: {
+        if (!state) return JS_UNDEFINED;
+        if (!state->open) return JS_ThrowPlainError(ctx, "Operation is not allowed when the object is closed.");
+        std::string_view rest = state->data ? std::string_view(*state->data) : std::string_view();
+        rest.remove_prefix(std::min(state->position, rest.size()));
+        int32_t count = argInt(ctx, argc, argv, 0, AD_READ_ALL);
+        size_t take = rest.size();
+        size_t consumed = take;
+        if (magic == VFS_STREAM_READ_TEXT && count == AD_READ_LINE) {
+            size_t newline = rest.find('\n');
+            take = newline == std::string_view::npos ? rest.size() : newline;
+            consumed = newline == std::string_view::npos ? rest.size() : newline + 1;
+            if (take > 0 && rest[take - 1] == '\r') --take;
+        } else if (count >= 0) {
+            take = consumed = std::min(rest.size(), static_cast<size_t>(count));
+        }
+        state->position += consumed;
+        std::string_view out = rest.substr(0, take);
+        if (magic == VFS_STREAM_READ) {
+            return JS_NewArrayBufferCopy(ctx, reinterpret_cast<const uint8_t*>(out.data()), out.size());
+        }
+        return bytesToText(ctx, out, isUtf8Charset(state->charset));
+    }
+    case VFS_STREAM_SAVE_TO_FILE: {
+        if (!state) return JS_UNDEFINED;
+        std::string path = argString(ctx, argc, argv, 0);
+        axObj->analyzeMethodCall("SaveToFile", {path});
+        if (!state->open) return JS_ThrowPlainError(ctx, "Operation is not allowed when the object is closed.");
+        if (!a_ctx) return JS_UNDEFINED;
+        if (a_ctx->fileSystem.exists(path) && argInt(ctx, argc, argv, 1, 1) != AD_SAVE_CREATE_OVERWRITE) {
+            return JS_ThrowPlainError(ctx, "Write to file failed.");
+        }
+        // 스트림 버퍼를 그대로 공유 (복사 없음)
+        if (!a_ctx->fileSystem.writeFile(path, state->data, "ADODB.Stream.SaveToFile")) {
+            return JS_ThrowPlainError(ctx, "Write to file failed.");
+        }
+        axObj->reportFileWritten(path, "ADODB.Stream.SaveToFile");
+        return JS_UNDEFINED;
+    }
+    case VFS_STREAM_LOAD_FROM_FILE: {
+        if (!state) return JS_UNDEFINED;
+        std::string path = argString(ctx, argc, argv, 0);
+        axObj->analyzeMethodCall("LoadFromFile", {path});
+        if (!state->open) return JS_ThrowPlainError(ctx, "Operation is not allowed when the object is closed.");
+        VirtualFileSystem::Buffer data = a_ctx ? a_ctx->fileSystem.readFile(path) : nullptr;
+        if (!data) return JS_ThrowPlainError(ctx, "File could not be opened.");
+        state->data = std::move(data);
+        state->position = 0;
+        return JS_UNDEFINED;
+    }
+    case VFS_STREAM_SET_EOS:
+        if (state && state->data && state->position < state->data->size()) {
+            state->data = VirtualFileSystem::makeBuffer(state->data->substr(0, state->position));
+        }
+        return JS_UNDEFINED;
+    case VFS_STREAM_CLOSE:
+        if (state) {
+            state->open = false;
+            state->data.reset();
+            state->position = 0;
+        }
+        return JS_UNDEFINED;
+
+    // ---- WScript.Shell ----
+    case VFS_SHELL_EXPAND_ENVIRONMENT:
+        return JS_NewString(ctx, VirtualFileSystem::expandEnvironment(argString(ctx, argc, argv, 0)).c_str());
+    }
+    return JS_UNDEFINED;
+}
+
+JSValue ActiveXObject::js_vfs_get(JSContext* ctx, JSValueConst this_val, int magic) {
+    ActiveXObject* axObj = getThis(ctx, this_val);
+    if (!axObj || !axObj->stream) return JS_UNDEFINED;
+    const StreamState& state = *axObj->stream;
+    size_t size = state.data ? state.data->size() : 0;
+
+    switch (magic) {
+    case VFS_PROP_AT_END_OF_STREAM:
+    case VFS_PROP_EOS:
+        return JS_NewBool(ctx, state.writable || state.position >= size);
+    case VFS_PROP_TYPE:
+        return JS_NewInt32(ctx, state.type);
+    case VFS_PROP_POSITION:
+        return JS_NewInt64(ctx, static_cast<int64_t>(state.position));
+    case VFS_PROP_SIZE:
+        return JS_NewInt64(ctx, static_cast<int64_t>(size));
+    case VFS_PROP_CHARSET:
+        return JS_NewString(ctx, state.charset.c_str());
+    case VFS_PROP_STATE:
+        return JS_NewInt32(ctx, state.open ? 1 : 0);
+    }
+    return JS_UNDEFINED;
+}
+
+JSValue ActiveXObject::js_vfs_set(JSContext* ctx, JSValueConst this_val, JSValueConst val, int magic) {
+    ActiveXObject* axObj = getThis(ctx, this_val);
+    if (!axObj || !axObj->stream) return JS_UNDEFINED;
+    StreamState& state = *axObj->stream;
+    JSValueConst args[] = { val };
+
+    switch (magic) {
+    case VFS_PROP_TYPE:
+        state.type = argInt(ctx, 1, args, 0, state.type) == AD_TYPE_BINARY ? AD_TYPE_BINARY : 2;
+        break;
+    case VFS_PROP_POSITION: {
+        size_t size = state.data ? state.data->size() : 0;
+        state.position = std::min(static_cast<size_t>(std::max(argInt(ctx, 1, args, 0, 0), 0)), size);
+        break;
+    }
+    case VFS_PROP_CHARSET:
+        state.charset = argString(ctx, 1, args, 0);
+        break;
+    }
+    return JS_UNDEFINED;
+}
+
 // ============================================
 // 🔥 QuickJS 등록 함수 (JSAnalyzer에서 호출)
 // ============================================
@@ -2,9 +2,12 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 #include "../../../../mon47-opensrc/opensrc/quickjs-ng/include/quickjs.h"
 #include "../../hooks/Hook.h"
+#include "../../core/VirtualFileSystem.h"
 
 struct JSAnalyzerContext;
 
@@ -12,7 +15,7 @@ struct JSAnalyzerContext;
 
 class ActiveXObject {
 public:
-    ActiveXObject(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID);
+    ActiveXObject(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID, bool track = true);
     ~ActiveXObject();
 
     // Static factory method for JavaScript constructor
@@ -31,6 +34,11 @@ public:
     static JSValue js_property_get(JSContext* ctx, JSValueConst this_val, JSAtom prop);
     static JSValue js_property_set(JSContext* ctx, JSValueConst this_val, JSAtom prop, JSValueConst val);
 
+    // 🔥 VFS 연동 메서드 / 속성 (magic = VfsOp)
+    static JSValue js_vfs_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic);
+    static JSValue js_vfs_get(JSContext* ctx, JSValueConst this_val, int magic);
+    static JSValue js_vfs_set(JSContext* ctx, JSValueConst this_val, JSValueConst val, int magic);
+
     // Helper to get ActiveXObject from JSValue
     static ActiveXObject* getThis(JSValueConst this_val);  // 🔥 deprecated
     static ActiveXObject* getThis(JSContext* ctx, JSValueConst this_val);  // 🔥 새로운 메서드
@@ -44,14 +52,39 @@ public:
     JSContext* ctx;
 
 private:
+    // 🔥 VFS 를 쓰는 ProgID 역할 (대소문자 무시로 판별)
+    enum class Role { Generic, FileSystem, Stream, TextStream, Shell };
+
+    // ADODB.Stream / Scripting.TextStream 상태 (내용은 VFS 와 공유하는 버퍼)
+    struct StreamState {
+        VirtualFileSystem::Buffer data;
+        size_t position = 0;
+        std::string path;           // TextStream: 열린 가상 파일
+        bool open = false;
+        bool writable = false;      // TextStream: ForWriting / ForAppending
+        bool dirty = false;         // TextStream: 닫을 때 기록 이벤트
+        int type = 2;               // ADODB: 1 = adTypeBinary, 2 = adTypeText
+        std::string charset = "unicode";
+    };
+
+    static Role roleOf(const std::string& progID);
+    static JSValue newInstance(JSContext* ctx, JSAnalyzerContext* a_ctx, const std::string& progID, bool track);
+    JSValue openTextStream(JSContext* ctx, const std::string& path, int ioMode, bool create, bool overwrite);
+    void reportFileWritten(const std::string& path, const char* writer);
+
     JSRuntime* rt;
     JSAnalyzerContext* a_ctx;
 
     std::string progID;
     std::map<std::string, JSValue> properties;
+    Role role = Role::Generic;
+    std::unique_ptr<StreamState> stream;
+    uint32_t tempNames = 0;
 
     void analyzeActiveXSecurity(const std::string& progID);
-    void analyzeMethodCall(const std::string& methodName, const std::vector<std::string>& args);
+    // droppedFiles: Run / Exec 명령줄에서 찾은 VFS 파일 (정규화 경로)
+    void analyzeMethodCall(const std::string& methodName, const std::vector<std::string>& args,
+                           const std::vector<std::string>& droppedFiles = {});
     bool isSensitiveProgID(const std::string& progID) const;
     std::string generateMockResponse(const std::string& methodName);
 
@@ -9,121 +9,81 @@ namespace ArrayObject {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
 
-    JSValue js_array_join(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
-        std::string result_str = "";
-        std::string separator = ",";
+    // 🔥 관찰 대상 판단 (저렴한 검사만 수행)
+    // - 빈 구분자 join: 문자 배열을 이어 붙이는 전형적인 난독화 패턴
+    // - 큰 결과 문자열: payload 조립
+    static bool isInterestingJoin(bool empty_separator, size_t result_len) {
+        return empty_separator || result_len >= JOIN_INTERESTING_MIN_LENGTH;
+    }
 
-        if (argc >= 1) {
-            const char* sep_str = JS_ToCString(ctx, argv[0]);
-            if (sep_str) {
-                separator = sep_str;
-                JS_FreeCString(ctx, sep_str);
+    JSValue js_array_join(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        // 구분자는 여기서 한 번만 문자열로 바꿔서 원본 join 에 넘김 (사용자 toString 이 두 번 실행되지 않게)
+        const bool has_separator = argc >= 1 && !JS_IsUndefined(argv[0]);
+        JSValue separator_val = JS_UNDEFINED;
+        if (has_separator) {
+            separator_val = JS_ToString(ctx, argv[0]);
+            if (JS_IsException(separator_val)) {
+                return separator_val;
             }
         }
 
-        JSValue len_val = JS_GetPropertyStr(ctx, this_val, "length");
-        int32_t len;
-        if (JS_ToInt32(ctx, &len, len_val) != 0) {
-            JS_FreeValue(ctx, len_val);
-            return JS_EXCEPTION;
+        // 엔진 기본 구현에 위임 (func_data[0] = 등록 시 저장한 원본 join)
+        JSValueConst call_args[1] = {separator_val};
+        JSValue result = JS_Call(ctx, func_data[0], this_val, has_separator ? 1 : 0, call_args);
+        if (JS_IsException(result)) {
+            JS_FreeValue(ctx, separator_val);
+            return result;
         }
-        JS_FreeValue(ctx, len_val);
 
-        for (int i = 0; i < len; i++) {
-            JSValue item = JS_GetPropertyUint32(ctx, this_val, i);
-            const char* item_str = JS_ToCString(ctx, item);
-            if (item_str) {
-                result_str += item_str;
-                JS_FreeCString(ctx, item_str);
-            }
-            if (i < len - 1) {
-                result_str += separator;
-            }
-            JS_FreeValue(ctx, item);
+        // 호출 수 (ApiCallCounts) 는 관찰 대상 여부와 관계없이 모든 호출을 셈
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx || (!a_ctx->dynamicAnalyzer && !a_ctx->chainTrackerManager) ||
+            !a_ctx->admitCall(HookApiId::ARRAY_JOIN)) {
+            JS_FreeValue(ctx, separator_val);
+            return result;
         }
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "Array.join", {JsValue(separator)}, JsValue(result_str), {}, 2});
-        }
-        
-        if (a_ctx && a_ctx->chainTrackerManager) {
-            a_ctx->chainTrackerManager->trackFunctionCall("Array.join", {JsValue(separator)}, JsValue(result_str));
+        std::string separator = ",";
+        if (has_separator) {
+            size_t sep_len = 0;
+            const char* sep_str = JS_ToCStringLen(ctx, &sep_len, separator_val);
+            if (sep_str) {
+                separator.assign(sep_str, sep_len);
+                JS_FreeCString(ctx, sep_str);
+            }
+            JS_FreeValue(ctx, separator_val);
         }
-        
-        return JS_NewString(ctx, result_str.c_str());
-    }
 
-    JSValue js_array_push(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSValue len_val = JS_GetPropertyStr(ctx, this_val, "length");
-        int32_t len;
-        if (JS_ToInt32(ctx, &len, len_val) != 0) {
-            JS_FreeValue(ctx, len_val);
-            return JS_EXCEPTION;
-        }
+        // 결과 길이는 문자열을 복사하지 않고 length 로 판단 (UTF-16 단위)
+        int64_t result_units = 0;
+        JSValue len_val = JSAtoms::getProperty(ctx, result, JSAtomId::length);
+        JS_ToInt64(ctx, &result_units, len_val);
         JS_FreeValue(ctx, len_val);
-
-        for (int i = 0; i < argc; i++) {
-            JS_SetPropertyUint32(ctx, this_val, len + i, JS_DupValue(ctx, argv[i]));
+        if (!isInterestingJoin(separator.empty(), static_cast<size_t>(result_units))) {
+            return result;
         }
 
-        int32_t new_len = len + argc;
-        JS_SetPropertyStr(ctx, this_val, "length", JS_NewInt32(ctx, new_len));
-        return JS_NewInt32(ctx, new_len);
-    }
-
-    JSValue js_array_pop(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSValue len_val = JS_GetPropertyStr(ctx, this_val, "length");
-        int32_t len;
-        if (JS_ToInt32(ctx, &len, len_val) != 0) {
-            JS_FreeValue(ctx, len_val);
-            return JS_EXCEPTION;
+        size_t result_len = 0;
+        const char* result_cstr = JS_ToCStringLen(ctx, &result_len, result);
+        if (!result_cstr) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return result;
         }
-        JS_FreeValue(ctx, len_val);
+        std::string result_str(result_cstr, result_len);
+        JS_FreeCString(ctx, result_cstr);
 
-        if (len == 0) {
-            return JS_UNDEFINED;
+        if (a_ctx->chainTrackerManager) {
+            a_ctx->chainTrackerManager->trackFunctionCall("Array.join", {JsValue(separator)}, JsValue(result_str));
         }
 
-        int32_t new_len = len - 1;
-        JSValue last_item = JS_GetPropertyUint32(ctx, this_val, new_len);
-
-        std::string index_str = std::to_string(new_len);
-        JSAtom prop_atom = JS_NewAtom(ctx, index_str.c_str());
-        JS_DeleteProperty(ctx, this_val, prop_atom, 0);
-        JS_FreeAtom(ctx, prop_atom);
-
-        JS_SetPropertyStr(ctx, this_val, "length", JS_NewInt32(ctx, new_len));
-
-        return last_item;
-    }
-
-    JSValue js_array_slice(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSValue new_arr = JS_NewArray(ctx);
-
-        JSValue len_val = JS_GetPropertyStr(ctx, this_val, "length");
-        int32_t len;
-        if (JS_ToInt32(ctx, &len, len_val) != 0) {
-            JS_FreeValue(ctx, len_val);
-            return JS_EXCEPTION;
+        // 마지막 사용처이므로 payload 로 이동
+        if (a_ctx->dynamicAnalyzer) {
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 2, [&] {
+                return HookPayload{"Array.join", {JsValue(std::move(separator))}, JsValue(std::move(result_str)), {}};
+            });
         }
-        JS_FreeValue(ctx, len_val);
-
-        int32_t start = 0;
-        if (argc >= 1) JS_ToInt32(ctx, &start, argv[0]);
-        if (start < 0) start = (std::max)(0, len + start);
-
-        int32_t end = len;
-        if (argc >= 2) JS_ToInt32(ctx, &end, argv[1]);
-        if (end < 0) end = len + end;
-        end = (std::min)(len, end);
 
-        int k = 0;
-        for (int i = start; i < end; i++) {
-            JSValue item = JS_GetPropertyUint32(ctx, this_val, i);
-            JS_SetPropertyUint32(ctx, new_arr, k++, item);
-        }
-        return new_arr;
+        return result;
     }
 
     JSValue js_uint8array_from(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
@@ -147,7 +107,7 @@ namespace ArrayObject {
         }
         
         // 배열 길이 가져오기
-        JSValue len_val = JS_GetPropertyStr(ctx, iterable, "length");
+        JSValue len_val = JSAtoms::getProperty(ctx, iterable, JSAtomId::length);
         int32_t len;
         if (JS_ToInt32(ctx, &len, len_val) != 0) {
             JS_FreeValue(ctx, len_val);
@@ -226,14 +186,24 @@ namespace ArrayObject {
             nullptr, false);
     }
 
+    // 원본 메서드를 func_data 로 묶은 hook 함수 생성 (name/length 는 원본과 동일하게 유지)
+    static void installHook(JSContext* ctx, JSValue proto, const char* name, int length, JSCFunctionData* hook) {
+        JSValue native_fn = JS_GetPropertyStr(ctx, proto, name);
+        if (!JS_IsFunction(ctx, native_fn)) {
+            JS_FreeValue(ctx, native_fn);
+            return;
+        }
+        JSValue hook_fn = JS_NewCFunctionData(ctx, hook, length, 0, 1, &native_fn);
+        JS_FreeValue(ctx, native_fn);
+        JS_DefinePropertyValueStr(ctx, hook_fn, "name", JS_NewString(ctx, name), JS_PROP_CONFIGURABLE);
+        JS_SetPropertyStr(ctx, proto, name, hook_fn);
+    }
+
     void registerArrayFunctions(JSContext* ctx, JSValue global_obj) {
         JSValue array_constructor = JS_GetPropertyStr(ctx, global_obj, "Array");
-        JSValue array_proto = JS_GetPropertyStr(ctx, array_constructor, "prototype");
+        JSValue array_proto = JSAtoms::getProperty(ctx, array_constructor, JSAtomId::prototype);
         
-        JS_SetPropertyStr(ctx, array_proto, "join", JS_NewCFunction(ctx, js_array_join, "join", 1));
-        JS_SetPropertyStr(ctx, array_proto, "push", JS_NewCFunction(ctx, js_array_push, "push", 1));
-        JS_SetPropertyStr(ctx, array_proto, "pop", JS_NewCFunction(ctx, js_array_pop, "pop", 0));
-        JS_SetPropertyStr(ctx, array_proto, "slice", JS_NewCFunction(ctx, js_array_slice, "slice", 2));
+        installHook(ctx, array_proto, "join", 1, js_array_join);
         
         JS_FreeValue(ctx, array_constructor);
         JS_FreeValue(ctx, array_proto);
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../quickjs.h"
+#include <cstddef>
 
 /**
  * Array 객체의 프로토타입 함수들
@@ -12,11 +13,12 @@ namespace ArrayObject {
      */
     void registerArrayFunctions(JSContext* ctx, JSValue global_obj);
 
-    // Array 프로토타입 메서드들
-    JSValue js_array_join(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
-    JSValue js_array_push(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
-    JSValue js_array_pop(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
-    JSValue js_array_slice(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    // join 결과가 이 길이 (UTF-16 단위) 이상이면 관찰 대상
+    constexpr size_t JOIN_INTERESTING_MIN_LENGTH = 128;
+
+    // Array 프로토타입 메서드 hook (func_data[0] = 엔진 원본 구현)
+    // push/pop/slice 는 관찰할 내용이 없으므로 엔진 구현을 그대로 사용
+    JSValue js_array_join(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
     
     // Uint8Array 정적 메서드들
     JSValue js_uint8array_from(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
@@ -2,6 +2,7 @@
 #include "BlobObject.h"
 #include "../../core/JSAnalyzer.h"
 #include "../../hooks/HookType.h"
+#include "../helpers/JSValueConverter.h"
 
 namespace BlobObject {
 
@@ -9,6 +10,43 @@ static JSAnalyzerContext* get_analyzer_context(JSContext* ctx) {
     return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
 }
 
+// Blob 내용은 opaque 에만 보관 (스크립트에서 읽거나 위조할 수 없음)
+struct BlobData {
+    std::string content;
+};
+
+static void blob_finalizer(JSRuntime* rt, JSValue val) {
+    delete static_cast<BlobData*>(JS_GetOpaque(val, JS_GetClassID(val)));
+}
+
+// 🔥 Blob class 는 첫 new Blob 에서 등록 (XHR / ActiveX class 등록이 끝난 뒤라 ID 가 겹치지 않음)
+static JSClassID blobClassID(JSContext* ctx, JSAnalyzerContext* a_ctx) {
+    if (!a_ctx) return 0;
+    if (a_ctx->blobClassID == 0) {
+        JSRuntime* rt = JS_GetRuntime(ctx);
+        JSClassID class_id = 0;
+        JS_NewClassID(rt, &class_id);
+        JSClassDef js_blob_class = {
+            .class_name = "Blob",
+            .finalizer = blob_finalizer,
+        };
+        if (JS_NewClass(rt, class_id, &js_blob_class) < 0) {
+            return 0;
+        }
+        JS_SetClassProto(ctx, class_id, JS_NewObject(ctx));
+        a_ctx->blobClassID = class_id;
+    }
+    return a_ctx->blobClassID;
+}
+
+// Blob 이 아니면 nullptr
+static const std::string* blobContent(JSContext* ctx, JSValueConst val) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (!a_ctx || a_ctx->blobClassID == 0) return nullptr;
+    BlobData* data = static_cast<BlobData*>(JS_GetOpaque(val, a_ctx->blobClassID));
+    return data ? &data->content : nullptr;
+}
+
 void registerBlobObject(JSContext* ctx, JSValue global_obj) {
     // Blob constructor
     JSValue blob_ctor = JS_NewCFunction2(ctx, js_blob_constructor,
@@ -37,6 +75,12 @@ JSValue js_blob_constructor(JSContext* ctx, JSValueConst new_target,
         
         for (int i = 0; i < len; i++) {
             JSValue item = JS_GetPropertyUint32(ctx, argv[0], i);
+            // Blob 조각은 원래 내용으로 이어 붙임
+            if (const std::string* inner = blobContent(ctx, item)) {
+                content += *inner;
+                JS_FreeValue(ctx, item);
+                continue;
+            }
             const char* str = JS_ToCString(ctx, item);
             if (str) {
                 content += str;
@@ -80,12 +124,19 @@ JSValue js_blob_constructor(JSContext* ctx, JSValueConst new_target,
         event.tags.insert("file_creation");
         event.tags.insert("blob");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
-    JSValue obj = JS_NewObjectClass(ctx, 0);
+    JSClassID class_id = blobClassID(ctx, a_ctx);
+    JSValue obj = class_id ? JS_NewObjectClass(ctx, class_id) : JS_NewObject(ctx);
+    if (JS_IsException(obj)) {
+        return obj;
+    }
     JS_SetPropertyStr(ctx, obj, "type", JS_NewString(ctx, type.c_str()));
     JS_SetPropertyStr(ctx, obj, "size", JS_NewInt32(ctx, content.length()));
+    if (class_id) {
+        JS_SetOpaque(obj, new BlobData{std::move(content)});
+    }
     return obj;
 }
 
@@ -95,22 +146,37 @@ JSValue js_url_createObjectURL(JSContext* ctx, JSValueConst this_val,
 
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::URL_CREATE_OBJECT_URL;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "URL.createObjectURL - Blob URL created";
-        event.tags.insert("file_creation");
-        event.tags.insert("obfuscation");
+        a_ctx->hookBus.emit(HookType::URL_CREATE_OBJECT_URL, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "URL.createObjectURL - Blob URL created";
+            event.tags.insert("file_creation");
+            event.tags.insert("obfuscation");
+            return event;
+        });
+    }
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+    if (!a_ctx) {
+        return JS_NewString(ctx, "blob:http://localhost/fake-uuid");
     }
 
-    return JS_NewString(ctx, "blob:http://localhost/fake-uuid");
+    // 🔥 Blob 내용을 URL 별로 보관 (new Worker(blobUrl) 등에서 스크립트로 사용)
+    char url[96];
+    const unsigned serial = ++a_ctx->blobUrlCount;
+    snprintf(url, sizeof(url), "blob:http://localhost/%08x-0000-4000-8000-%012x", serial, serial);
+    const std::string* content = blobContent(ctx, argv[0]);
+    if (content && a_ctx->blobUrls.size() < JSAnalyzerContext::MAX_BLOB_URLS) {
+        a_ctx->blobUrls[url] = *content;
+    }
+    return JS_NewString(ctx, url);
 }
 
 JSValue js_url_revokeObjectURL(JSContext* ctx, JSValueConst this_val, 
                                int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx && argc > 0) {
+        a_ctx->blobUrls.erase(JSValueConverter::toString(ctx, argv[0]));
+    }
     return JS_UNDEFINED;
 }
 
@@ -179,13 +179,13 @@ namespace CharacterDataObject {
         // 분석 컨텍스트에 기록 (필요시)
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::DOM_MANIPULATION, 
-                "replaceData",
-                {JsValue(offset), JsValue(count), JsValue(replaceStr)},
-                JsValue(std::monostate()),
-                {},
-                3
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 3, [&] {
+                return HookPayload{
+                    "replaceData",
+                    {JsValue(offset), JsValue(count), JsValue(replaceStr)},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "ConsoleObject.h"
 #include "../helpers/JSValueConverter.h"
+#include "../helpers/Base64Utils.h"
 #include "../helpers/SensitiveKeywordDetector.h"
 #include "../../core/JSAnalyzer.h"
 
@@ -18,8 +19,7 @@ namespace ConsoleObject {
 
     static bool isBase64Encoded(const std::string& text) {
         if (text.length() < 16) return false;
-        RE2 base64_pattern("^[A-Za-z0-9+/]+=*$");
-        return RE2::FullMatch(text, base64_pattern);
+        return Base64Utils::isBase64(text);
     }
 
     JSValue js_console_log(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
@@ -59,13 +59,13 @@ namespace ConsoleObject {
                 metadata["reason"] = JsValue("Base64 encoded data");
             }
             
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::CONSOLE_LOG,
-                "console.log",
-                args_vec,
-                JsValue(),
-                metadata,
-                severity
+            a_ctx->hookBus.emit(HookType::CONSOLE_LOG, severity, [&] {
+                return HookPayload{
+                    "console.log",
+                    args_vec,
+                    JsValue(),
+                    metadata
+                };
             });
         }
         
@@ -102,13 +102,13 @@ namespace ConsoleObject {
                 metadata["reason"] = JsValue("SENSITIVE DATA in warning");
             }
             
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::CONSOLE_WARN,
-                "console.warn",
-                args_vec,
-                JsValue(),
-                metadata,
-                severity
+            a_ctx->hookBus.emit(HookType::CONSOLE_WARN, severity, [&] {
+                return HookPayload{
+                    "console.warn",
+                    args_vec,
+                    JsValue(),
+                    metadata
+                };
             });
         }
         
@@ -149,13 +149,13 @@ namespace ConsoleObject {
                 metadata["reason"] = JsValue("Stack trace disclosure");
             }
             
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::CONSOLE_ERROR,
-                "console.error",
-                args_vec,
-                JsValue(),
-                metadata,
-                severity
+            a_ctx->hookBus.emit(HookType::CONSOLE_ERROR, severity, [&] {
+                return HookPayload{
+                    "console.error",
+                    args_vec,
+                    JsValue(),
+                    metadata
+                };
             });
         }
         
@@ -164,9 +164,12 @@ namespace ConsoleObject {
 
     void registerConsoleObject(JSContext* ctx, JSValue global_obj) {
         JSValue console_obj = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, console_obj, "log", JS_NewCFunction(ctx, js_console_log, "log", 1));
-        JS_SetPropertyStr(ctx, console_obj, "warn", JS_NewCFunction(ctx, js_console_warn, "warn", 1));
-        JS_SetPropertyStr(ctx, console_obj, "error", JS_NewCFunction(ctx, js_console_error, "error", 1));
+        static const JSCFunctionListEntry console_funcs[] = {
+            JS_CFUNC_DEF2("log", 1, js_console_log, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("warn", 1, js_console_warn, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("error", 1, js_console_error, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, console_obj, console_funcs, sizeof(console_funcs) / sizeof(console_funcs[0]));
         JS_SetPropertyStr(ctx, global_obj, "console", console_obj);
     }
 }
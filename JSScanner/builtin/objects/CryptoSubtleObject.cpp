@@ -35,21 +35,20 @@ JSValue js_crypto_subtle_encrypt(JSContext* ctx, JSValueConst this_val,
                                  int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CRYPTO_ENCRYPT;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "crypto.subtle.encrypt - encrypting data";
-        event.tags.insert("crypto");
-        event.tags.insert("encryption");
-        event.tags.insert("obfuscation");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CRYPTO_ENCRYPT, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "crypto.subtle.encrypt - encrypting data";
+            event.tags.insert("crypto");
+            event.tags.insert("encryption");
+            event.tags.insert("obfuscation");
+            return event;
+        });
     }
 
     // Return promise
     JSValue promise = JS_NewObject(ctx);
-    JS_SetPropertyStr(ctx, promise, "then", 
+    JSAtoms::setProperty(ctx, promise, JSAtomId::then, 
         JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, 
                                 int argc, JSValueConst* argv) -> JSValue {
             return JS_UNDEFINED;
@@ -61,19 +60,18 @@ JSValue js_crypto_subtle_decrypt(JSContext* ctx, JSValueConst this_val,
                                  int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CRYPTO_DECRYPT;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "crypto.subtle.decrypt - decrypting payload";
-        event.tags.insert("crypto");
-        event.tags.insert("decryption");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CRYPTO_DECRYPT, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "crypto.subtle.decrypt - decrypting payload";
+            event.tags.insert("crypto");
+            event.tags.insert("decryption");
+            return event;
+        });
     }
 
     JSValue promise = JS_NewObject(ctx);
-    JS_SetPropertyStr(ctx, promise, "then", 
+    JSAtoms::setProperty(ctx, promise, JSAtomId::then, 
         JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, 
                                 int argc, JSValueConst* argv) -> JSValue {
             return JS_UNDEFINED;
@@ -85,15 +83,14 @@ JSValue js_crypto_subtle_importKey(JSContext* ctx, JSValueConst this_val,
                                    int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CRYPTO_IMPORT_KEY;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "crypto.subtle.importKey - importing encryption key";
-        event.tags.insert("crypto");
-        event.tags.insert("key_management");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CRYPTO_IMPORT_KEY, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "crypto.subtle.importKey - importing encryption key";
+            event.tags.insert("crypto");
+            event.tags.insert("key_management");
+            return event;
+        });
     }
 
     JSValue promise = JS_NewObject(ctx);
@@ -104,14 +101,13 @@ JSValue js_crypto_subtle_generateKey(JSContext* ctx, JSValueConst this_val,
                                      int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CRYPTO_IMPORT_KEY;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "crypto.subtle.generateKey - generating encryption key";
-        event.tags.insert("crypto");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CRYPTO_IMPORT_KEY, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "crypto.subtle.generateKey - generating encryption key";
+            event.tags.insert("crypto");
+            return event;
+        });
     }
 
     JSValue promise = JS_NewObject(ctx);
@@ -1,33 +1,20 @@
 #include "pch.h"
 #include "DocumentObject.h"
 #include "../helpers/JSValueConverter.h"
+#include "../helpers/Base64Utils.h"
 #include "../helpers/SensitiveKeywordDetector.h"
 #include "../helpers/MockHelpers.h"
+#include "ElementObject.h"
 #include "../../model/JsValueVariant.h"
 #include "../../core/JSAnalyzer.h"
 
 namespace DocumentObject {
-    // 🔥 CRITICAL FIX: 멀티스레드 환경에서 데이터 레이스 방지
-    // 각 스레드마다 독립적인 cookie 저장소 사용
-    thread_local std::string g_cookie_storage = "";
-
     static JSAnalyzerContext* get_analyzer_context(JSContext* ctx) {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
 
-    JSValue js_document_write_hook(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
-        if (!a_ctx) return JS_UNDEFINED;
-
-        std::string content = "";
-        if (argc > 0) {
-            const char* str = JS_ToCString(ctx, argv[0]);
-            if (str) {
-                content = str;
-                JS_FreeCString(ctx, str);
-            }
-        }
-
+    // 🔥 document.write 내용 분석 (findings / hook 이벤트 / chain 추적)
+    static void analyzeDocumentWrite(JSAnalyzerContext* a_ctx, const std::string& content) {
         // 🔥 개선: content 내용 상세 분석
         std::map<std::string, JsValue> metadata;
         metadata["content_length"] = JsValue(static_cast<double>(content.length()));
@@ -59,8 +46,7 @@ namespace DocumentObject {
         
         // Base64 패턴 감지
         if (content.length() > 100) {
-            RE2 base64_pattern(R"([A-Za-z0-9+/]{50,}={0,2})");
-            if (RE2::PartialMatch(content, base64_pattern)) {
+            if (Base64Utils::containsBase64Run(content, 50)) {
                 metadata["contains_base64"] = JsValue("true");
             }
         }
@@ -121,23 +107,56 @@ namespace DocumentObject {
         a_ctx->findings->push_back({0, summaryContent, "document_write_detected"});
 
         if (a_ctx->dynamicAnalyzer) {
-            // 최대 1000자까지만 기록 (메모리 절약)
-            std::string recordContent = content.length() > 1000 ? content.substr(0, 1000) + "..." : content;
-            
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::DOM_MANIPULATION, 
-                "document.write", 
-                {JsValue(recordContent)},
-                JsValue(std::monostate()), 
-                metadata,
-                severity
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                // 최대 1000자까지만 기록 (메모리 절약)
+                std::string recordContent = content.length() > 1000 ? content.substr(0, 1000) + "..." : content;
+                return HookPayload{
+                    "document.write",
+                    {JsValue(recordContent)},
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
         if (a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("document.write", {JsValue(content)}, JsValue(std::monostate()));
         }
+    }
+
+    JSValue js_document_write_hook(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx) return JS_UNDEFINED;
+
+        std::string content = "";
+        if (argc > 0) {
+            const char* str = JS_ToCString(ctx, argv[0]);
+            if (str) {
+                content = str;
+                JS_FreeCString(ctx, str);
+            }
+        }
+
+        // 샘플링 / 제한은 분석만 건너뜀 (페이지 동작은 그대로 - 쓰기는 항상 반영)
+        if (a_ctx->admitCall(HookApiId::DOCUMENT_WRITE)) {
+            analyzeDocumentWrite(a_ctx, content);
+        }
 
+        // 🔥 닫힌 태그까지만 DOM 에 반영 (나머지는 다음 write / 블록 종료 시 flushPendingWrites)
+        ElementObject::insertHtml(ctx, a_ctx->dom.body(), a_ctx->dom.takeWritable(content, false), "document.write");
+
+        return JS_UNDEFINED;
+    }
+
+    void flushPendingWrites(JSContext* ctx) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (a_ctx && a_ctx->dom.hasPendingWrite()) {
+            ElementObject::insertHtml(ctx, a_ctx->dom.body(), a_ctx->dom.takeWritable({}, true), "document.write");
+        }
+    }
+
+    JSValue js_document_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        flushPendingWrites(ctx);
         return JS_UNDEFINED;
     }
 
@@ -152,14 +171,24 @@ namespace DocumentObject {
         JS_FreeCString(ctx, id_cstr);
 
         if (a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "getElementById", 
-                {JsValue(id)}, JsValue(std::monostate()), {}, 0});
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                return HookPayload{
+                    "getElementById",
+                    {JsValue(id)},
+                    JsValue(std::monostate()),
+                    {}
+                };
+            });
         }
         
         if (a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("getElementById", {JsValue(id)}, JsValue(std::monostate()));
         }
 
+        // 스크립트가 만든 노드가 있으면 그 노드, 없으면 기존 mock
+        if (DomNode* node = a_ctx->dom.getElementById(id)) {
+            return ElementObject::wrapNode(ctx, node);
+        }
         return MockHelpers::createMockElement(ctx, id);
     }
 
@@ -174,27 +203,47 @@ namespace DocumentObject {
         JS_FreeCString(ctx, tag_cstr);
 
         if (a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "createElement", 
-                {JsValue(tag)}, JsValue(std::monostate()), {}, 0});
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                return HookPayload{
+                    "createElement",
+                    {JsValue(tag)},
+                    JsValue(std::monostate()),
+                    {}
+                };
+            });
         }
         
         if (a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("createElement", {JsValue(tag)}, JsValue(std::monostate()));
         }
 
+        // DOM 한도를 넘으면 기존 mock
+        DomNode* node = tag.empty() ? nullptr : a_ctx->dom.createElement(tag);
+        if (node) {
+            return ElementObject::wrapNode(ctx, node);
+        }
         return MockHelpers::createMockElement(ctx, tag);
     }
 
+    JSValue js_document_createTextNode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx) return JS_NULL;
+        std::string text = argc > 0 ? JSValueConverter::toString(ctx, argv[0]) : std::string();
+        return ElementObject::wrapNode(ctx, a_ctx->dom.createText(text));
+    }
+
     JSValue js_document_get_cookie(JSContext* ctx, JSValueConst this_val) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        // 🔥 Task 컨텍스트의 cookie 저장소 ("a=1; b=2")
+        std::string cookies = a_ctx ? a_ctx->storage.cookieString() : std::string();
         
         // 🎯 0점에서 시작 (cookie 읽기 자체는 정상 동작)
         int severity = 0;
         std::map<std::string, JsValue> metadata;
         
         // Cookie 내용 분석
-        if (!g_cookie_storage.empty()) {
-            std::string lowerCookie = g_cookie_storage;
+        if (!cookies.empty()) {
+            std::string lowerCookie = cookies;
             std::transform(lowerCookie.begin(), lowerCookie.end(), lowerCookie.begin(), ::tolower);
             
             // 1. 민감한 쿠키 키워드 체크 (+2점)
@@ -206,30 +255,40 @@ namespace DocumentObject {
                 metadata["sensitive_cookie"] = JsValue(true);
             }
             
-            metadata["cookie_length"] = JsValue(static_cast<double>(g_cookie_storage.length()));
+            metadata["cookie_length"] = JsValue(static_cast<double>(cookies.length()));
         }
         
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "document.cookie.read", 
-                {}, JsValue(g_cookie_storage), metadata, severity});
+            a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, severity, [&] {
+                return HookPayload{
+                    "document.cookie.read",
+                    {},
+                    JsValue(cookies),
+                    metadata
+                };
+            });
         }
         if (a_ctx && a_ctx->chainTrackerManager) {
-            a_ctx->chainTrackerManager->trackFunctionCall("document.cookie_read", {}, JsValue(g_cookie_storage));
+            a_ctx->chainTrackerManager->trackFunctionCall("document.cookie_read", {}, JsValue(cookies));
         }
-        return JS_NewString(ctx, g_cookie_storage.c_str());
+        return JS_NewString(ctx, cookies.c_str());
     }
 
     JSValue js_document_set_cookie(JSContext* ctx, JSValueConst this_val, JSValueConst val) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         const char* cookie_cstr = JS_ToCString(ctx, val);
         if (cookie_cstr) {
-            g_cookie_storage = cookie_cstr;
+            // 대입 문자열 그대로 분석 (속성 포함), 저장소에는 name=value 만 반영
+            std::string cookieLine = cookie_cstr;
+            if (a_ctx) {
+                a_ctx->storage.setCookie(cookieLine);
+            }
             
             // 🎯 0점에서 시작 (cookie 설정 자체는 정상 동작)
             int severity = 0;
             std::map<std::string, JsValue> metadata;
             
-            std::string lowerCookie = g_cookie_storage;
+            std::string lowerCookie = cookieLine;
             std::transform(lowerCookie.begin(), lowerCookie.end(), lowerCookie.begin(), ::tolower);
             
             // 1. 민감한 쿠키 키워드 체크 (+3점)
@@ -254,15 +313,21 @@ namespace DocumentObject {
                 metadata["missing_secure"] = JsValue(true);
             }
             
-            metadata["cookie_length"] = JsValue(static_cast<double>(g_cookie_storage.length()));
+            metadata["cookie_length"] = JsValue(static_cast<double>(cookieLine.length()));
             
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "document.cookie.write", 
-                    {JsValue(g_cookie_storage)}, JsValue(std::monostate()), metadata, severity});
+                a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, severity, [&] {
+                    return HookPayload{
+                        "document.cookie.write",
+                        {JsValue(cookieLine)},
+                        JsValue(std::monostate()),
+                        metadata
+                    };
+                });
             }
             if (a_ctx && a_ctx->chainTrackerManager) {
                 a_ctx->chainTrackerManager->trackFunctionCall("document.cookie_write", 
-                    {JsValue(g_cookie_storage)}, JsValue(std::monostate()));
+                    {JsValue(cookieLine)}, JsValue(std::monostate()));
             }
             JS_FreeCString(ctx, cookie_cstr);
         }
@@ -317,8 +382,14 @@ namespace DocumentObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (argc < 1) {
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "querySelector_empty", 
-                    {}, JsValue(std::monostate()), {}, 0});
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                    return HookPayload{
+                        "querySelector_empty",
+                        {},
+                        JsValue(std::monostate()),
+                        {}
+                    };
+                });
             }
             return JS_NULL;
         }
@@ -326,8 +397,14 @@ namespace DocumentObject {
         std::string selector = JSValueConverter::toString(ctx, argv[0]);
         if (selector.empty()) {
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "querySelector_empty", 
-                    {}, JsValue(std::monostate()), {}, 0});
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                    return HookPayload{
+                        "querySelector_empty",
+                        {},
+                        JsValue(std::monostate()),
+                        {}
+                    };
+                });
             }
             return JS_NULL;
         }
@@ -345,8 +422,14 @@ namespace DocumentObject {
         std::string eventName = sensitive ? "querySelector_sensitive" : "querySelector";
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, eventName, 
-                {JsValue(selector)}, JsValue(std::monostate()), metadata, severity});
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                return HookPayload{
+                    eventName,
+                    {JsValue(selector)},
+                    JsValue(std::monostate()),
+                    metadata
+                };
+            });
         }
 
         if (a_ctx && a_ctx->chainTrackerManager) {
@@ -354,6 +437,11 @@ namespace DocumentObject {
                 {JsValue(selector)}, JsValue(std::monostate()));
         }
 
+        if (a_ctx) {
+            if (DomNode* node = a_ctx->dom.querySelector(a_ctx->dom.document(), selector)) {
+                return ElementObject::wrapNode(ctx, node);
+            }
+        }
         std::string elementId = "qs_" + std::to_string(std::hash<std::string>{}(selector));
         return MockHelpers::createMockElement(ctx, elementId);
     }
@@ -362,8 +450,14 @@ namespace DocumentObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (argc < 1) {
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "querySelectorAll_empty", 
-                    {}, JsValue(std::monostate()), {}, 0});
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                    return HookPayload{
+                        "querySelectorAll_empty",
+                        {},
+                        JsValue(std::monostate()),
+                        {}
+                    };
+                });
             }
             return JS_NewArray(ctx);
         }
@@ -375,7 +469,12 @@ namespace DocumentObject {
         std::map<std::string, JsValue> metadata;
         metadata["selector"] = JsValue(selector);
 
-        size_t count = 3;
+        // 실제 DOM 에 일치하는 노드가 없으면 mock 3개
+        std::vector<DomNode*> nodes;
+        if (a_ctx) {
+            nodes = a_ctx->dom.querySelectorAll(a_ctx->dom.document(), selector);
+        }
+        size_t count = nodes.empty() ? 3 : nodes.size();
         metadata["count"] = JsValue(static_cast<double>(count));
         if (!matched.empty()) {
             metadata["keywords"] = JsValue(matched);
@@ -384,8 +483,14 @@ namespace DocumentObject {
         int severity = sensitive ? 3 : 0;  // sensitive 키워드 감지 시에만 점수 부여
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "querySelectorAll", 
-                {JsValue(selector)}, JsValue(std::monostate()), metadata, severity});
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                return HookPayload{
+                    "querySelectorAll",
+                    {JsValue(selector)},
+                    JsValue(std::monostate()),
+                    metadata
+                };
+            });
         }
 
         if (a_ctx && a_ctx->chainTrackerManager) {
@@ -393,6 +498,10 @@ namespace DocumentObject {
                 {JsValue(selector)}, JsValue(std::monostate()));
         }
 
+        if (!nodes.empty()) {
+            return ElementObject::wrapNodes(ctx, nodes);
+        }
+
         JSValue array = JS_NewArray(ctx);
         for (uint32_t i = 0; i < count; ++i) {
             std::string elementId = "qs_all_" + std::to_string(std::hash<std::string>{}(selector + std::to_string(i)));
@@ -406,18 +515,19 @@ namespace DocumentObject {
     void registerDocumentObject(JSContext* ctx, JSValue global_obj) {
         JSValue document_obj = JS_NewObject(ctx);
         
-        JS_SetPropertyStr(ctx, document_obj, "write", 
-            JS_NewCFunction(ctx, js_document_write_hook, "write", 1));
-        JS_SetPropertyStr(ctx, document_obj, "getElementById", 
-            JS_NewCFunction(ctx, js_document_getElementById, "getElementById", 1));
-        JS_SetPropertyStr(ctx, document_obj, "createElement", 
-            JS_NewCFunction(ctx, js_document_createElement, "createElement", 1));
-        JS_SetPropertyStr(ctx, document_obj, "addEventListener", 
-            JS_NewCFunction(ctx, js_document_addEventListener, "addEventListener", 2));
-        JS_SetPropertyStr(ctx, document_obj, "querySelector", 
-            JS_NewCFunction(ctx, js_document_querySelector, "querySelector", 1));
-        JS_SetPropertyStr(ctx, document_obj, "querySelectorAll", 
-            JS_NewCFunction(ctx, js_document_querySelectorAll, "querySelectorAll", 1));
+        static const JSCFunctionListEntry document_funcs[] = {
+            JS_CFUNC_DEF2("write", 1, js_document_write_hook, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("getElementById", 1, js_document_getElementById, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("createElement", 1, js_document_createElement, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("addEventListener", 2, js_document_addEventListener, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("querySelector", 1, js_document_querySelector, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("querySelectorAll", 1, js_document_querySelectorAll, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("createTextNode", 1, js_document_createTextNode, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("close", 0, js_document_close, JS_PROP_C_W_E),
+            // 🔥 NEW: document.getElementsByTagName (DOM 에 없으면 querySelectorAll 과 같은 mock)
+            JS_CFUNC_DEF2("getElementsByTagName", 1, js_document_querySelectorAll, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, document_obj, document_funcs, sizeof(document_funcs) / sizeof(document_funcs[0]));
 
         // Cookie getter/setter
         JSCFunctionType cookie_getter_type;
@@ -428,7 +538,7 @@ namespace DocumentObject {
         cookie_setter_type.setter = js_document_set_cookie;
         JSValue cookie_setter = JS_NewCFunction2(ctx, cookie_setter_type.generic, "set_cookie", 1, JS_CFUNC_setter, 0);
 
-        JS_DefinePropertyGetSet(ctx, document_obj, JS_NewAtom(ctx, "cookie"), cookie_getter, cookie_setter, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, document_obj, JSAtomId::cookie, cookie_getter, cookie_setter, JS_PROP_C_W_E);
 
         JS_FreeValue(ctx, cookie_getter);
         JS_FreeValue(ctx, cookie_setter);
@@ -443,30 +553,38 @@ namespace DocumentObject {
         innerHTML_setter_type.setter = js_document_element_set_innerHTML;
         JSValue innerHTML_setter = JS_NewCFunction2(ctx, innerHTML_setter_type.generic, "set_innerHTML", 1, JS_CFUNC_setter, 0);
         
-        JS_DefinePropertyGetSet(ctx, documentElement_obj, JS_NewAtom(ctx, "innerHTML"), 
+        JSAtoms::defineGetSet(ctx, documentElement_obj, JSAtomId::innerHTML, 
                                 JS_UNDEFINED, innerHTML_setter, JS_PROP_C_W_E);
         JS_FreeValue(ctx, innerHTML_setter);
         
         // documentElement??document 객체???�록
         JS_SetPropertyStr(ctx, document_obj, "documentElement", documentElement_obj);
         
+        // 🔥 body / head 는 Task DOM 노드 (분석 컨텍스트가 없으면 기존 빈 객체)
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+
         // 🔥 body 객체 추가 (addEventListener 포함)
-        JSValue body_obj = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, body_obj, "addEventListener",
-            JS_NewCFunction(ctx, js_document_addEventListener, "addEventListener", 2));
+        JSValue body_obj = a_ctx ? ElementObject::wrapNode(ctx, a_ctx->dom.body()) : JS_NewObject(ctx);
+        if (!a_ctx) {
+            JS_SetPropertyStr(ctx, body_obj, "addEventListener",
+                JS_NewCFunction(ctx, js_document_addEventListener, "addEventListener", 2));
+        }
         JS_SetPropertyStr(ctx, document_obj, "body", body_obj);
         // body_obj는 자동으로 해제됨 (JS_SetPropertyStr이 참조를 가져감)
         
         // 🔥 location 객체 추가 (document.location.href 지원)
         JSValue location_obj = JS_NewObject(ctx);
         
-        // 각 속성 추가 (임시 JSValue 생성 → 설정 → 해제 불필요, JS_NewString은 이미 전달됨)
-        JS_SetPropertyStr(ctx, location_obj, "href", JS_NewString(ctx, "https://example.com/"));
-        JS_SetPropertyStr(ctx, location_obj, "hostname", JS_NewString(ctx, "example.com"));
-        JS_SetPropertyStr(ctx, location_obj, "pathname", JS_NewString(ctx, "/"));
-        JS_SetPropertyStr(ctx, location_obj, "protocol", JS_NewString(ctx, "https:"));
-        JS_SetPropertyStr(ctx, location_obj, "search", JS_NewString(ctx, ""));
-        JS_SetPropertyStr(ctx, location_obj, "hash", JS_NewString(ctx, ""));
+        static const JSCFunctionListEntry document_location_props[] = {
+            JS_PROP_STRING_DEF("href", "https://example.com/", JS_PROP_C_W_E),
+            JS_PROP_STRING_DEF("hostname", "example.com", JS_PROP_C_W_E),
+            JS_PROP_STRING_DEF("pathname", "/", JS_PROP_C_W_E),
+            JS_PROP_STRING_DEF("protocol", "https:", JS_PROP_C_W_E),
+            JS_PROP_STRING_DEF("search", "", JS_PROP_C_W_E),
+            JS_PROP_STRING_DEF("hash", "", JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, location_obj, document_location_props,
+                                   sizeof(document_location_props) / sizeof(document_location_props[0]));
         
         // location 객체를 document에 설정
         JS_SetPropertyStr(ctx, document_obj, "location", location_obj);
@@ -480,13 +598,9 @@ namespace DocumentObject {
         JS_SetPropertyStr(ctx, document_obj, "currentScript", JS_NULL);
         
         // 🔥 NEW: document.head 추가
-        JSValue head_obj = JS_NewObject(ctx);
+        JSValue head_obj = a_ctx ? ElementObject::wrapNode(ctx, a_ctx->dom.head()) : JS_NewObject(ctx);
         JS_SetPropertyStr(ctx, document_obj, "head", head_obj);
         
-        // 🔥 NEW: document.getElementsByTagName 추가 (빈 배열 반환)
-        JS_SetPropertyStr(ctx, document_obj, "getElementsByTagName",
-            JS_NewCFunction(ctx, js_document_querySelectorAll, "getElementsByTagName", 1));
-        
         // 🔥 NEW: document 객체를 전역에 등록하되, 읽기 전용으로 설정
         JS_DefinePropertyValueStr(ctx, global_obj, "document", document_obj, 
                                    JS_PROP_C_W_E | JS_PROP_CONFIGURABLE);
@@ -546,13 +660,13 @@ namespace DocumentObject {
                     // 최대 점수 제한
                     severity = std::min(severity, 15);
                     
-                    a_ctx->dynamicAnalyzer->recordEvent({
-                        HookType::DOM_MANIPULATION, 
-                        "document.documentElement.innerHTML", 
-                        {JsValue(htmlContent.substr(0, std::min(size_t(200), htmlContent.length())))},
-                        JsValue(std::monostate()), 
-                        metadata, 
-                        severity
+                    a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                        return HookPayload{
+                            "document.documentElement.innerHTML",
+                            {JsValue(htmlContent.substr(0, std::min(size_t(200), htmlContent.length())))},
+                            JsValue(std::monostate()),
+                            metadata
+                        };
                     });
                 }
                 
@@ -563,6 +677,11 @@ namespace DocumentObject {
                         JsValue(std::monostate())
                     );
                 }
+
+                // 교체된 페이지 내용은 body 아래에 반영 (head / body 구조는 유지)
+                a_ctx->dom.removeChildren(a_ctx->dom.head());
+                a_ctx->dom.removeChildren(a_ctx->dom.body());
+                ElementObject::insertHtml(ctx, a_ctx->dom.body(), htmlContent, "documentElement.innerHTML");
             }
         }
         
@@ -17,15 +17,19 @@ namespace DocumentObject {
     JSValue js_document_write_hook(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_getElementById(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_createElement(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_document_createTextNode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_document_close(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_addEventListener(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_querySelector(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_querySelectorAll(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_document_get_cookie(JSContext* ctx, JSValueConst this_val);
     JSValue js_document_set_cookie(JSContext* ctx, JSValueConst this_val, JSValueConst val);
     
+    /**
+     * document.write 로 쌓인 미완성 HTML 을 DOM 에 반영 (블록 종료 / document.close)
+     */
+    void flushPendingWrites(JSContext* ctx);
+
     // documentElement.innerHTML setter (추가)
     JSValue js_document_element_set_innerHTML(JSContext* ctx, JSValueConst this_val, JSValueConst val);
-
-    // Cookie 스토리지 (멀티스레드 안전성을 위해 thread_local 사용)
-    extern thread_local std::string g_cookie_storage;
 }
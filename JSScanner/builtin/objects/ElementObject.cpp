@@ -9,6 +9,49 @@ namespace ElementObject {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
 
+    // wrapper 가 가리키는 노드 serial 은 opaque 에만 보관 (스크립트에서 보거나 위조할 수 없음)
+    struct NodeRef {
+        uint32_t serial;
+    };
+
+    static void node_finalizer(JSRuntime* rt, JSValue val) {
+        delete static_cast<NodeRef*>(JS_GetOpaque(val, JS_GetClassID(val)));
+    }
+
+    // 🔥 wrapper class 는 첫 wrapper 생성 시 등록 (Blob 과 같은 방식)
+    static JSClassID elementClassID(JSContext* ctx, JSAnalyzerContext* a_ctx) {
+        if (a_ctx->domElementClassID == 0) {
+            JSRuntime* rt = JS_GetRuntime(ctx);
+            JSClassID class_id = 0;
+            JS_NewClassID(rt, &class_id);
+            JSClassDef js_element_class = {
+                .class_name = "HTMLElement",
+                .finalizer = node_finalizer,
+            };
+            if (JS_NewClass(rt, class_id, &js_element_class) < 0) {
+                return 0;
+            }
+            a_ctx->domElementClassID = class_id;
+        }
+        return a_ctx->domElementClassID;
+    }
+
+    DomNode* nodeOf(JSContext* ctx, JSValueConst obj) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx || a_ctx->domElementClassID == 0 || !JS_IsObject(obj)) {
+            return nullptr;
+        }
+        NodeRef* ref = static_cast<NodeRef*>(JS_GetOpaque(obj, a_ctx->domElementClassID));
+        return ref ? a_ctx->dom.node(ref->serial) : nullptr;
+    }
+
+    // script 속성 / 내용이 바뀐 뒤 호출 - document 에 연결돼 있으면 실행 대기열에 추가
+    static void queueIfScript(JSAnalyzerContext* a_ctx, DomNode* node, const char* origin) {
+        if (node->is("script")) {
+            a_ctx->dom.queueScripts(node, origin);
+        }
+    }
+
     JSValue js_classList_add(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         if (argc < 1) {
             return JS_UNDEFINED;
@@ -66,6 +109,12 @@ namespace ElementObject {
         }
         std::string name = JSValueConverter::toString(ctx, argv[0]);
         std::string value = JSValueConverter::toString(ctx, argv[1]);
+        if (DomNode* node = nodeOf(ctx, this_val)) {
+            JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+            a_ctx->dom.setAttribute(node, name, value);
+            queueIfScript(a_ctx, node, "setAttribute");
+            return JS_UNDEFINED;
+        }
         MockHelpers::setMockAttribute(ctx, JS_DupValue(ctx, this_val), name, value);
         return JS_UNDEFINED;
     }
@@ -75,6 +124,10 @@ namespace ElementObject {
             return JS_NULL;
         }
         std::string name = JSValueConverter::toString(ctx, argv[0]);
+        if (DomNode* node = nodeOf(ctx, this_val)) {
+            auto value = get_analyzer_context(ctx)->dom.getAttribute(node, name);
+            return value ? JS_NewStringLen(ctx, value->data(), value->size()) : JS_NULL;
+        }
         JSValue elementDup = JS_DupValue(ctx, this_val);
         JSValue attrs = JS_GetPropertyStr(ctx, elementDup, "__attributes");
         if (JS_IsUndefined(attrs) || JS_IsNull(attrs)) {
@@ -97,6 +150,9 @@ namespace ElementObject {
             return JS_NewBool(ctx, 0);
         }
         std::string name = JSValueConverter::toString(ctx, argv[0]);
+        if (DomNode* node = nodeOf(ctx, this_val)) {
+            return JS_NewBool(ctx, get_analyzer_context(ctx)->dom.getAttribute(node, name).has_value());
+        }
         JSValue elementDup = JS_DupValue(ctx, this_val);
         JSValue attrs = JS_GetPropertyStr(ctx, elementDup, "__attributes");
         if (JS_IsUndefined(attrs) || JS_IsNull(attrs)) {
@@ -117,6 +173,10 @@ namespace ElementObject {
             return JS_UNDEFINED;
         }
         std::string name = JSValueConverter::toString(ctx, argv[0]);
+        if (DomNode* node = nodeOf(ctx, this_val)) {
+            get_analyzer_context(ctx)->dom.removeAttribute(node, name);
+            return JS_UNDEFINED;
+        }
         JSValue elementDup = JS_DupValue(ctx, this_val);
         JSValue attrs = JS_GetPropertyStr(ctx, elementDup, "__attributes");
         if (!JS_IsUndefined(attrs) && !JS_IsNull(attrs)) {
@@ -150,8 +210,14 @@ namespace ElementObject {
 
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DOM_MANIPULATION, "addEventListener", 
-                {JsValue(eventName)}, JsValue(std::monostate()), {}, 0});
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 0, [&] {
+                return HookPayload{
+                    "addEventListener",
+                    {JsValue(eventName)},
+                    JsValue(std::monostate()),
+                    {}
+                };
+            });
         }
 
         JSValue elementDup = JS_DupValue(ctx, this_val);
@@ -197,12 +263,317 @@ namespace ElementObject {
         return JS_UNDEFINED;
     }
 
-    JSValue js_element_appendChild(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        if (argc < 1) return JS_NULL;
+    // 🔥 child 를 parent 아래(ref 앞)로 옮기고 새로 연결된 script 를 실행 대기열에 추가
+    // - mock 부모(찾지 못한 getElementById 결과 등)에 붙인 DOM 노드는 body 에 붙여 주입 script 를 놓치지 않음
+    // - 계층 오류는 예외 대신 무시 (기존 mock 과 동일하게 child 반환)
+    static JSValue insertChild(JSContext* ctx, JSValueConst this_val, JSValueConst child_val,
+                               JSValueConst ref_val, const char* origin) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (a_ctx && a_ctx->chainTrackerManager) {
-            a_ctx->chainTrackerManager->trackFunctionCall("appendChild", {}, JsValue(std::monostate()));
+            a_ctx->chainTrackerManager->trackFunctionCall(origin, {}, JsValue(std::monostate()));
+        }
+        DomNode* child = nodeOf(ctx, child_val);
+        if (child) {
+            DomNode* parent = nodeOf(ctx, this_val);
+            if (!parent) {
+                parent = a_ctx->dom.body();
+            }
+            DomNode* ref = nodeOf(ctx, ref_val);
+            if (a_ctx->dom.insertBefore(parent, child, ref && ref->parent == parent ? ref : nullptr)) {
+                a_ctx->dom.queueScripts(child, origin);
+            }
+        }
+        return JS_DupValue(ctx, child_val);
+    }
+
+    JSValue js_element_appendChild(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        if (argc < 1) return JS_NULL;
+        return insertChild(ctx, this_val, argv[0], JS_NULL, "appendChild");
+    }
+
+    JSValue js_element_insertBefore(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        if (argc < 1) return JS_NULL;
+        return insertChild(ctx, this_val, argv[0], argc > 1 ? argv[1] : JS_NULL, "insertBefore");
+    }
+
+    JSValue js_element_removeChild(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        if (argc < 1) return JS_NULL;
+        DomNode* parent = nodeOf(ctx, this_val);
+        DomNode* child = nodeOf(ctx, argv[0]);
+        if (parent && child) {
+            get_analyzer_context(ctx)->dom.removeChild(parent, child);
         }
         return JS_DupValue(ctx, argv[0]);
     }
+
+    JSValue js_element_remove(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (node && node->parent) {
+            get_analyzer_context(ctx)->dom.removeChild(node->parent, node);
+        }
+        return JS_UNDEFINED;
+    }
+
+    JSValue js_element_querySelector(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node || argc < 1) return JS_NULL;
+        std::string selector = JSValueConverter::toString(ctx, argv[0]);
+        return wrapNode(ctx, get_analyzer_context(ctx)->dom.querySelector(node, selector));
+    }
+
+    JSValue js_element_querySelectorAll(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node || argc < 1) return JS_NewArray(ctx);
+        std::string selector = JSValueConverter::toString(ctx, argv[0]);
+        return wrapNodes(ctx, get_analyzer_context(ctx)->dom.querySelectorAll(node, selector));
+    }
+
+    static JSValue js_element_focus(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        return JS_UNDEFINED;
+    }
+
+    // 노드 구조 / 내용 property (magic)
+    enum NodeProperty {
+        PROP_INNER_HTML,
+        PROP_OUTER_HTML,
+        PROP_TEXT_CONTENT,
+        PROP_TAG_NAME,
+        PROP_NODE_NAME,
+        PROP_NODE_TYPE,
+        PROP_PARENT_NODE,
+        PROP_FIRST_CHILD,
+        PROP_LAST_CHILD,
+        PROP_NEXT_SIBLING,
+        PROP_PREVIOUS_SIBLING,
+        PROP_CHILD_NODES,
+        PROP_CHILDREN,
+        PROP_IS_CONNECTED,
+    };
+
+    static JSValue newString(JSContext* ctx, std::string_view text) {
+        return JS_NewStringLen(ctx, text.data(), text.size());
+    }
+
+    static std::string upperTag(const DomNode* node) {
+        std::string tag(node->tag);
+        std::transform(tag.begin(), tag.end(), tag.begin(), ::toupper);
+        return tag;
+    }
+
+    static JSValue js_node_get(JSContext* ctx, JSValueConst this_val, int magic) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node) return JS_UNDEFINED;
+        DomTree& dom = get_analyzer_context(ctx)->dom;
+
+        switch (magic) {
+        case PROP_INNER_HTML:
+            return newString(ctx, dom.serialize(node, false));
+        case PROP_OUTER_HTML:
+            return newString(ctx, dom.serialize(node, true));
+        case PROP_TEXT_CONTENT:
+            return newString(ctx, dom.textContent(node));
+        case PROP_TAG_NAME:
+            return node->isElement() ? newString(ctx, upperTag(node)) : JS_UNDEFINED;
+        case PROP_NODE_NAME:
+            if (node->isElement()) return newString(ctx, upperTag(node));
+            return JS_NewString(ctx, node->type == DomNode::TEXT ? "#text" : "#comment");
+        case PROP_NODE_TYPE:
+            return JS_NewInt32(ctx, node->isElement() ? 1 : node->type == DomNode::TEXT ? 3 : 8);
+        case PROP_PARENT_NODE:
+            // document 노드는 전역 document 객체가 대신함
+            return node->parent && node->parent->type != DomNode::DOCUMENT ? wrapNode(ctx, node->parent) : JS_NULL;
+        case PROP_FIRST_CHILD:
+            return wrapNode(ctx, node->firstChild);
+        case PROP_LAST_CHILD:
+            return wrapNode(ctx, node->lastChild);
+        case PROP_NEXT_SIBLING:
+            return wrapNode(ctx, node->next);
+        case PROP_PREVIOUS_SIBLING:
+            return wrapNode(ctx, node->prev);
+        case PROP_CHILD_NODES:
+        case PROP_CHILDREN: {
+            std::vector<DomNode*> children;
+            for (DomNode* c = node->firstChild; c; c = c->next) {
+                if (magic == PROP_CHILD_NODES || c->isElement()) children.push_back(c);
+            }
+            return wrapNodes(ctx, children);
+        }
+        case PROP_IS_CONNECTED:
+            return JS_NewBool(ctx, DomTree::isConnected(node));
+        default:
+            return JS_UNDEFINED;
+        }
+    }
+
+    static JSValue js_node_set(JSContext* ctx, JSValueConst this_val, JSValueConst val, int magic) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node) return JS_UNDEFINED;
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        std::string text = JSValueConverter::toString(ctx, val);
+
+        switch (magic) {
+        case PROP_INNER_HTML:
+            // 🔥 브라우저는 innerHTML 로 넣은 script 를 실행하지 않지만 페이로드 노출을 위해 실행 (origin 으로 구분)
+            if (node->is("script") || node->is("style")) {
+                a_ctx->dom.setTextContent(node, text);
+                queueIfScript(a_ctx, node, "innerHTML");
+            } else {
+                a_ctx->dom.removeChildren(node);
+                insertHtml(ctx, node, text, "innerHTML");
+            }
+            break;
+        case PROP_OUTER_HTML: {
+            DomNode* parent = node->parent;
+            DomNode* holder = a_ctx->tagParser ? a_ctx->dom.createElement("template") : nullptr;
+            if (!parent || parent->type == DomNode::DOCUMENT || !holder) break;
+            // 연결되지 않은 임시 부모에 파싱한 뒤 node 자리로 옮김
+            a_ctx->tagParser->parseIntoDom(text, a_ctx->dom, holder);
+            while (DomNode* child = holder->firstChild) {
+                if (!a_ctx->dom.insertBefore(parent, child, node)) break;
+                a_ctx->dom.queueScripts(child, "outerHTML");
+            }
+            a_ctx->dom.removeChild(parent, node);
+            break;
+        }
+        case PROP_TEXT_CONTENT:
+            a_ctx->dom.setTextContent(node, text);
+            queueIfScript(a_ctx, node, "textContent");
+            break;
+        default:
+            break;
+        }
+        return JS_UNDEFINED;
+    }
+
+    // 속성을 그대로 반영하는 property (magic = 표 index)
+    static const char* const REFLECTED_ATTRIBUTES[] = {
+        "id", "class", "src", "href", "type", "name", "title", "rel", "action", "method", "target",
+    };
+    enum ReflectedAttribute {
+        REFLECT_ID, REFLECT_CLASS, REFLECT_SRC, REFLECT_HREF, REFLECT_TYPE, REFLECT_NAME,
+        REFLECT_TITLE, REFLECT_REL, REFLECT_ACTION, REFLECT_METHOD, REFLECT_TARGET,
+    };
+
+    static JSValue js_reflect_get(JSContext* ctx, JSValueConst this_val, int magic) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node || !node->isElement()) return JS_UNDEFINED;
+        auto value = get_analyzer_context(ctx)->dom.getAttribute(node, REFLECTED_ATTRIBUTES[magic]);
+        return value ? newString(ctx, *value) : JS_NewString(ctx, "");
+    }
+
+    static JSValue js_reflect_set(JSContext* ctx, JSValueConst this_val, JSValueConst val, int magic) {
+        DomNode* node = nodeOf(ctx, this_val);
+        if (!node || !node->isElement()) return JS_UNDEFINED;
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        a_ctx->dom.setAttribute(node, REFLECTED_ATTRIBUTES[magic], JSValueConverter::toString(ctx, val));
+        if (magic == REFLECT_SRC) {
+            queueIfScript(a_ctx, node, "src");
+        }
+        return JS_UNDEFINED;
+    }
+
+    static const JSCFunctionListEntry element_proto_funcs[] = {
+        JS_CFUNC_DEF("addEventListener", 2, js_element_addEventListener),
+        JS_CFUNC_DEF("setAttribute", 2, js_element_setAttribute),
+        JS_CFUNC_DEF("getAttribute", 1, js_element_getAttribute),
+        JS_CFUNC_DEF("hasAttribute", 1, js_element_hasAttribute),
+        JS_CFUNC_DEF("removeAttribute", 1, js_element_removeAttribute),
+        JS_CFUNC_DEF("appendChild", 1, js_element_appendChild),
+        JS_CFUNC_DEF("insertBefore", 2, js_element_insertBefore),
+        JS_CFUNC_DEF("removeChild", 1, js_element_removeChild),
+        JS_CFUNC_DEF("remove", 0, js_element_remove),
+        JS_CFUNC_DEF("querySelector", 1, js_element_querySelector),
+        JS_CFUNC_DEF("querySelectorAll", 1, js_element_querySelectorAll),
+        JS_CFUNC_DEF("getElementsByTagName", 1, js_element_querySelectorAll),
+        JS_CFUNC_DEF("focus", 0, js_element_focus),
+        JS_CGETSET_MAGIC_DEF("innerHTML", js_node_get, js_node_set, PROP_INNER_HTML),
+        JS_CGETSET_MAGIC_DEF("outerHTML", js_node_get, js_node_set, PROP_OUTER_HTML),
+        JS_CGETSET_MAGIC_DEF("textContent", js_node_get, js_node_set, PROP_TEXT_CONTENT),
+        JS_CGETSET_MAGIC_DEF("innerText", js_node_get, js_node_set, PROP_TEXT_CONTENT),
+        JS_CGETSET_MAGIC_DEF("text", js_node_get, js_node_set, PROP_TEXT_CONTENT),
+        JS_CGETSET_MAGIC_DEF("tagName", js_node_get, nullptr, PROP_TAG_NAME),
+        JS_CGETSET_MAGIC_DEF("nodeName", js_node_get, nullptr, PROP_NODE_NAME),
+        JS_CGETSET_MAGIC_DEF("nodeType", js_node_get, nullptr, PROP_NODE_TYPE),
+        JS_CGETSET_MAGIC_DEF("parentNode", js_node_get, nullptr, PROP_PARENT_NODE),
+        JS_CGETSET_MAGIC_DEF("parentElement", js_node_get, nullptr, PROP_PARENT_NODE),
+        JS_CGETSET_MAGIC_DEF("firstChild", js_node_get, nullptr, PROP_FIRST_CHILD),
+        JS_CGETSET_MAGIC_DEF("lastChild", js_node_get, nullptr, PROP_LAST_CHILD),
+        JS_CGETSET_MAGIC_DEF("nextSibling", js_node_get, nullptr, PROP_NEXT_SIBLING),
+        JS_CGETSET_MAGIC_DEF("previousSibling", js_node_get, nullptr, PROP_PREVIOUS_SIBLING),
+        JS_CGETSET_MAGIC_DEF("childNodes", js_node_get, nullptr, PROP_CHILD_NODES),
+        JS_CGETSET_MAGIC_DEF("children", js_node_get, nullptr, PROP_CHILDREN),
+        JS_CGETSET_MAGIC_DEF("isConnected", js_node_get, nullptr, PROP_IS_CONNECTED),
+        JS_CGETSET_MAGIC_DEF("id", js_reflect_get, js_reflect_set, REFLECT_ID),
+        JS_CGETSET_MAGIC_DEF("className", js_reflect_get, js_reflect_set, REFLECT_CLASS),
+        JS_CGETSET_MAGIC_DEF("src", js_reflect_get, js_reflect_set, REFLECT_SRC),
+        JS_CGETSET_MAGIC_DEF("href", js_reflect_get, js_reflect_set, REFLECT_HREF),
+        JS_CGETSET_MAGIC_DEF("type", js_reflect_get, js_reflect_set, REFLECT_TYPE),
+        JS_CGETSET_MAGIC_DEF("name", js_reflect_get, js_reflect_set, REFLECT_NAME),
+        JS_CGETSET_MAGIC_DEF("title", js_reflect_get, js_reflect_set, REFLECT_TITLE),
+        JS_CGETSET_MAGIC_DEF("rel", js_reflect_get, js_reflect_set, REFLECT_REL),
+        JS_CGETSET_MAGIC_DEF("action", js_reflect_get, js_reflect_set, REFLECT_ACTION),
+        JS_CGETSET_MAGIC_DEF("method", js_reflect_get, js_reflect_set, REFLECT_METHOD),
+        JS_CGETSET_MAGIC_DEF("target", js_reflect_get, js_reflect_set, REFLECT_TARGET),
+    };
+
+    // wrapper 공용 prototype (Task 컨텍스트당 1개, 처음 wrapper 를 만들 때 생성)
+    static JSValueConst elementProto(JSContext* ctx, JSAnalyzerContext* a_ctx) {
+        if (JS_IsUndefined(a_ctx->domWrappers.elementProto())) {
+            JSValue proto = JS_NewObject(ctx);
+            JS_SetPropertyFunctionList(ctx, proto, element_proto_funcs,
+                sizeof(element_proto_funcs) / sizeof(element_proto_funcs[0]));
+            a_ctx->domWrappers.setElementProto(ctx, proto);
+        }
+        return a_ctx->domWrappers.elementProto();
+    }
+
+    JSValue wrapNode(JSContext* ctx, DomNode* node) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!node || !a_ctx || node->type == DomNode::DOCUMENT) {
+            return JS_NULL;
+        }
+        JSValueConst cached = a_ctx->domWrappers.get(node->serial);
+        if (!JS_IsUndefined(cached)) {
+            return JS_DupValue(ctx, cached);
+        }
+
+        JSClassID class_id = elementClassID(ctx, a_ctx);
+        if (class_id == 0) {
+            return JS_ThrowInternalError(ctx, "DOM wrapper class registration failed");
+        }
+        JSValue obj = JS_NewObjectProtoClass(ctx, elementProto(ctx, a_ctx), class_id);
+        if (JS_IsException(obj)) {
+            return obj;
+        }
+        JS_SetOpaque(obj, new NodeRef{node->serial});
+        if (node->isElement()) {
+            // mock 과 같은 모양의 per-element 상태 (DOM 에 반영하지 않음)
+            auto value = a_ctx->dom.getAttribute(node, "value");
+            JS_SetPropertyStr(ctx, obj, "classList", MockHelpers::createClassListObject(ctx));
+            JS_SetPropertyStr(ctx, obj, "style", MockHelpers::createStyleObject(ctx));
+            JS_SetPropertyStr(ctx, obj, "dataset", JS_NewObject(ctx));
+            JS_SetPropertyStr(ctx, obj, "value", value ? newString(ctx, *value) : JS_NewString(ctx, ""));
+            JS_SetPropertyStr(ctx, obj, "disabled", JS_NewBool(ctx, 0));
+        }
+        a_ctx->domWrappers.put(ctx, node->serial, obj);
+        return obj;
+    }
+
+    JSValue wrapNodes(JSContext* ctx, const std::vector<DomNode*>& nodes) {
+        JSValue array = JS_NewArray(ctx);
+        for (uint32_t i = 0; i < nodes.size(); ++i) {
+            JS_SetPropertyUint32(ctx, array, i, wrapNode(ctx, nodes[i]));
+        }
+        return array;
+    }
+
+    void insertHtml(JSContext* ctx, DomNode* parent, const std::string& html, const char* origin) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx || !a_ctx->tagParser || !parent || html.empty()) {
+            return;
+        }
+        for (DomNode* inserted : a_ctx->tagParser->parseIntoDom(html, a_ctx->dom, parent)) {
+            a_ctx->dom.queueScripts(inserted, origin);
+        }
+    }
 }
@@ -1,5 +1,9 @@
 #pragma once
 #include "../../quickjs.h"
+#include <string>
+#include <vector>
+
+struct DomNode;
 
 /**
  * Element 객체의 메서드들
@@ -14,9 +18,29 @@ namespace ElementObject {
     JSValue js_element_hasAttribute(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_element_removeAttribute(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_element_appendChild(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_element_insertBefore(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_element_removeChild(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_element_remove(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_element_querySelector(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_element_querySelectorAll(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     
     // ClassList 메서드들
     JSValue js_classList_add(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_classList_remove(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_classList_contains(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+    /**
+     * 🔥 Task DOM(JSAnalyzerContext::dom) 노드 ↔ JS wrapper
+     * wrapper 는 노드당 1개이고 Element 메서드 / accessor 는 공용 prototype 에 있음
+     * (mock element 와 같은 함수를 쓰며, DOM 노드가 아니면 기존 mock 동작)
+     */
+    JSValue wrapNode(JSContext* ctx, DomNode* node);            // nullptr → null
+    JSValue wrapNodes(JSContext* ctx, const std::vector<DomNode*>& nodes);
+    DomNode* nodeOf(JSContext* ctx, JSValueConst obj);          // DOM wrapper 가 아니면 nullptr
+
+    /**
+     * html 을 parent 의 자식으로 파싱해 붙이고 새로 연결된 script 를 실행 대기열에 추가
+     * @param origin 대기열에 기록할 삽입 경로 ("document.write", "innerHTML" ...)
+     */
+    void insertHtml(JSContext* ctx, DomNode* parent, const std::string& html, const char* origin);
 }
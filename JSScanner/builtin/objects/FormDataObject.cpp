@@ -24,7 +24,7 @@ namespace FormDataObject {
             JSValue elements = JS_GetPropertyStr(ctx, argv[0], "elements");
             if (JS_IsObject(elements)) {
                 // elements는 HTMLFormElement의 input들
-                JSValue lengthVal = JS_GetPropertyStr(ctx, elements, "length");
+                JSValue lengthVal = JSAtoms::getProperty(ctx, elements, JSAtomId::length);
                 int32_t length = 0;
                 JS_ToInt32(ctx, &length, lengthVal);
                 JS_FreeValue(ctx, lengthVal);
@@ -68,7 +68,7 @@ namespace FormDataObject {
             if (!JS_IsUndefined(existingVal) && !JS_IsNull(existingVal)) {
                 // 이미 배열이면 추가
                 if (JS_IsArray(existingVal) > 0) {
-                    JSValue lengthVal = JS_GetPropertyStr(ctx, existingVal, "length");
+                    JSValue lengthVal = JSAtoms::getProperty(ctx, existingVal, JSAtomId::length);
                     int32_t length = 0;
                     JS_ToInt32(ctx, &length, lengthVal);
                     JS_FreeValue(ctx, lengthVal);
@@ -167,11 +167,14 @@ namespace FormDataObject {
         
         // FormData.prototype 생성
         JSValue formdata_proto = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, formdata_proto, "append", JS_NewCFunction(ctx, js_formdata_append, "append", 2));
-        JS_SetPropertyStr(ctx, formdata_proto, "get", JS_NewCFunction(ctx, js_formdata_get, "get", 1));
-        JS_SetPropertyStr(ctx, formdata_proto, "has", JS_NewCFunction(ctx, js_formdata_has, "has", 1));
-        JS_SetPropertyStr(ctx, formdata_proto, "set", JS_NewCFunction(ctx, js_formdata_set, "set", 2));
-        JS_SetPropertyStr(ctx, formdata_proto, "delete", JS_NewCFunction(ctx, js_formdata_delete, "delete", 1));
+        static const JSCFunctionListEntry formdata_proto_funcs[] = {
+            JS_CFUNC_DEF2("append", 2, js_formdata_append, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("get", 1, js_formdata_get, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("has", 1, js_formdata_has, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("set", 2, js_formdata_set, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("delete", 1, js_formdata_delete, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, formdata_proto, formdata_proto_funcs, sizeof(formdata_proto_funcs) / sizeof(formdata_proto_funcs[0]));
         
         // toString() 메서드 추가 - fetch의 body로 사용될 때 호출됨
         JS_SetPropertyStr(ctx, formdata_proto, "toString", JS_NewCFunction(ctx, 
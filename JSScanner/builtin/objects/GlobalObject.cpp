@@ -31,10 +31,8 @@ namespace GlobalObject {
         }
 
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
-        
-        // 함수 호출 카운터 증가
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->incrementFunctionCallCount();
+        if (a_ctx) {
+            a_ctx->admitCall(HookApiId::EVAL);  // eval 은 제한 없이 항상 기록
         }
 
         bool isString = JS_IsString(argv[0]);
@@ -54,7 +52,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "eval", {JsValue(evalCode)}, JsValue(std::monostate()), {}, 10});
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 10, [&] {
+                return HookPayload{"eval", {JsValue(evalCode)}, JsValue(std::monostate()), {}};
+            });
         }
 
         if (a_ctx && a_ctx->chainTrackerManager) {
@@ -83,11 +83,6 @@ namespace GlobalObject {
     JSValue js_atob(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         
-        // 함수 호출 카운터 증가
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->incrementFunctionCallCount();
-        }
-        
         if (argc < 1) return JS_NewString(ctx, "");
 
         const char* encoded_str_cstr = JS_ToCString(ctx, argv[0]);
@@ -98,37 +93,12 @@ namespace GlobalObject {
 
         std::string decoded_string = Base64Utils::decode(encoded_str);
 
-        // 🔥 호출 횟수 제한 체크
-        if (a_ctx) {
-            a_ctx->functionCallCounts["atob"]++;
-
-            int callCount = a_ctx->functionCallCounts["atob"];
-
-            // 제한 초과 시 경고
-            if (callCount > JSAnalyzerContext::MAX_FUNCTION_CALLS) {
-                if (callCount == JSAnalyzerContext::MAX_FUNCTION_CALLS + 1) {
-                    core::Log_Warn("JS Scanner - atob exceeded %s" ,std::to_string(JSAnalyzerContext::MAX_FUNCTION_CALLS) +
-                                 " calls - further calls will be ignored to prevent DoS");
-
-                    if (a_ctx->dynamicAnalyzer) {
-                        a_ctx->dynamicAnalyzer->recordEvent({
-                            HookType::CRYPTO_OPERATION,
-                            "atob",
-                            {JsValue("[LIMIT_EXCEEDED]")},
-                            JsValue("Analysis limit exceeded - function called too many times"),
-                            {},
-                            9
-                        });
-                    }
-                    a_ctx->analysisLimitExceeded = true;
-                }
-                return JS_NewString(ctx, decoded_string.c_str());
-            }
+        // 🔥 호출 횟수 제한 / 샘플링 (HOOK_API_POLICIES)
+        if (a_ctx && !a_ctx->admitCall(HookApiId::ATOB)) {
+            return JS_NewString(ctx, decoded_string.c_str());
         }
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "atob", {JsValue(encoded_str)}, JsValue(decoded_string), {}, 6});
-        }
+        JSValue result = JS_NewString(ctx, decoded_string.c_str());
 
         if (a_ctx && a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("atob", {JsValue(encoded_str)}, JsValue(decoded_string));
@@ -138,7 +108,14 @@ namespace GlobalObject {
             a_ctx->dynamicStringTracker->trackString("_atob_result", decoded_string);
         }
 
-        return JS_NewString(ctx, decoded_string.c_str());
+        // 마지막 사용처이므로 payload 로 이동
+        if (a_ctx && a_ctx->dynamicAnalyzer) {
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 6, [&] {
+                return HookPayload{"atob", {JsValue(std::move(encoded_str))}, JsValue(std::move(decoded_string)), {}};
+            });
+        }
+
+        return result;
     }
 
     // 🔥 setTimeout 재귀 깊이 제어
@@ -148,10 +125,11 @@ namespace GlobalObject {
     JSValue js_setTimeout(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (argc < 1) return JS_NewInt32(ctx, 0);
+        bool admitted = a_ctx && a_ctx->admitCall(HookApiId::SET_TIMEOUT);
 
         // 🔥 재귀 깊이 체크
         if (g_setTimeout_depth >= MAX_SETTIMEOUT_DEPTH) {
-            core::Log_Warn("[GlobalObject] setTimeout recursion limit reached: %d", g_setTimeout_depth);
+            SCAN_LOG_WARN("[GlobalObject] setTimeout recursion limit reached: %d", g_setTimeout_depth);
             if (a_ctx && a_ctx->findings) {
                 a_ctx->findings->push_back({
                     8, 
@@ -196,11 +174,13 @@ namespace GlobalObject {
         // 🔥 재귀 깊이 감소
         g_setTimeout_depth--;
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "setTimeout", {}, JsValue(std::monostate()), {}, 4});
+        if (admitted && a_ctx->dynamicAnalyzer) {
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 4, [&] {
+                return HookPayload{"setTimeout", {}, JsValue(std::monostate()), {}};
+            });
         }
         
-        if (a_ctx && a_ctx->chainTrackerManager) {
+        if (admitted && a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("setTimeout", {}, JsValue(std::monostate()));
         }
         
@@ -214,10 +194,11 @@ namespace GlobalObject {
     JSValue js_setInterval(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         if (argc < 1) return JS_NewInt32(ctx, 0);
+        bool admitted = a_ctx && a_ctx->admitCall(HookApiId::SET_INTERVAL);
 
         // 🔥 재귀 깊이 체크
         if (g_setInterval_depth >= MAX_SETINTERVAL_DEPTH) {
-            core::Log_Warn("[GlobalObject] setInterval recursion limit reached: %d", g_setInterval_depth);
+            SCAN_LOG_WARN("[GlobalObject] setInterval recursion limit reached: %d", g_setInterval_depth);
             if (a_ctx && a_ctx->findings) {
                 a_ctx->findings->push_back({
                     8,
@@ -263,11 +244,13 @@ namespace GlobalObject {
         // 🔥 재귀 깊이 감소
         g_setInterval_depth--;
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "setInterval", {}, JsValue(std::monostate()), {}, 4});
+        if (admitted && a_ctx->dynamicAnalyzer) {
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 4, [&] {
+                return HookPayload{"setInterval", {}, JsValue(std::monostate()), {}};
+            });
         }
 
-        if (a_ctx && a_ctx->chainTrackerManager) {
+        if (admitted && a_ctx->chainTrackerManager) {
             a_ctx->chainTrackerManager->trackFunctionCall("setInterval", {}, JsValue(std::monostate()));
         }
 
@@ -281,7 +264,9 @@ namespace GlobalObject {
         // 에러 방지를 위해 존재만 함
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "clearTimeout", {}, JsValue(std::monostate()), {}, 2});
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 2, [&] {
+                return HookPayload{"clearTimeout", {}, JsValue(std::monostate()), {}};
+            });
         }
 
         if (a_ctx && a_ctx->chainTrackerManager) {
@@ -298,7 +283,9 @@ namespace GlobalObject {
         // 에러 방지를 위해 존재만 함
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "clearInterval", {}, JsValue(std::monostate()), {}, 2});
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 2, [&] {
+                return HookPayload{"clearInterval", {}, JsValue(std::monostate()), {}};
+            });
         }
 
         if (a_ctx && a_ctx->chainTrackerManager) {
@@ -369,6 +356,10 @@ namespace GlobalObject {
         // Simple escape implementation (encode special chars as %XX)
         std::string encoded_string = urlEncode(input_str, false);
 
+        if (a_ctx && !a_ctx->admitCall(HookApiId::ESCAPE)) {
+            return JS_NewString(ctx, encoded_string.c_str());
+        }
+
         // Taint tracking
         if (a_ctx && a_ctx->chainTrackerManager) {
             TaintTracker* taintTracker = a_ctx->chainTrackerManager->getTaintTracker();
@@ -384,7 +375,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "escape", {JsValue(input_str)}, JsValue(encoded_string), {}, 5});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 5, [&] {
+                return HookPayload{"escape", {JsValue(input_str)}, JsValue(encoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, encoded_string.c_str());
@@ -402,6 +395,10 @@ namespace GlobalObject {
 
         std::string decoded_string = urlDecode(encoded_str);
 
+        if (a_ctx && !a_ctx->admitCall(HookApiId::UNESCAPE)) {
+            return JS_NewString(ctx, decoded_string.c_str());
+        }
+
         // Taint tracking
         if (a_ctx && a_ctx->chainTrackerManager) {
             TaintTracker* taintTracker = a_ctx->chainTrackerManager->getTaintTracker();
@@ -417,7 +414,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "unescape", {JsValue(encoded_str)}, JsValue(decoded_string), {}, 6});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 6, [&] {
+                return HookPayload{"unescape", {JsValue(encoded_str)}, JsValue(decoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, decoded_string.c_str());
@@ -450,7 +449,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "encodeURI", {JsValue(input_str)}, JsValue(encoded_string), {}, 5});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 5, [&] {
+                return HookPayload{"encodeURI", {JsValue(input_str)}, JsValue(encoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, encoded_string.c_str());
@@ -483,7 +484,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "decodeURI", {JsValue(encoded_str)}, JsValue(decoded_string), {}, 6});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 6, [&] {
+                return HookPayload{"decodeURI", {JsValue(encoded_str)}, JsValue(decoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, decoded_string.c_str());
@@ -516,7 +519,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "encodeURIComponent", {JsValue(input_str)}, JsValue(encoded_string), {}, 5});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 5, [&] {
+                return HookPayload{"encodeURIComponent", {JsValue(input_str)}, JsValue(encoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, encoded_string.c_str());
@@ -549,7 +554,9 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "decodeURIComponent", {JsValue(encoded_str)}, JsValue(decoded_string), {}, 6});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 6, [&] {
+                return HookPayload{"decodeURIComponent", {JsValue(encoded_str)}, JsValue(decoded_string), {}};
+            });
         }
 
         return JS_NewString(ctx, decoded_string.c_str());
@@ -593,19 +600,92 @@ namespace GlobalObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer && radix != 10) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::CRYPTO_OPERATION, "parseInt", {JsValue(str), JsValue(static_cast<double>(radix))}, JsValue(static_cast<double>(result)), {}, 4});
+            a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 4, [&] {
+                return HookPayload{"parseInt", {JsValue(str), JsValue(static_cast<double>(radix))}, JsValue(static_cast<double>(result)), {}};
+            });
         }
 
         return JS_NewInt32(ctx, result);
     }
 
+    // 🔥 불러온 스크립트 중첩 깊이 제어 (자기 자신을 importScripts / $.getScript 하는 스크립트)
+    static thread_local int g_loadedScript_depth = 0;
+    static const int MAX_LOADED_SCRIPT_DEPTH = 32;
+
+    JSValue evalLoadedScript(JSContext* ctx, const std::string& url, const std::string& code) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+
+        if (g_loadedScript_depth >= MAX_LOADED_SCRIPT_DEPTH) {
+            SCAN_LOG_WARN("[GlobalObject] Loaded script nesting limit reached: %d (%s)", g_loadedScript_depth, url.c_str());
+            if (a_ctx && a_ctx->findings) {
+                a_ctx->findings->push_back({
+                    8,
+                    "Excessive script loading recursion detected (limit: " + std::to_string(MAX_LOADED_SCRIPT_DEPTH) + ")",
+                    "loaded_script_recursion_limit"
+                });
+            }
+            return JS_ThrowRangeError(ctx, "Maximum loaded script nesting depth exceeded");
+        }
+
+        if (a_ctx && a_ctx->dynamicStringTracker) {
+            a_ctx->dynamicStringTracker->trackString("script:" + url, code);
+        }
+        const char* filename = url.empty() ? "<loaded-script>" : url.c_str();
+        g_loadedScript_depth++;
+        JSValue result = JS_Eval(ctx, code.c_str(), code.length(), filename, JS_EVAL_TYPE_GLOBAL);
+        g_loadedScript_depth--;
+        return result;
+    }
+
+    // 🔥 importScripts(url...) - 저장된 응답이 있는 URL 만 순서대로 실행
+    JSValue js_importScripts(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+
+        // 한도에 닿은 뒤의 호출은 URL 기록 / 응답 조회 없이 중단 (evalLoadedScript 와 같은 한도)
+        if (g_loadedScript_depth >= MAX_LOADED_SCRIPT_DEPTH) {
+            return JS_ThrowRangeError(ctx, "Maximum loaded script nesting depth exceeded");
+        }
+
+        for (int i = 0; i < argc; i++) {
+            std::string url = JSValueConverter::toString(ctx, argv[i]);
+
+            if (a_ctx && a_ctx->urlCollector) {
+                a_ctx->urlCollector->addUrlWithMetadata(url, "importScripts", 0);
+            }
+            if (a_ctx && a_ctx->dynamicAnalyzer) {
+                a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 8, [&] {
+                    return HookPayload{"importScripts", {JsValue(url)}, JsValue(std::monostate()), {{"url", JsValue(url)}}};
+                });
+            }
+
+            std::optional<ResponseCorpus::Response> stored;
+            if (a_ctx) {
+                stored = a_ctx->serveStoredResponse("importScripts", "GET", url);
+            }
+            if (!stored) {
+                continue;
+            }
+
+            JSValue result = evalLoadedScript(ctx, url, stored->body);
+            if (JS_IsException(result)) {
+                return JS_EXCEPTION;
+            }
+            JS_FreeValue(ctx, result);
+        }
+        return JS_UNDEFINED;
+    }
+
     void registerGlobalFunctions(JSContext* ctx, JSValue global_obj) {
-        JS_SetPropertyStr(ctx, global_obj, "print", JS_NewCFunction(ctx, js_print, "print", 1));
-        JS_SetPropertyStr(ctx, global_obj, "eval", JS_NewCFunction(ctx, js_eval_hook, "eval", 1));
-        JS_SetPropertyStr(ctx, global_obj, "atob", JS_NewCFunction(ctx, js_atob, "atob", 1));
-        JS_SetPropertyStr(ctx, global_obj, "setTimeout", JS_NewCFunction(ctx, js_setTimeout, "setTimeout", 1));
-        JS_SetPropertyStr(ctx, global_obj, "setInterval", JS_NewCFunction(ctx, js_setInterval, "setInterval", 1));
-        JS_SetPropertyStr(ctx, global_obj, "clearTimeout", JS_NewCFunction(ctx, js_clearTimeout, "clearTimeout", 1));
-        JS_SetPropertyStr(ctx, global_obj, "clearInterval", JS_NewCFunction(ctx, js_clearInterval, "clearInterval", 1));
+        static const JSCFunctionListEntry global_funcs[] = {
+            JS_CFUNC_DEF2("print", 1, js_print, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("eval", 1, js_eval_hook, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("atob", 1, js_atob, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("setTimeout", 1, js_setTimeout, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("setInterval", 1, js_setInterval, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("clearTimeout", 1, js_clearTimeout, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("clearInterval", 1, js_clearInterval, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("importScripts", 1, js_importScripts, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, global_obj, global_funcs, sizeof(global_funcs) / sizeof(global_funcs[0]));
     }
 }
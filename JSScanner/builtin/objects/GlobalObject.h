@@ -1,8 +1,9 @@
 #pragma once
 #include "../../quickjs.h"
+#include <string>
 
 /**
- * Global 객체의 함수들 (print, eval, atob, setTimeout, setInterval, clearTimeout, clearInterval)
+ * Global 객체의 함수들 (print, eval, atob, setTimeout, setInterval, clearTimeout, clearInterval, importScripts)
  */
 namespace GlobalObject {
     /**
@@ -20,4 +21,14 @@ namespace GlobalObject {
     JSValue js_setInterval(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_clearTimeout(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_clearInterval(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    JSValue js_importScripts(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+    /**
+     * 오프라인 응답 저장소에서 받은 다음 단계 스크립트를 전역 범위에서 실행
+     * (importScripts, $.getScript, $.ajax dataType "script" 공용)
+     * @param url 스크립트 URL (스택 trace 의 파일 이름으로 사용)
+     * @param code 스크립트 본문
+     * @return 실행 결과 (예외 시 JS_EXCEPTION)
+     */
+    JSValue evalLoadedScript(JSContext* ctx, const std::string& url, const std::string& code);
 }
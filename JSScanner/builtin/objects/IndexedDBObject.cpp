@@ -10,6 +10,84 @@ static JSAnalyzerContext* get_analyzer_context(JSContext* ctx) {
     return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
 }
 
+// 🔥 레코드는 JSAnalyzerContext::storage 에 "db \x1f store \x1f key" 로 저장
+// database / objectStore 객체는 이름만 숨은 property 로 가짐
+static std::string get_hidden_string(JSContext* ctx, JSValueConst obj, const char* name) {
+    JSValue value = JS_GetPropertyStr(ctx, obj, name);
+    const char* str = JS_IsString(value) ? JS_ToCString(ctx, value) : nullptr;
+    std::string out = str ? str : "";
+    if (str) JS_FreeCString(ctx, str);
+    JS_FreeValue(ctx, value);
+    return out;
+}
+
+static std::string to_std_string(JSContext* ctx, JSValueConst value) {
+    const char* str = JS_ToCString(ctx, value);
+    std::string out = str ? str : "";
+    if (str) {
+        JS_FreeCString(ctx, str);
+    } else {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    return out;
+}
+
+// 값은 JSON 으로 저장 (get 에서 같은 모양으로 복원)
+static std::string serialize_value(JSContext* ctx, JSValueConst value) {
+    JSValue json = JS_JSONStringify(ctx, value, JS_UNDEFINED, JS_UNDEFINED);
+    if (JS_IsException(json)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return to_std_string(ctx, value);
+    }
+    std::string out = JS_IsString(json) ? to_std_string(ctx, json) : "null";
+    JS_FreeValue(ctx, json);
+    return out;
+}
+
+// 명시한 key > value.id (흔한 keyPath) > 자동 증가
+static std::string record_key(JSContext* ctx, JSAnalyzerContext* a_ctx, int argc, JSValueConst* argv) {
+    if (argc > 1 && !JS_IsUndefined(argv[1])) {
+        return to_std_string(ctx, argv[1]);
+    }
+    if (JS_IsObject(argv[0])) {
+        JSValue id = JS_GetPropertyStr(ctx, argv[0], "id");
+        bool hasId = !JS_IsUndefined(id) && !JS_IsNull(id) && !JS_IsException(id);
+        std::string key = hasId ? to_std_string(ctx, id) : std::string();
+        JS_FreeValue(ctx, id);
+        if (hasId) return key;
+    }
+    return std::to_string(a_ctx ? a_ctx->storage.nextIndexedDbId() : 0);
+}
+
+static std::string store_record_key(JSContext* ctx, JSValueConst store, const std::string& key) {
+    return BrowserStorage::indexedDbKey(get_hidden_string(ctx, store, "__idbDatabase"),
+                                        get_hidden_string(ctx, store, "__idbStore"), key);
+}
+
+// 동기 mock IDBRequest (결과는 즉시 채움)
+static JSValue make_request(JSContext* ctx, JSValue result) {
+    JSValue request = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, request, "result", result);
+    JS_SetPropertyStr(ctx, request, "readyState", JS_NewString(ctx, "done"));
+    return request;
+}
+
+static JSValue make_object_store(JSContext* ctx, const std::string& database, const std::string& store) {
+    JSValue obj = JS_NewObject(ctx);
+    JS_DefinePropertyValueStr(ctx, obj, "__idbDatabase", JS_NewString(ctx, database.c_str()), 0);
+    JS_DefinePropertyValueStr(ctx, obj, "__idbStore", JS_NewString(ctx, store.c_str()), 0);
+    JS_SetPropertyStr(ctx, obj, "name", JS_NewString(ctx, store.c_str()));
+    JS_SetPropertyStr(ctx, obj, "add", 
+        JS_NewCFunction(ctx, js_idbobjectstore_add, "add", 2));
+    JS_SetPropertyStr(ctx, obj, "put", 
+        JS_NewCFunction(ctx, js_idbobjectstore_put, "put", 2));
+    JS_SetPropertyStr(ctx, obj, "get", 
+        JS_NewCFunction(ctx, js_idbobjectstore_get, "get", 1));
+    JS_SetPropertyStr(ctx, obj, "delete", 
+        JS_NewCFunction(ctx, js_idbobjectstore_delete, "delete", 1));
+    return obj;
+}
+
 void registerIndexedDBObject(JSContext* ctx, JSValue global_obj) {
     // Create indexedDB object
     JSValue indexedDB = JS_NewObject(ctx);
@@ -30,83 +108,80 @@ JSValue js_indexeddb_open(JSContext* ctx, JSValueConst this_val,
 
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::INDEXEDDB_OPEN;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "IndexedDB opened - potential persistent storage";
-
-        event.features["database_name"] = name;
-        event.features["version"] = version;
-        event.tags.insert("storage");
-        event.tags.insert("persistence");
-        event.tags.insert("indexeddb");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::INDEXEDDB_OPEN, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "IndexedDB opened - potential persistent storage";
+
+            event.features["database_name"] = name;
+            event.features["version"] = version;
+            event.tags.insert("storage");
+            event.tags.insert("persistence");
+            event.tags.insert("indexeddb");
+            return event;
+        });
     }
 
     if (db_name) JS_FreeCString(ctx, db_name);
 
     // Return mock IDBOpenDBRequest
-    JSValue request = JS_NewObject(ctx);
-    
-    // Add transaction method
     JSValue db = JS_NewObject(ctx);
+    JS_DefinePropertyValueStr(ctx, db, "__idbDatabase", JS_NewString(ctx, name.c_str()), 0);
+    JS_SetPropertyStr(ctx, db, "name", JS_NewString(ctx, name.c_str()));
     JS_SetPropertyStr(ctx, db, "transaction", 
         JS_NewCFunction(ctx, js_idbdatabase_transaction, "transaction", 2));
+    JS_SetPropertyStr(ctx, db, "createObjectStore", 
+        JS_NewCFunction(ctx, js_idbdatabase_createObjectStore, "createObjectStore", 2));
     
     // Simulate async success
-    JS_SetPropertyStr(ctx, request, "result", db);
-    JS_SetPropertyStr(ctx, request, "readyState", JS_NewString(ctx, "done"));
-    
-    return request;
+    return make_request(ctx, db);
 }
 
 JSValue js_idbdatabase_transaction(JSContext* ctx, JSValueConst this_val,
                                   int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::INDEXEDDB_TRANSACTION;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "IndexedDB transaction started";
-        event.tags.insert("storage");
-        event.tags.insert("indexeddb");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::INDEXEDDB_TRANSACTION, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "IndexedDB transaction started";
+            event.tags.insert("storage");
+            event.tags.insert("indexeddb");
+            return event;
+        });
     }
 
     JSValue transaction = JS_NewObject(ctx);
-    JSValue objectStore = JS_NewObject(ctx);
-    
-    JS_SetPropertyStr(ctx, objectStore, "add", 
-        JS_NewCFunction(ctx, js_idbobjectstore_add, "add", 2));
-    JS_SetPropertyStr(ctx, objectStore, "put", 
-        JS_NewCFunction(ctx, js_idbobjectstore_put, "put", 2));
-    
+    JS_DefinePropertyValueStr(ctx, transaction, "__idbDatabase",
+        JS_NewString(ctx, get_hidden_string(ctx, this_val, "__idbDatabase").c_str()), 0);
     JS_SetPropertyStr(ctx, transaction, "objectStore", 
-        JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, 
-                                int argc, JSValueConst* argv) -> JSValue {
-            JSValue store = JS_NewObject(ctx);
-            JS_SetPropertyStr(ctx, store, "add", 
-                JS_NewCFunction(ctx, js_idbobjectstore_add, "add", 2));
-            JS_SetPropertyStr(ctx, store, "put", 
-                JS_NewCFunction(ctx, js_idbobjectstore_put, "put", 2));
-            return store;
-        }, "objectStore", 1));
+        JS_NewCFunction(ctx, js_idbtransaction_objectStore, "objectStore", 1));
     
     return transaction;
 }
 
+JSValue js_idbdatabase_createObjectStore(JSContext* ctx, JSValueConst this_val,
+                                        int argc, JSValueConst* argv) {
+    std::string store = argc > 0 ? to_std_string(ctx, argv[0]) : std::string();
+    return make_object_store(ctx, get_hidden_string(ctx, this_val, "__idbDatabase"), store);
+}
+
+JSValue js_idbtransaction_objectStore(JSContext* ctx, JSValueConst this_val,
+                                     int argc, JSValueConst* argv) {
+    std::string store = argc > 0 ? to_std_string(ctx, argv[0]) : std::string();
+    return make_object_store(ctx, get_hidden_string(ctx, this_val, "__idbDatabase"), store);
+}
+
 JSValue js_idbobjectstore_add(JSContext* ctx, JSValueConst this_val, 
                               int argc, JSValueConst* argv) {
     if (argc < 1) return JS_UNDEFINED;
 
-    const char* value = JS_ToCString(ctx, argv[0]);
-    std::string val_str = value ? value : "";
+    std::string val_str = serialize_value(ctx, argv[0]);
 
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    std::string key = record_key(ctx, a_ctx, argc, argv);
+    bool stored = !a_ctx || a_ctx->storage.indexedDb().set(store_record_key(ctx, this_val, key), val_str);
+
     if (a_ctx && a_ctx->dynamicAnalyzer) {
         HookEvent event;
         event.hookType = HookType::INDEXEDDB_ADD;
@@ -127,14 +202,45 @@ JSValue js_idbobjectstore_add(JSContext* ctx, JSValueConst this_val,
         event.features["value"] = val_str.length() > 200 ?
             val_str.substr(0, 200) + "..." : val_str;
         event.features["data_size"] = static_cast<double>(val_str.length());
+        event.features["key"] = key;
+        if (!stored) {
+            event.features["quota_exceeded"] = true;
+        }
         event.tags.insert("storage");
         event.tags.insert("indexeddb");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
-    if (value) JS_FreeCString(ctx, value);
-    return JS_NewObject(ctx);
+    return make_request(ctx, JS_NewString(ctx, key.c_str()));
+}
+
+JSValue js_idbobjectstore_get(JSContext* ctx, JSValueConst this_val,
+                              int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    const std::string* stored = nullptr;
+    if (a_ctx && argc > 0) {
+        stored = a_ctx->storage.indexedDb().get(store_record_key(ctx, this_val, to_std_string(ctx, argv[0])));
+    }
+    if (!stored) {
+        return make_request(ctx, JS_UNDEFINED);
+    }
+
+    JSValue result = JS_ParseJSON(ctx, stored->c_str(), stored->size(), "<indexedDB>");
+    if (JS_IsException(result)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        result = JS_NewStringLen(ctx, stored->data(), stored->size());
+    }
+    return make_request(ctx, result);
+}
+
+JSValue js_idbobjectstore_delete(JSContext* ctx, JSValueConst this_val,
+                                 int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx && argc > 0) {
+        a_ctx->storage.indexedDb().remove(store_record_key(ctx, this_val, to_std_string(ctx, argv[0])));
+    }
+    return make_request(ctx, JS_UNDEFINED);
 }
 
 JSValue js_idbobjectstore_put(JSContext* ctx, JSValueConst this_val, 
@@ -22,12 +22,20 @@ namespace IndexedDBObject {
     JSValue js_indexeddb_open(JSContext* ctx, JSValueConst this_val, 
                              int argc, JSValueConst* argv);
 
-    // IDBDatabase methods (stub implementations)
+    // IDBDatabase / IDBObjectStore (레코드는 Task 컨텍스트 저장소에 보관)
     JSValue js_idbdatabase_transaction(JSContext* ctx, JSValueConst this_val, 
                                       int argc, JSValueConst* argv);
     JSValue js_idbobjectstore_add(JSContext* ctx, JSValueConst this_val, 
                                   int argc, JSValueConst* argv);
     JSValue js_idbobjectstore_put(JSContext* ctx, JSValueConst this_val, 
                                   int argc, JSValueConst* argv);
+    JSValue js_idbobjectstore_get(JSContext* ctx, JSValueConst this_val, 
+                                  int argc, JSValueConst* argv);
+    JSValue js_idbobjectstore_delete(JSContext* ctx, JSValueConst this_val, 
+                                     int argc, JSValueConst* argv);
+    JSValue js_idbdatabase_createObjectStore(JSContext* ctx, JSValueConst this_val, 
+                                            int argc, JSValueConst* argv);
+    JSValue js_idbtransaction_objectStore(JSContext* ctx, JSValueConst this_val, 
+                                         int argc, JSValueConst* argv);
 
 } // namespace IndexedDBObject
@@ -4,6 +4,7 @@
 #include "../../model/JsValueVariant.h"
 #include "../../core/JSAnalyzer.h"
 #include "../../hooks/HookType.h"
+#include "GlobalObject.h"
 
 namespace JQueryObject {
     // Forward declaration
@@ -15,6 +16,44 @@ namespace JQueryObject {
 
     // ==================== AJAX 메서드 ====================
 
+    // 저장된 응답 본문을 then(cb) / done(cb) 콜백에 전달 (func_data[0] = 본문)
+    static JSValue js_ajax_stored_then(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv,
+        int magic, JSValueConst* func_data) {
+        if (argc >= 1 && JS_IsFunction(ctx, argv[0])) {
+            JSValue ret = JS_Call(ctx, argv[0], JS_UNDEFINED, 1, func_data);
+            if (JS_IsException(ret)) {
+                return ret;
+            }
+            JS_FreeValue(ctx, ret);
+        }
+        return JS_DupValue(ctx, this_val);
+    }
+
+    // 🔥 오프라인 응답 저장소에서 받은 응답의 jqXHR 흉내 객체
+    static JSValue createStoredAjaxResult(JSContext* ctx, const std::string& body) {
+        JSValue result = JS_NewObject(ctx);
+        JSValue data = JS_NewStringLen(ctx, body.data(), body.size());
+        JSValue then_func = JS_NewCFunctionData(ctx, js_ajax_stored_then, 1, 0, 1, &data);
+        JS_SetPropertyStr(ctx, result, "responseText", data);
+        JS_SetPropertyStr(ctx, result, "done", JS_DupValue(ctx, then_func));
+        JSAtoms::setProperty(ctx, result, JSAtomId::then, then_func);
+        return result;
+    }
+
+    // success(data, "success") 호출 (콜백이 아니면 무시)
+    static bool callAjaxSuccess(JSContext* ctx, JSValueConst callback, const std::string& body) {
+        if (!JS_IsFunction(ctx, callback)) {
+            return true;
+        }
+        JSValue args[2] = { JS_NewStringLen(ctx, body.data(), body.size()), JS_NewString(ctx, "success") };
+        JSValue ret = JS_Call(ctx, callback, JS_UNDEFINED, 2, args);
+        JS_FreeValue(ctx, args[0]);
+        JS_FreeValue(ctx, args[1]);
+        bool ok = !JS_IsException(ret);
+        JS_FreeValue(ctx, ret);
+        return ok;
+    }
+
     JSValue js_ajax(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
 
@@ -53,22 +92,48 @@ namespace JQueryObject {
                 metadata["body"] = JsValue(data);
             }
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.ajax",
-                { JsValue(url), JsValue(method) },
-                JsValue(std::monostate()),
-                metadata,
-                5
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 5, [&] {
+                return HookPayload{
+                    "$.ajax",
+                    { JsValue(url), JsValue(method) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
+        // 🔥 저장된 응답이 있으면 dataType "script" 실행 → success → then 순서로 본문 전달
+        std::optional<ResponseCorpus::Response> stored;
+        if (a_ctx && !url.empty()) {
+            stored = a_ctx->serveStoredResponse("$.ajax", method, url);
+        }
+        if (stored) {
+            JSValue data_type_val = JS_GetPropertyStr(ctx, argv[0], "dataType");
+            bool isScript = JSValueConverter::toString(ctx, data_type_val) == "script";
+            JS_FreeValue(ctx, data_type_val);
+            if (isScript) {
+                JSValue ret = GlobalObject::evalLoadedScript(ctx, url, stored->body);
+                if (JS_IsException(ret)) {
+                    return ret;
+                }
+                JS_FreeValue(ctx, ret);
+            }
+
+            JSValue success_val = JS_GetPropertyStr(ctx, argv[0], "success");
+            bool ok = callAjaxSuccess(ctx, success_val, stored->body);
+            JS_FreeValue(ctx, success_val);
+            if (!ok) {
+                return JS_EXCEPTION;
+            }
+            return createStoredAjaxResult(ctx, stored->body);
+        }
+
         // Mock Promise 반환
         JSValue promise = JS_NewObject(ctx);
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -82,13 +147,13 @@ namespace JQueryObject {
             metadata["url"] = JsValue(url);
             metadata["method"] = JsValue("GET");
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.get",
-                { JsValue(url) },
-                JsValue(std::monostate()),
-                metadata,
-                4
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 4, [&] {
+                return HookPayload{
+                    "$.get",
+                    { JsValue(url) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
@@ -96,7 +161,7 @@ namespace JQueryObject {
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -114,13 +179,13 @@ namespace JQueryObject {
                 metadata["body"] = JsValue(data);
             }
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.post",
-                { JsValue(url), JsValue(data) },
-                JsValue(std::monostate()),
-                metadata,
-                5
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 5, [&] {
+                return HookPayload{
+                    "$.post",
+                    { JsValue(url), JsValue(data) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
@@ -128,7 +193,7 @@ namespace JQueryObject {
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -166,13 +231,13 @@ namespace JQueryObject {
                     metadata["contains_url"] = JsValue("true");
                 }
                 
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.html",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    metadata,
-                    severity
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                    return HookPayload{
+                        "$.html",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        metadata
+                    };
                 });
             }
         }
@@ -209,13 +274,13 @@ namespace JQueryObject {
                     severity += 1;
                 }
                 
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.append",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    metadata,
-                    severity
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, severity, [&] {
+                    return HookPayload{
+                        "$.append",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        metadata
+                    };
                 });
             }
         }
@@ -230,13 +295,13 @@ namespace JQueryObject {
             std::string content = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.text",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    {},
-                    3
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 3, [&] {
+                    return HookPayload{
+                        "$.text",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
         }
@@ -248,13 +313,13 @@ namespace JQueryObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::DOM_MANIPULATION,
-                "$.remove",
-                {},
-                JsValue(std::monostate()),
-                {},
-                4
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 4, [&] {
+                return HookPayload{
+                    "$.remove",
+                    {},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -268,13 +333,13 @@ namespace JQueryObject {
             std::string content = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.prepend",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    {},
-                    6
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 6, [&] {
+                    return HookPayload{
+                        "$.prepend",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
         }
@@ -289,13 +354,13 @@ namespace JQueryObject {
             std::string content = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.after",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    {},
-                    5
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 5, [&] {
+                    return HookPayload{
+                        "$.after",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
         }
@@ -310,13 +375,13 @@ namespace JQueryObject {
             std::string content = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.before",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    {},
-                    5
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 5, [&] {
+                    return HookPayload{
+                        "$.before",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
         }
@@ -331,13 +396,13 @@ namespace JQueryObject {
             std::string content = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.replaceWith",
-                    { JsValue(content) },
-                    JsValue(std::monostate()),
-                    {},
-                    6
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 6, [&] {
+                    return HookPayload{
+                        "$.replaceWith",
+                        { JsValue(content) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
         }
@@ -361,13 +426,13 @@ namespace JQueryObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::DOM_MANIPULATION,
-                "$.empty",
-                {},
-                JsValue(std::monostate()),
-                {},
-                3
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 3, [&] {
+                return HookPayload{
+                    "$.empty",
+                    {},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -406,13 +471,13 @@ namespace JQueryObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FUNCTION_CALL,
-                "$.on",
-                { JsValue(eventName) },
-                JsValue(std::monostate()),
-                {},
-                2
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 2, [&] {
+                return HookPayload{
+                    "$.on",
+                    { JsValue(eventName) },
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -443,13 +508,13 @@ namespace JQueryObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FUNCTION_CALL,
-                "$.click",
-                {},
-                JsValue(std::monostate()),
-                {},
-                2
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 2, [&] {
+                return HookPayload{
+                    "$.click",
+                    {},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -464,13 +529,13 @@ namespace JQueryObject {
         // 분석 목적으로는 콜백이 등록되었다는 사실만 기록하면 충분
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FUNCTION_CALL,
-                "$.ready",
-                {},
-                JsValue(std::monostate()),
-                {},
-                1
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 1, [&] {
+                return HookPayload{
+                    "$.ready",
+                    {},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -529,13 +594,13 @@ namespace JQueryObject {
             std::string value = JSValueConverter::toString(ctx, argv[0]);
 
             if (a_ctx && a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({
-                    HookType::DOM_MANIPULATION,
-                    "$.val",
-                    { JsValue(value) },
-                    JsValue(std::monostate()),
-                    {},
-                    3
+                a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 3, [&] {
+                    return HookPayload{
+                        "$.val",
+                        { JsValue(value) },
+                        JsValue(std::monostate()),
+                        {}
+                    };
                 });
             }
             return JS_DupValue(ctx, this_val);
@@ -823,13 +888,13 @@ namespace JQueryObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FUNCTION_CALL,
-                "$.serialize",
-                {},
-                JsValue("serialized_data"),
-                {},
-                4
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 4, [&] {
+                return HookPayload{
+                    "$.serialize",
+                    {},
+                    JsValue("serialized_data"),
+                    {}
+                };
             });
         }
 
@@ -863,13 +928,13 @@ namespace JQueryObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FUNCTION_CALL,
-                "$.submit",
-                {},
-                JsValue(std::monostate()),
-                {},
-                3
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 3, [&] {
+                return HookPayload{
+                    "$.submit",
+                    {},
+                    JsValue(std::monostate()),
+                    {}
+                };
             });
         }
 
@@ -888,13 +953,13 @@ namespace JQueryObject {
             metadata["url"] = JsValue(url);
             metadata["method"] = JsValue("GET");
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.load",
-                { JsValue(url) },
-                JsValue(std::monostate()),
-                metadata,
-                5
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 5, [&] {
+                return HookPayload{
+                    "$.load",
+                    { JsValue(url) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
@@ -911,13 +976,13 @@ namespace JQueryObject {
             metadata["url"] = JsValue(url);
             metadata["method"] = JsValue("GET");
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.getJSON",
-                { JsValue(url) },
-                JsValue(std::monostate()),
-                metadata,
-                4
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 4, [&] {
+                return HookPayload{
+                    "$.getJSON",
+                    { JsValue(url) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
@@ -925,7 +990,7 @@ namespace JQueryObject {
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -939,21 +1004,38 @@ namespace JQueryObject {
             metadata["url"] = JsValue(url);
             metadata["method"] = JsValue("GET");
 
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::FETCH_REQUEST,
-                "$.getScript",
-                { JsValue(url) },
-                JsValue(std::monostate()),
-                metadata,
-                8
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, 8, [&] {
+                return HookPayload{
+                    "$.getScript",
+                    { JsValue(url) },
+                    JsValue(std::monostate()),
+                    metadata
+                };
             });
         }
 
+        // 🔥 저장된 응답이 있으면 스크립트 실행 후 callback(data, "success")
+        std::optional<ResponseCorpus::Response> stored;
+        if (a_ctx && !url.empty()) {
+            stored = a_ctx->serveStoredResponse("$.getScript", "GET", url);
+        }
+        if (stored) {
+            JSValue ret = GlobalObject::evalLoadedScript(ctx, url, stored->body);
+            if (JS_IsException(ret)) {
+                return ret;
+            }
+            JS_FreeValue(ctx, ret);
+            if (argc >= 2 && !callAjaxSuccess(ctx, argv[1], stored->body)) {
+                return JS_EXCEPTION;
+            }
+            return createStoredAjaxResult(ctx, stored->body);
+        }
+
         JSValue promise = JS_NewObject(ctx);
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -1405,7 +1487,7 @@ namespace JQueryObject {
         JSValue arr = argv[0];
         JSValue callback = argv[1];
 
-        JSValue len_val = JS_GetPropertyStr(ctx, arr, "length");
+        JSValue len_val = JSAtoms::getProperty(ctx, arr, JSAtomId::length);
         int32_t len;
         if (JS_ToInt32(ctx, &len, len_val) == 0) {
             for (int32_t i = 0; i < len && i < 1000; i++) {  // 최대 1000개
@@ -1548,7 +1630,7 @@ namespace JQueryObject {
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         JS_SetPropertyStr(ctx, promise, "done", JS_DupValue(ctx, then_func));
         JS_SetPropertyStr(ctx, promise, "fail", JS_DupValue(ctx, then_func));
         JS_SetPropertyStr(ctx, promise, "always", JS_DupValue(ctx, then_func));
@@ -1590,7 +1672,7 @@ namespace JQueryObject {
             }
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         JS_SetPropertyStr(ctx, promise, "done", JS_DupValue(ctx, then_func));
         JS_SetPropertyStr(ctx, promise, "fail", JS_DupValue(ctx, then_func));
         return promise;
@@ -1601,7 +1683,7 @@ namespace JQueryObject {
         JSValue then_func = JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
             return this_val;
         }, "then", 1);
-        JS_SetPropertyStr(ctx, promise, "then", then_func);
+        JSAtoms::setProperty(ctx, promise, JSAtomId::then, then_func);
         return promise;
     }
 
@@ -1681,129 +1763,132 @@ namespace JQueryObject {
         JSValue jq_obj = JS_NewObject(ctx);
 
         // selector 저장
-        JS_SetPropertyStr(ctx, jq_obj, "_selector", JS_NewString(ctx, selector));
+        JSAtoms::setProperty(ctx, jq_obj, JSAtomId::_selector, JS_NewString(ctx, selector));
 
         // DOM 조작 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "html", JS_NewCFunction(ctx, js_html, "html", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "append", JS_NewCFunction(ctx, js_append, "append", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "text", JS_NewCFunction(ctx, js_text, "text", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "remove", JS_NewCFunction(ctx, js_remove, "remove", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "prepend", JS_NewCFunction(ctx, js_prepend, "prepend", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "after", JS_NewCFunction(ctx, js_after, "after", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "before", JS_NewCFunction(ctx, js_before, "before", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "replaceWith", JS_NewCFunction(ctx, js_replaceWith, "replaceWith", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "wrap", JS_NewCFunction(ctx, js_wrap, "wrap", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "unwrap", JS_NewCFunction(ctx, js_unwrap, "unwrap", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "clone", JS_NewCFunction(ctx, js_clone, "clone", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "empty", JS_NewCFunction(ctx, js_empty, "empty", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "detach", JS_NewCFunction(ctx, js_detach, "detach", 0));
-
-        // CSS/속성 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "css", JS_NewCFunction(ctx, js_css, "css", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "addClass", JS_NewCFunction(ctx, js_addClass, "addClass", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "removeClass", JS_NewCFunction(ctx, js_removeClass, "removeClass", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "toggleClass", JS_NewCFunction(ctx, js_toggleClass, "toggleClass", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "attr", JS_NewCFunction(ctx, js_attr, "attr", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "prop", JS_NewCFunction(ctx, js_prop, "prop", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "data", JS_NewCFunction(ctx, js_data, "data", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "val", JS_NewCFunction(ctx, js_val, "val", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "hasClass", JS_NewCFunction(ctx, js_hasClass, "hasClass", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "removeAttr", JS_NewCFunction(ctx, js_removeAttr, "removeAttr", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "removeProp", JS_NewCFunction(ctx, js_removeProp, "removeProp", 1));
-
-        // 트래버싱 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "find", JS_NewCFunction(ctx, js_find, "find", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "parent", JS_NewCFunction(ctx, js_parent, "parent", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "parents", JS_NewCFunction(ctx, js_parents, "parents", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "children", JS_NewCFunction(ctx, js_children, "children", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "siblings", JS_NewCFunction(ctx, js_siblings, "siblings", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "next", JS_NewCFunction(ctx, js_next, "next", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "prev", JS_NewCFunction(ctx, js_prev, "prev", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "eq", JS_NewCFunction(ctx, js_eq, "eq", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "first", JS_NewCFunction(ctx, js_first, "first", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "last", JS_NewCFunction(ctx, js_last, "last", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "filter", JS_NewCFunction(ctx, js_filter, "filter", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "closest", JS_NewCFunction(ctx, js_closest, "closest", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "nextAll", JS_NewCFunction(ctx, js_nextAll, "nextAll", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "prevAll", JS_NewCFunction(ctx, js_prevAll, "prevAll", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "nextUntil", JS_NewCFunction(ctx, js_nextUntil, "nextUntil", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "prevUntil", JS_NewCFunction(ctx, js_prevUntil, "prevUntil", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "parentsUntil", JS_NewCFunction(ctx, js_parentsUntil, "parentsUntil", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "contents", JS_NewCFunction(ctx, js_contents, "contents", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "end", JS_NewCFunction(ctx, js_end, "end", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "addBack", JS_NewCFunction(ctx, js_addBack, "addBack", 0));
-
-        // 효과/애니메이션 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "show", JS_NewCFunction(ctx, js_show, "show", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "hide", JS_NewCFunction(ctx, js_hide, "hide", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "toggle", JS_NewCFunction(ctx, js_toggle, "toggle", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "fadeIn", JS_NewCFunction(ctx, js_fadeIn, "fadeIn", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "fadeOut", JS_NewCFunction(ctx, js_fadeOut, "fadeOut", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "fadeToggle", JS_NewCFunction(ctx, js_fadeToggle, "fadeToggle", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "slideDown", JS_NewCFunction(ctx, js_slideDown, "slideDown", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "slideUp", JS_NewCFunction(ctx, js_slideUp, "slideUp", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "slideToggle", JS_NewCFunction(ctx, js_slideToggle, "slideToggle", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "animate", JS_NewCFunction(ctx, js_animate, "animate", 2));
-
-        // 폼 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "serialize", JS_NewCFunction(ctx, js_serialize, "serialize", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "serializeArray", JS_NewCFunction(ctx, js_serializeArray, "serializeArray", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "submit", JS_NewCFunction(ctx, js_submit, "submit", 1));
-
-        // AJAX 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "load", JS_NewCFunction(ctx, js_load, "load", 1));
-
-        // 이벤트 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "on", JS_NewCFunction(ctx, js_on, "on", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "off", JS_NewCFunction(ctx, js_off, "off", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "trigger", JS_NewCFunction(ctx, js_trigger, "trigger", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "click", JS_NewCFunction(ctx, js_click, "click", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "change", JS_NewCFunction(ctx, js_change, "change", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "focus", JS_NewCFunction(ctx, js_focus, "focus", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "blur", JS_NewCFunction(ctx, js_blur, "blur", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "keypress", JS_NewCFunction(ctx, js_keypress, "keypress", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "keydown", JS_NewCFunction(ctx, js_keydown, "keydown", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "keyup", JS_NewCFunction(ctx, js_keyup, "keyup", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "mouseenter", JS_NewCFunction(ctx, js_mouseenter, "mouseenter", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "mouseleave", JS_NewCFunction(ctx, js_mouseleave, "mouseleave", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "ready", JS_NewCFunction(ctx, js_ready, "ready", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "one", JS_NewCFunction(ctx, js_one, "one", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "hover", JS_NewCFunction(ctx, js_hover, "hover", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "dblclick", JS_NewCFunction(ctx, js_dblclick, "dblclick", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "scroll", JS_NewCFunction(ctx, js_scroll, "scroll", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "resize", JS_NewCFunction(ctx, js_resize, "resize", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "unload", JS_NewCFunction(ctx, js_unload, "unload", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "error", JS_NewCFunction(ctx, js_error, "error", 1));
-
-        // 유틸리티 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "map", JS_NewCFunction(ctx, js_map, "map", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "is", JS_NewCFunction(ctx, js_is, "is", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "not", JS_NewCFunction(ctx, js_not, "not", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "has", JS_NewCFunction(ctx, js_has, "has", 1));
-
-        // 치수/위치 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "width", JS_NewCFunction(ctx, js_width, "width", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "height", JS_NewCFunction(ctx, js_height, "height", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "offset", JS_NewCFunction(ctx, js_offset, "offset", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "position", JS_NewCFunction(ctx, js_position, "position", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "scrollTop", JS_NewCFunction(ctx, js_scrollTop, "scrollTop", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "scrollLeft", JS_NewCFunction(ctx, js_scrollLeft, "scrollLeft", 1));
-
-        // 배열/컬렉션 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "get", JS_NewCFunction(ctx, js_getElement, "get", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "toArray", JS_NewCFunction(ctx, js_toArray, "toArray", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "index", JS_NewCFunction(ctx, js_index, "index", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "size", JS_NewCFunction(ctx, js_size, "size", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "slice", JS_NewCFunction(ctx, js_slice, "slice", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "add", JS_NewCFunction(ctx, js_add, "add", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "length", JS_NewInt32(ctx, 1));
-
-        // Promise 메서드
-        JS_SetPropertyStr(ctx, jq_obj, "promise", JS_NewCFunction(ctx, js_promise, "promise", 0));
-        JS_SetPropertyStr(ctx, jq_obj, "then", JS_NewCFunction(ctx, js_then, "then", 2));
-        JS_SetPropertyStr(ctx, jq_obj, "done", JS_NewCFunction(ctx, js_done, "done", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "fail", JS_NewCFunction(ctx, js_fail, "fail", 1));
-        JS_SetPropertyStr(ctx, jq_obj, "always", JS_NewCFunction(ctx, js_always, "always", 1));
+        static const JSCFunctionListEntry jquery_funcs[] = {
+            JS_CFUNC_DEF2("html", 1, js_html, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("append", 1, js_append, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("text", 1, js_text, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("remove", 0, js_remove, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("prepend", 1, js_prepend, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("after", 1, js_after, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("before", 1, js_before, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("replaceWith", 1, js_replaceWith, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("wrap", 1, js_wrap, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("unwrap", 0, js_unwrap, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("clone", 0, js_clone, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("empty", 0, js_empty, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("detach", 0, js_detach, JS_PROP_C_W_E),
+
+            // CSS/속성 메서드
+            JS_CFUNC_DEF2("css", 2, js_css, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("addClass", 1, js_addClass, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("removeClass", 1, js_removeClass, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("toggleClass", 1, js_toggleClass, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("attr", 2, js_attr, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("prop", 2, js_prop, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("data", 2, js_data, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("val", 1, js_val, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("hasClass", 1, js_hasClass, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("removeAttr", 1, js_removeAttr, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("removeProp", 1, js_removeProp, JS_PROP_C_W_E),
+
+            // 트래버싱 메서드
+            JS_CFUNC_DEF2("find", 1, js_find, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("parent", 0, js_parent, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("parents", 0, js_parents, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("children", 0, js_children, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("siblings", 0, js_siblings, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("next", 0, js_next, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("prev", 0, js_prev, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("eq", 1, js_eq, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("first", 0, js_first, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("last", 0, js_last, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("filter", 1, js_filter, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("closest", 1, js_closest, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("nextAll", 0, js_nextAll, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("prevAll", 0, js_prevAll, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("nextUntil", 1, js_nextUntil, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("prevUntil", 1, js_prevUntil, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("parentsUntil", 1, js_parentsUntil, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("contents", 0, js_contents, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("end", 0, js_end, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("addBack", 0, js_addBack, JS_PROP_C_W_E),
+
+            // 효과/애니메이션 메서드
+            JS_CFUNC_DEF2("show", 0, js_show, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("hide", 0, js_hide, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("toggle", 0, js_toggle, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("fadeIn", 1, js_fadeIn, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("fadeOut", 1, js_fadeOut, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("fadeToggle", 0, js_fadeToggle, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("slideDown", 1, js_slideDown, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("slideUp", 1, js_slideUp, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("slideToggle", 0, js_slideToggle, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("animate", 2, js_animate, JS_PROP_C_W_E),
+
+            // 폼 메서드
+            JS_CFUNC_DEF2("serialize", 0, js_serialize, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("serializeArray", 0, js_serializeArray, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("submit", 1, js_submit, JS_PROP_C_W_E),
+
+            // AJAX 메서드
+            JS_CFUNC_DEF2("load", 1, js_load, JS_PROP_C_W_E),
+
+            // 이벤트 메서드
+            JS_CFUNC_DEF2("on", 2, js_on, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("off", 2, js_off, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("trigger", 1, js_trigger, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("click", 1, js_click, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("change", 1, js_change, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("focus", 1, js_focus, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("blur", 1, js_blur, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("keypress", 1, js_keypress, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("keydown", 1, js_keydown, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("keyup", 1, js_keyup, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("mouseenter", 1, js_mouseenter, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("mouseleave", 1, js_mouseleave, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("ready", 1, js_ready, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("one", 2, js_one, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("hover", 2, js_hover, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("dblclick", 1, js_dblclick, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("scroll", 1, js_scroll, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("resize", 1, js_resize, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("unload", 1, js_unload, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("error", 1, js_error, JS_PROP_C_W_E),
+
+            // 유틸리티 메서드
+            JS_CFUNC_DEF2("map", 1, js_map, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("is", 1, js_is, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("not", 1, js_not, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("has", 1, js_has, JS_PROP_C_W_E),
+
+            // 치수/위치 메서드
+            JS_CFUNC_DEF2("width", 1, js_width, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("height", 1, js_height, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("offset", 0, js_offset, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("position", 0, js_position, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("scrollTop", 1, js_scrollTop, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("scrollLeft", 1, js_scrollLeft, JS_PROP_C_W_E),
+
+            // 배열/컬렉션 메서드
+            JS_CFUNC_DEF2("get", 1, js_getElement, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("toArray", 0, js_toArray, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("index", 0, js_index, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("size", 0, js_size, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("slice", 2, js_slice, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("add", 1, js_add, JS_PROP_C_W_E),
+            JS_PROP_INT32_DEF("length", 1, JS_PROP_C_W_E),
+
+            // Promise 메서드
+            JS_CFUNC_DEF2("promise", 0, js_promise, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("then", 2, js_then, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("done", 1, js_done, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("fail", 1, js_fail, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("always", 1, js_always, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, jq_obj, jquery_funcs, sizeof(jquery_funcs) / sizeof(jquery_funcs[0]));
 
         return jq_obj;
     }
@@ -1828,35 +1913,38 @@ namespace JQueryObject {
         }, "$", 1);
 
         // $.ajax 계열
-        JS_SetPropertyStr(ctx, dollar_func, "ajax", JS_NewCFunction(ctx, js_ajax, "ajax", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "get", JS_NewCFunction(ctx, js_get, "get", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "post", JS_NewCFunction(ctx, js_post, "post", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "getJSON", JS_NewCFunction(ctx, js_getJSON, "getJSON", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "getScript", JS_NewCFunction(ctx, js_getScript, "getScript", 1));
-
-        // $.유틸리티
-        JS_SetPropertyStr(ctx, dollar_func, "each", JS_NewCFunction(ctx, js_each, "each", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "extend", JS_NewCFunction(ctx, js_extend, "extend", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "parseJSON", JS_NewCFunction(ctx, js_parseJSON, "parseJSON", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "trim", JS_NewCFunction(ctx, js_trim, "trim", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "type", JS_NewCFunction(ctx, js_type, "type", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "isArray", JS_NewCFunction(ctx, js_isArray, "isArray", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "isFunction", JS_NewCFunction(ctx, js_isFunction, "isFunction", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "isNumeric", JS_NewCFunction(ctx, js_isNumeric, "isNumeric", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "isEmptyObject", JS_NewCFunction(ctx, js_isEmptyObject, "isEmptyObject", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "isPlainObject", JS_NewCFunction(ctx, js_isPlainObject, "isPlainObject", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "inArray", JS_NewCFunction(ctx, js_inArray, "inArray", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "grep", JS_NewCFunction(ctx, js_grep, "grep", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "merge", JS_NewCFunction(ctx, js_merge, "merge", 2));
-        JS_SetPropertyStr(ctx, dollar_func, "makeArray", JS_NewCFunction(ctx, js_makeArray, "makeArray", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "unique", JS_NewCFunction(ctx, js_unique, "unique", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "globalEval", JS_NewCFunction(ctx, js_globalEval, "globalEval", 1));
-        JS_SetPropertyStr(ctx, dollar_func, "noop", JS_NewCFunction(ctx, js_noop, "noop", 0));
-        JS_SetPropertyStr(ctx, dollar_func, "now", JS_NewCFunction(ctx, js_now, "now", 0));
-
-        // $.Deferred/Promise
-        JS_SetPropertyStr(ctx, dollar_func, "Deferred", JS_NewCFunction(ctx, js_Deferred, "Deferred", 0));
-        JS_SetPropertyStr(ctx, dollar_func, "when", JS_NewCFunction(ctx, js_when, "when", 1));
+        static const JSCFunctionListEntry jquery_static_funcs[] = {
+            JS_CFUNC_DEF2("ajax", 1, js_ajax, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("get", 1, js_get, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("post", 2, js_post, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("getJSON", 1, js_getJSON, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("getScript", 1, js_getScript, JS_PROP_C_W_E),
+
+            // $.유틸리티
+            JS_CFUNC_DEF2("each", 2, js_each, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("extend", 2, js_extend, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("parseJSON", 1, js_parseJSON, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("trim", 1, js_trim, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("type", 1, js_type, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("isArray", 1, js_isArray, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("isFunction", 1, js_isFunction, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("isNumeric", 1, js_isNumeric, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("isEmptyObject", 1, js_isEmptyObject, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("isPlainObject", 1, js_isPlainObject, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("inArray", 2, js_inArray, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("grep", 2, js_grep, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("merge", 2, js_merge, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("makeArray", 1, js_makeArray, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("unique", 1, js_unique, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("globalEval", 1, js_globalEval, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("noop", 0, js_noop, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("now", 0, js_now, JS_PROP_C_W_E),
+
+            // $.Deferred/Promise
+            JS_CFUNC_DEF2("Deferred", 0, js_Deferred, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("when", 1, js_when, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, dollar_func, jquery_static_funcs, sizeof(jquery_static_funcs) / sizeof(jquery_static_funcs[0]));
 
         // $.fn.valid (기존 코드 호환)
         JSValue fn_obj = JS_NewObject(ctx);
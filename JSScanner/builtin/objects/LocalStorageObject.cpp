@@ -7,18 +7,15 @@
 #include <algorithm>
 
 namespace LocalStorageObject {
-    // 🔥 CRITICAL FIX: 멀티스레드 환경에서 데이터 레이스 방지
-    // 각 스레드마다 독립적인 localStorage 사용
-    thread_local std::unordered_map<std::string, std::string> g_local_storage = {
-        {"username", "stored.user@example.com"},
-        {"userEmail", "stored.user@example.com"},
-        {"organization", "storedcorp"}
-    };
-
     static JSAnalyzerContext* get_analyzer_context(JSContext* ctx) {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
 
+    // 🔥 Task 컨텍스트의 localStorage (컨텍스트 없으면 nullptr)
+    static StorageArea* get_storage(JSAnalyzerContext* a_ctx) {
+        return a_ctx ? &a_ctx->storage.localStorage() : nullptr;
+    }
+
     static int calculateLocalStorageSeverity(const std::string& key, const std::string& value, std::string& keywordSummary) {
         // 🎯 0점에서 시작 (localStorage 접근 자체는 정상 동작)
         int severity = 0;
@@ -77,13 +74,13 @@ namespace LocalStorageObject {
         }
 
         std::string key = JSValueConverter::toString(ctx, argv[0]);
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        StorageArea* storage = get_storage(a_ctx);
         std::string value;
-        auto it = g_local_storage.find(key);
-        if (it != g_local_storage.end()) {
-            value = it->second;
+        if (const std::string* stored = storage ? storage->get(key) : nullptr) {
+            value = *stored;
         }
 
-        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         std::map<std::string, JsValue> metadata;
         metadata["key"] = JsValue(key);
         metadata["length"] = JsValue(static_cast<double>(value.size()));
@@ -100,8 +97,14 @@ namespace LocalStorageObject {
         JsValue resultValue = value.empty() ? JsValue() : JsValue(value);
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "localStorage.getItem", 
-                {JsValue(key)}, resultValue, metadata, severity});
+            a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, severity, [&] {
+                return HookPayload{
+                    "localStorage.getItem",
+                    {JsValue(key)},
+                    resultValue,
+                    metadata
+                };
+            });
         }
 
         trackStorageChain(a_ctx, "localStorage.getItem", {JsValue(key)}, resultValue);
@@ -124,12 +127,17 @@ namespace LocalStorageObject {
 
         std::string key = JSValueConverter::toString(ctx, argv[0]);
         std::string value = JSValueConverter::toString(ctx, argv[1]);
-        g_local_storage[key] = value;
 
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        StorageArea* storage = get_storage(a_ctx);
+        bool stored = !storage || storage->set(key, value);
+
         std::map<std::string, JsValue> metadata;
         metadata["key"] = JsValue(key);
         metadata["length"] = JsValue(static_cast<double>(value.size()));
+        if (!stored) {
+            metadata["quota_exceeded"] = JsValue(true);
+        }
 
         std::string keywordSummary;
         int severity = calculateLocalStorageSeverity(key, value, keywordSummary);
@@ -138,8 +146,14 @@ namespace LocalStorageObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "localStorage.setItem", 
-                {JsValue(key), JsValue(value)}, JsValue(std::monostate()), metadata, severity});
+            a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, severity, [&] {
+                return HookPayload{
+                    "localStorage.setItem",
+                    {JsValue(key), JsValue(value)},
+                    JsValue(std::monostate()),
+                    metadata
+                };
+            });
         }
 
         trackStorageChain(a_ctx, "localStorage.setItem", {JsValue(key), JsValue(value)}, JsValue(std::monostate()));
@@ -148,6 +162,10 @@ namespace LocalStorageObject {
             a_ctx->dynamicStringTracker->trackString("localStorage." + key, value);
         }
 
+        // 브라우저와 같이 저장 한도 초과는 예외
+        if (!stored) {
+            return JS_ThrowPlainError(ctx, "QuotaExceededError: Failed to execute 'setItem' on 'Storage'");
+        }
         return JS_UNDEFINED;
     }
 
@@ -158,14 +176,13 @@ namespace LocalStorageObject {
         }
 
         std::string key = JSValueConverter::toString(ctx, argv[0]);
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        StorageArea* storage = get_storage(a_ctx);
         std::string removedValue;
-        auto it = g_local_storage.find(key);
-        if (it != g_local_storage.end()) {
-            removedValue = it->second;
-            g_local_storage.erase(it);
+        if (storage) {
+            storage->remove(key, &removedValue);
         }
 
-        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
         std::map<std::string, JsValue> metadata;
         metadata["key"] = JsValue(key);
         metadata["hadValue"] = JsValue(static_cast<double>(removedValue.empty() ? 0 : 1));
@@ -182,8 +199,14 @@ namespace LocalStorageObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "localStorage.removeItem", 
-                {JsValue(key)}, JsValue(std::monostate()), metadata, severity});
+            a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, severity, [&] {
+                return HookPayload{
+                    "localStorage.removeItem",
+                    {JsValue(key)},
+                    JsValue(std::monostate()),
+                    metadata
+                };
+            });
         }
 
         trackStorageChain(a_ctx, "localStorage.removeItem", {JsValue(key)}, JsValue(std::monostate()));
@@ -196,15 +219,21 @@ namespace LocalStorageObject {
         (void)argc;
         (void)argv;
 
-        std::size_t cleared = g_local_storage.size();
-        g_local_storage.clear();
-
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        StorageArea* storage = get_storage(a_ctx);
+        std::size_t cleared = storage ? storage->clear() : 0;
+
         if (a_ctx && a_ctx->dynamicAnalyzer) {
             std::map<std::string, JsValue> metadata;
             metadata["cleared"] = JsValue(static_cast<double>(cleared));
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::DATA_EXFILTRATION, "localStorage.clear", 
-                {}, JsValue(std::monostate()), metadata, 5});
+            a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, 5, [&] {
+                return HookPayload{
+                    "localStorage.clear",
+                    {},
+                    JsValue(std::monostate()),
+                    metadata
+                };
+            });
         }
 
         trackStorageChain(a_ctx, "localStorage.clear", {}, JsValue(std::monostate()));
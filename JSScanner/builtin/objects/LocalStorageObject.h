@@ -1,6 +1,5 @@
 #pragma once
 #include "../../quickjs.h"
-#include <unordered_map>
 #include <string>
 
 /**
@@ -19,7 +18,4 @@ namespace LocalStorageObject {
     JSValue js_localStorage_setItem(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_localStorage_removeItem(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_localStorage_clear(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
-
-    // LocalStorage 스토리지 (멀티스레드 안전성을 위해 thread_local 사용)
-    extern thread_local std::unordered_map<std::string, std::string> g_local_storage;
 }
@@ -21,7 +21,7 @@ void registerLowPriorityAPIs(JSContext* ctx, JSValue global_obj) {
     JSValue navigator = JS_GetPropertyStr(ctx, global_obj, "navigator");
     if (JS_IsUndefined(navigator)) {
         navigator = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, global_obj, "navigator", navigator);
+        JS_SetPropertyStr(ctx, global_obj, "navigator", JS_DupValue(ctx, navigator));
     }
     
     JSValue geolocation = JS_NewObject(ctx);
@@ -38,6 +38,7 @@ void registerLowPriorityAPIs(JSContext* ctx, JSValue global_obj) {
     JS_SetPropertyStr(ctx, clipboard, "readText", 
         JS_NewCFunction(ctx, js_clipboard_readText, "readText", 0));
     JS_SetPropertyStr(ctx, navigator, "clipboard", clipboard);
+    JS_FreeValue(ctx, navigator);
 
     // WebRTC
     JSValue rtc_ctor = JS_NewCFunction2(ctx, js_rtc_peerconnection_constructor,
@@ -59,16 +60,15 @@ JSValue js_notification_constructor(JSContext* ctx, JSValueConst new_target,
     
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::NOTIFICATION_CREATE;
-        event.severity = 6;
-        event.line = 0;
-        event.reason = "Notification created - potential phishing alert";
-        event.features["title"] = title ? title : "";
-        event.tags.insert("notification");
-        event.tags.insert("social_engineering");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::NOTIFICATION_CREATE, 6, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "Notification created - potential phishing alert";
+            event.features["title"] = title ? title : "";
+            event.tags.insert("notification");
+            event.tags.insert("social_engineering");
+            return event;
+        });
     }
 
     if (title && argc > 0) JS_FreeCString(ctx, title);
@@ -79,14 +79,13 @@ JSValue js_notification_requestPermission(JSContext* ctx, JSValueConst this_val,
                                          int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::NOTIFICATION_PERMISSION;
-        event.severity = 5;
-        event.line = 0;
-        event.reason = "Notification.requestPermission";
-        event.tags.insert("notification");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::NOTIFICATION_PERMISSION, 5, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "Notification.requestPermission";
+            event.tags.insert("notification");
+            return event;
+        });
     }
 
     JSValue promise = JS_NewObject(ctx);
@@ -101,15 +100,14 @@ JSValue js_geolocation_getCurrentPosition(JSContext* ctx, JSValueConst this_val,
                                          int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::GEOLOCATION_GET;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "geolocation.getCurrentPosition - location tracking";
-        event.tags.insert("privacy");
-        event.tags.insert("location");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::GEOLOCATION_GET, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "geolocation.getCurrentPosition - location tracking";
+            event.tags.insert("privacy");
+            event.tags.insert("location");
+            return event;
+        });
     }
 
     return JS_UNDEFINED;
@@ -119,16 +117,15 @@ JSValue js_geolocation_watchPosition(JSContext* ctx, JSValueConst this_val,
                                     int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::GEOLOCATION_WATCH;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "geolocation.watchPosition - continuous location tracking";
-        event.tags.insert("privacy");
-        event.tags.insert("location");
-        event.tags.insert("surveillance");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::GEOLOCATION_WATCH, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "geolocation.watchPosition - continuous location tracking";
+            event.tags.insert("privacy");
+            event.tags.insert("location");
+            event.tags.insert("surveillance");
+            return event;
+        });
     }
 
     return JS_NewInt32(ctx, 1); // Return fake watch ID
@@ -144,17 +141,16 @@ JSValue js_clipboard_writeText(JSContext* ctx, JSValueConst this_val,
     
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CLIPBOARD_WRITE;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "clipboard.writeText - clipboard hijacking";
-        event.features["text"] = text ? text : "";
-        event.tags.insert("privacy");
-        event.tags.insert("clipboard");
-        event.tags.insert("hijacking");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CLIPBOARD_WRITE, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "clipboard.writeText - clipboard hijacking";
+            event.features["text"] = text ? text : "";
+            event.tags.insert("privacy");
+            event.tags.insert("clipboard");
+            event.tags.insert("hijacking");
+            return event;
+        });
     }
 
     if (text && argc > 0) JS_FreeCString(ctx, text);
@@ -167,16 +163,15 @@ JSValue js_clipboard_readText(JSContext* ctx, JSValueConst this_val,
                               int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::CLIPBOARD_READ;
-        event.severity = 9;
-        event.line = 0;
-        event.reason = "clipboard.readText - stealing clipboard content";
-        event.tags.insert("privacy");
-        event.tags.insert("clipboard");
-        event.tags.insert("data_theft");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::CLIPBOARD_READ, 9, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "clipboard.readText - stealing clipboard content";
+            event.tags.insert("privacy");
+            event.tags.insert("clipboard");
+            event.tags.insert("data_theft");
+            return event;
+        });
     }
 
     JSValue promise = JS_NewObject(ctx);
@@ -191,16 +186,15 @@ JSValue js_rtc_peerconnection_constructor(JSContext* ctx, JSValueConst new_targe
                                           int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::WEBRTC_CREATE;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "RTCPeerConnection - potential IP leak";
-        event.tags.insert("privacy");
-        event.tags.insert("webrtc");
-        event.tags.insert("ip_leak");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::WEBRTC_CREATE, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "RTCPeerConnection - potential IP leak";
+            event.tags.insert("privacy");
+            event.tags.insert("webrtc");
+            event.tags.insert("ip_leak");
+            return event;
+        });
     }
 
     JSValue obj = JS_NewObjectClass(ctx, 0);
@@ -209,14 +203,13 @@ JSValue js_rtc_peerconnection_constructor(JSContext* ctx, JSValueConst new_targe
                                 int argc, JSValueConst* argv) -> JSValue {
             JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-                HookEvent event;
-                event.hookType = HookType::WEBRTC_DATA_CHANNEL;
-                event.severity = 7;
-                event.line = 0;
-                event.reason = "RTCPeerConnection.createDataChannel";
-                event.tags.insert("webrtc");
-
-                a_ctx->dynamicAnalyzer->recordEvent(event);
+                a_ctx->hookBus.emit(HookType::WEBRTC_DATA_CHANNEL, 7, [&] {
+                    HookEvent event;
+                    event.line = 0;
+                    event.reason = "RTCPeerConnection.createDataChannel";
+                    event.tags.insert("webrtc");
+                    return event;
+                });
             }
             return JS_NewObject(ctx);
         }, "createDataChannel", 2));
@@ -232,14 +225,13 @@ JSValue js_requestAnimationFrame(JSContext* ctx, JSValueConst this_val,
                                  int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::RAF_CREATE;
-        event.severity = 4;
-        event.line = 0;
-        event.reason = "requestAnimationFrame - potential timing attack";
-        event.tags.insert("timing_attack");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::RAF_CREATE, 4, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "requestAnimationFrame - potential timing attack";
+            event.tags.insert("timing_attack");
+            return event;
+        });
     }
 
     return JS_NewInt32(ctx, 1); // Return fake request ID
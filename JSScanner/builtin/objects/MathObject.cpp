@@ -20,20 +20,25 @@ namespace MathObject {
         if (magic == 0) { funcName = "Math.random"; }
         else if (magic == 1) { funcName = "Math.floor"; }
 
-        // 동적 분석 이벤트 기록
-        std::vector<JsValue> args_vec;
-        for (int i = 0; i < argc; i++) {
-            double d;
-            if (JS_ToFloat64(ctx, &d, argv[i]) == 0) {
-                args_vec.push_back(d);
+        // 동적 분석 이벤트 기록 (받을 구독자나 chain tracker 가 있을 때만 인자 변환)
+        const bool observed = a_ctx->hookBus.wants(HookType::FUNCTION_CALL, 1);
+        if (observed || a_ctx->chainTrackerManager) {
+            std::vector<JsValue> args_vec;
+            args_vec.reserve(argc);
+            for (int i = 0; i < argc; i++) {
+                double d;
+                if (JS_ToFloat64(ctx, &d, argv[i]) == 0) {
+                    args_vec.push_back(d);
+                }
             }
-        }
 
-        a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, funcName, args_vec, 
-            JsValue(std::monostate()), {}, 1});
+            if (a_ctx->chainTrackerManager) {
+                a_ctx->chainTrackerManager->trackFunctionCall(funcName, args_vec, JsValue(std::monostate()));
+            }
 
-        if (a_ctx && a_ctx->chainTrackerManager) {
-            a_ctx->chainTrackerManager->trackFunctionCall(funcName, args_vec, JsValue(std::monostate()));
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 1, [&] {
+                return HookPayload{funcName, std::move(args_vec), JsValue(std::monostate()), {}};
+            });
         }
 
         // 실제 함수 동작 흉내
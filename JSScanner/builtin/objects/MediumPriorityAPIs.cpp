@@ -28,6 +28,10 @@ void registerMediumPriorityAPIs(JSContext* ctx, JSValue global_obj) {
         JS_NewCFunction(ctx, js_sessionstorage_setItem, "setItem", 2));
     JS_SetPropertyStr(ctx, sessionStorage, "getItem", 
         JS_NewCFunction(ctx, js_sessionstorage_getItem, "getItem", 1));
+    JS_SetPropertyStr(ctx, sessionStorage, "removeItem", 
+        JS_NewCFunction(ctx, js_sessionstorage_removeItem, "removeItem", 1));
+    JS_SetPropertyStr(ctx, sessionStorage, "clear", 
+        JS_NewCFunction(ctx, js_sessionstorage_clear, "clear", 0));
     JS_SetPropertyStr(ctx, global_obj, "sessionStorage", sessionStorage);
 }
 
@@ -39,16 +43,15 @@ JSValue js_element_attachShadow(JSContext* ctx, JSValueConst this_val,
                                int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::SHADOW_DOM_ATTACH;
-        event.severity = 8;
-        event.line = 0;
-        event.reason = "attachShadow - DOM concealment technique";
-        event.tags.insert("dom_manipulation");
-        event.tags.insert("obfuscation");
-        event.tags.insert("shadow_dom");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::SHADOW_DOM_ATTACH, 8, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "attachShadow - DOM concealment technique";
+            event.tags.insert("dom_manipulation");
+            event.tags.insert("obfuscation");
+            event.tags.insert("shadow_dom");
+            return event;
+        });
     }
 
     JSValue shadowRoot = JS_NewObject(ctx);
@@ -64,15 +67,14 @@ JSValue js_mutation_observer_constructor(JSContext* ctx, JSValueConst new_target
                                         int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::MUTATION_OBSERVER_CREATE;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "MutationObserver created - DOM monitoring";
-        event.tags.insert("dom_manipulation");
-        event.tags.insert("monitoring");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::MUTATION_OBSERVER_CREATE, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "MutationObserver created - DOM monitoring";
+            event.tags.insert("dom_manipulation");
+            event.tags.insert("monitoring");
+            return event;
+        });
     }
 
     JSValue obj = JS_NewObjectClass(ctx, 0);
@@ -95,14 +97,13 @@ JSValue js_mutation_observer_observe(JSContext* ctx, JSValueConst this_val,
                                     int argc, JSValueConst* argv) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::MUTATION_OBSERVER_OBSERVE;
-        event.severity = 7;
-        event.line = 0;
-        event.reason = "MutationObserver.observe - tracking DOM changes";
-        event.tags.insert("dom_manipulation");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::MUTATION_OBSERVER_OBSERVE, 7, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "MutationObserver.observe - tracking DOM changes";
+            event.tags.insert("dom_manipulation");
+            return event;
+        });
     }
     
     return JS_UNDEFINED;
@@ -121,8 +122,13 @@ JSValue js_sessionstorage_setItem(JSContext* ctx, JSValueConst this_val,
     
     std::string key_str = key ? key : "";
     std::string val_str = value ? value : "";
+    if (key) JS_FreeCString(ctx, key);
+    if (value) JS_FreeCString(ctx, value);
 
+    // 🔥 Task 컨텍스트의 sessionStorage 에 저장
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    bool stored = !a_ctx || a_ctx->storage.sessionStorage().set(key_str, val_str);
+
     if (a_ctx && a_ctx->dynamicAnalyzer) {
         HookEvent event;
         event.hookType = HookType::SESSION_STORAGE_SET;
@@ -141,33 +147,66 @@ JSValue js_sessionstorage_setItem(JSContext* ctx, JSValueConst this_val,
         event.features["value"] = val_str.length() > 200 ? 
             val_str.substr(0, 200) + "..." : val_str;
         event.tags.insert("storage");
+        if (!stored) {
+            event.features["quota_exceeded"] = true;
+        }
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
-    if (key) JS_FreeCString(ctx, key);
-    if (value) JS_FreeCString(ctx, value);
-    
+    if (!stored) {
+        return JS_ThrowPlainError(ctx, "QuotaExceededError: Failed to execute 'setItem' on 'Storage'");
+    }
     return JS_UNDEFINED;
 }
 
 JSValue js_sessionstorage_getItem(JSContext* ctx, JSValueConst this_val, 
                                  int argc, JSValueConst* argv) {
     if (argc < 1) return JS_NULL;
-    
+
+    const char* key = JS_ToCString(ctx, argv[0]);
+    std::string key_str = key ? key : "";
+    if (key) JS_FreeCString(ctx, key);
+
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    const std::string* value = a_ctx ? a_ctx->storage.sessionStorage().get(key_str) : nullptr;
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::SESSION_STORAGE_GET;
-        event.severity = 5;
-        event.line = 0;
-        event.reason = "sessionStorage.getItem - reading session data";
-        event.tags.insert("storage");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(HookType::SESSION_STORAGE_GET, 5, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "sessionStorage.getItem - reading session data";
+            event.features["key"] = key_str;
+            event.features["found"] = value != nullptr;
+            event.tags.insert("storage");
+            return event;
+        });
     }
     
-    return JS_NULL;
+    return value ? JS_NewStringLen(ctx, value->data(), value->size()) : JS_NULL;
+}
+
+JSValue js_sessionstorage_removeItem(JSContext* ctx, JSValueConst this_val, 
+                                    int argc, JSValueConst* argv) {
+    if (argc < 1) return JS_UNDEFINED;
+
+    const char* key = JS_ToCString(ctx, argv[0]);
+    std::string key_str = key ? key : "";
+    if (key) JS_FreeCString(ctx, key);
+
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx) {
+        a_ctx->storage.sessionStorage().remove(key_str);
+    }
+    return JS_UNDEFINED;
+}
+
+JSValue js_sessionstorage_clear(JSContext* ctx, JSValueConst this_val, 
+                               int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx) {
+        a_ctx->storage.sessionStorage().clear();
+    }
+    return JS_UNDEFINED;
 }
 
 } // namespace MediumPriorityAPIs
@@ -28,5 +28,9 @@ namespace MediumPriorityAPIs {
                                      int argc, JSValueConst* argv);
     JSValue js_sessionstorage_getItem(JSContext* ctx, JSValueConst this_val, 
                                      int argc, JSValueConst* argv);
+    JSValue js_sessionstorage_removeItem(JSContext* ctx, JSValueConst this_val, 
+                                        int argc, JSValueConst* argv);
+    JSValue js_sessionstorage_clear(JSContext* ctx, JSValueConst this_val, 
+                                   int argc, JSValueConst* argv);
 
 } // namespace MediumPriorityAPIs
@@ -52,7 +52,7 @@ JSValue js_navigator_sendBeacon(JSContext* ctx, JSValueConst this_val,
         event.tags.insert("network");
         event.tags.insert("beacon");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
     if (url) JS_FreeCString(ctx, url);
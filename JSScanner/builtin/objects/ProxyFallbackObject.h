@@ -8,6 +8,7 @@
 namespace ProxyFallbackObject {
     /**
      * 글로벌 객체에 Proxy 기반 폴백 설치
+     * 설치 점검 결과는 hook trace(HookTrace) 가 활성화된 경우에만 기록
      * @param ctx JavaScript 컨텍스트
      * @param global_obj Global 객체
      */
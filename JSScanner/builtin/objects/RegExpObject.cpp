@@ -1,256 +1,334 @@
 #include "pch.h"
 #include "RegExpObject.h"
+#include "../../core/JSAnalyzer.h"
+#include "../../core/RegexCache.h"
+#include "../../core/JSAtomTable.h"
+#include "../../core/MetricsRegistry.h"
 #include <re2/re2.h>
 
 namespace RegExpObject {
 
     struct RegExpInfo {
         std::string pattern;
+        std::string flags;
         bool global = false;
-        bool ignoreCase = false;
-        bool multiline = false;
-        
+        bool sticky = false;
+        bool supported = true;  // RE2 로 처리 가능한 플래그 조합인지 (g, i, m, s, y)
+
         static RegExpInfo extract(JSContext* ctx, JSValueConst regexp_obj) {
             RegExpInfo info;
-            
-            JSValue source_val = JS_GetPropertyStr(ctx, regexp_obj, "source");
+
+            JSValue source_val = JSAtoms::getProperty(ctx, regexp_obj, JSAtomId::source);
             if (!JS_IsUndefined(source_val)) {
-                const char* source_str = JS_ToCString(ctx, source_val);
+                size_t source_len = 0;
+                const char* source_str = JS_ToCStringLen(ctx, &source_len, source_val);
                 if (source_str) {
-                    info.pattern = source_str;
+                    info.pattern.assign(source_str, source_len);
                     JS_FreeCString(ctx, source_str);
                 }
             }
             JS_FreeValue(ctx, source_val);
-            
-            JSValue flags_val = JS_GetPropertyStr(ctx, regexp_obj, "flags");
+
+            JSValue flags_val = JSAtoms::getProperty(ctx, regexp_obj, JSAtomId::flags);
             if (!JS_IsUndefined(flags_val)) {
                 const char* flags_str = JS_ToCString(ctx, flags_val);
                 if (flags_str) {
-                    std::string flags(flags_str);
-                    info.global = flags.find('g') != std::string::npos;
-                    info.ignoreCase = flags.find('i') != std::string::npos;
-                    info.multiline = flags.find('m') != std::string::npos;
+                    info.flags = flags_str;
                     JS_FreeCString(ctx, flags_str);
                 }
             }
             JS_FreeValue(ctx, flags_val);
-            
+
+            for (char flag : info.flags) {
+                switch (flag) {
+                    case 'g': info.global = true; break;
+                    case 'y': info.sticky = true; break;
+                    case 'i': case 'm': case 's': break;
+                    default: info.supported = false; break;  // u, d, v 등은 엔진 구현 사용
+                }
+            }
+            // named group 은 결과 groups 객체 구성이 필요하므로 엔진 구현 사용
+            if (info.pattern.find("(?<") != std::string::npos) {
+                info.supported = false;
+            }
+
             return info;
         }
     };
 
-    re2::RE2::Options createRE2Options(const RegExpInfo& info) {
-        re2::RE2::Options options;
-        options.set_case_sensitive(!info.ignoreCase);
-        options.set_one_line(!info.multiline);
-        options.set_max_mem(8 << 20);
-        return options;
+    static RegexCache& regexCacheFor(JSContext* ctx) {
+        JSAnalyzerContext* a_ctx = static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
+        if (a_ctx) {
+            return a_ctx->regexCache;
+        }
+        thread_local RegexCache fallbackCache;
+        return fallbackCache;
     }
 
-    JSValue js_regexp_exec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        if (argc < 1) {
-            return JS_NULL;
+    // RE2 는 UTF-8 byte offset 을 반환하므로 JS(UTF-16) index 와 일치하는 ASCII 입력만 처리
+    // \r, \v 는 JS 의 '.', '\s' 와 RE2 의 해석이 달라 엔진 구현 사용
+    static bool isPlainAscii(const std::string& input) {
+        for (unsigned char c : input) {
+            if (c >= 0x80 || c == '\r' || c == '\v') {
+                return false;
+            }
         }
-        
-        const char* input_str = JS_ToCString(ctx, argv[0]);
-        if (!input_str) {
-            return JS_ThrowTypeError(ctx, "exec() requires a string argument");
+        return true;
+    }
+
+    static bool toPlainAscii(JSContext* ctx, JSValueConst value, std::string& out) {
+        if (!JS_IsString(value)) {
+            return false;  // ToString 부수효과가 두 번 일어나지 않도록 문자열만 처리
         }
-        std::string input(input_str);
-        JS_FreeCString(ctx, input_str);
-        
-        RegExpInfo info = RegExpInfo::extract(ctx, this_val);
-        if (info.pattern.empty()) {
-            core::Log_Warn("RegExp exec: empty pattern");
-            return JS_NULL;
+        size_t len = 0;
+        const char* str = JS_ToCStringLen(ctx, &len, value);
+        if (!str) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return false;
         }
-        
-        try {
-            re2::RE2::Options options = createRE2Options(info);
-            re2::RE2 re(info.pattern, options);
-            
-            if (!re.ok()) {
-                core::Log_Error("RegExp exec: invalid pattern: %s (error: %s)", 
-                    info.pattern.c_str(), re.error().c_str());
-                return JS_NULL;
-            }
-            
-            int num_groups = re.NumberOfCapturingGroups();
-            std::vector<re2::StringPiece> matches(num_groups + 1);
-            
-            if (!re.Match(input, 0, input.size(), re2::RE2::UNANCHORED, 
-                          matches.data(), matches.size())) {
-                return JS_NULL;
-            }
-            
-            JSValue result_array = JS_NewArray(ctx);
-            
-            for (size_t i = 0; i < matches.size(); ++i) {
-                if (matches[i].data() != nullptr) {
-                    std::string match_str(matches[i].data(), matches[i].size());
-                    JS_SetPropertyUint32(ctx, result_array, i, 
-                        JS_NewString(ctx, match_str.c_str()));
-                } else {
-                    JS_SetPropertyUint32(ctx, result_array, i, JS_UNDEFINED);
-                }
-            }
-            
-            size_t match_pos = matches[0].data() - input.data();
-            JS_SetPropertyStr(ctx, result_array, "index", 
-                JS_NewInt64(ctx, static_cast<int64_t>(match_pos)));
-            
-            JS_SetPropertyStr(ctx, result_array, "input", 
-                JS_NewString(ctx, input.c_str()));
-            
-            return result_array;
-            
-        } catch (const std::exception& e) {
-            core::Log_Error("RegExp exec exception: %s", e.what());
-            return JS_NULL;
+        out.assign(str, len);
+        JS_FreeCString(ctx, str);
+        return isPlainAscii(out);
+    }
+
+    static MetricCounter& fallbackMetric(const char* op) {
+        return MetricsRegistry::instance().counter("jsscanner_regex_native_fallback_total", {{"op", op}},
+                                                   "RegExp hook calls delegated to the QuickJS regex engine");
+    }
+
+    static JSValue callNative(JSContext* ctx, JSValueConst* func_data, JSValueConst this_val,
+                              int argc, JSValueConst* argv, MetricCounter& metric) {
+        metric.inc();
+        return JS_Call(ctx, func_data[0], this_val, argc, argv);
+    }
+
+    static std::shared_ptr<const re2::RE2> lookup(JSContext* ctx, JSValueConst regexp, RegExpInfo& info) {
+        if (!JS_IsRegExp(regexp)) {
+            return nullptr;
+        }
+        info = RegExpInfo::extract(ctx, regexp);
+        if (!info.supported) {
+            return nullptr;
         }
+        return regexCacheFor(ctx).get(info.pattern, info.flags);
     }
 
-    JSValue js_regexp_test(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        if (argc < 1) {
-            return JS_ThrowTypeError(ctx, "test() requires one argument");
+    static int64_t readLastIndex(JSContext* ctx, JSValueConst regexp) {
+        JSValue last_val = JSAtoms::getProperty(ctx, regexp, JSAtomId::lastIndex);
+        int64_t last_index = 0;
+        if (JS_ToInt64(ctx, &last_index, last_val) != 0) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            last_index = 0;
         }
+        JS_FreeValue(ctx, last_val);
+        return last_index < 0 ? 0 : last_index;
+    }
 
-        const char* input_str = JS_ToCString(ctx, argv[0]);
-        if (!input_str) {
-            return JS_ThrowTypeError(ctx, "test() requires a string argument");
+    static void writeLastIndex(JSContext* ctx, JSValueConst regexp, int64_t value) {
+        JSAtoms::setProperty(ctx, regexp, JSAtomId::lastIndex, JS_NewInt64(ctx, value));
+    }
+
+    // RegExpBuiltinExec 와 같은 lastIndex 규칙으로 한 번 매칭
+    static bool execOnce(JSContext* ctx, JSValueConst regexp, const RegExpInfo& info, const re2::RE2& re,
+                         const std::string& input, std::vector<re2::StringPiece>& matches) {
+        bool uses_last_index = info.global || info.sticky;
+        int64_t start = uses_last_index ? readLastIndex(ctx, regexp) : 0;
+        if (start > static_cast<int64_t>(input.size())) {
+            writeLastIndex(ctx, regexp, 0);
+            return false;
         }
-        std::string input(input_str);
-        JS_FreeCString(ctx, input_str);
-        
-        RegExpInfo info = RegExpInfo::extract(ctx, this_val);
-        if (info.pattern.empty()) {
-            return JS_NewBool(ctx, false);
+
+        matches.assign(re.NumberOfCapturingGroups() + 1, re2::StringPiece());
+        bool matched = re.Match(input, static_cast<size_t>(start), input.size(),
+                                info.sticky ? re2::RE2::ANCHOR_START : re2::RE2::UNANCHORED,
+                                matches.data(), static_cast<int>(matches.size()));
+        if (uses_last_index) {
+            writeLastIndex(ctx, regexp, matched ? (matches[0].data() - input.data()) + matches[0].size() : 0);
         }
-        
-        try {
-            re2::RE2::Options options = createRE2Options(info);
-            re2::RE2 re(info.pattern, options);
-            
-            if (!re.ok()) {
-                return JS_NewBool(ctx, false);
+        return matched;
+    }
+
+    static JSValue buildExecResult(JSContext* ctx, const std::string& input,
+                                   const std::vector<re2::StringPiece>& matches) {
+        JSValue result_array = JS_NewArray(ctx);
+        for (size_t i = 0; i < matches.size(); ++i) {
+            if (matches[i].data() != nullptr) {
+                JS_SetPropertyUint32(ctx, result_array, static_cast<uint32_t>(i),
+                    JS_NewStringLen(ctx, matches[i].data(), matches[i].size()));
+            } else {
+                JS_SetPropertyUint32(ctx, result_array, static_cast<uint32_t>(i), JS_UNDEFINED);
             }
-            
-            bool matched = re2::RE2::PartialMatch(input, re);
-            return JS_NewBool(ctx, matched);
-            
-        } catch (const std::exception& e) {
-            core::Log_Error("RegExp test exception: %s", e.what());
-            return JS_NewBool(ctx, false);
         }
+
+        JSAtoms::setProperty(ctx, result_array, JSAtomId::index,
+            JS_NewInt64(ctx, static_cast<int64_t>(matches[0].data() - input.data())));
+        JSAtoms::setProperty(ctx, result_array, JSAtomId::input, JS_NewStringLen(ctx, input.data(), input.size()));
+        JSAtoms::setProperty(ctx, result_array, JSAtomId::groups, JS_UNDEFINED);
+        return result_array;
     }
 
-    JSValue js_string_match(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        if (argc < 1) {
-            return JS_ThrowTypeError(ctx, "match() requires one argument");
+    JSValue js_regexp_exec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        static MetricCounter& fallback = fallbackMetric("exec");
+        RegExpInfo info;
+        std::string input;
+        std::shared_ptr<const re2::RE2> re = lookup(ctx, this_val, info);
+        if (!re || argc < 1 || !toPlainAscii(ctx, argv[0], input)) {
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
         }
 
-        const char* str = JS_ToCString(ctx, this_val);
-        if (!str) {
-            return JS_ThrowTypeError(ctx, "match() requires a string");
+        std::vector<re2::StringPiece> matches;
+        if (!execOnce(ctx, this_val, info, *re, input, matches)) {
+            return JS_NULL;
         }
+        return buildExecResult(ctx, input, matches);
+    }
 
-        JSValue str_val = JS_NewString(ctx, str);
-        JS_FreeCString(ctx, str);
-
-        JSValue exec_result = js_regexp_exec(ctx, argv[0], 1, &str_val);
-        JS_FreeValue(ctx, str_val);
+    JSValue js_regexp_test(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        static MetricCounter& fallback = fallbackMetric("test");
+        RegExpInfo info;
+        std::string input;
+        std::shared_ptr<const re2::RE2> re = lookup(ctx, this_val, info);
+        if (!re || argc < 1 || !toPlainAscii(ctx, argv[0], input)) {
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
+        }
 
-        return exec_result;
+        if (!info.global && !info.sticky) {
+            return JS_NewBool(ctx, re2::RE2::PartialMatch(input, *re));
+        }
+        std::vector<re2::StringPiece> matches;
+        return JS_NewBool(ctx, execOnce(ctx, this_val, info, *re, input, matches));
     }
 
-    JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        if (argc < 2) {
-            return JS_ThrowTypeError(ctx, "replace() requires two arguments");
+    JSValue js_string_match(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        static MetricCounter& fallback = fallbackMetric("match");
+        RegExpInfo info;
+        std::string input;
+        std::shared_ptr<const re2::RE2> re = argc >= 1 ? lookup(ctx, argv[0], info) : nullptr;
+        if (!re || info.sticky || !toPlainAscii(ctx, this_val, input)) {
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
         }
 
-        const char* str = JS_ToCString(ctx, this_val);
-        if (!str) {
-            return JS_ThrowTypeError(ctx, "replace() requires a string");
+        std::vector<re2::StringPiece> matches;
+        if (!info.global) {
+            if (!execOnce(ctx, argv[0], info, *re, input, matches)) {
+                return JS_NULL;
+            }
+            return buildExecResult(ctx, input, matches);
         }
-        std::string input(str);
-        JS_FreeCString(ctx, str);
 
-        const char* repl_str = JS_ToCString(ctx, argv[1]);
+        // 전역 매칭: 모든 매치의 [0] 수집 (빈 매치는 한 칸 전진)
+        JSValue result_array = JS_NULL;
+        uint32_t count = 0;
+        size_t pos = 0;
+        re2::StringPiece whole;
+        while (pos <= input.size() &&
+               re->Match(input, pos, input.size(), re2::RE2::UNANCHORED, &whole, 1)) {
+            if (count == 0) {
+                result_array = JS_NewArray(ctx);
+            }
+            JS_SetPropertyUint32(ctx, result_array, count++, JS_NewStringLen(ctx, whole.data(), whole.size()));
+            size_t end = (whole.data() - input.data()) + whole.size();
+            pos = whole.empty() ? end + 1 : end;
+        }
+        writeLastIndex(ctx, argv[0], 0);
+        return result_array;
+    }
+
+    JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        static MetricCounter& fallback = fallbackMetric("replace");
+        RegExpInfo info;
+        std::string input;
+        std::string replacement;
+        std::shared_ptr<const re2::RE2> re = argc >= 2 ? lookup(ctx, argv[0], info) : nullptr;
+        // 치환 함수 / $ 패턴 / sticky 는 엔진 구현 사용
+        if (!re || info.sticky || !JS_IsString(argv[1]) || !toPlainAscii(ctx, this_val, input)) {
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
+        }
+        size_t repl_len = 0;
+        const char* repl_str = JS_ToCStringLen(ctx, &repl_len, argv[1]);
         if (!repl_str) {
-            return JS_NewString(ctx, input.c_str());
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
         }
-        std::string replacement(repl_str);
+        replacement.assign(repl_str, repl_len);
         JS_FreeCString(ctx, repl_str);
-
-        RegExpInfo info = RegExpInfo::extract(ctx, argv[0]);
-        if (info.pattern.empty()) {
-            return JS_NewString(ctx, input.c_str());
+        if (replacement.find('$') != std::string::npos) {
+            return callNative(ctx, func_data, this_val, argc, argv, fallback);
         }
 
-        try {
-            re2::RE2::Options options = createRE2Options(info);
-            re2::RE2 re(info.pattern, options);
-            
-            if (!re.ok()) {
-                return JS_NewString(ctx, input.c_str());
+        // RE2::Replace 의 rewrite 문법(\1 등)을 피하기 위해 직접 조립
+        std::string result;
+        result.reserve(input.size());
+        size_t pos = 0;
+        size_t copied = 0;
+        re2::StringPiece whole;
+        while (pos <= input.size() &&
+               re->Match(input, pos, input.size(), re2::RE2::UNANCHORED, &whole, 1)) {
+            size_t begin = whole.data() - input.data();
+            size_t end = begin + whole.size();
+            result.append(input, copied, begin - copied);
+            result += replacement;
+            copied = end;
+            if (!info.global) {
+                break;
             }
+            pos = whole.empty() ? end + 1 : end;
+        }
+        result.append(input, copied, std::string::npos);
 
-            std::string result = input;
-            
-            if (info.global) {
-                re2::RE2::GlobalReplace(&result, re, replacement);
-            } else {
-                re2::RE2::Replace(&result, re, replacement);
-            }
+        if (info.global) {
+            writeLastIndex(ctx, argv[0], 0);
+        }
+        return JS_NewStringLen(ctx, result.data(), result.size());
+    }
 
-            return JS_NewString(ctx, result.c_str());
-            
-        } catch (const std::exception& e) {
-            core::Log_Error("RegExp replace exception: %s", e.what());
-            return JS_NewString(ctx, input.c_str());
+    // 기존 메서드를 func_data[0] 로 보관하여 RE2 로 처리하지 못하는 경우 위임
+    static void installHook(JSContext* ctx, JSValue proto, const char* name, int length, JSCFunctionData* hook) {
+        JSValue native_fn = JS_GetPropertyStr(ctx, proto, name);
+        if (!JS_IsFunction(ctx, native_fn)) {
+            JS_FreeValue(ctx, native_fn);
+            SCAN_LOG_WARN("RegExp hook: native %s not found", name);
+            return;
         }
+        JSValue hook_fn = JS_NewCFunctionData(ctx, hook, length, 0, 1, &native_fn);
+        JS_FreeValue(ctx, native_fn);
+        JS_DefinePropertyValueStr(ctx, hook_fn, "name", JS_NewString(ctx, name), JS_PROP_CONFIGURABLE);
+        JS_SetPropertyStr(ctx, proto, name, hook_fn);
     }
 
     void registerRegExpMethods(JSContext* ctx, JSValue global_obj) {
         JSValue regexp_ctor = JS_GetPropertyStr(ctx, global_obj, "RegExp");
         if (JS_IsUndefined(regexp_ctor)) {
-            core::Log_Warn("RegExp constructor not found");
+            SCAN_LOG_WARN("RegExp constructor not found");
             return;
         }
 
-        JSValue regexp_proto = JS_GetPropertyStr(ctx, regexp_ctor, "prototype");
+        JSValue regexp_proto = JSAtoms::getProperty(ctx, regexp_ctor, JSAtomId::prototype);
         if (JS_IsUndefined(regexp_proto)) {
-            core::Log_Warn("RegExp.prototype not found");
+            SCAN_LOG_WARN("RegExp.prototype not found");
             JS_FreeValue(ctx, regexp_ctor);
             return;
         }
 
-        JS_SetPropertyStr(ctx, regexp_proto, "exec",
-            JS_NewCFunction(ctx, js_regexp_exec, "exec", 1));
-        
-        JS_SetPropertyStr(ctx, regexp_proto, "test",
-            JS_NewCFunction(ctx, js_regexp_test, "test", 1));
+        installHook(ctx, regexp_proto, "exec", 1, js_regexp_exec);
+        installHook(ctx, regexp_proto, "test", 1, js_regexp_test);
 
         JS_FreeValue(ctx, regexp_proto);
         JS_FreeValue(ctx, regexp_ctor);
 
         JSValue string_ctor = JS_GetPropertyStr(ctx, global_obj, "String");
         if (!JS_IsUndefined(string_ctor)) {
-            JSValue string_proto = JS_GetPropertyStr(ctx, string_ctor, "prototype");
+            JSValue string_proto = JSAtoms::getProperty(ctx, string_ctor, JSAtomId::prototype);
             if (!JS_IsUndefined(string_proto)) {
-                JS_SetPropertyStr(ctx, string_proto, "match",
-                    JS_NewCFunction(ctx, js_string_match, "match", 1));
-
-                JS_SetPropertyStr(ctx, string_proto, "replace",
-                    JS_NewCFunction(ctx, js_string_replace, "replace", 2));
+                installHook(ctx, string_proto, "match", 1, js_string_match);
+                installHook(ctx, string_proto, "replace", 2, js_string_replace);
 
                 JS_FreeValue(ctx, string_proto);
             }
             JS_FreeValue(ctx, string_ctor);
         }
 
-        core::Log_Info("RE2-based RegExp methods registered successfully");
+        SCAN_LOG_DEBUG("RE2-based RegExp methods registered successfully");
     }
 
 }
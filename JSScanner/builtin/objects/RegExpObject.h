@@ -10,6 +10,10 @@
  * - RegExp.prototype.exec(string) - 패턴 매칭 결과 반환
  * - String.prototype.match(regexp) - 문자열에서 패턴 매칭
  * - String.prototype.replace(regexp, replacement) - 패턴 기반 문자열 치환
+ *
+ * 컴파일된 RE2 는 컨텍스트별 RegexCache 에서 재사용하며,
+ * RE2 로 JS 의미를 보장할 수 없는 경우(역참조/lookaround, u 플래그, 비 ASCII 입력,
+ * 치환 함수나 $ 패턴 등)는 func_data[0] 에 보관한 QuickJS 기본 구현에 위임합니다.
  */
 
 namespace RegExpObject {
@@ -18,25 +22,25 @@ namespace RegExpObject {
  * RegExp.prototype.test(string)
  * 정규식이 문자열과 매치되는지 boolean 반환
  */
-JSValue js_regexp_test(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_regexp_test(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
 
 /**
  * RegExp.prototype.exec(string)
  * 정규식 매칭 결과를 배열로 반환 (매치되지 않으면 null)
  */
-JSValue js_regexp_exec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_regexp_exec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
 
 /**
  * String.prototype.match(regexp)
  * 문자열에서 정규식과 매칭되는 부분 찾기
  */
-JSValue js_string_match(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_string_match(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
 
 /**
  * String.prototype.replace(regexp, replacement)
  * 정규식으로 문자열 치환
  */
-JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
 
 /**
  * RegExp 객체 등록
@@ -8,69 +8,75 @@ namespace StringObject {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
 
-    JSValue js_string_fromCharCode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
-        std::string result = "";
-        std::vector<JsValue> args_vec;
+    JSValue js_string_fromCharCode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data) {
+        // 엔진 기본 구현에 위임 (func_data[0] = 원본 String.fromCharCode, UTF-16 처리 포함)
+        JSValue result = JS_Call(ctx, func_data[0], this_val, argc, argv);
+        if (JS_IsException(result)) {
+            return result;
+        }
 
-        for (int i = 0; i < argc; i++) {
-            int32_t code;
-            if (JS_ToInt32(ctx, &code, argv[i]) != 0) {
-                continue;
-            }
-            result += static_cast<char>(code);
-            args_vec.push_back(static_cast<double>(code));
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (!a_ctx) {
+            return result;
         }
 
-        // 🔥 호출 횟수 제한 체크
-        if (a_ctx) {
-            a_ctx->functionCallCounts["String.fromCharCode"]++;
+        // 🔥 호출 횟수 제한 (제한 초과 후에는 추적하지 않음)
+        if (!a_ctx->admitCall(HookApiId::STRING_FROM_CHAR_CODE)) {
+            return result;
+        }
 
-            int callCount = a_ctx->functionCallCounts["String.fromCharCode"];
+        // 받을 구독자가 없으면 (severity floor 미만) bus 쪽 변환은 필요 없음
+        const bool observed = a_ctx->dynamicAnalyzer && a_ctx->hookBus.wants(HookType::FUNCTION_CALL, 3);
+        if (!observed && !a_ctx->chainTrackerManager && !a_ctx->dynamicStringTracker) {
+            return result;
+        }
 
-            // 제한 초과 시 첫 번째 경고만 기록하고 이후는 무시
-            if (callCount > JSAnalyzerContext::MAX_FUNCTION_CALLS) {
-                if (callCount == JSAnalyzerContext::MAX_FUNCTION_CALLS + 1) {
-                    core::Log_Warn("String.fromCharCode exceeded $s" ,std::to_string(JSAnalyzerContext::MAX_FUNCTION_CALLS) +
-                                 " calls - further calls will be ignored to prevent DoS");
+        // 관찰 대상일 때만 인자/결과를 C++ 값으로 변환
+        size_t result_len = 0;
+        const char* result_cstr = JS_ToCStringLen(ctx, &result_len, result);
+        if (!result_cstr) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return result;
+        }
+        std::string result_str(result_cstr, result_len);
+        JS_FreeCString(ctx, result_cstr);
 
-                    // 경고 이벤트만 한 번 기록
-                    if (a_ctx->dynamicAnalyzer) {
-                        a_ctx->dynamicAnalyzer->recordEvent({
-                            HookType::FUNCTION_CALL,
-                            "String.fromCharCode",
-                            {JsValue("[LIMIT_EXCEEDED]")},
-                            JsValue("Analysis limit exceeded - function called too many times"),
-                            {},
-                            9  // 높은 severity
-                        });
-                    }
-                    a_ctx->analysisLimitExceeded = true;
-                }
-                // 제한 초과 후에는 추적하지 않음 (성능 향상)
-                return JS_NewString(ctx, result.c_str());
+        std::vector<JsValue> args_vec;
+        args_vec.reserve(argc);
+        for (int i = 0; i < argc; i++) {
+            int32_t code;
+            if (JS_ToInt32(ctx, &code, argv[i]) == 0) {
+                args_vec.push_back(static_cast<double>(code & 0xFFFF));
             }
         }
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({HookType::FUNCTION_CALL, "String.fromCharCode", args_vec, JsValue(result), {}, 3});
+        if (a_ctx->chainTrackerManager) {
+            a_ctx->chainTrackerManager->trackFunctionCall("String.fromCharCode", args_vec, JsValue(result_str));
         }
 
-        if (a_ctx && a_ctx->chainTrackerManager) {
-            a_ctx->chainTrackerManager->trackFunctionCall("String.fromCharCode", args_vec, JsValue(result));
+        if (a_ctx->dynamicStringTracker) {
+            a_ctx->dynamicStringTracker->trackString("_fromCharCode_result", result_str);
         }
 
-        if (a_ctx && a_ctx->dynamicStringTracker) {
-            a_ctx->dynamicStringTracker->trackString("_fromCharCode_result", result);
+        // 마지막 사용처이므로 payload 로 이동
+        if (observed) {
+            a_ctx->hookBus.emit(HookType::FUNCTION_CALL, 3, [&] {
+                return HookPayload{"String.fromCharCode", std::move(args_vec), JsValue(std::move(result_str)), {}};
+            });
         }
 
-        return JS_NewString(ctx, result.c_str());
+        return result;
     }
 
     void registerStringFunctions(JSContext* ctx, JSValue global_obj) {
         JSValue string_constructor = JS_GetPropertyStr(ctx, global_obj, "String");
-        JS_SetPropertyStr(ctx, string_constructor, "fromCharCode", 
-            JS_NewCFunction(ctx, js_string_fromCharCode, "fromCharCode", 1));
+        JSValue native_fn = JS_GetPropertyStr(ctx, string_constructor, "fromCharCode");
+        if (JS_IsFunction(ctx, native_fn)) {
+            JSValue hook_fn = JS_NewCFunctionData(ctx, js_string_fromCharCode, 1, 0, 1, &native_fn);
+            JS_DefinePropertyValueStr(ctx, hook_fn, "name", JS_NewString(ctx, "fromCharCode"), JS_PROP_CONFIGURABLE);
+            JS_SetPropertyStr(ctx, string_constructor, "fromCharCode", hook_fn);
+        }
+        JS_FreeValue(ctx, native_fn);
         JS_SetPropertyStr(ctx, global_obj, "String", string_constructor);
     }
 }
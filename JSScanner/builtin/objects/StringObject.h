@@ -12,6 +12,6 @@ namespace StringObject {
      */
     void registerStringFunctions(JSContext* ctx, JSValue global_obj);
 
-    // String.fromCharCode
-    JSValue js_string_fromCharCode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+    // String.fromCharCode hook (func_data[0] = 엔진 원본 구현)
+    JSValue js_string_fromCharCode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValueConst* func_data);
 }
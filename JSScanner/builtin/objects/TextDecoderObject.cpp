@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "TextDecoderObject.h"
+#include "../../core/JSAtomTable.h"
 #include <string>
 #include <vector>
 #include <cstring>
@@ -141,7 +142,7 @@ namespace TextDecoderObject {
         }
 
         // 인스턴스 객체 생성
-        JSValue proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+        JSValue proto = JSAtoms::getProperty(ctx, new_target, JSAtomId::prototype);
         JSValue obj = JS_NewObjectProtoClass(ctx, proto, 0);
         JS_FreeValue(ctx, proto);
         return obj;
@@ -2,6 +2,8 @@
 #include "WebAssemblyObject.h"
 #include "../helpers/JSValueConverter.h"
 #include "../../core/JSAnalyzer.h"
+#include "../../core/WasmModuleParser.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -24,16 +26,15 @@ struct WasmModuleInfo {
     int function_count = 0;
     int import_count = 0;
     std::vector<std::string> suspicious_imports;
+    // 🔥 NEW: WasmModuleParser 해석 결과
+    bool parsed = false;
+    WasmModuleParser::Summary module;
+    WasmModuleParser::HashLoopProfile hashLoop;
 };
 
+// 🔥 추정(함수 수 / 크기)이 아니라 code 섹션의 opcode 분포(rotl / xor / shift 밀도)와 export 이름으로 판단
 static bool isCryptoMiningPattern(const WasmModuleInfo& info) {
-    // Crypto mining patterns:
-    // 1. Large number of functions (>100)
-    // 2. Has memory section (for hash computation)
-    // 3. Large byte size (>50KB)
-    return info.function_count > 100 && 
-           info.has_memory && 
-           info.byte_size > 50000;
+    return info.parsed && info.hashLoop.looksLikeMiner;
 }
 
 static bool isSuspiciousImport(const std::string& import_name) {
@@ -50,57 +51,108 @@ static bool isSuspiciousImport(const std::string& import_name) {
     return false;
 }
 
+static std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+// ArrayBuffer / TypedArray 의 바이트 (없으면 nullptr)
+static const uint8_t* getWasmBytes(JSContext* ctx, JSValueConst buffer, size_t& size) {
+    size = 0;
+    uint8_t* data = JS_GetArrayBuffer(ctx, &size, buffer);
+    if (data) {
+        return data;
+    }
+    JS_FreeValue(ctx, JS_GetException(ctx));    // ArrayBuffer 가 아니면 TypeError
+
+    size_t offset = 0;
+    size_t length = 0;
+    size_t bytesPerElement = 0;
+    JSValue underlying = JS_GetTypedArrayBuffer(ctx, buffer, &offset, &length, &bytesPerElement);
+    if (JS_IsException(underlying)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return nullptr;
+    }
+    size_t total = 0;
+    data = JS_GetArrayBuffer(ctx, &total, underlying);
+    JS_FreeValue(ctx, underlying);      // 인자가 버퍼를 계속 참조하므로 포인터는 유효
+    if (!data || offset > total || length > total - offset) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return nullptr;
+    }
+    size = length;
+    return data + offset;
+}
+
 static WasmModuleInfo analyzeWasmBuffer(JSContext* ctx, JSValueConst buffer) {
     WasmModuleInfo info;
-    
-    // Get buffer size
+
     size_t size = 0;
-    uint8_t* data = JS_GetArrayBuffer(ctx, &size, buffer);
-    
-    if (data && size > 8) {
-        info.byte_size = size;
-        
-        // Check WASM magic number (0x00 0x61 0x73 0x6d)
-        if (data[0] == 0x00 && data[1] == 0x61 && 
-            data[2] == 0x73 && data[3] == 0x6d) {
-            
-            // Parse WASM sections (simplified)
-            size_t offset = 8; // Skip magic + version
-            
-            while (offset < size - 5) {
-                uint8_t section_id = data[offset++];
-                
-                // Read section size (simplified LEB128)
-                uint32_t section_size = data[offset++];
-                
-                switch (section_id) {
-                    case 1: // Type section
-                        info.function_count++;
-                        break;
-                    case 2: // Import section
-                        info.import_count++;
-                        info.has_network_imports = true; // Simplified
-                        break;
-                    case 3: // Function section
-                        info.function_count += section_size / 2; // Rough estimate
-                        break;
-                    case 4: // Table section
-                        info.has_table = true;
-                        break;
-                    case 5: // Memory section
-                        info.has_memory = true;
-                        break;
-                }
-                
-                offset += section_size;
-                if (offset >= size) break;
-            }
+    const uint8_t* data = getWasmBytes(ctx, buffer, size);
+    if (!data) {
+        return info;
+    }
+
+    info.byte_size = size;
+    info.module = WasmModuleParser::parse(data, size);
+    info.parsed = info.module.version != 0;     // 헤더 통과 (이후 오류는 module.error)
+    info.hashLoop = WasmModuleParser::profile(info.module);
+    info.function_count = static_cast<int>(info.module.totalFunctionCount());
+    info.import_count = static_cast<int>(info.module.importCount);
+    info.has_memory = info.module.hasMemory;
+    info.has_table = info.module.hasTable;
+
+    // 모듈이 선언한 import 이름 ("env.fetch" 등)
+    for (const auto& imp : info.module.imports) {
+        std::string full = imp.module + "." + imp.name;
+        std::string lower = toLower(full);
+        if (isSuspiciousImport(lower)) {
+            info.suspicious_imports.push_back(full);
+            info.has_network_imports |= lower.find("fetch") != std::string::npos ||
+                                        lower.find("xhr") != std::string::npos ||
+                                        lower.find("websocket") != std::string::npos;
+            info.has_crypto_imports |= lower.find("crypto") != std::string::npos;
         }
     }
-    
+
     return info;
 }
 
+// 🔥 NEW: 해석 결과 metadata (instantiate / compile 공통)
+static void addModuleMetadata(const WasmModuleInfo& info, std::map<std::string, JsValue>& metadata) {
+    if (!info.parsed) {
+        return;
+    }
+    const auto& module = info.module;
+    metadata["wasm_valid"] = JsValue(module.valid);
+    if (!module.error.empty()) {
+        metadata["parse_error"] = JsValue(module.error);
+    }
+    metadata["export_count"] = JsValue(static_cast<double>(module.exportCount));
+    metadata["instruction_count"] = JsValue(static_cast<double>(module.instructionCount));
+    metadata["rotate_density"] = JsValue(info.hashLoop.rotateDensity);
+    metadata["xor_density"] = JsValue(info.hashLoop.xorDensity);
+    metadata["hash_mix_density"] = JsValue(info.hashLoop.mixDensity);
+    if (info.hashLoop.minerExport) {
+        metadata["miner_export"] = JsValue(true);
+    }
+
+    std::string imports;
+    for (const auto& imp : module.imports) {
+        imports += imp.module + "." + imp.name + ", ";
+    }
+    if (!imports.empty()) {
+        metadata["module_imports"] = JsValue(imports);
+    }
+    std::string exports;
+    for (const auto& exp : module.exports) {
+        exports += exp.name + ", ";
+    }
+    if (!exports.empty()) {
+        metadata["module_exports"] = JsValue(exports);
+    }
+}
+
 // ============================================================================
 // Registration
 // ============================================================================
@@ -171,6 +223,7 @@ JSValue js_wasm_instantiate(JSContext* ctx, JSValueConst this_val,
         metadata["import_count"] = JsValue(static_cast<double>(info.import_count));
         metadata["has_memory"] = JsValue(info.has_memory);
         metadata["has_table"] = JsValue(info.has_table);
+        addModuleMetadata(info, metadata);
         
         int severity = 7;
         std::string reason;
@@ -204,13 +257,13 @@ JSValue js_wasm_instantiate(JSContext* ctx, JSValueConst this_val,
             metadata["all_imports"] = JsValue(imports_info);
         }
         
-        a_ctx->dynamicAnalyzer->recordEvent({
-            HookType::WASM_INSTANTIATE,
-            "WebAssembly.instantiate",
-            args_vec,
-            JsValue(),
-            metadata,
-            severity
+        a_ctx->hookBus.emit(HookType::WASM_INSTANTIATE, severity, [&] {
+            return HookPayload{
+                "WebAssembly.instantiate",
+                args_vec,
+                JsValue(),
+                metadata
+            };
         });
     }
 
@@ -264,6 +317,7 @@ JSValue js_wasm_compile(JSContext* ctx, JSValueConst this_val,
         metadata["module_size"] = JsValue(static_cast<double>(info.byte_size));
         metadata["function_count"] = JsValue(static_cast<double>(info.function_count));
         metadata["has_memory"] = JsValue(info.has_memory);
+        addModuleMetadata(info, metadata);
         
         int severity = 7;
         std::string reason;
@@ -271,6 +325,7 @@ JSValue js_wasm_compile(JSContext* ctx, JSValueConst this_val,
         if (isCryptoMiningPattern(info)) {
             severity = 10;
             reason = "CRYPTO MINING PATTERN!";
+            metadata["pattern"] = JsValue("crypto_mining");
         } else if (info.byte_size > 100000) {
             severity = 8;
             reason = "Large module compilation";
@@ -280,13 +335,13 @@ JSValue js_wasm_compile(JSContext* ctx, JSValueConst this_val,
             metadata["reason"] = JsValue(reason);
         }
         
-        a_ctx->dynamicAnalyzer->recordEvent({
-            HookType::WASM_COMPILE,
-            "WebAssembly.compile",
-            args_vec,
-            JsValue(),
-            metadata,
-            severity
+        a_ctx->hookBus.emit(HookType::WASM_COMPILE, severity, [&] {
+            return HookPayload{
+                "WebAssembly.compile",
+                args_vec,
+                JsValue(),
+                metadata
+            };
         });
     }
 
@@ -2,6 +2,7 @@
 #include "WebSocketObject.h"
 #include "../../core/JSAnalyzer.h"
 #include "../../hooks/HookType.h"
+#include "../../builtin/helpers/Base64Utils.h"
 #include "../../builtin/helpers/SensitiveKeywordDetector.h"
 #include <string>
 
@@ -32,8 +33,7 @@ bool containsSensitiveData(const std::string& data) {
 
 bool isBase64Encoded(const std::string& data) {
     if (data.length() < 16) return false;
-    RE2 base64_pattern("^[A-Za-z0-9+/]+=*$");
-    return RE2::FullMatch(data, base64_pattern);
+    return Base64Utils::isBase64(data);
 }
 
 // ============================================================================
@@ -59,28 +59,28 @@ void registerWebSocketObject(JSContext* ctx, JSValue global_obj) {
     onmessage_setter_type.setter = js_websocket_set_onmessage;
     JSValue onmessage_setter = JS_NewCFunction2(ctx, onmessage_setter_type.generic,
         "set_onmessage", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onmessage"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onmessage,
         JS_UNDEFINED, onmessage_setter, JS_PROP_C_W_E);
 
     JSCFunctionType onerror_setter_type;
     onerror_setter_type.setter = js_websocket_set_onerror;
     JSValue onerror_setter = JS_NewCFunction2(ctx, onerror_setter_type.generic,
         "set_onerror", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onerror"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onerror,
         JS_UNDEFINED, onerror_setter, JS_PROP_C_W_E);
 
     JSCFunctionType onopen_setter_type;
     onopen_setter_type.setter = js_websocket_set_onopen;
     JSValue onopen_setter = JS_NewCFunction2(ctx, onopen_setter_type.generic,
         "set_onopen", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onopen"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onopen,
         JS_UNDEFINED, onopen_setter, JS_PROP_C_W_E);
 
     JSCFunctionType onclose_setter_type;
     onclose_setter_type.setter = js_websocket_set_onclose;
     JSValue onclose_setter = JS_NewCFunction2(ctx, onclose_setter_type.generic,
         "set_onclose", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onclose"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onclose,
         JS_UNDEFINED, onclose_setter, JS_PROP_C_W_E);
 
     // Register getters
@@ -88,14 +88,14 @@ void registerWebSocketObject(JSContext* ctx, JSValue global_obj) {
     readyState_getter_type.getter = js_websocket_get_readyState;
     JSValue readyState_getter = JS_NewCFunction2(ctx, readyState_getter_type.generic,
         "get_readyState", 0, JS_CFUNC_getter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "readyState"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::readyState,
         readyState_getter, JS_UNDEFINED, JS_PROP_C_W_E);
 
     JSCFunctionType url_getter_type;
     url_getter_type.getter = js_websocket_get_url;
     JSValue url_getter = JS_NewCFunction2(ctx, url_getter_type.generic,
         "get_url", 0, JS_CFUNC_getter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "url"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::url,
         url_getter, JS_UNDEFINED, JS_PROP_C_W_E);
 
     JS_SetConstructor(ctx, ws_ctor, proto);
@@ -138,7 +138,7 @@ JSValue js_websocket_constructor(JSContext* ctx, JSValueConst new_target,
         event.tags.insert("network");
         event.tags.insert("websocket");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
     if (url) JS_FreeCString(ctx, url);
@@ -198,7 +198,7 @@ JSValue js_websocket_send(JSContext* ctx, JSValueConst this_val,
         event.tags.insert("network");
         event.tags.insert("websocket");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
     if (data) JS_FreeCString(ctx, data);
@@ -219,40 +219,39 @@ JSValue js_websocket_set_onmessage(JSContext* ctx, JSValueConst this_val,
                                    JSValueConst val) {
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
     if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::WEBSOCKET_MESSAGE;
-        event.severity = 9;
-        event.line = 0;
-        event.reason = "WebSocket onmessage - receiving remote commands";
+        a_ctx->hookBus.emit(HookType::WEBSOCKET_MESSAGE, 9, [&] {
+            HookEvent event;
+            event.line = 0;
+            event.reason = "WebSocket onmessage - receiving remote commands";
         
-        // Analyze handler function
-        if (JS_IsFunction(ctx, val)) {
-            JSValue str_val = JS_ToString(ctx, val);
-            const char* func_str = JS_ToCString(ctx, str_val);
+            // Analyze handler function
+            if (JS_IsFunction(ctx, val)) {
+                JSValue str_val = JS_ToString(ctx, val);
+                const char* func_str = JS_ToCString(ctx, str_val);
             
-            if (func_str) {
-                std::string func_content(func_str);
+                if (func_str) {
+                    std::string func_content(func_str);
                 
-                if (func_content.find("eval") != std::string::npos ||
-                    func_content.find("Function") != std::string::npos) {
-                    event.severity = 10;
-                    event.reason += " (Contains eval/Function - RCE!)";
-                    event.tags.insert("remote_code_execution");
-                }
+                    if (func_content.find("eval") != std::string::npos ||
+                        func_content.find("Function") != std::string::npos) {
+                        event.severity = 10;
+                        event.reason += " (Contains eval/Function - RCE!)";
+                        event.tags.insert("remote_code_execution");
+                    }
                 
-                event.features["handler_content"] = func_content.length() > 200 ?
-                    func_content.substr(0, 200) + "..." : func_content;
+                    event.features["handler_content"] = func_content.length() > 200 ?
+                        func_content.substr(0, 200) + "..." : func_content;
                 
-                JS_FreeCString(ctx, func_str);
+                    JS_FreeCString(ctx, func_str);
+                }
+                JS_FreeValue(ctx, str_val);
             }
-            JS_FreeValue(ctx, str_val);
-        }
         
-        event.tags.insert("remote_control");
-        event.tags.insert("event_handler");
-        event.tags.insert("websocket");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+            event.tags.insert("remote_control");
+            event.tags.insert("event_handler");
+            event.tags.insert("websocket");
+            return event;
+        });
     }
 
     JS_SetPropertyStr(ctx, this_val, "_onmessage", JS_DupValue(ctx, val));
@@ -4,16 +4,22 @@
 #include "../helpers/SensitiveKeywordDetector.h"
 #include "../../model/JsValueVariant.h"
 #include "../../core/JSAnalyzer.h"
+#include "../../core/HookTrace.h"
+#include <iterator>
 
 namespace WindowObject {
     // Forward declarations
     static JSValue createMockFetchResponse(JSContext* ctx, const std::string& url, const std::string& method,
-        const std::string& bodySnippet, bool sensitive);
+        const std::string& bodySnippet, bool sensitive, const ResponseCorpus::Response* stored);
     static JSValue createMockFetchPromise(JSContext* ctx, const std::string& url, const std::string& method,
-        const std::string& bodySnippet, bool sensitive);
+        const std::string& bodySnippet, bool sensitive, const ResponseCorpus::Response* stored);
     JSValue js_mock_response_text(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
     JSValue js_mock_response_json(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
 
+    static JSValue js_mock_response_clone(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
+        return JS_DupValue(ctx, this_val);
+    }
+
     static JSAnalyzerContext* get_analyzer_context(JSContext* ctx) {
         return static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
     }
@@ -47,8 +53,14 @@ namespace WindowObject {
                 a_ctx->urlCollector->addUrlWithMetadata(url, "location.href", 0);  // 🔥 MODIFIED
             }
             if (a_ctx->dynamicAnalyzer) {
-                a_ctx->dynamicAnalyzer->recordEvent({ HookType::LOCATION_CHANGE, "location.href.set",
-                    {JsValue(url)}, JsValue(std::monostate()), {}, 9 });
+                a_ctx->hookBus.emit(HookType::LOCATION_CHANGE, 9, [&] {
+                    return HookPayload{
+                        "location.href.set",
+                        {JsValue(url)},
+                        JsValue(std::monostate()),
+                        {}
+                    };
+                });
             }
             if (a_ctx->chainTrackerManager) {
                 a_ctx->chainTrackerManager->trackFunctionCall("window.location.href=",
@@ -72,8 +84,14 @@ namespace WindowObject {
                     a_ctx->urlCollector->addUrlWithMetadata(url, "location.replace", 0);  // 🔥 MODIFIED
                 }
                 if (a_ctx->dynamicAnalyzer) {
-                    a_ctx->dynamicAnalyzer->recordEvent({ HookType::LOCATION_CHANGE, "location.replace",
-                        {JsValue(url)}, JsValue(std::monostate()), {}, 9 });
+                    a_ctx->hookBus.emit(HookType::LOCATION_CHANGE, 9, [&] {
+                        return HookPayload{
+                            "location.replace",
+                            {JsValue(url)},
+                            JsValue(std::monostate()),
+                            {}
+                        };
+                    });
                 }
                 if (a_ctx->chainTrackerManager) {
                     a_ctx->chainTrackerManager->trackFunctionCall("window.location.replace",
@@ -98,8 +116,14 @@ namespace WindowObject {
                     a_ctx->urlCollector->addUrlWithMetadata(url, "location.assign", 0);  // 🔥 MODIFIED
                 }
                 if (a_ctx->dynamicAnalyzer) {
-                    a_ctx->dynamicAnalyzer->recordEvent({ HookType::LOCATION_CHANGE, "location.assign",
-                        {JsValue(url)}, JsValue(std::monostate()), {}, 9 });
+                    a_ctx->hookBus.emit(HookType::LOCATION_CHANGE, 9, [&] {
+                        return HookPayload{
+                            "location.assign",
+                            {JsValue(url)},
+                            JsValue(std::monostate()),
+                            {}
+                        };
+                    });
                 }
                 if (a_ctx->chainTrackerManager) {
                     a_ctx->chainTrackerManager->trackFunctionCall("window.location.assign",
@@ -123,13 +147,13 @@ namespace WindowObject {
         }
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::ENVIRONMENT_DETECTION,
-                "navigator.userAgent",
-                {},
-                JsValue(userAgent),
-                {},
-                6
+            a_ctx->hookBus.emit(HookType::ENVIRONMENT_DETECTION, 6, [&] {
+                return HookPayload{
+                    "navigator.userAgent",
+                    {},
+                    JsValue(userAgent),
+                    {}
+                };
             });
         }
 
@@ -274,21 +298,27 @@ namespace WindowObject {
     }
 
     static JSValue createMockFetchResponse(JSContext* ctx, const std::string& url, const std::string& method,
-        const std::string& bodySnippet, bool sensitive) {
+        const std::string& bodySnippet, bool sensitive, const ResponseCorpus::Response* stored) {
+        int status = stored ? stored->status : 200;
         JSValue response = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, response, "ok", JS_NewBool(ctx, 1));
-        JS_SetPropertyStr(ctx, response, "status", JS_NewInt32(ctx, 200));
-        JS_SetPropertyStr(ctx, response, "statusText", JS_NewString(ctx, "OK"));
+        JS_SetPropertyStr(ctx, response, "ok", JS_NewBool(ctx, status >= 200 && status < 300));
+        JS_SetPropertyStr(ctx, response, "status", JS_NewInt32(ctx, status));
+        JS_SetPropertyStr(ctx, response, "statusText", JS_NewString(ctx, status == 200 ? "OK" : ""));
         JS_SetPropertyStr(ctx, response, "url", JS_NewString(ctx, url.c_str()));
         JS_SetPropertyStr(ctx, response, "method", JS_NewString(ctx, method.c_str()));
         JS_SetPropertyStr(ctx, response, "sensitive", JS_NewBool(ctx, sensitive ? 1 : 0));
         JS_SetPropertyStr(ctx, response, "bodySnippet", JS_NewString(ctx, bodySnippet.c_str()));
+        // 🔥 오프라인 응답 저장소에 저장된 본문 (text() / json() 이 우선 사용)
+        if (stored) {
+            JS_SetPropertyStr(ctx, response, "responseBody", JS_NewStringLen(ctx, stored->body.data(), stored->body.size()));
+        }
 
-        JS_SetPropertyStr(ctx, response, "text", JS_NewCFunction(ctx, js_mock_response_text, "text", 0));
-        JS_SetPropertyStr(ctx, response, "json", JS_NewCFunction(ctx, js_mock_response_json, "json", 0));
-        JS_SetPropertyStr(ctx, response, "clone", JS_NewCFunction(ctx, [](JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
-            return JS_DupValue(ctx, this_val);
-            }, "clone", 0));
+        static const JSCFunctionListEntry mock_response_funcs[] = {
+            JS_CFUNC_DEF2("text", 0, js_mock_response_text, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("json", 0, js_mock_response_json, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("clone", 0, js_mock_response_clone, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, response, mock_response_funcs, sizeof(mock_response_funcs) / sizeof(mock_response_funcs[0]));
 
         return response;
     }
@@ -300,9 +330,6 @@ namespace WindowObject {
         std::string bodySnippet = "";
         bool hasSensitiveData = false;
 
-        // 디버그: fetch 호출 확인
-        // printf("[DEBUG] fetch() called with URL: %s\n", url.c_str());
-
         if (argc >= 2 && JS_IsObject(argv[1])) {
             JSValue method_val = JS_GetPropertyStr(ctx, argv[1], "method");
             if (!JS_IsException(method_val)) {
@@ -311,13 +338,10 @@ namespace WindowObject {
             }
             JS_FreeValue(ctx, method_val);
 
-            // printf("[DEBUG] fetch() method: %s\n", method.c_str());
-
             // body 파라미터 확인
             JSValue body_val = JS_GetPropertyStr(ctx, argv[1], "body");
             if (!JS_IsUndefined(body_val) && !JS_IsNull(body_val)) {
                 bodySnippet = JSValueConverter::toString(ctx, body_val);
-                // printf("[DEBUG] fetch() body: %s\n", bodySnippet.c_str());
                 
                 // 민감 데이터 확인
                 std::string bodyLower = bodySnippet;
@@ -327,20 +351,20 @@ namespace WindowObject {
                     bodyLower.find("token") != std::string::npos ||
                     bodyLower.find("auth") != std::string::npos) {
                     hasSensitiveData = true;
-                    printf("[DEBUG] Sensitive data detected!\n");
+                    HOOK_TRACE("fetch", "sensitive_body", {"url", url}, {"method", method});
                 }
             }
             JS_FreeValue(ctx, body_val);
         }
 
-        if (a_ctx && a_ctx->dynamicAnalyzer) {
+        if (a_ctx && a_ctx->admitCall(HookApiId::FETCH) && a_ctx->dynamicAnalyzer) {
             // 🔥 MODIFIED: 메타데이터 포함하여 URL 추가
             if (a_ctx->urlCollector) {
                 a_ctx->urlCollector->addUrlWithMetadata(url, "fetch", 0);
             }
             
             // 🔥 함수 호출 횟수 확인 (fetch 호출 전)
-            size_t functionCallCount = a_ctx->dynamicAnalyzer->getFunctionCallCount();
+            size_t functionCallCount = static_cast<size_t>(a_ctx->callCounters.activityCount());
             
             // 🔥 Taint 개수 확인
             size_t taintCount = 0;
@@ -376,15 +400,13 @@ namespace WindowObject {
                 
                 if (excessive_calls) {
                     metadata["excessive_function_calls"] = JsValue(true);
-                    printf("[ALERT] Suspicious fetch detected! Function call count: %zu (>= 1000)\n", functionCallCount);
+                    HOOK_TRACE("fetch", "excessive_calls", {"url", url}, {"method", method}, {"count", functionCallCount});
                 }
                 
                 if (excessive_taints) {
                     metadata["excessive_taints"] = JsValue(true);
-                    printf("[ALERT] Suspicious fetch detected! Taint count: %zu (>= 100)\n", taintCount);
+                    HOOK_TRACE("fetch", "excessive_taints", {"url", url}, {"method", method}, {"count", taintCount});
                 }
-                
-                printf("[ALERT] URL: %s, Method: %s\n", url.c_str(), method.c_str());
             }
 
             // HookEvent 생성 - 생성자 사용
@@ -400,11 +422,28 @@ namespace WindowObject {
             // status 설정
             fetchEvent.status = finalStatus;
 
-            a_ctx->dynamicAnalyzer->recordEvent(fetchEvent);
+            a_ctx->hookBus.emit(HookType::FETCH_REQUEST, finalSeverity, [&] { return std::move(fetchEvent); });
+        }
+
+        // 🔥 Task 디렉터리에 저장된 응답이 있으면 그 본문으로 응답 (다음 단계 payload 추적)
+        std::optional<ResponseCorpus::Response> stored;
+        if (a_ctx) {
+            stored = a_ctx->serveStoredResponse("fetch", method, url);
         }
 
         // Promise를 반환하여 .then() 체이닝이 가능하도록 함
-        return createMockFetchPromise(ctx, url, method, bodySnippet, hasSensitiveData);
+        return createMockFetchPromise(ctx, url, method, bodySnippet, hasSensitiveData, stored ? &*stored : nullptr);
+    }
+
+    // 저장된 응답 본문(responseBody), 없으면 요청 본문(bodySnippet)
+    static std::string mockResponseBody(JSContext* ctx, JSValueConst response) {
+        JSValue bodyVal = JS_GetPropertyStr(ctx, response, "responseBody");
+        if (JS_IsUndefined(bodyVal)) {
+            bodyVal = JS_GetPropertyStr(ctx, response, "bodySnippet");
+        }
+        std::string body = JSValueConverter::toString(ctx, bodyVal);
+        JS_FreeValue(ctx, bodyVal);
+        return body;
     }
 
     JSValue js_mock_response_text(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
@@ -415,11 +454,9 @@ namespace WindowObject {
             return JS_NewString(ctx, "");
         }
 
-        JSValue bodyVal = JS_GetPropertyStr(ctx, this_val, "bodySnippet");
-        std::string body = JSValueConverter::toString(ctx, bodyVal);
-        JS_FreeValue(ctx, bodyVal);
+        std::string body = mockResponseBody(ctx, this_val);
 
-        JSValue textValue = JS_NewString(ctx, body.c_str());
+        JSValue textValue = JS_NewStringLen(ctx, body.data(), body.size());
         JSValue callResult = JS_Call(ctx, resolvingFuncs[0], JS_UNDEFINED, 1, &textValue);
         JS_FreeValue(ctx, callResult);  // 🔥 반환값 해제
         JS_FreeValue(ctx, textValue);
@@ -436,9 +473,7 @@ namespace WindowObject {
             return JS_NewObject(ctx);
         }
 
-        JSValue bodyVal = JS_GetPropertyStr(ctx, this_val, "bodySnippet");
-        std::string body = JSValueConverter::toString(ctx, bodyVal);
-        JS_FreeValue(ctx, bodyVal);
+        std::string body = mockResponseBody(ctx, this_val);
 
         // JSON 파싱 시도
         JSValue jsonValue = JS_ParseJSON(ctx, body.c_str(), body.length(), "response.json");
@@ -458,16 +493,16 @@ namespace WindowObject {
     }
 
     static JSValue createMockFetchPromise(JSContext* ctx, const std::string& url, const std::string& method,
-        const std::string& bodySnippet, bool sensitive) {
+        const std::string& bodySnippet, bool sensitive, const ResponseCorpus::Response* stored) {
         JSValue resolvingFuncs[2];
         JSValue promise = JS_NewPromiseCapability(ctx, resolvingFuncs);
         if (JS_IsException(promise)) {
             JSValue exception = JS_GetException(ctx);
             JS_FreeValue(ctx, exception);
-            return createMockFetchResponse(ctx, url, method, bodySnippet, sensitive);
+            return createMockFetchResponse(ctx, url, method, bodySnippet, sensitive, stored);
         }
 
-        JSValue response = createMockFetchResponse(ctx, url, method, bodySnippet, sensitive);
+        JSValue response = createMockFetchResponse(ctx, url, method, bodySnippet, sensitive, stored);
         JSValue callResult = JS_Call(ctx, resolvingFuncs[0], JS_UNDEFINED, 1, &response);
         JS_FreeValue(ctx, callResult);  // 🔥 반환값 해제
         JS_FreeValue(ctx, response);
@@ -476,24 +511,95 @@ namespace WindowObject {
         return promise;
     }
 
+    // 🔥 window 대상 객체에 없는 이름의 대체 값 (atom → handler)
+    // - 브라우저에서는 window.window === window.self === window.top === window
+    using WindowProxyRoute = JSValue (*)(JSContext* ctx, JSValueConst target, JSValueConst receiver);
+
+    static JSValue route_window_self(JSContext* ctx, JSValueConst target, JSValueConst receiver) {
+        return JS_DupValue(ctx, receiver);
+    }
+
+    static const struct {
+        JSAtomId id;
+        WindowProxyRoute handler;
+    } WINDOW_PROXY_ROUTES[] = {
+        { JSAtomId::window, route_window_self },
+        { JSAtomId::self, route_window_self },
+        { JSAtomId::top, route_window_self },
+        { JSAtomId::parent, route_window_self },
+        { JSAtomId::frames, route_window_self },
+        { JSAtomId::globalThis, route_window_self },
+    };
+
+    static WindowProxyRoute find_window_proxy_route(JSContext* ctx, JSAtom atom) {
+        const JSAtomTable* atoms = JSAtoms::table(ctx);
+        if (!atoms) {
+            return nullptr;
+        }
+        for (const auto& route : WINDOW_PROXY_ROUTES) {
+            if ((*atoms)[route.id] == atom) {
+                return route.handler;
+            }
+        }
+        return nullptr;
+    }
+
     // Proxy get handler
+    // - 키를 문자열로 바꾸지 않고 atom 그대로 조회
+    // - 대상에 없는 이름은 컨텍스트의 WindowPropertyCache 에 기록해서 다음 조회부터 바로 반환
     static JSValue js_window_proxy_get(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
         if (argc < 2) return JS_UNDEFINED;
 
-        JSValue target = argv[0];
-        JSValue prop = argv[1];
+        JSValueConst target = argv[0];
+        JSValueConst receiver = argc >= 3 ? argv[2] : argv[0];
+
+        JSAtom atom = JS_ValueToAtom(ctx, argv[1]);
+        if (atom == JS_ATOM_NULL) {
+            return JS_EXCEPTION;
+        }
 
-        const char* prop_cstr = JS_ToCString(ctx, prop);
-        if (prop_cstr) {
-            std::string prop_name = prop_cstr;
-            JS_FreeCString(ctx, prop_cstr);
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        WindowPropertyCache* cache = a_ctx ? &a_ctx->windowPropertyCache : nullptr;
+
+        JSValue result = JS_UNDEFINED;
+        bool missing = cache && cache->isKnownMissing(ctx, atom);
+        if (!missing) {
+            result = JS_GetProperty(ctx, target, atom);
+            if (JS_IsUndefined(result)) {
+                int has = JS_HasProperty(ctx, target, atom);
+                if (has < 0) {
+                    JS_FreeAtom(ctx, atom);
+                    return JS_EXCEPTION;
+                }
+                missing = (has == 0);
+                if (missing && cache) {
+                    cache->markMissing(ctx, atom);
+                }
+            }
+        }
 
-            if (prop_name == "fetch") {
-                return JS_GetPropertyStr(ctx, target, "fetch");
+        if (missing) {
+            if (WindowProxyRoute route = find_window_proxy_route(ctx, atom)) {
+                result = route(ctx, target, receiver);
             }
         }
+        JS_FreeAtom(ctx, atom);
+        return result;
+    }
 
-        return JS_GetProperty(ctx, target, JS_ValueToAtom(ctx, prop));
+    // Proxy set / defineProperty / deleteProperty / setPrototypeOf handler
+    // - 미존재 캐시를 무효화한 뒤 등록 시 묶어둔 Reflect 함수로 그대로 위임
+    static const char* const WINDOW_PROXY_MUTATING_TRAPS[] = {
+        "set", "defineProperty", "deleteProperty", "setPrototypeOf"
+    };
+
+    static JSValue js_window_proxy_mutate(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv,
+        int magic, JSValueConst* func_data) {
+        JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+        if (a_ctx) {
+            a_ctx->windowPropertyCache.invalidate();
+        }
+        return JS_Call(ctx, func_data[0], JS_UNDEFINED, argc, argv);
     }
 
     void registerWindowObject(JSContext* ctx, JSValue global_obj) {
@@ -504,7 +610,7 @@ namespace WindowObject {
         JSCFunctionType nav_ua_getter_type;
         nav_ua_getter_type.getter = js_navigator_get_userAgent;
         JSValue nav_ua_getter = JS_NewCFunction2(ctx, nav_ua_getter_type.generic, "get_userAgent", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "userAgent"), nav_ua_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::userAgent, nav_ua_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_ua_getter);
         
         // 🔥 추가 navigator 속성들
@@ -512,50 +618,51 @@ namespace WindowObject {
         JSCFunctionType nav_platform_getter_type;
         nav_platform_getter_type.getter = js_navigator_get_platform;
         JSValue nav_platform_getter = JS_NewCFunction2(ctx, nav_platform_getter_type.generic, "get_platform", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "platform"), nav_platform_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::platform, nav_platform_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_platform_getter);
         
         // vendor
         JSCFunctionType nav_vendor_getter_type;
         nav_vendor_getter_type.getter = js_navigator_get_vendor;
         JSValue nav_vendor_getter = JS_NewCFunction2(ctx, nav_vendor_getter_type.generic, "get_vendor", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "vendor"), nav_vendor_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::vendor, nav_vendor_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_vendor_getter);
         
         // language
         JSCFunctionType nav_language_getter_type;
         nav_language_getter_type.getter = js_navigator_get_language;
         JSValue nav_language_getter = JS_NewCFunction2(ctx, nav_language_getter_type.generic, "get_language", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "language"), nav_language_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::language, nav_language_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_language_getter);
         
         // hardwareConcurrency
         JSCFunctionType nav_hw_getter_type;
         nav_hw_getter_type.getter = js_navigator_get_hardwareConcurrency;
         JSValue nav_hw_getter = JS_NewCFunction2(ctx, nav_hw_getter_type.generic, "get_hardwareConcurrency", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "hardwareConcurrency"), nav_hw_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::hardwareConcurrency, nav_hw_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_hw_getter);
         
         // deviceMemory
         JSCFunctionType nav_mem_getter_type;
         nav_mem_getter_type.getter = js_navigator_get_deviceMemory;
         JSValue nav_mem_getter = JS_NewCFunction2(ctx, nav_mem_getter_type.generic, "get_deviceMemory", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "deviceMemory"), nav_mem_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::deviceMemory, nav_mem_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_mem_getter);
         
         // maxTouchPoints
         JSCFunctionType nav_touch_getter_type;
         nav_touch_getter_type.getter = js_navigator_get_maxTouchPoints;
         JSValue nav_touch_getter = JS_NewCFunction2(ctx, nav_touch_getter_type.generic, "get_maxTouchPoints", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, navigator_obj, JS_NewAtom(ctx, "maxTouchPoints"), nav_touch_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, navigator_obj, JSAtomId::maxTouchPoints, nav_touch_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, nav_touch_getter);
         
         // Clipboard API 추가
         JSValue clipboard_obj = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, clipboard_obj, "writeText", 
-            JS_NewCFunction(ctx, js_navigator_clipboard_writeText, "writeText", 1));
-        JS_SetPropertyStr(ctx, clipboard_obj, "write", 
-            JS_NewCFunction(ctx, js_navigator_clipboard_write, "write", 1));
+        static const JSCFunctionListEntry clipboard_funcs[] = {
+            JS_CFUNC_DEF2("writeText", 1, js_navigator_clipboard_writeText, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("write", 1, js_navigator_clipboard_write, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, clipboard_obj, clipboard_funcs, sizeof(clipboard_funcs) / sizeof(clipboard_funcs[0]));
         JS_SetPropertyStr(ctx, navigator_obj, "clipboard", clipboard_obj);
 
         JS_SetPropertyStr(ctx, global_obj, "navigator", JS_DupValue(ctx, navigator_obj));
@@ -567,15 +674,15 @@ namespace WindowObject {
         JSCFunctionType setter_func_type;
         setter_func_type.setter = js_window_location_set_href;
         JSValue setter_obj = JS_NewCFunction2(ctx, setter_func_type.generic, "set_href", 1, JS_CFUNC_setter, 0);
-        JS_DefinePropertyGetSet(ctx, location_obj, JS_NewAtom(ctx, "href"), JS_UNDEFINED, setter_obj, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, location_obj, JSAtomId::href, JS_UNDEFINED, setter_obj, JS_PROP_C_W_E);
         JS_FreeValue(ctx, setter_obj);
 
-        JS_SetPropertyStr(ctx, location_obj, "replace",
-            JS_NewCFunction(ctx, js_window_location_replace, "replace", 1));
-        JS_SetPropertyStr(ctx, location_obj, "assign",
-            JS_NewCFunction(ctx, js_window_location_assign, "assign", 1));
+        static const JSCFunctionListEntry location_funcs[] = {
+            JS_CFUNC_DEF2("replace", 1, js_window_location_replace, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("assign", 1, js_window_location_assign, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, location_obj, location_funcs, sizeof(location_funcs) / sizeof(location_funcs[0]));
         JS_SetPropertyStr(ctx, window_obj, "location", location_obj);
-        JS_SetPropertyStr(ctx, window_obj, "fetch", JS_NewCFunction(ctx, js_fetch, "fetch", 2));
 
         JS_SetPropertyStr(ctx, window_obj, "navigator", JS_DupValue(ctx, navigator_obj));
         JS_FreeValue(ctx, navigator_obj);
@@ -587,42 +694,42 @@ namespace WindowObject {
         JSCFunctionType screen_width_getter_type;
         screen_width_getter_type.getter = js_screen_get_width;
         JSValue screen_width_getter = JS_NewCFunction2(ctx, screen_width_getter_type.generic, "get_width", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "width"), screen_width_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::width, screen_width_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_width_getter);
         
         // height
         JSCFunctionType screen_height_getter_type;
         screen_height_getter_type.getter = js_screen_get_height;
         JSValue screen_height_getter = JS_NewCFunction2(ctx, screen_height_getter_type.generic, "get_height", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "height"), screen_height_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::height, screen_height_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_height_getter);
         
         // availWidth
         JSCFunctionType screen_availWidth_getter_type;
         screen_availWidth_getter_type.getter = js_screen_get_availWidth;
         JSValue screen_availWidth_getter = JS_NewCFunction2(ctx, screen_availWidth_getter_type.generic, "get_availWidth", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "availWidth"), screen_availWidth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::availWidth, screen_availWidth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_availWidth_getter);
         
         // availHeight
         JSCFunctionType screen_availHeight_getter_type;
         screen_availHeight_getter_type.getter = js_screen_get_availHeight;
         JSValue screen_availHeight_getter = JS_NewCFunction2(ctx, screen_availHeight_getter_type.generic, "get_availHeight", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "availHeight"), screen_availHeight_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::availHeight, screen_availHeight_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_availHeight_getter);
         
         // colorDepth
         JSCFunctionType screen_colorDepth_getter_type;
         screen_colorDepth_getter_type.getter = js_screen_get_colorDepth;
         JSValue screen_colorDepth_getter = JS_NewCFunction2(ctx, screen_colorDepth_getter_type.generic, "get_colorDepth", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "colorDepth"), screen_colorDepth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::colorDepth, screen_colorDepth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_colorDepth_getter);
         
         // pixelDepth
         JSCFunctionType screen_pixelDepth_getter_type;
         screen_pixelDepth_getter_type.getter = js_screen_get_pixelDepth;
         JSValue screen_pixelDepth_getter = JS_NewCFunction2(ctx, screen_pixelDepth_getter_type.generic, "get_pixelDepth", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, screen_obj, JS_NewAtom(ctx, "pixelDepth"), screen_pixelDepth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, screen_obj, JSAtomId::pixelDepth, screen_pixelDepth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, screen_pixelDepth_getter);
         
         // screen 객체를 window와 전역에 등록
@@ -633,28 +740,45 @@ namespace WindowObject {
         JSCFunctionType innerWidth_getter_type;
         innerWidth_getter_type.getter = js_window_get_innerWidth;
         JSValue innerWidth_getter = JS_NewCFunction2(ctx, innerWidth_getter_type.generic, "get_innerWidth", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, window_obj, JS_NewAtom(ctx, "innerWidth"), innerWidth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, window_obj, JSAtomId::innerWidth, innerWidth_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, innerWidth_getter);
 
         JSCFunctionType innerHeight_getter_type;
         innerHeight_getter_type.getter = js_window_get_innerHeight;
         JSValue innerHeight_getter = JS_NewCFunction2(ctx, innerHeight_getter_type.generic, "get_innerHeight", 0, JS_CFUNC_getter, 0);
-        JS_DefinePropertyGetSet(ctx, window_obj, JS_NewAtom(ctx, "innerHeight"), innerHeight_getter, JS_UNDEFINED, JS_PROP_C_W_E);
+        JSAtoms::defineGetSet(ctx, window_obj, JSAtomId::innerHeight, innerHeight_getter, JS_UNDEFINED, JS_PROP_C_W_E);
         JS_FreeValue(ctx, innerHeight_getter);
 
-        JS_SetPropertyStr(ctx, window_obj, "stop",
-            JS_NewCFunction(ctx, js_window_stop, "stop", 0));
-        
-        // 🔥 NEW: window.open 추가
-        JS_SetPropertyStr(ctx, window_obj, "open",
-            JS_NewCFunction(ctx, js_window_open, "open", 3));
-
-        // 🔥 addEventListener 추가 (window와 전역 모두)
-        JS_SetPropertyStr(ctx, window_obj, "addEventListener",
-            JS_NewCFunction(ctx, js_addEventListener, "addEventListener", 2));
+        static const JSCFunctionListEntry window_funcs[] = {
+            JS_CFUNC_DEF2("fetch", 2, js_fetch, JS_PROP_C_W_E),
+            JS_CFUNC_DEF2("stop", 0, js_window_stop, JS_PROP_C_W_E),
+            // 🔥 NEW: window.open 추가
+            JS_CFUNC_DEF2("open", 3, js_window_open, JS_PROP_C_W_E),
+            // 🔥 addEventListener 추가 (window와 전역 모두)
+            JS_CFUNC_DEF2("addEventListener", 2, js_addEventListener, JS_PROP_C_W_E),
+        };
+        JS_SetPropertyFunctionList(ctx, window_obj, window_funcs, sizeof(window_funcs) / sizeof(window_funcs[0]));
 
         JSValue handler = JS_NewObject(ctx);
-        JS_SetPropertyStr(ctx, handler, "get", JS_NewCFunction(ctx, js_window_proxy_get, "get", 2));
+        JS_SetPropertyStr(ctx, handler, "get", JS_NewCFunction(ctx, js_window_proxy_get, "get", 3));
+
+        JSValue reflect_obj = JS_GetPropertyStr(ctx, global_obj, "Reflect");
+        for (int i = 0; i < static_cast<int>(std::size(WINDOW_PROXY_MUTATING_TRAPS)); ++i) {
+            JSValue reflect_fn = JS_GetPropertyStr(ctx, reflect_obj, WINDOW_PROXY_MUTATING_TRAPS[i]);
+            if (JS_IsFunction(ctx, reflect_fn)) {
+                JS_SetPropertyStr(ctx, handler, WINDOW_PROXY_MUTATING_TRAPS[i],
+                    JS_NewCFunctionData(ctx, js_window_proxy_mutate, 4, i, 1, &reflect_fn));
+            }
+            JS_FreeValue(ctx, reflect_fn);
+        }
+        JS_FreeValue(ctx, reflect_obj);
+
+        // 미존재 캐시는 window 의 prototype(Object.prototype) 변경도 확인해야 하므로 참조 보관
+        if (JSAnalyzerContext* a_ctx = get_analyzer_context(ctx)) {
+            JSValue window_proto = JS_GetPrototype(ctx, window_obj);
+            a_ctx->windowPropertyCache.attach(ctx, window_proto);
+            JS_FreeValue(ctx, window_proto);
+        }
 
         JSValue proxy_ctor = JS_GetPropertyStr(ctx, global_obj, "Proxy");
         JSValue proxy_args[2] = { window_obj, handler };
@@ -677,14 +801,14 @@ namespace WindowObject {
         JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
 
         if (a_ctx && a_ctx->dynamicAnalyzer) {
-            a_ctx->dynamicAnalyzer->recordEvent({
-                HookType::DOM_MANIPULATION,
-                "window.stop",
-                {},
-                JsValue(std::monostate()),
-                {{"action", JsValue("stop_page_loading")}},
-                8
-                });
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, 8, [&] {
+                return HookPayload{
+                    "window.stop",
+                    {},
+                    JsValue(std::monostate()),
+                    {{"action", JsValue("stop_page_loading")}}
+                };
+            });
         }
 
         return JS_UNDEFINED;
@@ -702,13 +826,13 @@ namespace WindowObject {
                 if (a_ctx) {
                     // DynamicAnalyzer에 이벤트 기록
                     if (a_ctx->dynamicAnalyzer) {
-                        a_ctx->dynamicAnalyzer->recordEvent({
-                            HookType::DATA_EXFILTRATION,
-                            "navigator.clipboard.writeText",
-                            {JsValue(text)},
-                            JsValue(std::monostate()),
-                            {},
-                            10  // CRITICAL severity
+                        a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, 10, [&] {  // CRITICAL severity
+                            return HookPayload{
+                                "navigator.clipboard.writeText",
+                                {JsValue(text)},
+                                JsValue(std::monostate()),
+                                {}
+                            };
                         });
                     }
                     
@@ -744,13 +868,13 @@ namespace WindowObject {
             
             if (a_ctx) {
                 if (a_ctx->dynamicAnalyzer) {
-                    a_ctx->dynamicAnalyzer->recordEvent({
-                        HookType::DATA_EXFILTRATION,
-                        "navigator.clipboard.write",
-                        {JsValue(content)},
-                        JsValue(std::monostate()),
-                        {},
-                        10
+                    a_ctx->hookBus.emit(HookType::DATA_EXFILTRATION, 10, [&] {
+                        return HookPayload{
+                            "navigator.clipboard.write",
+                            {JsValue(content)},
+                            JsValue(std::monostate()),
+                            {}
+                        };
                     });
                 }
                 
@@ -779,13 +903,13 @@ namespace WindowObject {
                 
                 // 동적 분석 이벤트 기록
                 if (a_ctx->dynamicAnalyzer) {
-                    a_ctx->dynamicAnalyzer->recordEvent({
-                        HookType::LOCATION_CHANGE,
-                        "window.open",
-                        {JsValue(url)},
-                        JsValue(std::monostate()),
-                        {},
-                        7  // MEDIUM severity
+                    a_ctx->hookBus.emit(HookType::LOCATION_CHANGE, 7, [&] {  // MEDIUM severity
+                        return HookPayload{
+                            "window.open",
+                            {JsValue(url)},
+                            JsValue(std::monostate()),
+                            {}
+                        };
                     });
                 }
                 
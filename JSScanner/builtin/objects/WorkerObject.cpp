@@ -3,6 +3,8 @@
 #include "../../core/JSAnalyzer.h"
 #include "../../hooks/HookType.h"
 #include "../../builtin/helpers/SensitiveKeywordDetector.h"
+#include "../../builtin/helpers/JSValueConverter.h"
+#include "GlobalObject.h"
 #include <string>
 
 namespace WorkerObject {
@@ -34,6 +36,210 @@ static JSValue js_messageport_close(JSContext* ctx, JSValueConst this_val,
     return JS_UNDEFINED;
 }
 
+// 보고용 URL (data: URL 은 길이 제한)
+static std::string shortUrl(const std::string& url) {
+    return url.length() > 128 ? url.substr(0, 128) + "..." : url;
+}
+
+// this 의 worker id (실행 중인 Worker 가 아니면 -1)
+static int getWorkerId(JSContext* ctx, JSValueConst this_val) {
+    int32_t id = -1;
+    JSValue id_val = JS_GetPropertyStr(ctx, this_val, "_workerId");
+    if (JS_IsNumber(id_val)) {
+        JS_ToInt32(ctx, &id, id_val);
+    }
+    JS_FreeValue(ctx, id_val);
+    return id;
+}
+
+// 🔥 Worker 스크립트 해석: blob: (URL.createObjectURL) / data: / 저장된 응답
+// 반환: 출처 이름 (찾지 못하면 nullptr)
+static const char* resolveWorkerScript(JSAnalyzerContext* a_ctx, const std::string& url, std::string& source) {
+    if (isBlobUrl(url)) {
+        auto it = a_ctx->blobUrls.find(url);
+        if (it == a_ctx->blobUrls.end()) {
+            return nullptr;
+        }
+        source = it->second;
+        return "blob";
+    }
+    if (isDataUrl(url)) {
+        return WorkerHost::decodeDataUrl(url, source) ? "data" : nullptr;
+    }
+    std::optional<ResponseCorpus::Response> stored = a_ctx->serveStoredResponse("Worker", "GET", url);
+    if (!stored) {
+        return nullptr;
+    }
+    source = std::move(stored->body);
+    return "stored";
+}
+
+// 스크립트를 찾으면 WorkerHost 에서 실행 시작 (worker id, 실행하지 않으면 -1)
+// execution: 이벤트에 기록할 실행 상태 (blob / data / stored / unresolved / nested / limit)
+static int launchWorker(JSContext* ctx, JSAnalyzerContext* a_ctx, JSValueConst target,
+                        const std::string& url, bool shared, std::string& execution) {
+    if (!a_ctx || !a_ctx->workerHost) {
+        execution = (a_ctx && a_ctx->workerChannel) ? "nested" : "disabled";
+        return -1;
+    }
+    std::string source;
+    const char* origin = resolveWorkerScript(a_ctx, url, source);
+    if (!origin) {
+        execution = "unresolved";
+        return -1;
+    }
+    if (a_ctx->dynamicStringTracker) {
+        a_ctx->dynamicStringTracker->trackString("worker:" + shortUrl(url), source);
+    }
+    int id = a_ctx->workerHost->start(ctx, target, url, std::move(source), shared);
+    execution = id >= 0 ? origin : "limit";
+    return id;
+}
+
+// postMessage 이벤트 (부모 → Worker, Worker → 부모 공통)
+static void emitPostMessageEvent(JSAnalyzerContext* a_ctx, const std::string& msg_str, const char* reason) {
+    if (!a_ctx || !a_ctx->dynamicAnalyzer) {
+        return;
+    }
+    bool sensitive = SensitiveKeywordDetector::containsSensitiveKeyword(msg_str);
+    a_ctx->hookBus.emit(HookType::WORKER_POST_MESSAGE, sensitive ? 10 : 7, [&] {
+        HookEvent event;
+        event.line = 0;
+        event.reason = reason;
+        if (sensitive) {
+            event.reason += " (SENSITIVE DATA)";
+            event.tags.insert("data_exfiltration");
+        }
+        event.features["message"] = msg_str.length() > 200 ?
+            msg_str.substr(0, 200) + "..." : msg_str;
+        event.tags.insert("worker");
+        event.tags.insert("background_execution");
+        return event;
+    });
+}
+
+static void callListener(JSContext* ctx, JSValueConst fn, JSValueConst this_val, JSValueConst event) {
+    JSValue result = JS_Call(ctx, fn, this_val, 1, &event);
+    if (JS_IsException(result)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+    }
+    JS_FreeValue(ctx, result);
+}
+
+// ============================================================================
+// Worker Scope (WorkerHost 가 만든 Worker 컨텍스트 전용)
+// ============================================================================
+
+// Worker 안의 postMessage / port.postMessage → 부모
+static JSValue js_worker_scope_postMessage(JSContext* ctx, JSValueConst this_val,
+                                           int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (!a_ctx || !a_ctx->workerChannel) {
+        return JS_UNDEFINED;
+    }
+    std::string data = argc > 0 ? WorkerHost::serializeMessage(ctx, argv[0]) : "";
+    emitPostMessageEvent(a_ctx, data, "Worker postMessage - data returned to page");
+    if (data.length() <= WorkerHost::MAX_MESSAGE_BYTES) {
+        a_ctx->workerChannel->outbox.push(std::move(data));
+    } else {
+        a_ctx->workerChannel->outbox.recordDropped();
+    }
+    return JS_UNDEFINED;
+}
+
+// Worker 안의 close() - 남은 메시지를 처리하지 않고 종료
+static JSValue js_worker_scope_close(JSContext* ctx, JSValueConst this_val,
+                                     int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx && a_ctx->workerChannel) {
+        a_ctx->workerChannel->inbox.close();
+    }
+    return JS_UNDEFINED;
+}
+
+static void deleteGlobal(JSContext* ctx, JSValueConst global_obj, const char* name) {
+    JSAtom atom = JS_NewAtom(ctx, name);
+    JS_DeleteProperty(ctx, global_obj, atom, 0);
+    JS_FreeAtom(ctx, atom);
+}
+
+void installWorkerScope(JSContext* ctx, JSValue global_obj) {
+    // WorkerGlobalScope 에는 window / document 가 없고 self 는 전역 객체
+    deleteGlobal(ctx, global_obj, "window");
+    deleteGlobal(ctx, global_obj, "document");
+    JS_SetPropertyStr(ctx, global_obj, "self", JS_DupValue(ctx, global_obj));
+
+    JS_SetPropertyStr(ctx, global_obj, "postMessage",
+        JS_NewCFunction(ctx, js_worker_scope_postMessage, "postMessage", 1));
+    JS_SetPropertyStr(ctx, global_obj, "close",
+        JS_NewCFunction(ctx, js_worker_scope_close, "close", 0));
+    JS_SetPropertyStr(ctx, global_obj, "addEventListener",
+        JS_NewCFunction(ctx, js_worker_addEventListener, "addEventListener", 2));
+}
+
+JSValue createWorkerPort(JSContext* ctx) {
+    JSValue port = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, port, "postMessage",
+        JS_NewCFunction(ctx, js_worker_scope_postMessage, "postMessage", 1));
+    JS_SetPropertyStr(ctx, port, "start", JS_NewCFunction(ctx, js_messageport_start, "start", 0));
+    JS_SetPropertyStr(ctx, port, "close", JS_NewCFunction(ctx, js_messageport_close, "close", 0));
+    JS_SetPropertyStr(ctx, port, "addEventListener",
+        JS_NewCFunction(ctx, js_worker_addEventListener, "addEventListener", 2));
+    return port;
+}
+
+JSValue createMessageEvent(JSContext* ctx, const std::string& message) {
+    JSValue event = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, event, "type", JS_NewString(ctx, "message"));
+    JS_SetPropertyStr(ctx, event, "data", WorkerHost::deserializeMessage(ctx, message));
+    JS_SetPropertyStr(ctx, event, "origin", JS_NewString(ctx, ""));
+    return event;
+}
+
+JSValue createConnectEvent(JSContext* ctx, JSValueConst port) {
+    JSValue event = JS_NewObject(ctx);
+    JSValue ports = JS_NewArray(ctx);
+    JS_SetPropertyUint32(ctx, ports, 0, JS_DupValue(ctx, port));
+    JS_SetPropertyStr(ctx, event, "type", JS_NewString(ctx, "connect"));
+    JS_SetPropertyStr(ctx, event, "data", JS_NewString(ctx, ""));
+    JS_SetPropertyStr(ctx, event, "ports", ports);
+    JS_SetPropertyStr(ctx, event, "source", JS_DupValue(ctx, port));
+    return event;
+}
+
+int dispatchEvent(JSContext* ctx, JSValueConst target, const char* type, JSValueConst event) {
+    int called = 0;
+    std::string name = std::string("on") + type;
+
+    // on<type> 속성 (Worker.prototype 의 setter 는 _on<type> 에 저장)
+    JSValue handler = JS_GetPropertyStr(ctx, target, name.c_str());
+    if (!JS_IsFunction(ctx, handler)) {
+        JS_FreeValue(ctx, handler);
+        handler = JS_GetPropertyStr(ctx, target, ("_" + name).c_str());
+    }
+    if (JS_IsFunction(ctx, handler)) {
+        callListener(ctx, handler, target, event);
+        called++;
+    }
+    JS_FreeValue(ctx, handler);
+
+    JSValue listeners = JS_GetPropertyStr(ctx, target, ("_listeners_" + std::string(type)).c_str());
+    if (JS_IsArray(listeners)) {
+        int64_t len = 0;
+        JS_GetLength(ctx, listeners, &len);
+        for (int64_t i = 0; i < len; i++) {
+            JSValue fn = JS_GetPropertyUint32(ctx, listeners, static_cast<uint32_t>(i));
+            if (JS_IsFunction(ctx, fn)) {
+                callListener(ctx, fn, target, event);
+                called++;
+            }
+            JS_FreeValue(ctx, fn);
+        }
+    }
+    JS_FreeValue(ctx, listeners);
+    return called;
+}
+
 // ============================================================================
 // Registration
 // ============================================================================
@@ -49,19 +255,21 @@ void registerWorkerObject(JSContext* ctx, JSValue global_obj) {
         JS_NewCFunction(ctx, js_worker_postMessage, "postMessage", 1));
     JS_SetPropertyStr(ctx, proto, "terminate",
         JS_NewCFunction(ctx, js_worker_terminate, "terminate", 0));
+    JS_SetPropertyStr(ctx, proto, "addEventListener",
+        JS_NewCFunction(ctx, js_worker_addEventListener, "addEventListener", 2));
 
     JSCFunctionType onmessage_setter_type;
     onmessage_setter_type.setter = js_worker_set_onmessage;
     JSValue onmessage_setter = JS_NewCFunction2(ctx, onmessage_setter_type.generic,
         "set_onmessage", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onmessage"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onmessage,
         JS_UNDEFINED, onmessage_setter, JS_PROP_C_W_E);
 
     JSCFunctionType onerror_setter_type;
     onerror_setter_type.setter = js_worker_set_onerror;
     JSValue onerror_setter = JS_NewCFunction2(ctx, onerror_setter_type.generic,
         "set_onerror", 1, JS_CFUNC_setter, 0);
-    JS_DefinePropertyGetSet(ctx, proto, JS_NewAtom(ctx, "onerror"),
+    JSAtoms::defineGetSet(ctx, proto, JSAtomId::onerror,
         JS_UNDEFINED, onerror_setter, JS_PROP_C_W_E);
 
     JS_SetConstructor(ctx, worker_ctor, proto);
@@ -86,7 +294,22 @@ JSValue js_worker_constructor(JSContext* ctx, JSValueConst new_target,
     const char* script_url = JS_ToCString(ctx, argv[0]);
     std::string url = script_url ? script_url : "";
 
+    // Worker.prototype 을 쓰는 객체 (postMessage / terminate / onmessage)
+    JSValue proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+    JSValue obj = JS_NewObjectProto(ctx, proto);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj)) {
+        if (script_url) JS_FreeCString(ctx, script_url);
+        return obj;
+    }
+    JS_SetPropertyStr(ctx, obj, "_scriptUrl", JS_DupValue(ctx, argv[0]));
+
+    // 🔥 스크립트를 찾으면 별도 컨텍스트에서 실행
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    std::string execution;
+    int worker_id = launchWorker(ctx, a_ctx, obj, url, false, execution);
+    JS_SetPropertyStr(ctx, obj, "_workerId", JS_NewInt32(ctx, worker_id));
+
     if (a_ctx && a_ctx->dynamicAnalyzer) {
         HookEvent event;
         event.hookType = HookType::WORKER_CREATE;
@@ -105,18 +328,16 @@ JSValue js_worker_constructor(JSContext* ctx, JSValueConst new_target,
             event.severity = 8;
         }
 
-        event.features["script_url"] = url;
+        event.features["script_url"] = shortUrl(url);
+        event.features["execution"] = execution;
         event.tags.insert("background_execution");
         event.tags.insert("worker");
         event.tags.insert("threading");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
     if (script_url) JS_FreeCString(ctx, script_url);
-
-    JSValue obj = JS_NewObjectClass(ctx, 0);
-    JS_SetPropertyStr(ctx, obj, "_scriptUrl", JS_DupValue(ctx, argv[0]));
     return obj;
 }
 
@@ -128,38 +349,31 @@ JSValue js_worker_postMessage(JSContext* ctx, JSValueConst this_val,
                               int argc, JSValueConst* argv) {
     if (argc < 1) return JS_UNDEFINED;
 
-    const char* message = JS_ToCString(ctx, argv[0]);
-    std::string msg_str = message ? message : "";
+    // 객체는 "[object Object]" 대신 직렬화된 JSON 으로 검사 / 전달
+    std::string msg_str = WorkerHost::serializeMessage(ctx, argv[0]);
+    std::string data = msg_str;
+    if (msg_str.empty()) {
+        msg_str = JSValueConverter::toString(ctx, argv[0]);
+    }
 
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
-    if (a_ctx && a_ctx->dynamicAnalyzer) {
-        HookEvent event;
-        event.hookType = HookType::WORKER_POST_MESSAGE;
-        event.line = 0;
-        event.reason = "Worker.postMessage - data transfer to background";
+    emitPostMessageEvent(a_ctx, msg_str, "Worker.postMessage - data transfer to background");
 
-        if (SensitiveKeywordDetector::containsSensitiveKeyword(msg_str)) {
-            event.severity = 10;
-            event.reason += " (SENSITIVE DATA)";
-            event.tags.insert("data_exfiltration");
-        } else {
-            event.severity = 7;
+    if (a_ctx && a_ctx->workerHost) {
+        int worker_id = getWorkerId(ctx, this_val);
+        if (worker_id >= 0) {
+            a_ctx->workerHost->postMessage(worker_id, std::move(data));
         }
-
-        event.features["message"] = msg_str.length() > 200 ?
-            msg_str.substr(0, 200) + "..." : msg_str;
-        event.tags.insert("worker");
-        event.tags.insert("background_execution");
-
-        a_ctx->dynamicAnalyzer->recordEvent(event);
     }
-
-    if (message) JS_FreeCString(ctx, message);
     return JS_UNDEFINED;
 }
 
 JSValue js_worker_terminate(JSContext* ctx, JSValueConst this_val, 
                             int argc, JSValueConst* argv) {
+    JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    if (a_ctx && a_ctx->workerHost) {
+        a_ctx->workerHost->terminate(getWorkerId(ctx, this_val));
+    }
     return JS_UNDEFINED;
 }
 
@@ -179,6 +393,30 @@ JSValue js_worker_set_onerror(JSContext* ctx, JSValueConst this_val,
     return JS_UNDEFINED;
 }
 
+// addEventListener(type, fn) - _listeners_<type> 배열에 보관 (dispatchEvent 에서 호출)
+// Worker 컨텍스트의 전역 addEventListener 는 this 가 없으므로 전역 객체에 보관
+JSValue js_worker_addEventListener(JSContext* ctx, JSValueConst this_val,
+                                   int argc, JSValueConst* argv) {
+    if (argc < 2 || !JS_IsFunction(ctx, argv[1])) {
+        return JS_UNDEFINED;
+    }
+    std::string key = "_listeners_" + JSValueConverter::toString(ctx, argv[0]);
+
+    JSValue target = JS_IsObject(this_val) ? JS_DupValue(ctx, this_val) : JS_GetGlobalObject(ctx);
+    JSValue listeners = JS_GetPropertyStr(ctx, target, key.c_str());
+    if (!JS_IsArray(listeners)) {
+        JS_FreeValue(ctx, listeners);
+        listeners = JS_NewArray(ctx);
+        JS_SetPropertyStr(ctx, target, key.c_str(), JS_DupValue(ctx, listeners));
+    }
+    int64_t len = 0;
+    JS_GetLength(ctx, listeners, &len);
+    JS_SetPropertyUint32(ctx, listeners, static_cast<uint32_t>(len), JS_DupValue(ctx, argv[1]));
+    JS_FreeValue(ctx, listeners);
+    JS_FreeValue(ctx, target);
+    return JS_UNDEFINED;
+}
+
 // ============================================================================
 // SharedWorker Constructor
 // ============================================================================
@@ -195,7 +433,29 @@ JSValue js_sharedworker_constructor(JSContext* ctx, JSValueConst new_target,
     std::string url = script_url ? script_url : "";
     std::string worker_name = name ? name : "";
 
+    // Create SharedWorker object with port property
+    JSValue obj = JS_NewObject(ctx);
+    JS_SetPropertyStr(ctx, obj, "_scriptUrl", JS_DupValue(ctx, argv[0]));
+    
+    // Create MessagePort object for cross-tab communication
+    JSValue port = JS_NewObject(ctx);
+    JSValue postMessage_func = JS_NewCFunction(ctx, js_worker_postMessage, "postMessage", 1);
+    JSValue start_func = JS_NewCFunction(ctx, js_messageport_start, "start", 0);
+    JSValue close_func = JS_NewCFunction(ctx, js_messageport_close, "close", 0);
+
+    JS_SetPropertyStr(ctx, port, "postMessage", postMessage_func);
+    JS_SetPropertyStr(ctx, port, "start", start_func);
+    JS_SetPropertyStr(ctx, port, "close", close_func);
+    JS_SetPropertyStr(ctx, port, "addEventListener",
+        JS_NewCFunction(ctx, js_worker_addEventListener, "addEventListener", 2));
+
+    // 🔥 Worker 가 보내는 메시지는 port 로 전달
     JSAnalyzerContext* a_ctx = get_analyzer_context(ctx);
+    std::string execution;
+    int worker_id = launchWorker(ctx, a_ctx, port, url, true, execution);
+    JS_SetPropertyStr(ctx, port, "_workerId", JS_NewInt32(ctx, worker_id));
+    JS_SetPropertyStr(ctx, obj, "port", port);
+
     if (a_ctx && a_ctx->dynamicAnalyzer) {
         HookEvent event;
         event.hookType = HookType::SHARED_WORKER_CREATE;
@@ -214,35 +474,19 @@ JSValue js_sharedworker_constructor(JSContext* ctx, JSValueConst new_target,
             event.severity = 9;
         }
 
-        event.features["script_url"] = url;
+        event.features["script_url"] = shortUrl(url);
         event.features["worker_name"] = worker_name;
+        event.features["execution"] = execution;
         event.tags.insert("background_execution");
         event.tags.insert("shared_worker");
         event.tags.insert("cross_tab_communication");
         event.tags.insert("persistence");
 
-        a_ctx->dynamicAnalyzer->recordEvent(event);
+        a_ctx->hookBus.emit(event.hookType, event.severity, [&] { return std::move(event); });
     }
 
     if (script_url) JS_FreeCString(ctx, script_url);
     if (name && argc > 1) JS_FreeCString(ctx, name);
-
-    // Create SharedWorker object with port property
-    JSValue obj = JS_NewObjectClass(ctx, 0);
-    JS_SetPropertyStr(ctx, obj, "_scriptUrl", JS_DupValue(ctx, argv[0]));
-    
-    // Create MessagePort object for cross-tab communication
-    JSValue port = JS_NewObject(ctx);
-    JSValue postMessage_func = JS_NewCFunction(ctx, js_worker_postMessage, "postMessage", 1);
-    JSValue start_func = JS_NewCFunction(ctx, js_messageport_start, "start", 0);
-    JSValue close_func = JS_NewCFunction(ctx, js_messageport_close, "close", 0);
-
-    JS_SetPropertyStr(ctx, port, "postMessage", postMessage_func);
-    JS_SetPropertyStr(ctx, port, "start", start_func);
-    JS_SetPropertyStr(ctx, port, "close", close_func);
-
-    JS_SetPropertyStr(ctx, obj, "port", port);
-    
     return obj;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../quickjs.h"
+#include <string>
 
 /**
  * Worker/SharedWorker 객체 - 백그라운드 악성코드 탐지 (Priority: HIGH)
@@ -16,6 +17,9 @@
  * 3. 암호화 작업 (크립토마이닝) → Severity 8
  * 4. Blob URL로 Worker 생성 (난독화) → Severity 9
  * 5. SharedWorker로 탭 간 데이터 공유 → Severity 9
+ *
+ * 🔥 스크립트 실행: blob: / data: / 저장된 응답으로 해석되는 Worker 는
+ *    WorkerHost 가 별도 런타임에서 실행 (postMessage 는 양방향 메시지 큐로 전달)
  */
 namespace WorkerObject {
     
@@ -40,5 +44,17 @@ namespace WorkerObject {
                                     JSValueConst val);
     JSValue js_worker_set_onerror(JSContext* ctx, JSValueConst this_val, 
                                   JSValueConst val);
+    JSValue js_worker_addEventListener(JSContext* ctx, JSValueConst this_val,
+                                       int argc, JSValueConst* argv);
+
+    // 🔥 Worker 실행 지원 (core/WorkerHost)
+    // target 의 on<type> / _on<type> 핸들러와 addEventListener 리스너 호출 (호출한 개수)
+    int dispatchEvent(JSContext* ctx, JSValueConst target, const char* type, JSValueConst event);
+    JSValue createMessageEvent(JSContext* ctx, const std::string& message);
+    JSValue createConnectEvent(JSContext* ctx, JSValueConst port);
+    // Worker 컨텍스트 안의 MessagePort (postMessage → 부모)
+    JSValue createWorkerPort(JSContext* ctx);
+    // Worker 컨텍스트 전역: self / postMessage / close / addEventListener (window / document 없음)
+    void installWorkerScope(JSContext* ctx, JSValue global_obj);
 
 } // namespace WorkerObject
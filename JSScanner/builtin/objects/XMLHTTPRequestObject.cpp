@@ -4,6 +4,7 @@
 #include "../../core/DynamicStringTracker.h"
 #include "../../core/ChainTrackerManager.h"
 #include "../../core/JSAnalyzer.h" // For JSAnalyzerContext
+#include "../../core/HookTrace.h"
 
 // Forward declaration of JSAnalyzerContext is no longer needed here as JSAnalyzer.h is included
 // struct JSAnalyzerContext; // Remove this line if it exists
@@ -166,9 +167,7 @@ void XMLHTTPRequestObject::analyzeXHRSecurity(const std::string& method, const s
 
 void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, const std::string& url, const std::string& body, const std::map<std::string, std::string>& headers) {
     // 🔥 함수 호출 카운터 증가
-    if (a_ctx && a_ctx->dynamicAnalyzer) {
-        a_ctx->dynamicAnalyzer->incrementFunctionCallCount();
-    }
+    bool admitted = a_ctx && a_ctx->admitCall(HookApiId::XHR_SEND);
     
     if (method == "POST" || method == "PUT") {
         if (!body.empty()) {
@@ -197,9 +196,9 @@ void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, con
         }
     }
     
-    // 🔥 XHR 요청에 대한 recordEvent 추가 (fetch와 동일한 로직)
-    if (a_ctx && a_ctx->dynamicAnalyzer) {
-        size_t functionCallCount = a_ctx->dynamicAnalyzer->getFunctionCallCount();
+    // 🔥 XHR 요청에 대한 hook 이벤트 추가 (fetch와 동일한 로직)
+    if (admitted && a_ctx->dynamicAnalyzer) {
+        size_t functionCallCount = static_cast<size_t>(a_ctx->callCounters.activityCount());
         
         // 🔥 Taint 개수 확인
         size_t taintCount = 0;
@@ -246,7 +245,7 @@ void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, con
             finalSeverity += 2;
             finalStatus = 1;
             eventMetadata["excessive_function_calls"] = JsValue(true);
-            printf("[ALERT] Excessive XHR calls! Function call count: %zu (>= 1000)\n", functionCallCount);
+            HOOK_TRACE("xhr", "excessive_calls", {"url", url}, {"count", functionCallCount});
         }
         
         // 3. 과도한 Taint (+2점)
@@ -254,7 +253,7 @@ void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, con
             finalSeverity += 2;
             finalStatus = 1;
             eventMetadata["excessive_taints"] = JsValue(true);
-            printf("[ALERT] Excessive taint values! Taint count: %zu (>= 100)\n", taintCount);
+            HOOK_TRACE("xhr", "excessive_taints", {"url", url}, {"count", taintCount});
         }
         
         // 4. 외부/의심 도메인 체크 (+2점)
@@ -287,8 +286,7 @@ void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, con
         finalSeverity = std::min(finalSeverity, 10);
         
         if (finalSeverity >= 6) {
-            printf("[ALERT] High risk XHR detected! URL: %s, Method: %s, Score: %d\n", 
-                   url.c_str(), method.c_str(), finalSeverity);
+            HOOK_TRACE("xhr", "high_risk", {"url", url}, {"method", method}, {"score", finalSeverity});
         }
         
         // HookEvent 생성 - 생성자 사용
@@ -304,14 +302,19 @@ void XMLHTTPRequestObject::analyzeRequestSecurity(const std::string& method, con
         // status 설정
         xhrEvent.status = finalStatus;
         
-        a_ctx->dynamicAnalyzer->recordEvent(xhrEvent);
+        a_ctx->hookBus.emit(HookType::FETCH_REQUEST, finalSeverity, [&] { return std::move(xhrEvent); });
     }
 }
 
 void XMLHTTPRequestObject::simulateResponse() {
     try {
-        this->responseText = generateMockResponse();
-        this->status = 200;
+        // 🔥 Task 디렉터리에 저장된 응답이 있으면 그 본문 사용 (없으면 URL 기반 mock)
+        std::optional<ResponseCorpus::Response> stored;
+        if (a_ctx) {
+            stored = a_ctx->serveStoredResponse("XMLHttpRequest", method, url);
+        }
+        this->responseText = stored ? std::move(stored->body) : generateMockResponse();
+        this->status = stored ? stored->status : 200;
         this->readyState = 2; // HEADERS_RECEIVED
         triggerReadyStateChange();
         this->readyState = 3; // LOADING
@@ -319,7 +322,7 @@ void XMLHTTPRequestObject::simulateResponse() {
         this->readyState = 4; // DONE
         triggerReadyStateChange();
     } catch (const std::exception& e) {
-        std::cerr << "[XHR] Error simulating response: " << e.what() << std::endl;
+        SCAN_LOG_ERROR("%s[XHR] Error simulating response: %s", logMsg.c_str(), e.what());
     }
 }
 
@@ -357,7 +360,7 @@ void XMLHTTPRequestObject::triggerReadyStateChange() {
         if (!JS_IsUndefined(exception) && !JS_IsNull(exception)) {
             const char* error_msg = JS_ToCString(ctx, exception);
             if (error_msg) {
-                std::cerr << "Error in onreadystatechange callback: " << error_msg << std::endl;
+                SCAN_LOG_WARN("%s[XHR] Error in onreadystatechange callback: %s", logMsg.c_str(), error_msg);
                 JS_FreeCString(ctx, error_msg);
             }
         }
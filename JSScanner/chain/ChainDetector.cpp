@@ -5,7 +5,7 @@
 
 // debug_chain 함수 - Logger의 debug 설정에 따름
 static void debug_chain(const std::string& message) {
-    core::Log_Debug("JS Scanner - [CHAIN] %s" , message);
+    SCAN_LOG_DEBUG("JS Scanner - [CHAIN] %s" , message);
 }
 
 // Initialize static sets
@@ -1,8 +1,10 @@
 #include "pch.h"
 #include "BrowserConfig.h"
+#include "BrowserEnvShim.h"
+#include "ScanLog.h"
 #include "../quickjs.h"
 #include <fstream>
-#include <cstring>
+#include <stdexcept>
 
 // ==================== 미리 정의된 프로필 ====================
 
@@ -63,179 +65,120 @@ BrowserConfig BrowserConfig::getDefaultDesktopProfile() {
     return config;
 }
 
+BrowserConfig BrowserConfig::getMobileProfile() {
+    BrowserConfig config;
+
+    // Navigator (Android Chrome)
+    config.userAgent = "Mozilla/5.0 (Linux; Android 13; Pixel 7) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Mobile Safari/537.36";
+    config.appVersion = "5.0 (Linux; Android 13; Pixel 7) AppleWebKit/537.36";
+    config.appName = "Netscape";
+    config.platform = "Linux armv81";
+    config.vendor = "Google Inc.";
+    config.product = "Gecko";
+    config.language = "en-US";
+    config.languages = "en-US,en";
+    config.cookieEnabled = true;
+    config.doNotTrack = false;
+    config.maxTouchPoints = 5;
+    config.hardwareConcurrency = 8;
+    config.deviceMemory = 8;
+    config.onLine = true;
+    config.javaEnabled = false;
+    config.pdfViewerEnabled = false;
+
+    // Screen
+    config.screenWidth = 412;
+    config.screenHeight = 915;
+    config.screenAvailWidth = 412;
+    config.screenAvailHeight = 915;
+    config.screenColorDepth = 24;
+    config.screenPixelDepth = 24;
+    config.screenOrientation = "portrait-primary";
+    config.devicePixelRatio = 2.625;
+
+    // Window
+    config.innerWidth = 412;
+    config.innerHeight = 839;
+    config.outerWidth = 412;
+    config.outerHeight = 915;
+    config.screenX = 0;
+    config.screenY = 0;
+    config.closed = false;
+
+    // WebGL
+    config.webglVendor = "Qualcomm";
+    config.webglRenderer = "Adreno (TM) 730";
+    config.webglVersion = "WebGL 1.0";
+    config.webglMaxTextureSize = 16384;
+
+    // Plugins
+    config.pluginsLength = 0;
+    config.pluginsList = "";
+
+    // Battery
+    config.batteryCharging = false;
+    config.batteryLevel = 0.8;
+
+    return config;
+}
+
 // ==================== JavaScript 환경 초기화 ====================
 
+// shim 에 넘길 프로필 값 (구조는 BrowserEnvShim 의 JS 코드가 생성)
+static JSValue makeShimProfile(JSContext* ctx, const BrowserConfig& config) {
+    JSValue profile = JS_NewObject(ctx);
+
+    auto setString = [&](const char* key, const std::string& value) {
+        JS_DefinePropertyValueStr(ctx, profile, key, JS_NewStringLen(ctx, value.data(), value.size()), JS_PROP_C_W_E);
+    };
+    auto setBool = [&](const char* key, bool value) {
+        JS_DefinePropertyValueStr(ctx, profile, key, JS_NewBool(ctx, value ? 1 : 0), JS_PROP_C_W_E);
+    };
+    auto setInt = [&](const char* key, int64_t value) {
+        JS_DefinePropertyValueStr(ctx, profile, key, JS_NewInt64(ctx, value), JS_PROP_C_W_E);
+    };
+
+    // Navigator
+    setString("userAgent", config.userAgent);
+    setString("platform", config.platform);
+    setString("appName", config.appName);
+    setString("appVersion", config.appVersion);
+    setString("vendor", config.vendor);
+    setString("language", config.language);
+    setString("languages", config.languages);
+    setBool("onLine", config.onLine);
+    setBool("cookieEnabled", config.cookieEnabled);
+    setInt("hardwareConcurrency", config.hardwareConcurrency);
+    setInt("deviceMemory", config.deviceMemory);
+    setInt("maxTouchPoints", config.maxTouchPoints);
+    setBool("webdriver", config.hasWebdriver);
+
+    // Document / Location
+    setString("documentURL", config.documentURL);
+    setString("documentReadyState", config.documentReadyState);
+
+    // Screen
+    setInt("screenWidth", config.screenWidth);
+    setInt("screenHeight", config.screenHeight);
+    setInt("screenAvailWidth", config.screenAvailWidth);
+    setInt("screenAvailHeight", config.screenAvailHeight);
+    setInt("screenColorDepth", config.screenColorDepth);
+    setInt("screenPixelDepth", config.screenPixelDepth);
+
+    return profile;
+}
+
 void BrowserConfig::initializeJSEnvironment(void* jsContext) const {
     JSContext* ctx = static_cast<JSContext*>(jsContext);
     if (!ctx) return;
-    
-    JSValue global = JS_GetGlobalObject(ctx);
-    
-    // ============================================
-    // Navigator 객체 생성 및 바인딩
-    // ============================================
-    JSValue navigator = JS_NewObject(ctx);
-    
-    // userAgent
-    JS_DefinePropertyValueStr(ctx, navigator, "userAgent",
-        JS_NewString(ctx, userAgent.c_str()), JS_PROP_C_W_E);
-    
-    // platform
-    JS_DefinePropertyValueStr(ctx, navigator, "platform",
-        JS_NewString(ctx, platform.c_str()), JS_PROP_C_W_E);
-    
-    // appName
-    JS_DefinePropertyValueStr(ctx, navigator, "appName",
-        JS_NewString(ctx, appName.c_str()), JS_PROP_C_W_E);
-    
-    // appVersion
-    JS_DefinePropertyValueStr(ctx, navigator, "appVersion",
-        JS_NewString(ctx, appVersion.c_str()), JS_PROP_C_W_E);
-    
-    // vendor
-    JS_DefinePropertyValueStr(ctx, navigator, "vendor",
-        JS_NewString(ctx, vendor.c_str()), JS_PROP_C_W_E);
-    
-    // language
-    JS_DefinePropertyValueStr(ctx, navigator, "language",
-        JS_NewString(ctx, language.c_str()), JS_PROP_C_W_E);
-    
-    // languages 배열 생성
-    JSValue languagesArray = JS_NewArray(ctx);
-    size_t idx = 0;
-    std::string langStr = languages;
-    size_t pos = 0;
-    while ((pos = langStr.find(',')) != std::string::npos) {
-        std::string lang = langStr.substr(0, pos);
-        JS_SetPropertyUint32(ctx, languagesArray, idx++, JS_NewString(ctx, lang.c_str()));
-        langStr.erase(0, pos + 1);
-    }
-    if (!langStr.empty()) {
-        JS_SetPropertyUint32(ctx, languagesArray, idx, JS_NewString(ctx, langStr.c_str()));
-    }
-    JS_DefinePropertyValueStr(ctx, navigator, "languages", languagesArray, JS_PROP_C_W_E);
-    
-    // onLine
-    JS_DefinePropertyValueStr(ctx, navigator, "onLine",
-        JS_NewBool(ctx, onLine ? 1 : 0), JS_PROP_C_W_E);
-    
-    // cookieEnabled
-    JS_DefinePropertyValueStr(ctx, navigator, "cookieEnabled",
-        JS_NewBool(ctx, cookieEnabled ? 1 : 0), JS_PROP_C_W_E);
-    
-    // hardwareConcurrency
-    JS_DefinePropertyValueStr(ctx, navigator, "hardwareConcurrency",
-        JS_NewInt32(ctx, hardwareConcurrency), JS_PROP_C_W_E);
-    
-    // deviceMemory
-    JS_DefinePropertyValueStr(ctx, navigator, "deviceMemory",
-        JS_NewInt64(ctx, deviceMemory), JS_PROP_C_W_E);
-    
-    // maxTouchPoints
-    JS_DefinePropertyValueStr(ctx, navigator, "maxTouchPoints",
-        JS_NewInt32(ctx, maxTouchPoints), JS_PROP_C_W_E);
-    
-    // webdriver
-    JS_DefinePropertyValueStr(ctx, navigator, "webdriver",
-        JS_NewBool(ctx, hasWebdriver ? 1 : 0), JS_PROP_C_W_E);
-    
-    // Global에 navigator 등록
-    JS_DefinePropertyValueStr(ctx, global, "navigator", navigator, JS_PROP_C_W_E);
-    
-    // ============================================
-    // Location 객체 생성
-    // ============================================
-    JSValue location = JS_NewObject(ctx);
-    JS_DefinePropertyValueStr(ctx, location, "href",
-        JS_NewString(ctx, documentURL.c_str()), JS_PROP_C_W_E);
-    
-    // URL 파싱 (간단한 구현)
-    std::string protocol = "about:";
-    std::string host = "";
-    std::string hostname = "";
-    std::string pathname = "blank";
-    
-    if (documentURL.find("://") != std::string::npos) {
-        size_t protocolEnd = documentURL.find("://");
-        protocol = documentURL.substr(0, protocolEnd + 1);  // "https:"
-        
-        size_t hostStart = protocolEnd + 3;
-        size_t pathStart = documentURL.find('/', hostStart);
-        
-        if (pathStart != std::string::npos) {
-            host = documentURL.substr(hostStart, pathStart - hostStart);
-            hostname = host;
-            pathname = documentURL.substr(pathStart);
-        } else {
-            host = documentURL.substr(hostStart);
-            hostname = host;
-            pathname = "/";
-        }
-    }
-    
-    JS_DefinePropertyValueStr(ctx, location, "protocol",
-        JS_NewString(ctx, protocol.c_str()), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, location, "host",
-        JS_NewString(ctx, host.c_str()), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, location, "hostname",
-        JS_NewString(ctx, hostname.c_str()), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, location, "pathname",
-        JS_NewString(ctx, pathname.c_str()), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, location, "search",
-        JS_NewString(ctx, ""), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, location, "hash",
-        JS_NewString(ctx, ""), JS_PROP_C_W_E);
-    
-    // ============================================
-    // Document 객체 확인 및 설정
-    // ============================================
-    JSValue document = JS_GetPropertyStr(ctx, global, "document");
-    if (JS_IsUndefined(document) || JS_IsNull(document)) {
-        document = JS_NewObject(ctx);
-        
-        // readyState
-        JS_DefinePropertyValueStr(ctx, document, "readyState",
-            JS_NewString(ctx, documentReadyState.c_str()), JS_PROP_C_W_E);
-        
-        // createElement 더미 함수
-        const char* createElementCode = "(function(tag) { return {}; })";
-        JSValue createElement = JS_Eval(ctx, createElementCode, 
-                                        strlen(createElementCode),
-                                        "<createElement>", 
-                                        JS_EVAL_TYPE_GLOBAL);
-        JS_DefinePropertyValueStr(ctx, document, "createElement",
-            createElement, JS_PROP_C_W_E);
-        
-        JS_DefinePropertyValueStr(ctx, global, "document", document, JS_PROP_C_W_E);
+
+    // 🔥 navigator / location / document / screen 구성은 미리 컴파일된 shim 으로 처리
+    JSValue profile = makeShimProfile(ctx, *this);
+    bool installed = BrowserEnvShim::install(ctx, profile);
+    JS_FreeValue(ctx, profile);
+
+    // shim 실패 시 (원인은 BrowserEnvShim 이 기록) 브라우저 객체 없이 분석하지 않도록 컨텍스트 생성 실패로 처리
+    if (!installed) {
+        throw std::runtime_error("BrowserConfig: browser environment shim failed to install");
     }
-    
-    // document.location 설정
-    JS_DefinePropertyValueStr(ctx, document, "location",
-        JS_DupValue(ctx, location), JS_PROP_C_W_E);
-    
-    // window.location도 동일하게 설정
-    JS_DefinePropertyValueStr(ctx, global, "location", location, JS_PROP_C_W_E);
-    
-    // ============================================
-    // Screen 객체 생성
-    // ============================================
-    JSValue screen = JS_NewObject(ctx);
-    JS_DefinePropertyValueStr(ctx, screen, "width",
-        JS_NewInt32(ctx, screenWidth), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, screen, "height",
-        JS_NewInt32(ctx, screenHeight), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, screen, "availWidth",
-        JS_NewInt32(ctx, screenAvailWidth), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, screen, "availHeight",
-        JS_NewInt32(ctx, screenAvailHeight), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, screen, "colorDepth",
-        JS_NewInt32(ctx, screenColorDepth), JS_PROP_C_W_E);
-    JS_DefinePropertyValueStr(ctx, screen, "pixelDepth",
-        JS_NewInt32(ctx, screenPixelDepth), JS_PROP_C_W_E);
-    
-    JS_DefinePropertyValueStr(ctx, global, "screen", screen, JS_PROP_C_W_E);
-    
-    // Cleanup
-    JS_FreeValue(ctx, document);
-    JS_FreeValue(ctx, global);
-}
\ No newline at end of file
+}
@@ -145,5 +145,6 @@ public:
     
     // ==================== JavaScript 환경 초기화 ====================
     // QuickJS Context에 브라우저 환경(navigator, document, location 등)을 설정
+    // shim 을 설치하지 못하면 std::runtime_error (호출 전에 잡고 있던 JSValue 는 먼저 해제할 것)
     void initializeJSEnvironment(void* jsContext) const;  // JSContext* ctx
 };
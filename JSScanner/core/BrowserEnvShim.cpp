@@ -0,0 +1,177 @@
+#include "pch.h"
+#include "BrowserEnvShim.h"
+#include "ScanLog.h"
+#include "MetricsRegistry.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace BrowserEnvShim {
+
+namespace {
+
+// BrowserConfig::initializeJSEnvironment 가 만드는 유일한 브라우저 환경 (C++ 대체 경로 없음)
+// - 모든 속성은 JS_PROP_C_W_E 로 정의 (setter 우회)
+// - document 는 없을 때만 생성, location 은 document / 전역 양쪽에 등록
+const char SHIM_SOURCE[] = R"JS((function (p) {
+    var g = globalThis;
+    var def = function (o, k, v) {
+        Object.defineProperty(o, k, { value: v, writable: true, enumerable: true, configurable: true });
+    };
+
+    var languages = p.languages.split(',');
+    if (languages.length && languages[languages.length - 1] === '') languages.pop();
+
+    var navigator = {};
+    def(navigator, 'userAgent', p.userAgent);
+    def(navigator, 'platform', p.platform);
+    def(navigator, 'appName', p.appName);
+    def(navigator, 'appVersion', p.appVersion);
+    def(navigator, 'vendor', p.vendor);
+    def(navigator, 'language', p.language);
+    def(navigator, 'languages', languages);
+    def(navigator, 'onLine', p.onLine);
+    def(navigator, 'cookieEnabled', p.cookieEnabled);
+    def(navigator, 'hardwareConcurrency', p.hardwareConcurrency);
+    def(navigator, 'deviceMemory', p.deviceMemory);
+    def(navigator, 'maxTouchPoints', p.maxTouchPoints);
+    def(navigator, 'webdriver', p.webdriver);
+    def(g, 'navigator', navigator);
+
+    var url = p.documentURL;
+    var protocol = 'about:', host = '', pathname = 'blank';
+    var protocolEnd = url.indexOf('://');
+    if (protocolEnd !== -1) {
+        protocol = url.substring(0, protocolEnd + 1);
+        var hostStart = protocolEnd + 3;
+        var pathStart = url.indexOf('/', hostStart);
+        if (pathStart !== -1) {
+            host = url.substring(hostStart, pathStart);
+            pathname = url.substring(pathStart);
+        } else {
+            host = url.substring(hostStart);
+            pathname = '/';
+        }
+    }
+
+    var location = {};
+    def(location, 'href', url);
+    def(location, 'protocol', protocol);
+    def(location, 'host', host);
+    def(location, 'hostname', host);
+    def(location, 'pathname', pathname);
+    def(location, 'search', '');
+    def(location, 'hash', '');
+
+    var document = g.document;
+    if (document === undefined || document === null) {
+        document = {};
+        def(document, 'readyState', p.documentReadyState);
+        def(document, 'createElement', function (tag) { return {}; });
+        def(g, 'document', document);
+    }
+    def(document, 'location', location);
+    def(g, 'location', location);
+
+    var screen = {};
+    def(screen, 'width', p.screenWidth);
+    def(screen, 'height', p.screenHeight);
+    def(screen, 'availWidth', p.screenAvailWidth);
+    def(screen, 'availHeight', p.screenAvailHeight);
+    def(screen, 'colorDepth', p.screenColorDepth);
+    def(screen, 'pixelDepth', p.screenPixelDepth);
+    def(g, 'screen', screen);
+}))JS";
+
+std::once_flag g_compileOnce;
+std::vector<uint8_t> g_bytecode;
+
+void logException(JSContext* ctx, const char* stage) {
+    JSValue exception = JS_GetException(ctx);
+    const char* message = JS_ToCString(ctx, exception);
+    SCAN_LOG_ERROR("[BrowserEnvShim] %s failed: %s", stage, message ? message : "(unknown)");
+    if (message) JS_FreeCString(ctx, message);
+    JS_FreeValue(ctx, exception);
+}
+
+// 전용 런타임에서 컴파일 후 bytecode 만 보관 (런타임/컨텍스트 상태와 무관)
+void compileSnapshot() {
+    auto start = std::chrono::steady_clock::now();
+
+    JSRuntime* rt = JS_NewRuntime();
+    JSContext* ctx = rt ? JS_NewContext(rt) : nullptr;
+    if (!ctx) {
+        SCAN_LOG_ERROR("[BrowserEnvShim] Failed to create compile runtime");
+        if (rt) JS_FreeRuntime(rt);
+        return;
+    }
+
+    JSValue script = JS_Eval(ctx, SHIM_SOURCE, sizeof(SHIM_SOURCE) - 1, "<browser-env>",
+                             JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(script)) {
+        logException(ctx, "compile");
+    } else {
+        size_t size = 0;
+        uint8_t* buf = JS_WriteObject(ctx, &size, script, JS_WRITE_OBJ_BYTECODE | JS_WRITE_OBJ_STRIP_DEBUG);
+        if (buf) {
+            g_bytecode.assign(buf, buf + size);
+            js_free(ctx, buf);
+        } else {
+            logException(ctx, "serialize");
+        }
+    }
+    JS_FreeValue(ctx, script);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    SCAN_LOG_INFO("[BrowserEnvShim] Compiled environment shim: %zu bytes bytecode in %.3f ms",
+                  g_bytecode.size(), seconds * 1000.0);
+}
+
+} // namespace
+
+size_t bytecodeSize() {
+    std::call_once(g_compileOnce, compileSnapshot);
+    return g_bytecode.size();
+}
+
+bool install(JSContext* ctx, JSValueConst profile) {
+    static MetricHistogram& installTime = MetricsRegistry::instance().histogram(
+        "jsscanner_browser_env_install_seconds", {}, MetricsRegistry::latencyBuckets(),
+        "Browser environment shim instantiation time per context");
+
+    if (bytecodeSize() == 0) {
+        return false;
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    JSValue script = JS_ReadObject(ctx, g_bytecode.data(), g_bytecode.size(), JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(script)) {
+        logException(ctx, "load");
+        return false;
+    }
+
+    // script 실행 결과 = shim 함수 (JS_EvalFunction 이 script 소유권을 가져감)
+    JSValue shim = JS_EvalFunction(ctx, script);
+    if (JS_IsException(shim)) {
+        logException(ctx, "instantiate");
+        return false;
+    }
+
+    JSValue result = JS_Call(ctx, shim, JS_UNDEFINED, 1, &profile);
+    bool ok = !JS_IsException(result);
+    if (!ok) {
+        logException(ctx, "install");
+    }
+    JS_FreeValue(ctx, result);
+    JS_FreeValue(ctx, shim);
+
+    installTime.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return ok;
+}
+
+} // namespace BrowserEnvShim
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+#include "../quickjs.h"
+
+// ========================================
+// 🔥 브라우저 환경 shim (navigator / location / document / screen)
+// - 환경 구성 로직은 JS 함수 하나로 작성하고, 프로세스당 1회 전용 런타임에서 bytecode 로 컴파일
+// - 각 컨텍스트에서는 bytecode 를 읽어 함수로 만든 뒤 프로필 값 객체 하나만 넘겨 호출
+//   (데스크톱/모바일 등 프로필 차이는 전부 profile 객체의 값)
+// ========================================
+namespace BrowserEnvShim {
+
+    // profile 을 인자로 shim 실행 (profile 의 소유권은 호출자에게 있음)
+    // 실패 시 false (예외는 로그 후 정리)
+    bool install(JSContext* ctx, JSValueConst profile);
+
+    // 컴파일된 bytecode 크기 (컴파일 실패 시 0)
+    size_t bytecodeSize();
+
+} // namespace BrowserEnvShim
@@ -0,0 +1,211 @@
+#include "pch.h"
+#include "BrowserStorage.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <ctime>
+
+namespace {
+
+std::string_view trim(std::string_view text) {
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) return {};
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+bool equalsNoCase(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+        return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+    });
+}
+
+// Expires 값에서 4자리 연도 (없으면 0)
+int expiresYear(std::string_view value) {
+    for (size_t i = 0; i + 4 <= value.size(); ++i) {
+        if (std::all_of(value.begin() + i, value.begin() + i + 4,
+                        [](char c) { return std::isdigit(static_cast<unsigned char>(c)); })) {
+            return std::stoi(std::string(value.substr(i, 4)));
+        }
+    }
+    return 0;
+}
+
+int currentYear() {
+    // 그레고리력 평균 연 길이로 충분 (지난 연도 Expires 판별용)
+    return 1970 + static_cast<int>(std::time(nullptr) / 31556952);
+}
+
+}  // namespace
+
+const std::string* StorageArea::get(const std::string& key) const {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || !isLive(it->second)) return nullptr;
+    return &it->second.value;
+}
+
+bool StorageArea::set(const std::string& key, std::string value) {
+    auto it = entries_.find(key);
+    bool live = it != entries_.end() && isLive(it->second);
+    size_t oldBytes = live ? key.size() + it->second.value.size() : 0;
+    size_t newBytes = key.size() + value.size();
+
+    if (bytes_ - oldBytes + newBytes > maxBytes_ || (!live && live_ >= maxItems_)) {
+        limitReached_ = true;
+        return false;
+    }
+
+    if (it == entries_.end()) {
+        if (entries_.size() >= 2 * live_ + 64) {
+            compact();
+        }
+        it = entries_.emplace(key, Entry{}).first;
+    }
+    Entry& entry = it->second;
+    if (!live) {
+        // 새 항목이거나 이전 세대 항목 재사용
+        if (entry.generation != 0) {
+            staleBytes_ -= key.size() + entry.value.size();
+        }
+        entry.order = nextOrder_++;
+        entry.generation = generation_;
+        ++live_;
+    }
+    entry.value = std::move(value);
+    bytes_ = bytes_ - oldBytes + newBytes;
+    return true;
+}
+
+bool StorageArea::remove(const std::string& key, std::string* removed) {
+    auto it = entries_.find(key);
+    if (it == entries_.end() || !isLive(it->second)) return false;
+    bytes_ -= key.size() + it->second.value.size();
+    --live_;
+    if (removed) *removed = std::move(it->second.value);
+    entries_.erase(it);
+    return true;
+}
+
+size_t StorageArea::clear() {
+    size_t cleared = live_;
+    ++generation_;
+    live_ = 0;
+    staleBytes_ += bytes_;
+    bytes_ = 0;
+    // clear 를 반복해도 이전 세대 값이 쌓이지 않도록 (이 시점에는 모든 항목이 이전 세대)
+    if (staleBytes_ > maxBytes_) {
+        std::unordered_map<std::string, Entry>().swap(entries_);
+        staleBytes_ = 0;
+    }
+    return cleared;
+}
+
+void StorageArea::compact() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        it = isLive(it->second) ? std::next(it) : entries_.erase(it);
+    }
+    staleBytes_ = 0;
+}
+
+std::vector<std::pair<std::string_view, std::string_view>> StorageArea::items() const {
+    std::vector<const std::pair<const std::string, Entry>*> live;
+    live.reserve(live_);
+    for (const auto& item : entries_) {
+        if (isLive(item.second)) live.push_back(&item);
+    }
+    std::sort(live.begin(), live.end(), [](const auto* a, const auto* b) {
+        return a->second.order < b->second.order;
+    });
+
+    std::vector<std::pair<std::string_view, std::string_view>> out;
+    out.reserve(live.size());
+    for (const auto* item : live) {
+        out.emplace_back(item->first, item->second.value);
+    }
+    return out;
+}
+
+BrowserStorage::BrowserStorage()
+    : cookies_(MAX_COOKIES, MAX_COOKIES * MAX_COOKIE_BYTES),
+      local_(MAX_WEB_STORAGE_ITEMS, MAX_WEB_STORAGE_BYTES),
+      session_(MAX_WEB_STORAGE_ITEMS, MAX_WEB_STORAGE_BYTES),
+      indexedDb_(MAX_INDEXED_DB_RECORDS, MAX_INDEXED_DB_BYTES) {
+    seedDefaults();
+}
+
+void BrowserStorage::seedDefaults() {
+    // 로그인 흔적을 찾는 스크립트가 읽을 기본 값
+    local_.set("username", "stored.user@example.com");
+    local_.set("userEmail", "stored.user@example.com");
+    local_.set("organization", "storedcorp");
+}
+
+void BrowserStorage::reset() {
+    cookies_.clear();
+    local_.clear();
+    session_.clear();
+    indexedDb_.clear();
+    indexedDbIds_ = 0;
+    seedDefaults();
+}
+
+BrowserStorage::CookieUpdate BrowserStorage::setCookie(std::string_view cookieLine) {
+    size_t semicolon = cookieLine.find(';');
+    std::string_view pair = trim(cookieLine.substr(0, semicolon));
+    size_t equals = pair.find('=');
+    // '=' 가 없으면 이름 없는 cookie (브라우저 동작과 같음)
+    std::string name(equals == std::string_view::npos ? std::string_view() : trim(pair.substr(0, equals)));
+    std::string value(equals == std::string_view::npos ? pair : trim(pair.substr(equals + 1)));
+    if (name.empty() && value.empty()) return CookieUpdate::Rejected;
+    if (name.size() + value.size() > MAX_COOKIE_BYTES) return CookieUpdate::Rejected;
+
+    bool expired = false;
+    while (semicolon != std::string_view::npos) {
+        size_t next = cookieLine.find(';', semicolon + 1);
+        std::string_view attribute = trim(cookieLine.substr(semicolon + 1, next - semicolon - 1));
+        semicolon = next;
+
+        size_t eq = attribute.find('=');
+        std::string_view attrName = trim(attribute.substr(0, eq));
+        std::string_view attrValue = eq == std::string_view::npos ? std::string_view() : trim(attribute.substr(eq + 1));
+        if (equalsNoCase(attrName, "max-age")) {
+            std::string digits(attrValue);
+            char* end = nullptr;
+            long seconds = std::strtol(digits.c_str(), &end, 10);
+            if (end != digits.c_str() && seconds <= 0) expired = true;
+        } else if (equalsNoCase(attrName, "expires")) {
+            int year = expiresYear(attrValue);
+            if (year > 0 && year < currentYear()) expired = true;
+        }
+    }
+
+    if (expired) {
+        cookies_.remove(name);
+        return CookieUpdate::Deleted;
+    }
+    return cookies_.set(name, std::move(value)) ? CookieUpdate::Stored : CookieUpdate::Rejected;
+}
+
+std::string BrowserStorage::cookieString() const {
+    std::string out;
+    for (const auto& [name, value] : cookies_.items()) {
+        if (!out.empty()) out += "; ";
+        if (!name.empty()) {
+            out.append(name);
+            out.push_back('=');
+        }
+        out.append(value);
+    }
+    return out;
+}
+
+std::string BrowserStorage::indexedDbKey(std::string_view database, std::string_view store, std::string_view key) {
+    std::string out;
+    out.reserve(database.size() + store.size() + key.size() + 2);
+    out.append(database);
+    out.push_back('\x1f');
+    out.append(store);
+    out.push_back('\x1f');
+    out.append(key);
+    return out;
+}
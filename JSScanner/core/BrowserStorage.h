@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// 🔥 key → value 저장 영역 (localStorage / sessionStorage / cookie / IndexedDB 레코드)
+// - 항목마다 세대(generation) 를 기록해서 clear() 는 세대만 올림 (O(1))
+// - 이전 세대 항목은 set() 에서 재사용하거나 개수가 커지면 한 번에 정리
+//   (남은 이전 세대 바이트가 maxBytes 를 넘으면 clear() 에서 바로 해제 - 메모리는 한도의 2배 이내)
+// - 항목 수 / 바이트 (key + value) 한도를 넘는 set() 은 거부
+// - 단일 스레드 (Task 컨텍스트에서만 사용)
+class StorageArea {
+public:
+    StorageArea(size_t maxItems, size_t maxBytes) : maxItems_(maxItems), maxBytes_(maxBytes) {}
+
+    // 없으면 nullptr (반환 포인터는 다음 set / remove 전까지 유효)
+    const std::string* get(const std::string& key) const;
+    // 한도 초과 시 false (기존 값은 그대로)
+    bool set(const std::string& key, std::string value);
+    bool remove(const std::string& key, std::string* removed = nullptr);
+    // 지운 항목 수
+    size_t clear();
+
+    // 처음 넣은 순서 (같은 key 를 다시 set 해도 순서 유지)
+    std::vector<std::pair<std::string_view, std::string_view>> items() const;
+
+    size_t size() const { return live_; }
+    size_t bytes() const { return bytes_; }
+    // 아직 해제하지 않은 이전 세대 항목의 바이트
+    size_t staleBytes() const { return staleBytes_; }
+    bool limitReached() const { return limitReached_; }
+
+private:
+    struct Entry {
+        std::string value;
+        uint64_t order = 0;
+        uint32_t generation = 0;
+    };
+
+    bool isLive(const Entry& entry) const { return entry.generation == generation_; }
+    void compact();
+
+    std::unordered_map<std::string, Entry> entries_;
+    size_t maxItems_;
+    size_t maxBytes_;
+    uint32_t generation_ = 1;
+    uint64_t nextOrder_ = 0;
+    size_t live_ = 0;
+    size_t bytes_ = 0;
+    size_t staleBytes_ = 0;
+    bool limitReached_ = false;
+};
+
+// 🔥 Task 단위 브라우저 저장소 (JSAnalyzerContext 소유 - Task 간 cookie / storage 공유 없음)
+// - cookie 는 document.cookie 대입 한 줄씩 반영 (Max-Age / 지난 Expires 는 삭제)
+// - IndexedDB 레코드는 "db \x1f store \x1f key" 로 한 영역에 보관 (reset 이 영역 수와 무관)
+// - reset() 은 영역마다 세대만 올리고 기본 localStorage 값을 다시 넣음 (O(1))
+class BrowserStorage {
+public:
+    static constexpr size_t MAX_COOKIES = 180;
+    static constexpr size_t MAX_COOKIE_BYTES = 4096;            // cookie 하나 (name + value)
+    static constexpr size_t MAX_WEB_STORAGE_BYTES = 5 * 1024 * 1024;
+    static constexpr size_t MAX_WEB_STORAGE_ITEMS = 10000;
+    static constexpr size_t MAX_INDEXED_DB_BYTES = 16 * 1024 * 1024;
+    static constexpr size_t MAX_INDEXED_DB_RECORDS = 65536;
+
+    enum class CookieUpdate { Stored, Deleted, Rejected };
+
+    BrowserStorage();
+    BrowserStorage(const BrowserStorage&) = delete;
+    BrowserStorage& operator=(const BrowserStorage&) = delete;
+
+    // document.cookie = "name=value; path=/; max-age=..."
+    CookieUpdate setCookie(std::string_view cookieLine);
+    // document.cookie 읽기 ("a=1; b=2")
+    std::string cookieString() const;
+
+    StorageArea& localStorage() { return local_; }
+    StorageArea& sessionStorage() { return session_; }
+    StorageArea& cookies() { return cookies_; }
+    StorageArea& indexedDb() { return indexedDb_; }
+
+    static std::string indexedDbKey(std::string_view database, std::string_view store, std::string_view key);
+    // key 없이 add / put 한 레코드용 자동 증가 key
+    uint64_t nextIndexedDbId() { return ++indexedDbIds_; }
+
+    void reset();
+
+private:
+    void seedDefaults();
+
+    StorageArea cookies_;
+    StorageArea local_;
+    StorageArea session_;
+    StorageArea indexedDb_;
+    uint64_t indexedDbIds_ = 0;
+};
@@ -0,0 +1,390 @@
+#include "pch.h"
+#include "BruteForceDecoder.h"
+#include "../builtin/helpers/Base64Utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+// 평문 판정용 문자 클래스 (탭/개행 포함 출력 가능 문자)
+constexpr std::array<uint8_t, 256> makePrintableTable() {
+    std::array<uint8_t, 256> t{};
+    for (int c = 0x20; c <= 0x7E; ++c) t[c] = 1;
+    t['\t'] = t['\n'] = t['\r'] = 1;
+    return t;
+}
+
+// 키 순위용 가중치: 공백 / 소문자(영문·코드 빈도순) > 대문자·숫자·코드 기호 > 기타 출력 문자 >> 제어/상위 바이트
+// - 짧은 반복 키의 열(column)별 추정에서 비슷한 키(예: 1비트 차이)를 구분하도록 글자 빈도 반영
+constexpr std::array<int16_t, 256> makeWeightTable() {
+    std::array<int16_t, 256> t{};
+    for (auto& w : t) w = -30;
+    for (int c = 0x21; c <= 0x7E; ++c) t[c] = 2;
+    // a-z 상대 빈도 (대략적인 영문 + JS 소스 분포)
+    const int16_t letterFreq[26] = {8, 1, 3, 4, 13, 2, 2, 6, 7, 0, 1, 4, 2, 7, 8, 2, 0, 6, 6, 9, 3, 1, 2, 0, 2, 0};
+    for (int c = 0; c < 26; ++c) t['a' + c] = static_cast<int16_t>(4 + letterFreq[c]);
+    for (int c = 'A'; c <= 'Z'; ++c) t[c] = 5;
+    for (int c = '0'; c <= '9'; ++c) t[c] = 5;
+    t[' '] = 15;
+    t['\t'] = t['\n'] = t['\r'] = 5;
+    const char punct[] = ".,;:()[]{}'\"=/_-+<>!?&|$%*\\";
+    for (const char* p = punct; *p; ++p) t[static_cast<unsigned char>(*p)] = 5;
+    return t;
+}
+
+constexpr std::array<uint8_t, 256> PRINTABLE = makePrintableTable();
+constexpr std::array<int16_t, 256> WEIGHT = makeWeightTable();
+
+// 복호화 결과에서 찾는 JS / 명령어 키워드 (소문자)
+const char* const KEYWORDS[] = {
+    "eval", "function", "document", "window", "http", "script", "fromcharcode",
+    "createobject", "activexobject", "wscript", "powershell", "cmd", "shell",
+    "iframe", "location", "return", "xmlhttp", ".exe", "download", "invoke", "var "
+};
+
+constexpr double MIN_PRINTABLE_RATIO = 0.95;
+constexpr double MIN_ENTROPY_BITS = 2.5;
+constexpr int TOP_KEYS = 3;
+constexpr size_t REPEATING_KEY_LENGTHS[] = {2, 3, 4, 5, 6, 7, 8, 16};
+constexpr size_t MIN_SAMPLES_PER_COLUMN = 8;
+
+std::string hexKey(const std::string& key) {
+    std::string out = "0x";
+    char buf[3];
+    for (unsigned char c : key) {
+        std::snprintf(buf, sizeof(buf), "%02x", c);
+        out += buf;
+    }
+    return out;
+}
+
+double printableRatio(std::string_view text) {
+    if (text.empty()) return 0;
+    size_t printable = 0;
+    for (unsigned char c : text) printable += PRINTABLE[c];
+    return static_cast<double>(printable) / text.size();
+}
+
+double entropyBits(const std::array<uint32_t, 256>& hist, size_t n) {
+    double entropy = 0;
+    for (uint32_t count : hist) {
+        if (count) {
+            double p = static_cast<double>(count) / n;
+            entropy -= p * std::log2(p);
+        }
+    }
+    return entropy;
+}
+
+// 단순 루프로 유지 (컴파일러 자동 벡터화 대상)
+std::string xorBytes(std::string_view data, const std::string& key) {
+    std::string out(data);
+    size_t keyLen = key.size();
+    if (keyLen == 1) {
+        char k = key[0];
+        for (char& c : out) c = static_cast<char>(c ^ k);
+    } else {
+        for (size_t i = 0; i < out.size(); ++i) out[i] = static_cast<char>(out[i] ^ key[i % keyLen]);
+    }
+    return out;
+}
+
+std::string shiftBytes(std::string_view data, uint8_t k) {
+    std::string out(data);
+    for (char& c : out) c = static_cast<char>(static_cast<uint8_t>(c) + k);
+    return out;
+}
+
+std::string rotLetters(std::string_view data, int n) {
+    std::string out(data);
+    for (char& c : out) {
+        if (c >= 'a' && c <= 'z') c = static_cast<char>('a' + (c - 'a' + n) % 26);
+        else if (c >= 'A' && c <= 'Z') c = static_cast<char>('A' + (c - 'A' + n) % 26);
+    }
+    return out;
+}
+
+void appendUtf8(std::string& out, uint32_t cp) {
+    if (cp <= 0xFF) {
+        out += static_cast<char>(cp);   // Latin-1 범위는 바이트 그대로 (charCodeAt 기반 XOR 페이로드)
+    } else if (cp <= 0x7FF) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp <= 0xFFFF) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+bool parseHex(std::string_view text, size_t pos, size_t len, uint32_t& value) {
+    if (pos + len > text.size()) return false;
+    value = 0;
+    for (size_t i = pos; i < pos + len; ++i) {
+        char c = text[i];
+        if (!std::isxdigit(static_cast<unsigned char>(c))) return false;
+        value = value * 16 + (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : (std::tolower(c) - 'a' + 10));
+    }
+    return true;
+}
+
+} // namespace
+
+std::string BruteForceDecoder::Candidate::describe() const {
+    switch (method) {
+    case Method::Xor: return "XOR key " + hexKey(key);
+    case Method::RepeatingXor: return "repeating XOR key " + hexKey(key);
+    case Method::Rot: return "ROT" + std::to_string(key.empty() ? 0 : static_cast<unsigned char>(key[0]));
+    case Method::Shift: return "shift +" + std::to_string(key.empty() ? 0 : static_cast<unsigned char>(key[0]));
+    }
+    return "";
+}
+
+BruteForceDecoder::BruteForceDecoder(std::chrono::microseconds budget) : budget_(budget) {}
+
+void BruteForceDecoder::resetBudget() {
+    used_ = std::chrono::microseconds{0};
+    stats_ = Stats{};
+}
+
+int BruteForceDecoder::countKeywordHits(std::string_view text) {
+    std::string lower(text);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    int hits = 0;
+    for (const char* keyword : KEYWORDS) {
+        if (lower.find(keyword) != std::string::npos) hits++;
+    }
+    return hits;
+}
+
+bool BruteForceDecoder::isCandidate(std::string_view data) {
+    if (data.size() < MIN_LENGTH || data.size() > MAX_LENGTH) return false;
+    if (Base64Utils::isBase64(data)) return false;   // atob 경로에서 처리
+    if (data.size() % 2 == 0 &&
+        std::all_of(data.begin(), data.end(), [](unsigned char c) { return std::isxdigit(c) != 0; })) {
+        return false;
+    }
+
+    Histogram hist{};
+    for (unsigned char c : data) hist[c]++;
+    if (entropyBits(hist, data.size()) < MIN_ENTROPY_BITS) return false;
+
+    // 이미 읽을 수 있는 코드/명령어면 복호화 불필요
+    return countKeywordHits(data) == 0;
+}
+
+BruteForceDecoder::Candidate BruteForceDecoder::finish(Method method, std::string key, std::string decoded) {
+    Candidate candidate;
+    candidate.method = method;
+    candidate.key = std::move(key);
+    candidate.printableRatio = printableRatio(decoded);
+    candidate.keywordHits = countKeywordHits(decoded);
+    candidate.decoded = std::move(decoded);
+    candidate.score = candidate.printableRatio + 0.25 * (std::min)(candidate.keywordHits, 4);
+    return candidate;
+}
+
+std::optional<BruteForceDecoder::Candidate> BruteForceDecoder::bestSingleByte(std::string_view data, const Histogram& hist,
+                                                                            Method method) {
+    uint8_t distinct[256];
+    int distinctCount = 0;
+    for (int b = 0; b < 256; ++b) {
+        if (hist[b]) distinct[distinctCount++] = static_cast<uint8_t>(b);
+    }
+
+    // 키별 가중치 / 출력 가능 비율을 히스토그램으로 계산 (문자열을 다시 읽지 않음)
+    struct Ranked { int64_t weight; uint8_t key; };
+    Ranked top[TOP_KEYS];
+    int topCount = 0;
+    const uint64_t minPrintable = static_cast<uint64_t>(std::ceil(MIN_PRINTABLE_RATIO * data.size()));
+
+    for (int k = 1; k < 256; ++k) {
+        int64_t weight = 0;
+        uint64_t printable = 0;
+        for (int i = 0; i < distinctCount; ++i) {
+            uint8_t b = distinct[i];
+            uint8_t mapped = method == Method::Xor ? static_cast<uint8_t>(b ^ k) : static_cast<uint8_t>(b + k);
+            weight += static_cast<int64_t>(hist[b]) * WEIGHT[mapped];
+            printable += hist[b] * PRINTABLE[mapped];
+        }
+        if (printable < minPrintable) continue;
+
+        Ranked ranked{weight, static_cast<uint8_t>(k)};
+        if (topCount < TOP_KEYS) {
+            top[topCount++] = ranked;
+        } else {
+            Ranked* worst = std::min_element(top, top + topCount, [](const Ranked& a, const Ranked& b) { return a.weight < b.weight; });
+            if (worst->weight < ranked.weight) *worst = ranked;
+        }
+    }
+
+    std::optional<Candidate> best;
+    for (int i = 0; i < topCount; ++i) {
+        std::string key(1, static_cast<char>(top[i].key));
+        std::string decoded = method == Method::Xor ? xorBytes(data, key) : shiftBytes(data, top[i].key);
+        Candidate candidate = finish(method, std::move(key), std::move(decoded));
+        if (candidate.keywordHits > 0 && (!best || candidate.score > best->score)) {
+            best = std::move(candidate);
+        }
+    }
+    return best;
+}
+
+std::optional<BruteForceDecoder::Candidate> BruteForceDecoder::bestRepeatingXor(std::string_view data) {
+    std::optional<Candidate> best;
+    for (size_t keyLen : REPEATING_KEY_LENGTHS) {
+        if (data.size() < keyLen * MIN_SAMPLES_PER_COLUMN) break;
+
+        // 열(column)마다 독립적인 단일 바이트 XOR 로 보고 가중치 최대 키 선택
+        std::string key(keyLen, '\0');
+        for (size_t col = 0; col < keyLen; ++col) {
+            Histogram hist{};
+            for (size_t i = col; i < data.size(); i += keyLen) hist[static_cast<uint8_t>(data[i])]++;
+            uint8_t distinct[256];
+            int distinctCount = 0;
+            for (int b = 0; b < 256; ++b) {
+                if (hist[b]) distinct[distinctCount++] = static_cast<uint8_t>(b);
+            }
+
+            int64_t bestWeight = INT64_MIN;
+            for (int k = 0; k < 256; ++k) {
+                int64_t weight = 0;
+                for (int i = 0; i < distinctCount; ++i) {
+                    weight += static_cast<int64_t>(hist[distinct[i]]) * WEIGHT[distinct[i] ^ k];
+                }
+                if (weight > bestWeight) {
+                    bestWeight = weight;
+                    key[col] = static_cast<char>(k);
+                }
+            }
+        }
+
+        // 더 짧은 주기로 표현되는 키는 이미 시도한 길이 (단일 바이트 포함)
+        bool periodic = false;
+        for (size_t period = 1; period < keyLen && !periodic; ++period) {
+            if (keyLen % period) continue;
+            periodic = true;
+            for (size_t i = period; i < keyLen; ++i) {
+                if (key[i] != key[i - period]) { periodic = false; break; }
+            }
+        }
+        if (periodic) continue;
+
+        Candidate candidate = finish(Method::RepeatingXor, key, xorBytes(data, key));
+        if (candidate.printableRatio >= MIN_PRINTABLE_RATIO && candidate.keywordHits > 0 &&
+            (!best || candidate.score > best->score)) {
+            best = std::move(candidate);
+        }
+    }
+    return best;
+}
+
+std::optional<BruteForceDecoder::Candidate> BruteForceDecoder::bestRot(std::string_view data) {
+    size_t letters = std::count_if(data.begin(), data.end(), [](unsigned char c) { return std::isalpha(c) != 0; });
+    if (letters * 2 < data.size()) return std::nullopt;
+
+    std::optional<Candidate> best;
+    for (int n = 1; n < 26; ++n) {
+        Candidate candidate = finish(Method::Rot, std::string(1, static_cast<char>(n)), rotLetters(data, n));
+        if (candidate.keywordHits > 0 && (!best || candidate.score > best->score)) {
+            best = std::move(candidate);
+        }
+    }
+    return best;
+}
+
+std::optional<BruteForceDecoder::Candidate> BruteForceDecoder::tryDecode(std::string_view data) {
+    // 예산 확인이 먼저 - 초과 후에는 후보 판정 (히스토그램 / 키워드 스캔) 도 하지 않음
+    if (budgetExhausted()) {
+        stats_.skippedBudget++;
+        return std::nullopt;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto charge = [&] {
+        auto now = std::chrono::steady_clock::now();
+        used_ += std::chrono::duration_cast<std::chrono::microseconds>(now - start);
+        start = now;
+        return budgetExhausted();
+    };
+    // 후보 판정 시간도 예산에 포함 (후보가 아닌 큰 문자열이 많을 때도 상한 유지)
+    bool eligible = isCandidate(data);
+    if (charge() && eligible) {
+        stats_.skippedBudget++;
+        return std::nullopt;
+    }
+    if (!eligible) return std::nullopt;
+    stats_.attempted++;
+
+    Histogram hist{};
+    for (unsigned char c : data) hist[c]++;
+
+    std::optional<Candidate> best;
+    auto consider = [&](std::optional<Candidate> candidate) {
+        if (candidate && (!best || candidate->score > best->score)) best = std::move(candidate);
+    };
+
+    // 비용이 낮은 순서로 시도, 단계마다 예산 확인
+    consider(bestSingleByte(data, hist, Method::Xor));
+    if (!charge()) consider(bestSingleByte(data, hist, Method::Shift));
+    if (!charge()) consider(bestRot(data));
+    if (!charge() && !best) consider(bestRepeatingXor(data));
+    charge();
+
+    if (best) stats_.decoded++;
+    return best;
+}
+
+std::string BruteForceDecoder::unescapeJsLiteral(std::string_view literal) {
+    std::string out;
+    out.reserve(literal.size());
+    for (size_t i = 0; i < literal.size(); ++i) {
+        char c = literal[i];
+        if (c != '\\' || i + 1 >= literal.size()) {
+            out += c;
+            continue;
+        }
+        char e = literal[++i];
+        uint32_t cp = 0;
+        switch (e) {
+        case 'n': out += '\n'; break;
+        case 'r': out += '\r'; break;
+        case 't': out += '\t'; break;
+        case 'b': out += '\b'; break;
+        case 'f': out += '\f'; break;
+        case 'v': out += '\v'; break;
+        case '0': out += '\0'; break;
+        case '\n': break;   // 줄 이어쓰기
+        case 'x':
+            if (parseHex(literal, i + 1, 2, cp)) { appendUtf8(out, cp); i += 2; }
+            else out += e;
+            break;
+        case 'u':
+            if (i + 1 < literal.size() && literal[i + 1] == '{') {
+                size_t close = literal.find('}', i + 2);
+                if (close != std::string_view::npos && close > i + 2 && close - (i + 2) <= 6 && parseHex(literal, i + 2, close - (i + 2), cp)) {
+                    appendUtf8(out, cp);
+                    i = close;
+                } else {
+                    out += e;
+                }
+            } else if (parseHex(literal, i + 1, 4, cp)) {
+                appendUtf8(out, cp);
+                i += 4;
+            } else {
+                out += e;
+            }
+            break;
+        default: out += e; break;
+        }
+    }
+    return out;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// 🔥 XOR / ROT / shift 무차별 대입 복호화
+// - 단일 바이트 XOR (256개 키), 반복 XOR 키 (길이 2~8, 16), ROT-N, 바이트 덧셈 shift 를 모두 시도
+// - 키별 점수는 입력의 바이트 히스토그램으로 계산 (문자열 길이와 무관하게 키당 O(서로 다른 바이트 수))
+//   상위 후보만 실제로 복호화해서 JS/명령어 키워드 적중 수로 최종 선택
+// - Task 단위 CPU 예산을 넘으면 더 이상 시도하지 않음 (DynamicStringTracker::reset 에서 초기화)
+class BruteForceDecoder {
+public:
+    static constexpr std::chrono::microseconds DEFAULT_BUDGET{50000};   // Task 당 50ms
+    static constexpr size_t MIN_LENGTH = 16;
+    static constexpr size_t MAX_LENGTH = 64 * 1024;
+
+    enum class Method { Xor, RepeatingXor, Rot, Shift };
+
+    struct Candidate {
+        Method method = Method::Xor;
+        std::string key;            // XOR 키 바이트 / ROT·shift 는 1바이트 값
+        std::string decoded;
+        double printableRatio = 0;
+        int keywordHits = 0;
+        double score = 0;
+
+        // 예: "XOR key 0x5a", "repeating XOR key 0x1f2e3d", "ROT13", "shift +7"
+        std::string describe() const;
+    };
+
+    struct Stats {
+        uint64_t attempted = 0;         // 후보로 판정되어 시도한 문자열
+        uint64_t decoded = 0;           // 복호화 성공
+        uint64_t skippedBudget = 0;     // 예산 초과로 건너뜀
+    };
+
+    explicit BruteForceDecoder(std::chrono::microseconds budget = DEFAULT_BUDGET);
+
+    // 복호화 대상인지 (길이, 키워드 없음, Base64/hex 아님, 엔트로피)
+    static bool isCandidate(std::string_view data);
+
+    // 모든 변환을 시도해서 가장 그럴듯한 평문 반환 (예산 초과 / 후보 아님 / 실패 시 nullopt)
+    std::optional<Candidate> tryDecode(std::string_view data);
+
+    // JS 문자열 리터럴 본문의 escape (\xHH, \uHHHH, \n 등) 해제 (U+00FF 초과는 UTF-8)
+    static std::string unescapeJsLiteral(std::string_view literal);
+
+    // 소문자 기준 JS/명령어 키워드 적중 수
+    static int countKeywordHits(std::string_view text);
+
+    void resetBudget();
+    bool budgetExhausted() const { return used_ >= budget_; }
+    std::chrono::microseconds used() const { return used_; }
+    const Stats& stats() const { return stats_; }
+
+private:
+    using Histogram = std::array<uint32_t, 256>;
+
+    std::optional<Candidate> bestSingleByte(std::string_view data, const Histogram& hist, Method method);
+    std::optional<Candidate> bestRepeatingXor(std::string_view data);
+    std::optional<Candidate> bestRot(std::string_view data);
+
+    static Candidate finish(Method method, std::string key, std::string decoded);
+
+    std::chrono::microseconds budget_;
+    std::chrono::microseconds used_{0};
+    Stats stats_;
+};
@@ -0,0 +1,744 @@
+#include "pch.h"
+#include "DomTree.h"
+#include <algorithm>
+#include <cstring>
+
+// ============================================================================
+// DomArena
+// ============================================================================
+
+void* DomArena::allocate(size_t size, size_t align) {
+    if (cursor_) {
+        uintptr_t p = (reinterpret_cast<uintptr_t>(cursor_) + align - 1) & ~(uintptr_t(align) - 1);
+        if (p + size <= reinterpret_cast<uintptr_t>(end_)) {
+            cursor_ = reinterpret_cast<uint8_t*>(p + size);
+            return reinterpret_cast<void*>(p);
+        }
+    }
+
+    // 큰 할당은 전용 블록 (현재 블록의 남은 공간은 계속 사용)
+    size_t blockSize = std::max(BLOCK_SIZE, size + align);
+    if (reserved_ + blockSize > limit_) {
+        return nullptr;
+    }
+    blocks_.emplace_back(new uint8_t[blockSize]);
+    reserved_ += blockSize;
+
+    uint8_t* base = blocks_.back().get();
+    uintptr_t p = (reinterpret_cast<uintptr_t>(base) + align - 1) & ~(uintptr_t(align) - 1);
+    if (blockSize == BLOCK_SIZE) {
+        cursor_ = reinterpret_cast<uint8_t*>(p + size);
+        end_ = base + blockSize;
+    }
+    return reinterpret_cast<void*>(p);
+}
+
+std::string_view DomArena::copy(std::string_view text) {
+    if (text.empty()) {
+        return {};
+    }
+    char* out = static_cast<char*>(allocate(text.size(), 1));
+    if (!out) {
+        return {};
+    }
+    std::memcpy(out, text.data(), text.size());
+    return std::string_view(out, text.size());
+}
+
+void DomArena::reset() {
+    blocks_.clear();
+    cursor_ = nullptr;
+    end_ = nullptr;
+    reserved_ = 0;
+}
+
+// ============================================================================
+// 선택자 / 직렬화 helper
+// ============================================================================
+namespace {
+
+char lowerChar(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (lowerChar(a[i]) != lowerChar(b[i])) return false;
+    }
+    return true;
+}
+
+// text[pos..] 이 prefix 로 시작하는지 (대소문자 무시)
+bool startsWithAt(std::string_view text, size_t pos, std::string_view prefix) {
+    return pos + prefix.size() <= text.size() && equalsIgnoreCase(text.substr(pos, prefix.size()), prefix);
+}
+
+// 첫 글자가 영문자가 아닌 needle ("</script" 등) 은 find 로 후보 위치만 비교 (선형)
+size_t findIgnoreCase(std::string_view text, std::string_view needle, size_t from) {
+    if (needle.empty()) return from <= text.size() ? from : std::string_view::npos;
+    const char first = needle[0];
+    const bool letter = lowerChar(first) != first || (first >= 'a' && first <= 'z');
+    for (size_t i = from; i + needle.size() <= text.size(); ++i) {
+        if (!letter) {
+            i = text.find(first, i);
+            if (i == std::string_view::npos || i + needle.size() > text.size()) break;
+        } else if (lowerChar(text[i]) != lowerChar(first)) {
+            continue;
+        }
+        if (startsWithAt(text, i, needle)) return i;
+    }
+    return std::string_view::npos;
+}
+
+// text[pos..] 가 prefix 보다 짧고 그 앞부분과 같음 (다음 조각이 와야 구분 가능)
+bool isPartialAt(std::string_view text, size_t pos, std::string_view prefix) {
+    size_t available = text.size() - pos;
+    return available < prefix.size() && equalsIgnoreCase(text.substr(pos), prefix.substr(0, available));
+}
+
+bool isVoidElement(std::string_view tag) {
+    static const char* const VOID_TAGS[] = {"area", "base", "br", "col", "embed", "hr", "img", "input",
+                                            "link", "meta", "param", "source", "track", "wbr"};
+    for (const char* v : VOID_TAGS) {
+        if (tag == v) return true;
+    }
+    return false;
+}
+
+bool isRawTextElement(std::string_view tag) {
+    return tag == "script" || tag == "style" || tag == "xmp" || tag == "iframe" ||
+           tag == "noembed" || tag == "noframes" || tag == "plaintext";
+}
+
+bool isJavaScriptType(std::string_view type) {
+    std::string lower;
+    for (char c : type) {
+        if (c == ';') break;
+        if (c != ' ' && c != '\t') lower.push_back(lowerChar(c));
+    }
+    static const char* const TYPES[] = {"", "text/javascript", "application/javascript", "module",
+                                        "text/ecmascript", "application/ecmascript", "text/jscript",
+                                        "application/x-javascript", "text/x-javascript", "text/livescript"};
+    for (const char* t : TYPES) {
+        if (lower == t) return true;
+    }
+    return false;
+}
+
+void appendEscaped(std::string& out, std::string_view text, bool attribute) {
+    for (char c : text) {
+        switch (c) {
+        case '&': out += "&amp;"; break;
+        case '<': if (attribute) out += c; else out += "&lt;"; break;
+        case '>': if (attribute) out += c; else out += "&gt;"; break;
+        case '"': if (attribute) out += "&quot;"; else out += c; break;
+        default: out += c; break;
+        }
+    }
+}
+
+// 선택자 한 단위 (tag#id.class[attr=value])
+struct Compound {
+    std::string tag;                    // 비어 있거나 "*" 면 모든 태그
+    std::string id;
+    std::vector<std::string> classes;
+    std::vector<std::pair<std::string, std::optional<std::string>>> attributes;
+};
+using SelectorChain = std::vector<Compound>;   // 후손 결합자로 연결 (왼쪽 → 오른쪽)
+
+bool isIdentChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '-' || c == '_' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+std::string readIdent(std::string_view s, size_t& i) {
+    size_t start = i;
+    while (i < s.size() && isIdentChar(s[i])) ++i;
+    return std::string(s.substr(start, i - start));
+}
+
+bool parseChain(std::string_view group, SelectorChain& chain) {
+    size_t i = 0;
+    while (i < group.size()) {
+        while (i < group.size() && (group[i] == ' ' || group[i] == '\t' || group[i] == '\n' || group[i] == '>')) ++i;
+        if (i >= group.size()) break;
+
+        Compound compound;
+        if (group[i] == '*') {
+            compound.tag = "*";
+            ++i;
+        } else if (isIdentChar(group[i])) {
+            compound.tag = readIdent(group, i);
+            std::transform(compound.tag.begin(), compound.tag.end(), compound.tag.begin(), lowerChar);
+        }
+
+        while (i < group.size() && group[i] != ' ' && group[i] != '\t' && group[i] != '\n' && group[i] != '>') {
+            char c = group[i++];
+            if (c == '#') {
+                compound.id = readIdent(group, i);
+                if (compound.id.empty()) return false;
+            } else if (c == '.') {
+                std::string cls = readIdent(group, i);
+                if (cls.empty()) return false;
+                compound.classes.push_back(std::move(cls));
+            } else if (c == '[') {
+                std::string name = readIdent(group, i);
+                if (name.empty()) return false;
+                std::transform(name.begin(), name.end(), name.begin(), lowerChar);
+                std::optional<std::string> value;
+                if (i < group.size() && group[i] == '=') {
+                    ++i;
+                    if (i < group.size() && (group[i] == '"' || group[i] == '\'')) {
+                        char quote = group[i++];
+                        size_t end = group.find(quote, i);
+                        if (end == std::string_view::npos) return false;
+                        value = std::string(group.substr(i, end - i));
+                        i = end + 1;
+                    } else {
+                        value = readIdent(group, i);
+                    }
+                }
+                if (i >= group.size() || group[i] != ']') return false;
+                ++i;
+                compound.attributes.emplace_back(std::move(name), std::move(value));
+            } else {
+                return false;       // 의사 클래스 / 형제 결합자 등
+            }
+        }
+        if (compound.tag.empty() && compound.id.empty() && compound.classes.empty() && compound.attributes.empty()) {
+            return false;
+        }
+        chain.push_back(std::move(compound));
+    }
+    return !chain.empty();
+}
+
+bool hasClass(std::string_view classAttr, std::string_view cls) {
+    size_t i = 0;
+    while (i < classAttr.size()) {
+        while (i < classAttr.size() && (classAttr[i] == ' ' || classAttr[i] == '\t' || classAttr[i] == '\n')) ++i;
+        size_t start = i;
+        while (i < classAttr.size() && classAttr[i] != ' ' && classAttr[i] != '\t' && classAttr[i] != '\n') ++i;
+        if (i > start && classAttr.substr(start, i - start) == cls) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// DomTree
+// ============================================================================
+
+DomTree::DomTree() : arena_(MAX_ARENA_BYTES) {
+    initDocument();
+}
+
+void DomTree::reset() {
+    arena_.reset();
+    nodes_.clear();
+    writeBuffer_.clear();
+    writeOpen_ = WriteOpen::None;
+    writeResume_ = 0;
+    scripts_.clear();
+    queuedTotal_ = 0;
+    droppedScripts_ = 0;
+    exhausted_ = false;
+    initDocument();
+}
+
+void DomTree::initDocument() {
+    document_ = newNode(DomNode::DOCUMENT);
+    html_ = createElement("html");
+    head_ = createElement("head");
+    body_ = createElement("body");
+    appendChild(document_, html_);
+    appendChild(html_, head_);
+    appendChild(html_, body_);
+}
+
+DomNode* DomTree::newNode(DomNode::Type type) {
+    if (nodes_.size() >= MAX_NODES) {
+        exhausted_ = true;
+        return nullptr;
+    }
+    void* memory = arena_.allocate(sizeof(DomNode), alignof(DomNode));
+    if (!memory) {
+        exhausted_ = true;
+        return nullptr;
+    }
+    DomNode* node = new (memory) DomNode{};
+    node->type = type;
+    node->serial = static_cast<uint32_t>(nodes_.size());
+    nodes_.push_back(node);
+    return node;
+}
+
+std::string_view DomTree::copy(std::string_view text) {
+    std::string_view out = arena_.copy(text);
+    if (out.size() != text.size()) {
+        exhausted_ = true;
+    }
+    return out;
+}
+
+std::string_view DomTree::copyLower(std::string_view text) {
+    std::string_view out = copy(text);
+    char* p = const_cast<char*>(out.data());
+    for (size_t i = 0; i < out.size(); ++i) {
+        p[i] = lowerChar(p[i]);
+    }
+    return out;
+}
+
+DomNode* DomTree::createElement(std::string_view tag) {
+    DomNode* node = newNode(DomNode::ELEMENT);
+    if (node) {
+        node->tag = copyLower(tag);
+    }
+    return node;
+}
+
+DomNode* DomTree::createText(std::string_view text) {
+    DomNode* node = newNode(DomNode::TEXT);
+    if (node) {
+        node->data = copy(text);
+    }
+    return node;
+}
+
+DomNode* DomTree::createComment(std::string_view text) {
+    DomNode* node = newNode(DomNode::COMMENT);
+    if (node) {
+        node->data = copy(text);
+    }
+    return node;
+}
+
+bool DomTree::contains(const DomNode* ancestor, const DomNode* node) {
+    for (const DomNode* n = node; n; n = n->parent) {
+        if (n == ancestor) return true;
+    }
+    return false;
+}
+
+bool DomTree::isConnected(const DomNode* node) {
+    while (node && node->parent) {
+        node = node->parent;
+    }
+    return node && node->type == DomNode::DOCUMENT;
+}
+
+bool DomTree::insertBefore(DomNode* parent, DomNode* child, DomNode* ref) {
+    if (!parent || !child || child->type == DomNode::DOCUMENT ||
+        (parent->type != DomNode::ELEMENT && parent->type != DomNode::DOCUMENT) ||
+        contains(child, parent) || (ref && ref->parent != parent)) {
+        return false;
+    }
+    if (ref == child) {
+        ref = child->next;
+    }
+
+    if (child->parent) {
+        removeChild(child->parent, child);
+    }
+
+    child->parent = parent;
+    child->next = ref;
+    child->prev = ref ? ref->prev : parent->lastChild;
+    if (child->prev) {
+        child->prev->next = child;
+    } else {
+        parent->firstChild = child;
+    }
+    if (ref) {
+        ref->prev = child;
+    } else {
+        parent->lastChild = child;
+    }
+    return true;
+}
+
+bool DomTree::removeChild(DomNode* parent, DomNode* child) {
+    if (!parent || !child || child->parent != parent) {
+        return false;
+    }
+    if (child->prev) {
+        child->prev->next = child->next;
+    } else {
+        parent->firstChild = child->next;
+    }
+    if (child->next) {
+        child->next->prev = child->prev;
+    } else {
+        parent->lastChild = child->prev;
+    }
+    child->parent = nullptr;
+    child->prev = nullptr;
+    child->next = nullptr;
+    return true;
+}
+
+void DomTree::removeChildren(DomNode* parent) {
+    if (!parent) return;
+    while (parent->firstChild) {
+        removeChild(parent, parent->firstChild);
+    }
+}
+
+void DomTree::setAttribute(DomNode* element, std::string_view name, std::string_view value) {
+    if (!element || element->type != DomNode::ELEMENT || name.empty()) {
+        return;
+    }
+    DomAttribute* last = nullptr;
+    for (DomAttribute* attr = element->attributes; attr; attr = attr->next) {
+        if (equalsIgnoreCase(attr->name, name)) {
+            attr->value = copy(value);
+            return;
+        }
+        last = attr;
+    }
+
+    void* memory = arena_.allocate(sizeof(DomAttribute), alignof(DomAttribute));
+    if (!memory) {
+        exhausted_ = true;
+        return;
+    }
+    DomAttribute* attr = new (memory) DomAttribute{copyLower(name), copy(value), nullptr};
+    if (last) {
+        last->next = attr;      // 선언 순서 유지 (outerHTML)
+    } else {
+        element->attributes = attr;
+    }
+}
+
+std::optional<std::string_view> DomTree::getAttribute(const DomNode* element, std::string_view name) const {
+    if (!element) return std::nullopt;
+    for (const DomAttribute* attr = element->attributes; attr; attr = attr->next) {
+        if (equalsIgnoreCase(attr->name, name)) {
+            return attr->value;
+        }
+    }
+    return std::nullopt;
+}
+
+bool DomTree::removeAttribute(DomNode* element, std::string_view name) {
+    if (!element) return false;
+    DomAttribute** link = &element->attributes;
+    while (*link) {
+        if (equalsIgnoreCase((*link)->name, name)) {
+            *link = (*link)->next;
+            return true;
+        }
+        link = &(*link)->next;
+    }
+    return false;
+}
+
+std::string DomTree::textContent(const DomNode* node) const {
+    if (!node) return {};
+    if (node->type == DomNode::TEXT || node->type == DomNode::COMMENT) {
+        return std::string(node->data);
+    }
+    std::string out;
+    for (const DomNode* n = node->firstChild; n; ) {
+        if (n->type == DomNode::TEXT) {
+            out.append(n->data);
+        }
+        // 전위 순회 (node 의 subtree 안에서만)
+        if (n->firstChild) {
+            n = n->firstChild;
+            continue;
+        }
+        while (n && n != node && !n->next) n = n->parent;
+        if (!n || n == node) break;
+        n = n->next;
+    }
+    return out;
+}
+
+void DomTree::setTextContent(DomNode* node, std::string_view text) {
+    if (!node) return;
+    if (node->type == DomNode::TEXT || node->type == DomNode::COMMENT) {
+        node->data = copy(text);
+        return;
+    }
+    removeChildren(node);
+    if (!text.empty()) {
+        appendChild(node, createText(text));
+    }
+}
+
+std::string DomTree::serialize(const DomNode* node, bool outer) const {
+    std::string out;
+    if (!node) return out;
+
+    // 재귀 없이 직렬화 (깊은 트리에서 스택 보호)
+    struct Frame { const DomNode* node; bool closing; };
+    std::vector<Frame> stack;
+    if (outer) {
+        stack.push_back({node, false});
+    } else {
+        for (const DomNode* c = node->lastChild; c; c = c->prev) stack.push_back({c, false});
+    }
+
+    while (!stack.empty()) {
+        Frame frame = stack.back();
+        stack.pop_back();
+        const DomNode* n = frame.node;
+        if (frame.closing) {
+            out += "</";
+            out.append(n->tag);
+            out += '>';
+            continue;
+        }
+        switch (n->type) {
+        case DomNode::TEXT:
+            if (n->parent && isRawTextElement(n->parent->tag)) {
+                out.append(n->data);
+            } else {
+                appendEscaped(out, n->data, false);
+            }
+            break;
+        case DomNode::COMMENT:
+            out += "<!--";
+            out.append(n->data);
+            out += "-->";
+            break;
+        case DomNode::ELEMENT:
+            out += '<';
+            out.append(n->tag);
+            for (const DomAttribute* attr = n->attributes; attr; attr = attr->next) {
+                out += ' ';
+                out.append(attr->name);
+                out += "=\"";
+                appendEscaped(out, attr->value, true);
+                out += '"';
+            }
+            out += '>';
+            if (isVoidElement(n->tag)) break;
+            stack.push_back({n, true});
+            for (const DomNode* c = n->lastChild; c; c = c->prev) stack.push_back({c, false});
+            break;
+        case DomNode::DOCUMENT:
+            for (const DomNode* c = n->lastChild; c; c = c->prev) stack.push_back({c, false});
+            break;
+        }
+    }
+    return out;
+}
+
+DomNode* DomTree::getElementById(std::string_view id) const {
+    if (id.empty()) return nullptr;
+    for (DomNode* n = document_ ? document_->firstChild : nullptr; n; ) {
+        if (n->type == DomNode::ELEMENT) {
+            auto value = getAttribute(n, "id");
+            if (value && *value == id) return n;
+        }
+        if (n->firstChild) {
+            n = n->firstChild;
+            continue;
+        }
+        while (n && !n->next) n = n->parent;
+        if (n) n = n->next;
+    }
+    return nullptr;
+}
+
+std::vector<DomNode*> DomTree::querySelectorAll(const DomNode* root, std::string_view selector, size_t limit) const {
+    std::vector<DomNode*> matches;
+    if (!root || limit == 0) return matches;
+
+    std::vector<SelectorChain> groups;
+    size_t start = 0;
+    while (start <= selector.size()) {
+        size_t comma = selector.find(',', start);
+        if (comma == std::string_view::npos) comma = selector.size();
+        SelectorChain chain;
+        if (!parseChain(selector.substr(start, comma - start), chain)) {
+            return matches;
+        }
+        groups.push_back(std::move(chain));
+        start = comma + 1;
+    }
+
+    auto matchCompound = [this](const DomNode* n, const Compound& c) {
+        if (n->type != DomNode::ELEMENT) return false;
+        if (!c.tag.empty() && c.tag != "*" && n->tag != c.tag) return false;
+        if (!c.id.empty()) {
+            auto id = getAttribute(n, "id");
+            if (!id || *id != c.id) return false;
+        }
+        if (!c.classes.empty()) {
+            auto cls = getAttribute(n, "class");
+            if (!cls) return false;
+            for (const auto& name : c.classes) {
+                if (!hasClass(*cls, name)) return false;
+            }
+        }
+        for (const auto& [name, value] : c.attributes) {
+            auto attr = getAttribute(n, name);
+            if (!attr || (value && *attr != *value)) return false;
+        }
+        return true;
+    };
+
+    // 오른쪽 단위부터 맞추고 나머지는 가까운 조상부터 탐욕적으로 (후손 결합자만 있으므로 충분)
+    auto matchChain = [&](const DomNode* n, const SelectorChain& chain) {
+        if (!matchCompound(n, chain.back())) return false;
+        const DomNode* ancestor = n->parent;
+        for (size_t i = chain.size() - 1; i-- > 0; ) {
+            while (ancestor && !matchCompound(ancestor, chain[i])) ancestor = ancestor->parent;
+            if (!ancestor) return false;
+            ancestor = ancestor->parent;
+        }
+        return true;
+    };
+
+    for (DomNode* n = root->firstChild; n; ) {
+        for (const auto& chain : groups) {
+            if (matchChain(n, chain)) {
+                matches.push_back(n);
+                if (matches.size() >= limit) return matches;
+                break;
+            }
+        }
+        if (n->firstChild) {
+            n = n->firstChild;
+            continue;
+        }
+        while (n && n != root && !n->next) n = n->parent;
+        if (!n || n == root) break;
+        n = n->next;
+    }
+    return matches;
+}
+
+DomNode* DomTree::querySelector(const DomNode* root, std::string_view selector) const {
+    auto matches = querySelectorAll(root, selector, 1);
+    return matches.empty() ? nullptr : matches.front();
+}
+
+std::string DomTree::takeWritable(std::string_view chunk, bool flush) {
+    writeBuffer_.append(chunk);
+    if (flush || writeBuffer_.size() > MAX_WRITE_BUFFER) {
+        std::string all;
+        all.swap(writeBuffer_);
+        writeOpen_ = WriteOpen::None;
+        writeResume_ = 0;
+        return all;
+    }
+
+    // 열린 태그 / script / style / 주석이 닫히지 않은 첫 위치에서 자름
+    // - 남겨 둔 구성 요소는 항상 writeBuffer_ 맨 앞이고, 끝 표시는 지난번에 찾다 멈춘 위치부터 이어서 찾음
+    //   (조각을 많이 나눠 써도 전체 검사량은 누적 길이에 비례)
+    constexpr size_t npos = std::string_view::npos;
+    std::string_view text = writeBuffer_;
+    size_t cut = text.size();
+    size_t start = 0;
+    size_t i = 0;
+    WriteOpen open = writeOpen_;
+    size_t from = writeResume_;
+    size_t resume = 0;
+    while (true) {
+        if (open == WriteOpen::None) {
+            i = text.find('<', i);
+            if (i == npos) break;
+            // "<scr" 처럼 끝에서 잘린 시작 표시는 다음 조각과 합쳐서 다시 구분
+            if (isPartialAt(text, i, "<!--") || isPartialAt(text, i, "<script") || isPartialAt(text, i, "<style")) {
+                cut = i;
+                break;
+            }
+            start = i;
+            if (startsWithAt(text, i, "<!--")) {
+                open = WriteOpen::Comment;
+                from = i + 4;
+            } else if (startsWithAt(text, i, "<script") || startsWithAt(text, i, "<style")) {
+                open = WriteOpen::RawText;
+                writeCloseTag_ = startsWithAt(text, i, "<script") ? "</script" : "</style";
+                from = i + 1;
+            } else {
+                open = WriteOpen::Tag;
+                from = i + 1;
+            }
+        }
+
+        size_t end = npos;
+        if (open == WriteOpen::Comment) {
+            end = text.find("-->", from);
+            if (end != npos) end += 2;
+            else resume = (std::max)(from, text.size() >= 2 ? text.size() - 2 : 0);
+        } else if (open == WriteOpen::RawText) {
+            size_t close = findIgnoreCase(text, writeCloseTag_, from);
+            if (close == npos) {
+                size_t overlap = writeCloseTag_.size() - 1;
+                resume = (std::max)(from, text.size() >= overlap ? text.size() - overlap : 0);
+            } else {
+                // 닫는 태그 이후는 일반 태그처럼 '>' 만 찾음
+                open = WriteOpen::Tag;
+                from = close;
+                continue;
+            }
+        } else {
+            end = text.find('>', from);
+            if (end == npos) resume = text.size();
+        }
+        if (end == npos) {
+            cut = start;
+            break;
+        }
+        open = WriteOpen::None;
+        i = end + 1;
+    }
+
+    writeOpen_ = cut < text.size() ? open : WriteOpen::None;
+    writeResume_ = open == WriteOpen::None ? 0 : resume - cut;
+    std::string ready = writeBuffer_.substr(0, cut);
+    writeBuffer_.erase(0, cut);
+    return ready;
+}
+
+size_t DomTree::queueScripts(DomNode* root, const char* origin) {
+    if (!root || !isConnected(root)) {
+        return 0;
+    }
+    size_t added = 0;
+    for (DomNode* n = root; n; ) {
+        if (n->is("script") && !n->scriptStarted) {
+            auto type = getAttribute(n, "type");
+            auto src = getAttribute(n, "src");
+            std::string source = textContent(n);
+            if (type && !isJavaScriptType(*type)) {
+                n->scriptStarted = true;        // JSON / template 등은 실행하지 않음
+            } else if ((src && !src->empty()) || !source.empty()) {
+                n->scriptStarted = true;
+                if (queuedTotal_ >= MAX_SCRIPTS) {
+                    droppedScripts_++;
+                } else {
+                    scripts_.push_back({std::move(source), src ? std::string(*src) : std::string(), origin, n->serial});
+                    queuedTotal_++;
+                    added++;
+                }
+            }
+        }
+
+        if (n->firstChild) {
+            n = n->firstChild;
+            continue;
+        }
+        while (n && n != root && !n->next) n = n->parent;
+        if (!n || n == root) break;
+        n = n->next;
+    }
+    return added;
+}
+
+std::optional<DomTree::PendingScript> DomTree::nextScript() {
+    if (scripts_.empty()) {
+        return std::nullopt;
+    }
+    PendingScript script = std::move(scripts_.front());
+    scripts_.pop_front();
+    return script;
+}
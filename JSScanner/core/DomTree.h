@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 🔥 DOM 노드 / 문자열용 bump allocator
+// - 64KB 블록 단위로 할당하고 개별 해제 없이 reset() / 소멸 시 일괄 해제
+// - 여기서 할당한 객체는 소멸자가 호출되지 않으므로 trivially destructible 타입만 사용
+class DomArena {
+public:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    explicit DomArena(size_t limit) : limit_(limit) {}
+    DomArena(const DomArena&) = delete;
+    DomArena& operator=(const DomArena&) = delete;
+
+    // 한도 초과 시 nullptr
+    void* allocate(size_t size, size_t align);
+    // 문자열 복사본 (한도 초과 시 빈 view)
+    std::string_view copy(std::string_view text);
+    void reset();
+
+    size_t bytesReserved() const { return reserved_; }
+
+private:
+    std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+    uint8_t* cursor_ = nullptr;
+    uint8_t* end_ = nullptr;
+    size_t reserved_ = 0;
+    size_t limit_;
+};
+
+struct DomAttribute {
+    std::string_view name;      // 소문자
+    std::string_view value;
+    DomAttribute* next;
+};
+
+struct DomNode {
+    enum Type : uint8_t { DOCUMENT, ELEMENT, TEXT, COMMENT };
+
+    Type type;
+    bool scriptStarted;         // 실행 대기열에 넣었거나 실행하지 않기로 한 script (HTML "already started")
+    uint32_t serial;            // DomTree::node() 조회 키 (JS wrapper class 의 opaque)
+    std::string_view tag;       // 소문자 태그 (ELEMENT)
+    std::string_view data;      // TEXT / COMMENT 내용
+    DomAttribute* attributes;
+    DomNode* parent;
+    DomNode* firstChild;
+    DomNode* lastChild;
+    DomNode* prev;
+    DomNode* next;
+
+    bool isElement() const { return type == ELEMENT; }
+    bool is(std::string_view name) const { return type == ELEMENT && tag == name; }
+};
+
+// 🔥 Task 단위 경량 DOM (document.write / innerHTML / appendChild 의 대상)
+// - 노드 / 속성 / 문자열은 DomArena 에 할당하고 Task 가 끝나면 한 번에 해제
+// - 노드 수 / arena 크기 한도를 넘으면 생성 함수가 nullptr 을 반환 (호출 측은 기존 mock 동작 유지)
+// - document 에 연결된 script 는 실행 대기열(PendingScript)로 넘김 - 실행은 JSAnalyzer 블록 루프
+// - 단일 스레드 (Task 컨텍스트에서만 사용)
+class DomTree {
+public:
+    static constexpr size_t MAX_ARENA_BYTES = 32 * 1024 * 1024;
+    static constexpr size_t MAX_NODES = 200000;
+    static constexpr size_t MAX_SCRIPTS = 256;              // Task 당 대기열에 넣는 script 수
+    static constexpr size_t MAX_WRITE_BUFFER = 4 * 1024 * 1024;
+
+    struct PendingScript {
+        std::string source;     // inline 내용 (src 가 있으면 비어 있을 수 있음)
+        std::string src;
+        std::string origin;     // "document.write" / "innerHTML" / "appendChild" ...
+        uint32_t serial = 0;
+    };
+
+    DomTree();
+    DomTree(const DomTree&) = delete;
+    DomTree& operator=(const DomTree&) = delete;
+
+    // 모든 노드 해제 후 빈 문서(html / head / body)로 초기화
+    void reset();
+
+    DomNode* document() const { return document_; }
+    DomNode* documentElement() const { return html_; }
+    DomNode* head() const { return head_; }
+    DomNode* body() const { return body_; }
+    DomNode* node(uint32_t serial) const { return serial < nodes_.size() ? nodes_[serial] : nullptr; }
+
+    DomNode* createElement(std::string_view tag);
+    DomNode* createText(std::string_view text);
+    DomNode* createComment(std::string_view text);
+
+    // child 를 기존 위치에서 떼어 parent 아래로 이동 (ref 앞, ref 가 nullptr 이면 끝)
+    // child 가 parent 의 조상이거나 ref 가 parent 의 자식이 아니면 false
+    bool insertBefore(DomNode* parent, DomNode* child, DomNode* ref);
+    bool appendChild(DomNode* parent, DomNode* child) { return insertBefore(parent, child, nullptr); }
+    bool removeChild(DomNode* parent, DomNode* child);
+    void removeChildren(DomNode* parent);
+
+    void setAttribute(DomNode* element, std::string_view name, std::string_view value);
+    std::optional<std::string_view> getAttribute(const DomNode* element, std::string_view name) const;
+    bool removeAttribute(DomNode* element, std::string_view name);
+
+    static bool isConnected(const DomNode* node);
+    static bool contains(const DomNode* ancestor, const DomNode* node);
+
+    std::string textContent(const DomNode* node) const;
+    // 자식을 모두 지우고 텍스트 노드 하나로 교체 (빈 문자열이면 자식 없음)
+    void setTextContent(DomNode* node, std::string_view text);
+    // outer: 자신 포함 (outerHTML) / 아니면 자식만 (innerHTML)
+    std::string serialize(const DomNode* node, bool outer) const;
+
+    DomNode* getElementById(std::string_view id) const;
+    // 지원: 태그 / #id / .class / [attr] / [attr=value] 조합, 공백·'>' 후손 결합자, ',' 목록
+    // (의사 클래스 등 해석할 수 없는 선택자는 아무것도 찾지 않음)
+    std::vector<DomNode*> querySelectorAll(const DomNode* root, std::string_view selector, size_t limit = SIZE_MAX) const;
+    DomNode* querySelector(const DomNode* root, std::string_view selector) const;
+
+    // 🔥 document.write 조각 누적 - 태그 / script / 주석이 닫힌 지점까지만 돌려주고 나머지는 보관
+    // flush: 보관 중인 나머지까지 모두 반환 (document.close / 블록 종료)
+    std::string takeWritable(std::string_view chunk, bool flush);
+    bool hasPendingWrite() const { return !writeBuffer_.empty(); }
+
+    // 새로 document 에 연결된 subtree 의 script 를 실행 대기열에 추가 (추가한 수)
+    // 내용과 src 가 모두 없는 script 는 나중에 내용이 채워질 때 다시 호출하면 추가됨
+    size_t queueScripts(DomNode* root, const char* origin);
+    std::optional<PendingScript> nextScript();
+    size_t pendingScripts() const { return scripts_.size(); }
+    size_t queuedScripts() const { return queuedTotal_; }
+    size_t droppedScripts() const { return droppedScripts_; }
+
+    size_t nodeCount() const { return nodes_.size(); }
+    size_t arenaBytes() const { return arena_.bytesReserved(); }
+    // 한도 때문에 생성 / 복사를 거부한 적이 있는지
+    bool exhausted() const { return exhausted_; }
+
+private:
+    DomNode* newNode(DomNode::Type type);
+    std::string_view copyLower(std::string_view text);
+    std::string_view copy(std::string_view text);
+    void initDocument();
+
+    DomArena arena_;
+    std::vector<DomNode*> nodes_;           // serial → 노드
+    DomNode* document_ = nullptr;
+    DomNode* html_ = nullptr;
+    DomNode* head_ = nullptr;
+    DomNode* body_ = nullptr;
+
+    std::string writeBuffer_;
+    // writeBuffer_ 맨 앞에 남은 (닫히지 않은) 구성 요소와 끝 표시를 이어서 찾을 위치
+    enum class WriteOpen { None, Tag, Comment, RawText };
+    WriteOpen writeOpen_ = WriteOpen::None;
+    std::string_view writeCloseTag_;        // RawText: "</script" / "</style" (문자열 상수)
+    size_t writeResume_ = 0;
+    std::deque<PendingScript> scripts_;
+    size_t queuedTotal_ = 0;
+    size_t droppedScripts_ = 0;
+    bool exhausted_ = false;
+};
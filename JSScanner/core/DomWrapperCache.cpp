@@ -0,0 +1,29 @@
+#include "pch.h"
+#include "DomWrapperCache.h"
+
+JSValueConst DomWrapperCache::get(uint32_t serial) const {
+    auto it = wrappers_.find(serial);
+    return it == wrappers_.end() ? JS_UNDEFINED : it->second;
+}
+
+void DomWrapperCache::put(JSContext* ctx, uint32_t serial, JSValueConst wrapper) {
+    auto [it, inserted] = wrappers_.emplace(serial, JS_UNDEFINED);
+    if (!inserted) {
+        JS_FreeValue(ctx, it->second);
+    }
+    it->second = JS_DupValue(ctx, wrapper);
+}
+
+void DomWrapperCache::setElementProto(JSContext* ctx, JSValue proto) {
+    JS_FreeValue(ctx, elementProto_);
+    elementProto_ = proto;
+}
+
+void DomWrapperCache::release(JSRuntime* rt) {
+    for (auto& entry : wrappers_) {
+        JS_FreeValueRT(rt, entry.second);
+    }
+    wrappers_.clear();
+    JS_FreeValueRT(rt, elementProto_);
+    elementProto_ = JS_UNDEFINED;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include "../quickjs.h"
+
+// 🔥 DOM 노드 → JS wrapper 객체 (노드당 1개 - getElementById 결과끼리 === 비교 유지)
+// - wrapper 는 강한 참조로 보관하고 Task 런타임 정리 전에 release() 로 해제
+//   (노드는 DomTree arena 에 있으므로 wrapper finalizer 에서 노드를 건드리지 않음)
+// - Element 공통 메서드 / accessor 를 가진 prototype 도 함께 보관
+class DomWrapperCache {
+public:
+    DomWrapperCache() = default;
+    DomWrapperCache(const DomWrapperCache&) = delete;
+    DomWrapperCache& operator=(const DomWrapperCache&) = delete;
+
+    // 보관 중인 wrapper (없으면 JS_UNDEFINED, 참조 수 증가 없음)
+    JSValueConst get(uint32_t serial) const;
+    // wrapper 보관 (참조를 복제해서 보관)
+    void put(JSContext* ctx, uint32_t serial, JSValueConst wrapper);
+
+    JSValueConst elementProto() const { return elementProto_; }
+    // prototype 소유권을 넘겨받음
+    void setElementProto(JSContext* ctx, JSValue proto);
+
+    // JS_FreeRuntime 전에 호출
+    void release(JSRuntime* rt);
+
+    size_t size() const { return wrappers_.size(); }
+
+private:
+    std::unordered_map<uint32_t, JSValue> wrappers_;
+    JSValue elementProto_ = JS_UNDEFINED;
+};
@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "DynamicAnalyzer.h"
+#include "MetricsRegistry.h"
+#include "HookBus.h"
+#include "../reporters/constants/AnalysisConstants.h"
 
 #include "../model/JsValueVariant.h"
 
@@ -52,13 +55,28 @@ void DynamicAnalyzer::recordEvent(const HookEvent& event) {
         // Remove oldest 10% to avoid frequent single deletions
         size_t removeCount = DynamicAnalyzer::MAX_CAPTURED_EVENTS / 10;
         capturedEvents.erase(capturedEvents.begin(), capturedEvents.begin() + removeCount);
-        core::Log_Debug("%s[HOOK] Memory limit reached. Removed %zu oldest events.", 
+        SCAN_LOG_DEBUG("%s[HOOK] Memory limit reached. Removed %zu oldest events.", 
                        logMsg.c_str(), removeCount);
     }
     
     capturedEvents.push_back(event);
+    MetricsRegistry::instance().recordHookEvent(event.getType());
     // Hook event recorded (severity: %d)
-    core::Log_Debug("%s[HOOK] %s (severity: %d)", logMsg.c_str(), summarizeHookEvent(event).c_str(), event.getSeverity());
+    SCAN_LOG_DEBUG("%s[HOOK] %s (severity: %d)", logMsg.c_str(), summarizeHookEvent(event).c_str(), event.getSeverity());
+}
+
+void DynamicAnalyzer::subscribe(HookBus& bus) {
+    // ResponseGenerator 입력 기준:
+    // - severity >= MIN_RELEVANT_SEVERITY 이벤트, DATA_EXFILTRATION / FETCH_REQUEST 전체
+    // - 암호화 연산 그룹핑이 보는 CRYPTO_OPERATION / FUNCTION_CALL 은 MIN_CHAIN_EVENT_SEVERITY 이상
+    //   (Math.* / jQuery 유틸 등 severity 1 호출은 payload 를 만들지 않음)
+    HookBus::Interest interest;
+    interest.atLeast(AnalysisConstants::MIN_RELEVANT_SEVERITY)
+        .on(HookType::DATA_EXFILTRATION)
+        .on(HookType::FETCH_REQUEST)
+        .on(HookType::CRYPTO_OPERATION, AnalysisConstants::MIN_CHAIN_EVENT_SEVERITY)
+        .on(HookType::FUNCTION_CALL, AnalysisConstants::MIN_CHAIN_EVENT_SEVERITY);
+    bus.subscribe("DynamicAnalyzer", interest, [this](const HookEvent& event) { recordEvent(event); });
 }
 
 const std::vector<HookEvent>& DynamicAnalyzer::getHookEvents() const {
@@ -77,18 +95,4 @@ std::vector<HookEvent> DynamicAnalyzer::getEventsBySeverity(int minSeverity) con
 
 void DynamicAnalyzer::reset() {
     capturedEvents.clear();
-    functionCallCount = 0;
-}
-
-// 함수 호출 카운터 메서드 구현
-void DynamicAnalyzer::incrementFunctionCallCount() {
-    functionCallCount++;
-}
-
-size_t DynamicAnalyzer::getFunctionCallCount() const {
-    return functionCallCount;
-}
-
-void DynamicAnalyzer::resetFunctionCallCount() {
-    functionCallCount = 0;
 }
@@ -18,7 +18,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Sensitive function name stored in variable"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Sensitive function: " + varName + " = \"" + value + "\"");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Sensitive function: " + varName + " = \"" + value + "\"");
     }
 
     // Check for URL
@@ -28,7 +28,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "URL stored in variable"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] URL in variable: " + varName + " = \"" + value + "\"");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] URL in variable: " + varName + " = \"" + value + "\"");
     }
     
     // 🔥 새로 추가: 복잡한 난독화 패턴 감지
@@ -43,7 +43,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Array index shuffling pattern detected - common obfuscation technique"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Array obfuscation: " + varName);
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Array obfuscation: " + varName);
     }
     
     // 2. 16진수 변수명 패턴 (_0xABCD 같은 변수)
@@ -61,7 +61,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Multiple hexadecimal variable names detected (count: " + std::to_string(hex_var_count) + ")"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Hex variable names: " + std::to_string(hex_var_count));
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Hex variable names: " + std::to_string(hex_var_count));
     }
     
     // 3. 대량의 Base64 인코딩 데이터 (1000자 이상)
@@ -71,7 +71,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Large Base64 encoded data (" + std::to_string(value.length()) + " bytes)"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Large Base64: " + std::to_string(value.length()) + " bytes");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Large Base64: " + std::to_string(value.length()) + " bytes");
     }
     
     // 4. IIFE (즉시 실행 함수) 패턴
@@ -82,7 +82,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Immediately Invoked Function Expression (IIFE) detected"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] IIFE pattern detected");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] IIFE pattern detected");
     }
     
     // 5. 다층 디코딩 체인 (atob + TextDecoder + document.write)
@@ -94,7 +94,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Multi-layer decoding chain: atob -> TextDecoder -> document.write"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Decoding chain detected");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Decoding chain detected");
     }
     
     // 6. JavaScript 코드가 문자열에 포함된 경우
@@ -115,7 +115,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
                 "JavaScript code stored in variable (keywords: " + std::to_string(js_keyword_count) + ")"
             );
             detectedEvents.push_back(event);
-            debug("[TRACKER] JS code in variable: " + std::to_string(js_keyword_count) + " keywords");
+            SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] JS code in variable: " + std::to_string(js_keyword_count) + " keywords");
         }
     }
     
@@ -127,7 +127,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Dangerous HTML tags in variable"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Dangerous HTML in variable");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Dangerous HTML in variable");
     }
     
     // 8. 안티-분석 패턴 (navigator.userAgent, window.innerWidth 체크)
@@ -141,7 +141,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Anti-analysis technique: Mobile device detection"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Anti-analysis detected");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Anti-analysis detected");
     }
     
     // 9. 악성 패턴 (ActiveXObject, WScript.Shell 등)
@@ -156,7 +156,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
                 "Malicious pattern detected: " + pattern
             );
             detectedEvents.push_back(event);
-            debug("[TRACKER] Malicious pattern: " + pattern);
+            SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Malicious pattern: " + pattern);
             break; // 하나만 감지해도 충분
         }
     }
@@ -168,7 +168,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "🚨 CRITICAL: Clipboard hijacking with malicious payload detected!"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] 🚨 CLIPBOARD HIJACKING DETECTED!");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] 🚨 CLIPBOARD HIJACKING DETECTED!");
     }
     
     // 11. 악성 명령어 탐지 (cmd, wscript, CreateObject 등)
@@ -178,7 +178,7 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "⚠️  Malicious system command detected (cmd/powershell/wscript)"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] ⚠️  Malicious command detected");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] ⚠️  Malicious command detected");
     }
     
     // 12. 스크립트 인젝션 탐지
@@ -188,7 +188,19 @@ void DynamicStringTracker::trackString(const std::string& varName, const std::st
             "Script injection pattern detected (eval/Execute/document.write)"
         );
         detectedEvents.push_back(event);
-        debug("[TRACKER] Script injection pattern");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Script injection pattern");
+    }
+
+    // 13. XOR / ROT / shift 로 가려진 문자열 복호화 후 평문을 다시 추적
+    // (복호화 결과는 키워드를 포함하므로 isCandidate 에서 걸러져 재귀는 한 단계로 끝남)
+    if (auto candidate = bruteForce.tryDecode(value)) {
+        SensitiveStringEvent event(
+            varName, candidate->decoded.substr(0, 200), "brute_force_decoded",
+            "Obfuscated string decoded with " + candidate->describe()
+        );
+        detectedEvents.push_back(event);
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Brute-force decoded (" + candidate->describe() + "): " + varName);
+        trackString(varName + "#decoded", candidate->decoded);
     }
 }
 
@@ -204,7 +216,7 @@ std::string DynamicStringTracker::resolveIndirectCall(const std::string& varName
     std::string value = getTrackedString(varName);
 
     if (!value.empty() && StringDeobfuscator::isSensitiveFunctionName(value)) {
-        debug("[TRACKER] Resolved indirect call: window[" + varName + "] -> " + value);
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "[TRACKER] Resolved indirect call: window[" + varName + "] -> " + value);
 
         SensitiveStringEvent event(
             varName, value, "indirect_call",
@@ -222,12 +234,14 @@ const std::vector<DynamicStringTracker::SensitiveStringEvent>& DynamicStringTrac
 
 void DynamicStringTracker::reset() {
     trackedStrings.clear();
+    eventBase += detectedEvents.size();
     detectedEvents.clear();
+    bruteForce.resetBudget();
 }
 
 void DynamicStringTracker::generateReport() const {
     if (detectedEvents.empty()) {
-        debug("✅ No sensitive string events detected");
+        SCAN_LOG_DEBUG("%s[DynamicStringTracker] %s", logMsg.c_str(), "✅ No sensitive string events detected");
         return;
     }
 
@@ -4,18 +4,14 @@
 #include <vector>
 #include <unordered_map>
 #include <chrono>
-#include <iostream> // For debug logging
 
 #include "StringDeobfuscator.h" // Include the actual header
+#include "BruteForceDecoder.h"
 
 // No need for forward declarations here, as StringDeobfuscator.h is included
 // and its static methods are directly accessible.
 
-// Define DEBUG_MODE for conditional logging, similar to Java's Main.DEBUG_MODE
-// This can be controlled by a preprocessor definition or a global variable
-#ifndef SCANNER_DEBUG_MODE
-#define SCANNER_DEBUG_MODE true // Set to false for release builds
-#endif
+// 디버그 로그는 SCAN_LOG_DEBUG 로 출력 (Release 빌드에서는 메시지 생성 자체가 제거됨)
 
 class DynamicStringTracker {
 public:
@@ -38,12 +34,8 @@ public:
 private:
     std::unordered_map<std::string, std::string> trackedStrings;
     std::vector<SensitiveStringEvent> detectedEvents;
-
-    void debug(const std::string& message) const {
-        if (SCANNER_DEBUG_MODE) {
-            std::cerr << "[DynamicStringTracker] " << message << std::endl;
-        }
-    }
+    size_t eventBase = 0;  // reset() 으로 버려진 이벤트 수 (커서는 계속 증가)
+    BruteForceDecoder bruteForce;  // XOR/ROT/shift 복호화 (Task 단위 예산, reset 에서 초기화)
 
 public:
     DynamicStringTracker();
@@ -53,6 +45,15 @@ public:
     std::string getTrackedString(const std::string& varName) const;
     std::string resolveIndirectCall(const std::string& varName);
     const std::vector<SensitiveStringEvent>& getDetectedEvents() const;
+
+    // 🔥 단조 증가 이벤트 커서 (reset 이후에도 감소하지 않음)
+    // 처리한 위치를 저장해두고 이후에는 그 뒤에 생긴 이벤트만 처리
+    size_t getEventCursor() const { return eventBase + detectedEvents.size(); }
+    size_t getFirstEventCursor() const { return eventBase; }
+    const SensitiveStringEvent& getEventAt(size_t cursor) const { return detectedEvents[cursor - eventBase]; }
     void reset();
     void generateReport() const;
+
+    // 정적 분석 등 추적 외 경로에서도 같은 예산으로 복호화하도록 공유
+    BruteForceDecoder& getBruteForceDecoder() { return bruteForce; }
 };
\ No newline at end of file
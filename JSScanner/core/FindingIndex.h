@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+// 🔥 finding 중복 제거 인덱스 (Task 단위)
+// - key 는 (reason, 메시지) 전체 문자열 - hash 충돌이나 구분자 조합으로 다른 finding 이 빠지지 않음
+// - reason 길이를 앞에 붙여서 ("ab", "c") 와 ("a", "bc") 가 같은 key 가 되지 않게 함
+class FindingIndex {
+public:
+    // 처음 보는 (reason, 메시지) 면 true
+    bool insert(std::string_view reason, std::string_view message) {
+        return keys_.insert(makeKey(reason, message)).second;
+    }
+
+    bool contains(std::string_view reason, std::string_view message) const {
+        return keys_.count(makeKey(reason, message)) != 0;
+    }
+
+    size_t size() const { return keys_.size(); }
+    void clear() { keys_.clear(); }
+
+private:
+    static std::string makeKey(std::string_view reason, std::string_view message) {
+        std::string key = std::to_string(reason.size());
+        key.reserve(key.size() + 1 + reason.size() + message.size());
+        key.push_back(':');
+        key.append(reason);
+        key.append(message);
+        return key;
+    }
+
+    std::unordered_set<std::string> keys_;
+};
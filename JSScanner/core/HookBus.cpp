@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "HookBus.h"
+#include "MetricsRegistry.h"
+
+HookBus::Interest& HookBus::Interest::atLeast(int minSeverity) {
+    for (int& value : minSeverity_) {
+        value = (std::min)(value, minSeverity);
+    }
+    return *this;
+}
+
+HookBus::Interest& HookBus::Interest::on(HookType type, int minSeverity) {
+    int& value = minSeverity_[static_cast<size_t>(type)];
+    value = (std::min)(value, minSeverity);
+    return *this;
+}
+
+void HookBus::subscribe(std::string name, const Interest& interest, Handler handler) {
+    subscribers_.push_back({std::move(name), interest, std::move(handler)});
+    rebuildAcceptTable();
+}
+
+void HookBus::clearSubscribers() {
+    subscribers_.clear();
+    rebuildAcceptTable();
+}
+
+void HookBus::rebuildAcceptTable() {
+    acceptMin_.fill(Interest::NOT_INTERESTED);
+    for (const Subscriber& subscriber : subscribers_) {
+        for (size_t i = 0; i < HOOK_TYPE_COUNT; ++i) {
+            acceptMin_[i] = (std::min)(acceptMin_[i], subscriber.interest.minSeverity(static_cast<HookType>(i)));
+        }
+    }
+}
+
+void HookBus::dispatch(HookType type, int severity, const HookEvent& event) {
+    for (const Subscriber& subscriber : subscribers_) {
+        if (subscriber.interest.accepts(type, severity)) {
+            subscriber.handler(event);
+        }
+    }
+}
+
+void HookBus::exportMetrics() {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    for (size_t i = 0; i < HOOK_TYPE_COUNT; ++i) {
+        HookStats& stats = stats_[i];
+        if (stats.emitted == 0 && stats.skipped == 0) {
+            continue;
+        }
+        std::string type = HookTypeToString(static_cast<HookType>(i));
+        if (stats.emitted) {
+            registry.counter("jsscanner_hook_bus_events_total", {{"type", type}, {"outcome", "emitted"}},
+                             "Hook bus events by type and outcome").inc(stats.emitted);
+        }
+        if (stats.skipped) {
+            registry.counter("jsscanner_hook_bus_events_total", {{"type", type}, {"outcome", "skipped"}},
+                             "Hook bus events by type and outcome").inc(stats.skipped);
+        }
+        registry.gauge("jsscanner_hook_bus_overhead_seconds_total", {{"type", type}, {"phase", "build"}},
+                       "Time spent building and dispatching hook events").add(stats.buildNs / 1e9);
+        registry.gauge("jsscanner_hook_bus_overhead_seconds_total", {{"type", type}, {"phase", "dispatch"}},
+                       "Time spent building and dispatching hook events").add(stats.dispatchNs / 1e9);
+        stats = HookStats{};
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <array>
+#include <vector>
+#include <string>
+#include <map>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include "../hooks/HookType.h"
+#include "../hooks/HookEvent.h"
+#include "../model/JsValueVariant.h"
+
+// emit() 빌더가 HookEvent 대신 반환할 수 있는 간단한 payload
+struct HookPayload {
+    std::string name;
+    std::vector<JsValue> args;
+    JsValue result;
+    std::map<std::string, JsValue> metadata;
+};
+
+// 🔥 Hook 이벤트 버스 (Task 컨텍스트 단위, 단일 스레드)
+// - 소비자는 HookType 별 최소 severity 로 관심을 등록
+// - 발행자는 (type, severity) 와 payload 빌더만 넘기고, 받을 구독자가 있을 때만 빌더를 호출
+//     a_ctx->hookBus.emit(HookType::CRYPTO_OPERATION, 6, [&] {
+//         return HookPayload{"atob", {JsValue(input)}, JsValue(output), {}};
+//     });
+// - HookType 별 발행/생략 횟수와 생성/전달 시간을 집계 (exportMetrics 로 MetricsRegistry 에 반영)
+class HookBus {
+public:
+    // HookType 별 최소 severity (NOT_INTERESTED = 받지 않음)
+    class Interest {
+    public:
+        static constexpr int NOT_INTERESTED = INT_MAX;
+
+        Interest() { minSeverity_.fill(NOT_INTERESTED); }
+
+        // 모든 HookType 을 minSeverity 이상에서 수신
+        Interest& atLeast(int minSeverity);
+        // 특정 HookType 을 minSeverity 이상에서 수신
+        Interest& on(HookType type, int minSeverity = INT_MIN);
+
+        bool accepts(HookType type, int severity) const {
+            return severity >= minSeverity_[static_cast<size_t>(type)];
+        }
+        int minSeverity(HookType type) const { return minSeverity_[static_cast<size_t>(type)]; }
+
+    private:
+        std::array<int, HOOK_TYPE_COUNT> minSeverity_;
+    };
+
+    using Handler = std::function<void(const HookEvent&)>;
+
+    struct HookStats {
+        uint64_t emitted = 0;   // 1개 이상 구독자에게 전달
+        uint64_t skipped = 0;   // 구독자가 없어 payload 생성 생략
+        uint64_t buildNs = 0;   // payload 생성 시간
+        uint64_t dispatchNs = 0; // 구독자 전달 시간
+    };
+
+    void subscribe(std::string name, const Interest& interest, Handler handler);
+    void clearSubscribers();
+
+    // (type, severity) 이벤트를 받을 구독자가 있는지 (O(1))
+    bool wants(HookType type, int severity) const {
+        return severity >= acceptMin_[static_cast<size_t>(type)];
+    }
+
+    // build(): HookEvent 또는 HookPayload 반환. 받을 구독자가 없으면 호출하지 않음
+    template <typename Build>
+    bool emit(HookType type, int severity, Build&& build) {
+        HookStats& stats = stats_[static_cast<size_t>(type)];
+        if (!wants(type, severity)) {
+            stats.skipped++;
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        HookEvent event = makeEvent(type, severity, build());
+        auto built = std::chrono::steady_clock::now();
+        dispatch(type, severity, event);
+        auto end = std::chrono::steady_clock::now();
+
+        stats.emitted++;
+        stats.buildNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(built - start).count());
+        stats.dispatchNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - built).count());
+        return true;
+    }
+
+    const HookStats& stats(HookType type) const { return stats_[static_cast<size_t>(type)]; }
+
+    // 누적 통계를 MetricsRegistry 에 더하고 초기화 (Task 종료 시 호출)
+    void exportMetrics();
+
+private:
+    struct Subscriber {
+        std::string name;
+        Interest interest;
+        Handler handler;
+    };
+
+    // type/severity 는 emit() 인자 기준으로 맞춤 (hookType 만 설정하던 호출부 보정)
+    static HookEvent makeEvent(HookType type, int severity, HookEvent&& event) {
+        event.type = event.hookType = type;
+        event.severity = severity;
+        return std::move(event);
+    }
+    static HookEvent makeEvent(HookType type, int severity, HookPayload&& payload) {
+        return HookEvent(type, std::move(payload.name), std::move(payload.args), std::move(payload.result),
+                         std::move(payload.metadata), severity);
+    }
+
+    void dispatch(HookType type, int severity, const HookEvent& event);
+    void rebuildAcceptTable();
+
+    std::vector<Subscriber> subscribers_;
+    std::array<int, HOOK_TYPE_COUNT> acceptMin_ = makeEmptyTable();
+    std::array<HookStats, HOOK_TYPE_COUNT> stats_{};
+
+    static std::array<int, HOOK_TYPE_COUNT> makeEmptyTable() {
+        std::array<int, HOOK_TYPE_COUNT> table;
+        table.fill(Interest::NOT_INTERESTED);
+        return table;
+    }
+};
@@ -0,0 +1,12 @@
+#include "pch.h"
+#include "HookCallCounters.h"
+
+std::map<std::string, uint64_t> HookCallCounters::snapshot() const {
+    std::map<std::string, uint64_t> counts;
+    for (size_t i = 0; i < HOOK_API_COUNT; ++i) {
+        if (calls_[i] != 0) {
+            counts[HOOK_API_POLICIES[i].name] = calls_[i];
+        }
+    }
+    return counts;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <array>
+#include <map>
+#include <string>
+#include <cstdint>
+#include "../hooks/HookApi.h"
+
+// hook 호출 허용 여부
+enum class HookCallDecision {
+    Record,        // 이벤트 기록/추적
+    Skip,          // 샘플링 또는 제한 초과로 건너뜀
+    LimitReached   // 이번 호출로 maxCalls 를 처음 넘음 (제한 초과 이벤트 1회 기록)
+};
+
+// 🔥 hook API 별 호출 카운터 (HookApiId 로 색인하는 고정 배열, Task 컨텍스트 단위)
+class HookCallCounters {
+public:
+    HookCallDecision onCall(HookApiId id) {
+        const HookApiPolicy& policy = hookApiPolicy(id);
+        uint64_t count = ++calls_[static_cast<size_t>(id)];
+        if (policy.countsAsActivity) {
+            activity_++;
+        }
+
+        if (policy.maxCalls != 0 && count > policy.maxCalls) {
+            return count == uint64_t{policy.maxCalls} + 1 ? HookCallDecision::LimitReached : HookCallDecision::Skip;
+        }
+        if (count > policy.sampleAfter && policy.sampleEvery > 1 &&
+            (count - policy.sampleAfter) % policy.sampleEvery != 0) {
+            return HookCallDecision::Skip;
+        }
+        return HookCallDecision::Record;
+    }
+
+    uint64_t count(HookApiId id) const { return calls_[static_cast<size_t>(id)]; }
+
+    // countsAsActivity API 의 전체 호출 수 (기존 DynamicAnalyzer 함수 호출 카운터 대체)
+    uint64_t activityCount() const { return activity_; }
+
+    // 리포트용 (호출된 API 만, 이름 → 횟수)
+    std::map<std::string, uint64_t> snapshot() const;
+
+    void reset() {
+        calls_.fill(0);
+        activity_ = 0;
+    }
+
+private:
+    std::array<uint64_t, HOOK_API_COUNT> calls_{};   // 긴 실행에서도 넘치지 않게 64비트
+    uint64_t activity_ = 0;
+};
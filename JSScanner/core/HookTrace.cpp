@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "HookTrace.h"
+#include <fstream>
+
+static thread_local HookTrace* g_current_hook_trace = nullptr;
+
+HookTrace::HookTrace(size_t maxRecords)
+    : maxRecords_(maxRecords), origin_(std::chrono::steady_clock::now()) {
+}
+
+HookTrace* HookTrace::current() {
+    return g_current_hook_trace;
+}
+
+HookTrace::Activation::Activation(HookTrace* trace)
+    : previous_(g_current_hook_trace) {
+    g_current_hook_trace = trace;
+}
+
+HookTrace::Activation::~Activation() {
+    g_current_hook_trace = previous_;
+}
+
+void HookTrace::record(const char* channel, const char* event, std::initializer_list<Field> fields) {
+    if (records_.size() >= maxRecords_) {
+        dropped_++;
+        return;
+    }
+    int64_t ts = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - origin_).count();
+    records_.push_back(Record{ts, channel, event, std::vector<Field>(fields)});
+}
+
+std::string HookTrace::toNdjson(const std::string& taskId) const {
+    std::string out;
+    out.reserve(records_.size() * 96);
+
+    for (const auto& record : records_) {
+        nlohmann::ordered_json line;
+        line["ts"] = record.tsUs;
+        line["ch"] = record.channel;
+        line["ev"] = record.event;
+        for (const auto& field : record.fields) {
+            switch (field.kind) {
+            case Field::Kind::String:
+                line[field.key] = field.str;
+                break;
+            case Field::Kind::Integer:
+                line[field.key] = field.num;
+                break;
+            case Field::Kind::Boolean:
+                line[field.key] = field.num != 0;
+                break;
+            }
+        }
+        // hook 인자에 잘못된 UTF-8 이 섞여 있어도 한 줄은 반드시 출력
+        out += line.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+        out += '\n';
+    }
+
+    nlohmann::ordered_json summary;
+    summary["ch"] = "trace";
+    summary["ev"] = "summary";
+    summary["task"] = taskId;
+    summary["records"] = records_.size();
+    summary["dropped"] = dropped_;
+    out += summary.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+    out += '\n';
+    return out;
+}
+
+bool HookTrace::writeNdjson(const std::string& path, const std::string& taskId) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out << toNdjson(taskId);
+    return out.good();
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 🔥 Task 단위 hook 추적 채널 (opt-in, NDJSON)
+// - hook / 환경 설치 코드의 진단 메시지(printf)를 대체: 한 줄에 JSON 레코드 하나
+//   {"ts":<us>,"ch":"fetch","ev":"excessive_calls","url":"...","count":1200}
+// - 활성화된 HookTrace 가 없으면 HOOK_TRACE 는 thread_local 포인터 검사 한 번만 수행
+//   (필드 인자는 평가되지 않음)
+// - findings 에는 아무것도 넣지 않음 (보고서와 분리된 진단 채널)
+// - 실행 시 JSSCANNER_HOOK_TRACE=1 이면 scan_report/<taskId>.hooks.ndjson 저장
+class HookTrace {
+public:
+    static constexpr size_t DEFAULT_MAX_RECORDS = 100000;
+
+    // 레코드 필드 값 (문자열 / 정수 / bool)
+    struct Field {
+        enum class Kind : uint8_t { String, Integer, Boolean };
+
+        const char* key;
+        Kind kind;
+        std::string str;
+        int64_t num = 0;
+
+        Field(const char* k, std::string v) : key(k), kind(Kind::String), str(std::move(v)) {}
+        Field(const char* k, const char* v) : key(k), kind(Kind::String), str(v ? v : "") {}
+        Field(const char* k, bool v) : key(k), kind(Kind::Boolean), num(v ? 1 : 0) {}
+        template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+        Field(const char* k, T v) : key(k), kind(Kind::Integer), num(static_cast<int64_t>(v)) {}
+    };
+
+    struct Record {
+        int64_t tsUs;
+        const char* channel;    // 문자열 리터럴
+        const char* event;      // 문자열 리터럴
+        std::vector<Field> fields;
+    };
+
+    explicit HookTrace(size_t maxRecords = DEFAULT_MAX_RECORDS);
+
+    // 현재 스레드에 활성화된 trace (없으면 nullptr)
+    static HookTrace* current();
+
+    // 현재 스레드에 trace 를 설치/해제하는 RAII 가드 (nullptr 설치 = 비활성)
+    class Activation {
+    public:
+        explicit Activation(HookTrace* trace);
+        ~Activation();
+        Activation(const Activation&) = delete;
+        Activation& operator=(const Activation&) = delete;
+    private:
+        HookTrace* previous_;
+    };
+
+    void record(const char* channel, const char* event, std::initializer_list<Field> fields = {});
+
+    const std::vector<Record>& records() const { return records_; }
+    size_t dropped() const { return dropped_; }
+
+    // 레코드당 한 줄 (마지막 줄은 task / dropped 요약)
+    std::string toNdjson(const std::string& taskId) const;
+    bool writeNdjson(const std::string& path, const std::string& taskId) const;
+
+private:
+    size_t maxRecords_;
+    size_t dropped_ = 0;
+    std::chrono::steady_clock::time_point origin_;
+    std::vector<Record> records_;
+};
+
+// 비활성 시 인자를 평가하지 않는 기록 매크로
+// 예: HOOK_TRACE("fetch", "sensitive_body", {"url", url});
+#define HOOK_TRACE(channel, event, ...)                                        \
+    do {                                                                       \
+        if (HookTrace* _hook_trace = HookTrace::current()) {                   \
+            _hook_trace->record(channel, event, {__VA_ARGS__});                \
+        }                                                                      \
+    } while (0)
@@ -7,16 +7,22 @@
 #include "../model/Detection.h"
 #include "../core/ChainTrackerManager.h"
 #include "DynamicStringTracker.h"
+#include "StaticStringEvaluator.h"
 #include "../builtin/objects/XMLHTTPRequestObject.h"
+#include "../builtin/objects/DocumentObject.h"
 #include "../parser/js/UrlCollector.h"
 #include "StringDeobfuscator.h"
 #include "../parser/html/TagParser.h"
 #include "../reporters/ResponseGenerator.h"
 #include "../reporters/HtmlJsReportWriter.h"
 #include "VariableScanner.h"  // 💡 변수 스캐너 추가
+#include "StageProfiler.h"
+#include "HookTrace.h"
+#include "MetricsRegistry.h"
 
 // Builtin Objects - 분리된 객체들
 #include "../builtin/BuiltinObject.h"
+#include "../builtin/LazyGlobals.h"
 #include <algorithm>
 #include <cctype>
 #include <fstream>
@@ -45,13 +51,13 @@ static int js_interrupt_handler(JSRuntime *rt, void *opaque) {
     
     // 🔥 음수 값 방지 (시간이 역행하는 경우)
     if (elapsed < 0) {
-        core::Log_Warn("[JSAnalyzer] Negative elapsed time detected, resetting");
+        SCAN_LOG_WARN("[JSAnalyzer] Negative elapsed time detected, resetting");
         g_execution_start = now;
         return 0;
     }
     
     if (g_should_interrupt || elapsed > MAX_EXECUTION_TIME_MS) {
-        core::Log_Warn("[JSAnalyzer] Execution timeout or interrupt (%lld ms)", (long long)elapsed);
+        SCAN_LOG_WARN("[JSAnalyzer] Execution timeout or interrupt (%lld ms)", (long long)elapsed);
         g_execution_started = false;  // 🔥 리셋
         return 1; // 인터럽트 요청
     }
@@ -109,6 +115,141 @@ struct RuntimeClassIDs {
 static RuntimeClassIDs* getRuntimeClassIDs(JSRuntime* rt) {
     return static_cast<RuntimeClassIDs*>(JS_GetRuntimeOpaque(rt));
 }
+
+// 🔥 동일한 (reason, 메시지) finding 은 Task 내에서 한 번만 추가
+static bool addFindingOnce(JSAnalyzerContext* a_ctx, std::vector<htmljs_scanner::Detection>& findings,
+                           htmljs_scanner::Detection detection) {
+    if (a_ctx) {
+        if (!a_ctx->findingIndex.insert(detection.reason, detection.snippet)) {
+            return false;
+        }
+    }
+    findings.push_back(std::move(detection));
+    return true;
+}
+
+// 🔥 Detection 으로 변환할 DynamicStringTracker 이벤트의 severity (변환 대상이 아니면 0)
+static int trackedEventSeverity(const std::string& type) {
+    if (type == "malicious_pattern_detected" ||
+        type == "anti_analysis_detected") {
+        return 9;
+    }
+    if (type == "decoding_chain_detected" ||
+        type == "large_encoded_data" ||
+        type == "brute_force_decoded") {
+        return 8;
+    }
+    if (type == "obfuscated_variables" ||
+        type == "array_obfuscation" ||
+        type == "iife_obfuscation") {
+        return 7;
+    }
+    if (type == "javascript_code_in_variable" ||
+        type == "html_code_in_variable") {
+        return 5;
+    }
+    return 0;
+}
+
+bool JSAnalyzerContext::admitCall(HookApiId id) {
+    HookCallDecision decision = callCounters.onCall(id);
+    if (decision == HookCallDecision::Record) {
+        return true;
+    }
+    if (decision == HookCallDecision::LimitReached) {
+        const HookApiPolicy& policy = hookApiPolicy(id);
+        SCAN_LOG_WARN("%s%s exceeded %u calls - further calls will be ignored to prevent DoS",
+                      logMsg.c_str(), policy.name, policy.maxCalls);
+        hookBus.emit(policy.limitEventType, 9, [&] {
+            return HookPayload{
+                policy.name,
+                {JsValue("[LIMIT_EXCEEDED]")},
+                JsValue("Analysis limit exceeded - function called too many times"),
+                {}
+            };
+        });
+        analysisLimitExceeded = true;
+    }
+    return false;
+}
+
+// 🔥 저장된 응답 조회 결과 (api 는 호출 지점의 고정 문자열 - fetch / XMLHttpRequest / importScripts 등)
+static MetricCounter& offlineResponseMetric(const char* api, const char* outcome) {
+    return MetricsRegistry::instance().counter("jsscanner_offline_responses_total",
+        {{"api", api}, {"outcome", outcome}}, "Stored response lookups by API and outcome (hit / miss)");
+}
+
+std::optional<ResponseCorpus::Response> JSAnalyzerContext::serveStoredResponse(const char* api,
+                                                                              const std::string& method,
+                                                                              const std::string& url) {
+    if (!responseCorpus) {
+        return std::nullopt;
+    }
+    std::optional<ResponseCorpus::Response> stored = responseCorpus->lookup(method, url);
+    if (!stored) {
+        HOOK_TRACE("response_corpus", "miss", {"api", api}, {"method", method}, {"url", url});
+        offlineResponseMetric(api, "miss").inc();
+        return std::nullopt;
+    }
+
+    HOOK_TRACE("response_corpus", "hit", {"api", api}, {"method", method}, {"url", url},
+               {"source", stored->source}, {"bytes", stored->body.size()});
+    offlineResponseMetric(api, "hit").inc();
+    return stored;
+}
+
+// 🔥 블록 실행 방식별 카운터 (호출 지점에서 static 으로 캐시)
+static MetricCounter& blockMetric(const char* mode, const char* reason) {
+    return MetricsRegistry::instance().counter("jsscanner_blocks_total",
+        {{"mode", mode}, {"reason", reason}}, "JavaScript blocks by execution mode and skip reason");
+}
+
+// 🔥 Task 단위 처리량/소요 시간 기록 (모든 반환 경로에서 소멸자로 처리)
+class TaskMetricsScope {
+public:
+    TaskMetricsScope() : start_(std::chrono::steady_clock::now()) {
+        static MetricCounter& started = MetricsRegistry::instance().counter(
+            "jsscanner_tasks_started_total", {}, "Analysis tasks started");
+        static MetricGauge& inFlight = MetricsRegistry::instance().gauge(
+            "jsscanner_tasks_in_flight", {}, "Analysis tasks currently running");
+        started.inc();
+        inFlight.add(1);
+    }
+    ~TaskMetricsScope() {
+        static MetricCounter& completed = MetricsRegistry::instance().counter(
+            "jsscanner_tasks_total", {}, "Analysis tasks completed");
+        static MetricGauge& inFlight = MetricsRegistry::instance().gauge("jsscanner_tasks_in_flight");
+        static MetricHistogram& duration = MetricsRegistry::instance().histogram(
+            "jsscanner_task_duration_seconds", {}, MetricsRegistry::latencyBuckets(),
+            "End-to-end analysis task latency");
+        completed.inc();
+        inFlight.add(-1);
+        duration.observe(std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+        MetricsRegistry::instance().writeConfiguredFile();
+    }
+    TaskMetricsScope(const TaskMetricsScope&) = delete;
+    TaskMetricsScope& operator=(const TaskMetricsScope&) = delete;
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+// 🔥 Task 컨텍스트 초기화 비용 (스크립트 실행 전 소요 시간 / 힙 사용량)
+// - globals 라벨로 lazy / eager(JSSCANNER_EAGER_GLOBALS=1) 등록 결과를 나란히 비교
+static void recordContextBaseline(JSRuntime* rt, std::chrono::steady_clock::time_point setupStart) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - setupStart).count();
+    JSMemoryUsage usage;
+    JS_ComputeMemoryUsage(rt, &usage);
+
+    const char* mode = LazyGlobals::eagerMode() ? "eager" : "lazy";
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    registry.histogram("jsscanner_context_setup_seconds", {{"globals", mode}}, MetricsRegistry::latencyBuckets(),
+        "Runtime/context creation and builtin registration time").observe(seconds);
+    registry.histogram("jsscanner_context_baseline_memory_bytes", {{"globals", mode}}, MetricsRegistry::memoryBuckets(),
+        "JS heap in use after context setup, before any script runs").observe(static_cast<double>(usage.memory_used_size));
+
+    SCAN_LOG_DEBUG("[JSAnalyzer] Context setup (%s globals): %.3f ms, baseline heap %lld bytes, %lld objects",
+        mode, seconds * 1000.0, static_cast<long long>(usage.memory_used_size), static_cast<long long>(usage.obj_count));
+}
+
 // JSAnalyzer 생성자
 JSAnalyzer::JSAnalyzer() {
     std::lock_guard<std::mutex> lock(instance_mutex);
@@ -172,8 +313,12 @@ JSAnalyzer::JSAnalyzer() {
         JSAnalyzerContext* analyzer_ctx = new JSAnalyzerContext{
             &findings, this->dynamicAnalyzer, tracker, chainManager, urlCollector, tagParser, browserConfig
         };
+        if (this->dynamicAnalyzer) {
+            this->dynamicAnalyzer->subscribe(analyzer_ctx->hookBus);
+        }
 
         JS_SetContextOpaque(ctx, analyzer_ctx);
+        analyzer_ctx->atoms.init(ctx);
         JSValue global_obj = JS_GetGlobalObject(ctx);
 
         // 분리된 객체들을 등록
@@ -186,14 +331,14 @@ JSAnalyzer::JSAnalyzer() {
         // 🔥 Proxy Fallback 설치 (마지막에 등록 - 미구현 API 처리)
         ProxyFallbackObject::installProxyFallback(ctx, global_obj);
 
-    // 🔥 JavaScript 환경 초기화 (BrowserConfig 사용)
-    browserConfig->initializeJSEnvironment(ctx);
-
         JS_FreeValue(ctx, global_obj);
+
+        // 🔥 JavaScript 환경 초기화 (BrowserConfig 사용, 실패 시 예외)
+        browserConfig->initializeJSEnvironment(ctx);
         
     } catch (const std::exception& e) {
         // 초기화 실패 시 정리
-        core::Log_Error("%sException in JSAnalyzer constructor: %s", logMsg.c_str(), e.what());
+        SCAN_LOG_ERROR("%sException in JSAnalyzer constructor: %s", logMsg.c_str(), e.what());
         if (ctx) {
             JS_FreeContext(ctx);    
             ctx = nullptr;
@@ -275,8 +420,12 @@ JSAnalyzer::JSAnalyzer(DynamicAnalyzer* analyzer) {
     JSAnalyzerContext* analyzer_ctx = new JSAnalyzerContext{
         &findings, this->dynamicAnalyzer, tracker, chainManager, urlCollector, tagParser, browserConfig
     };
+    if (this->dynamicAnalyzer) {
+        this->dynamicAnalyzer->subscribe(analyzer_ctx->hookBus);
+    }
 
     JS_SetContextOpaque(ctx, analyzer_ctx);
+    analyzer_ctx->atoms.init(ctx);
     JSValue global_obj = JS_GetGlobalObject(ctx);
 
     // 분리된 객체들을 등록
@@ -289,14 +438,14 @@ JSAnalyzer::JSAnalyzer(DynamicAnalyzer* analyzer) {
     // 🔥 Proxy Fallback 설치 (마지막에 등록 - 미구현 API 처리)
     ProxyFallbackObject::installProxyFallback(ctx, global_obj);
 
-    // 🔥 JavaScript 환경 초기화 (BrowserConfig 사용)
-    browserConfig->initializeJSEnvironment(ctx);
-
         JS_FreeValue(ctx, global_obj);
+
+        // 🔥 JavaScript 환경 초기화 (BrowserConfig 사용, 실패 시 예외)
+        browserConfig->initializeJSEnvironment(ctx);
         
     } catch (const std::exception& e) {
         // 초기화 실패 시 정리
-        core::Log_Error("%sException in JSAnalyzer constructor (with external analyzer): %s", logMsg.c_str(), e.what());
+        SCAN_LOG_ERROR("%sException in JSAnalyzer constructor (with external analyzer): %s", logMsg.c_str(), e.what());
         if (ctx) {
             JS_FreeContext(ctx);
             ctx = nullptr;
@@ -398,9 +547,9 @@ JSAnalyzer::~JSAnalyzer() {
         
     } catch (const std::exception& e) {
         // 소멸자에서 예외를 던지면 안 되므로 로깅만 수행
-        core::Log_Error("%sException in JSAnalyzer destructor: %s", logMsg.c_str(), e.what());
+        SCAN_LOG_ERROR("%sException in JSAnalyzer destructor: %s", logMsg.c_str(), e.what());
     } catch (...) {
-        core::Log_Error("%sUnknown exception in JSAnalyzer destructor", logMsg.c_str());
+        SCAN_LOG_ERROR("%sUnknown exception in JSAnalyzer destructor", logMsg.c_str());
     }
 }
 
@@ -512,7 +661,7 @@ static std::string stripTxtSuffix(const std::string& lowerFileName) {
 
 static void debug_log(const std::string& message) {
 
-    core::Log_Debug("%s", message.c_str());
+    SCAN_LOG_DEBUG("%s", message.c_str());
 }
 
 static void collectFilesRecursive(const std::string& directory, std::vector<std::string>& files) {
@@ -550,7 +699,7 @@ static void collectFilesRecursive(const std::string& directory, std::vector<std:
             
             // 🔥 webpack/bundle 파일 스킵
             if (shouldSkipFile(name)) {
-                core::Log_Info("[JSAnalyzer] Skipping webpack/bundle file: %s", name.c_str());
+                SCAN_LOG_INFO("[JSAnalyzer] Skipping webpack/bundle file: %s", name.c_str());
                 continue;
             }
             
@@ -558,7 +707,7 @@ static void collectFilesRecursive(const std::string& directory, std::vector<std:
             if (isFileTooLarge(formattedPath)) {
                 struct stat st;
                 if (stat(formattedPath.c_str(), &st) == 0) {
-                    core::Log_Info("[JSAnalyzer] Skipping large file (%zu KB): %s", 
+                    SCAN_LOG_INFO("[JSAnalyzer] Skipping large file (%zu KB): %s", 
                                   st.st_size / 1024, name.c_str());
                 }
                 continue;
@@ -592,7 +741,7 @@ static std::vector<std::string> collectFiles(const std::string& inputPath) {
 
         // 🔥 webpack/bundle 파일 스킵
         if (shouldSkipFile(fileName)) {
-            core::Log_Warn("[JSAnalyzer] File matches skip pattern: %s", fileName.c_str());
+            SCAN_LOG_WARN("[JSAnalyzer] File matches skip pattern: %s", fileName.c_str());
             return filesToProcess;
         }
         
@@ -600,7 +749,7 @@ static std::vector<std::string> collectFiles(const std::string& inputPath) {
         if (isFileTooLarge(normalizedPath)) {
             struct stat st;
             if (stat(normalizedPath.c_str(), &st) == 0) {
-                core::Log_Warn("[JSAnalyzer] File too large (%zu KB): %s", 
+                SCAN_LOG_WARN("[JSAnalyzer] File too large (%zu KB): %s", 
                               st.st_size / 1024, fileName.c_str());
             }
             return filesToProcess;
@@ -617,11 +766,11 @@ static std::vector<std::string> processHtmlFile(JSAnalyzerContext* a_ctx, const
     std::vector<std::string> jsCodeList;
     try {
         std::string normalizedPath = MakeFormalPath(filePath.c_str());
-        core::Log_Info("%sProcessing HTML file: %s", logMsg.c_str(), normalizedPath.c_str());
+        SCAN_LOG_INFO("%sProcessing HTML file: %s", logMsg.c_str(), normalizedPath.c_str());
         
         std::ifstream fileStream(normalizedPath);
         if (!fileStream.is_open()) {
-            core::Log_Error("%sERROR opening HTML file: %s", logMsg.c_str(), normalizedPath.c_str());
+            SCAN_LOG_ERROR("%sERROR opening HTML file: %s", logMsg.c_str(), normalizedPath.c_str());
             debug_log( "ERROR opening HTML file: " + normalizedPath);
             return jsCodeList;
         }
@@ -629,14 +778,15 @@ static std::vector<std::string> processHtmlFile(JSAnalyzerContext* a_ctx, const
         buffer << fileStream.rdbuf();
         std::string htmlContent = buffer.str();
         
-        core::Log_Info("%sHTML content size: %zu bytes", logMsg.c_str(), htmlContent.size());
+        SCAN_LOG_INFO("%sHTML content size: %zu bytes", logMsg.c_str(), htmlContent.size());
 
         if (a_ctx && a_ctx->tagParser) {
+            STAGE_SCOPE("html_parse");
             jsCodeList = a_ctx->tagParser->scriptTagParser(htmlContent);
-            core::Log_Info("%sExtracted %zu script blocks from HTML", logMsg.c_str(), jsCodeList.size());
+            SCAN_LOG_INFO("%sExtracted %zu script blocks from HTML", logMsg.c_str(), jsCodeList.size());
         }
     } catch (const std::exception& e) {
-        core::Log_Error("%sERROR processing HTML file %s: %s", logMsg.c_str(), filePath.c_str(), e.what());
+        SCAN_LOG_ERROR("%sERROR processing HTML file %s: %s", logMsg.c_str(), filePath.c_str(), e.what());
         debug_log("ERROR processing HTML file " + filePath + ": " + e.what());
     }
     return jsCodeList;
@@ -672,7 +822,7 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     
     // 🔥 재귀 깊이 체크 (전역) - 최우선 검사
     if (g_execute_recursion_depth >= MAX_EXECUTE_RECURSION) {
-        core::Log_Error("%sMaximum recursion depth reached (%d), aborting execution", 
+        SCAN_LOG_ERROR("%sMaximum recursion depth reached (%d), aborting execution", 
                        logMsg.c_str(), g_execute_recursion_depth);
         findings.push_back(htmljs_scanner::Detection{
             0, 
@@ -687,6 +837,10 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
         RecursionGuard() { g_execute_recursion_depth++; }
         ~RecursionGuard() { g_execute_recursion_depth--; }
     } recursion_guard;
+
+    // 🔥 단계별 시간 측정 (블록 단위 집계)
+    ScopedStageBlock stage_block;
+    STAGE_SCOPE("block");
     
     // 🔥 인스턴스 뮤텍스로 QuickJS 접근 보호 (멀티스레드 안전성)
     std::lock_guard<std::mutex> lock(instance_mutex);
@@ -698,7 +852,7 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     
     // 🔥 Context 유효성 검사 강화
     if (!ctx || !rt) {
-        core::Log_Error("%sInvalid context or runtime - cannot execute JavaScript", logMsg.c_str());
+        SCAN_LOG_ERROR("%sInvalid context or runtime - cannot execute JavaScript", logMsg.c_str());
         return;
     }
     
@@ -706,7 +860,7 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     // 이유: False Positive가 많고, 동적 분석을 차단하여 실제 위협을 놓칠 수 있음
     /*
     if (containsMaliciousPatterns(jsCodeCopy)) {
-        core::Log_Error("%sMalicious patterns detected, blocking execution", logMsg.c_str());
+        SCAN_LOG_ERROR("%sMalicious patterns detected, blocking execution", logMsg.c_str());
         findings.push_back(htmljs_scanner::Detection{
             0,
             "Malicious code patterns detected - execution blocked",
@@ -753,19 +907,26 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
         {"/*! For license information", "Licensed Bundle"}
     };
     
+    // 🔥 사전 필터 구간 측정 (정적 분석 전환 시 먼저 종료)
+    std::optional<ScopedStage> prefilter_stage;
+    prefilter_stage.emplace("prefilter");
+
     // 코드 첫 2000자를 체크 (라이브러리는 보통 헤더에 명시)
     std::string codeHeader = jsCodeCopy.substr(0, std::min(size_t(2000), jsCodeCopy.length()));
     
     // 🔥 라이브러리/번들 감지 시 정적 분석만 수행
     for (const auto& [pattern, libName] : KNOWN_SAFE_LIBRARIES) {
         if (codeHeader.find(pattern) != std::string::npos) {
-            core::Log_Info("%sDetected known library/bundle: %s - using static analysis only", 
+            SCAN_LOG_INFO("%sDetected known library/bundle: %s - using static analysis only", 
                           logMsg.c_str(), libName.c_str());
             findings.push_back(htmljs_scanner::Detection{
                 3,
                 "Known library/bundle detected: " + libName + " - static analysis only",
                 "known_library_static_only"
             });
+            static MetricCounter& known_library_metric = blockMetric("static_only", "known_library");
+            known_library_metric.inc();
+            prefilter_stage.reset();
             performStaticPatternAnalysis(jsCodeCopy, findings);
             return;
         }
@@ -778,13 +939,16 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     
     // 크기가 100KB 이상이면 정적 분석으로 전환
     if (code_size > MAX_CODE_SIZE_DYNAMIC) {
-        core::Log_Warn("%sCode size (%zu bytes) exceeds dynamic analysis limit (%zu bytes) - using static analysis only", 
+        SCAN_LOG_WARN("%sCode size (%zu bytes) exceeds dynamic analysis limit (%zu bytes) - using static analysis only", 
                        logMsg.c_str(), code_size, MAX_CODE_SIZE_DYNAMIC);
         findings.push_back(htmljs_scanner::Detection{
             5,
             "Large code (" + std::to_string(code_size) + " bytes) analyzed statically for stability",
             "large_code_static_only"
         });
+        static MetricCounter& large_code_metric = blockMetric("static_only", "large_code");
+        large_code_metric.inc();
+        prefilter_stage.reset();
         performStaticPatternAnalysis(jsCodeCopy, findings);
         return;
     }
@@ -838,13 +1002,16 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     
     // 위험한 패턴 발견 시 정적 분석만
     if (has_dangerous_pattern) {
-        core::Log_Warn("%sDangerous pattern detected (%s) - using static analysis only", 
+        SCAN_LOG_WARN("%sDangerous pattern detected (%s) - using static analysis only", 
                        logMsg.c_str(), found_pattern.c_str());
         findings.push_back(htmljs_scanner::Detection{
             7,
             "Dangerous pattern detected: " + found_pattern + " - static analysis only",
             "dangerous_pattern_static_only"
         });
+        static MetricCounter& dangerous_pattern_metric = blockMetric("static_only", "dangerous_pattern");
+        dangerous_pattern_metric.inc();
+        prefilter_stage.reset();
         performStaticPatternAnalysis(jsCodeCopy, findings);
         return;
     }
@@ -885,16 +1052,20 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
             "functions:" + std::to_string(function_count) + "/" + std::to_string(MAX_FUNCTION_COUNT) + ", " +
             "arrays:" + std::to_string(array_count) + "/" + std::to_string(MAX_ARRAY_COUNT);
         
-        core::Log_Warn("%sCode too complex (%s) - using static analysis only", 
+        SCAN_LOG_WARN("%sCode too complex (%s) - using static analysis only", 
                        logMsg.c_str(), complexity_reason.c_str());
         findings.push_back(htmljs_scanner::Detection{
             5,
             "Complex code structure detected (" + complexity_reason + ") - static analysis only",
             "complex_code_static_only"
         });
+        static MetricCounter& complex_code_metric = blockMetric("static_only", "complex_code");
+        complex_code_metric.inc();
+        prefilter_stage.reset();
         performStaticPatternAnalysis(jsCodeCopy, findings);
         return;
     }
+    prefilter_stage.reset();
     
     // try-catch로 전체 블록 보호
     try {
@@ -905,7 +1076,7 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
         // 메모리 사용량이 너무 높으면 실행 중단 - 더 엄격하게
         const int64_t MAX_MEMORY_BEFORE_EXEC = 100 * 1024 * 1024; // 150MB → 100MB로 감소
         if (mem_usage_before.memory_used_size > MAX_MEMORY_BEFORE_EXEC) {
-            core::Log_Error("%sMemory usage too high: %lld bytes (max: %lld), skipping execution", 
+            SCAN_LOG_ERROR("%sMemory usage too high: %lld bytes (max: %lld), skipping execution", 
                            logMsg.c_str(), 
                            (long long)mem_usage_before.memory_used_size,
                            (long long)MAX_MEMORY_BEFORE_EXEC);
@@ -914,17 +1085,26 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
                 "Memory usage too high before execution: " + std::to_string(mem_usage_before.memory_used_size) + " bytes", 
                 "memory_limit_error"
             });
+            static MetricCounter& memory_limit_metric = blockMetric("static_only", "memory_limit");
+            memory_limit_metric.inc();
             // 🔥 메모리 부족 시에도 정적 분석은 수행
             performStaticPatternAnalysis(jsCodeCopy, findings);
             return;
         }
         
         // 메인 코드 실행
-        core::Log_Info("%sExecuting JavaScript code (%zu bytes, max nesting: %zu, recursion depth: %d)", 
+        SCAN_LOG_DEBUG("%sExecuting JavaScript code (%zu bytes, max nesting: %zu, recursion depth: %d)", 
                        logMsg.c_str(), jsCodeCopy.length(), max_depth, g_execute_recursion_depth);
         
         // 🔥 JS_Eval 실행 - JSValueGuard로 자동 메모리 관리
-        JSValue val = JS_Eval(ctx, jsCodeCopy.c_str(), jsCodeCopy.length(), "<eval>", JS_EVAL_TYPE_GLOBAL);
+        static MetricCounter& dynamic_metric = blockMetric("dynamic", "executed");
+        dynamic_metric.inc();
+
+        JSValue val;
+        {
+            STAGE_SCOPE("js_eval");
+            val = JS_Eval(ctx, jsCodeCopy.c_str(), jsCodeCopy.length(), "<eval>", JS_EVAL_TYPE_GLOBAL);
+        }
         JSValueGuard val_guard(ctx, val);
         
         // 🔥 Exception 처리 개선
@@ -936,18 +1116,18 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
                 const char* error_msg = JS_ToCString(ctx, exception);
                 if (error_msg) {
                     // 🔍 상세한 에러 로깅
-                    core::Log_Error("%s========================================", logMsg.c_str());
-                    core::Log_Error("%sJS EXECUTION ERROR DETECTED", logMsg.c_str());
-                    core::Log_Error("%s========================================", logMsg.c_str());
-                    core::Log_Error("%sError message: %s", logMsg.c_str(), error_msg);
+                    SCAN_LOG_ERROR("%s========================================", logMsg.c_str());
+                    SCAN_LOG_ERROR("%sJS EXECUTION ERROR DETECTED", logMsg.c_str());
+                    SCAN_LOG_ERROR("%s========================================", logMsg.c_str());
+                    SCAN_LOG_ERROR("%sError message: %s", logMsg.c_str(), error_msg);
                     
                     // 실패한 코드 일부 출력 (처음 200자)
                     std::string code_snippet = jsCodeCopy.length() > 200 ? 
                         jsCodeCopy.substr(0, 200) + "..." : jsCodeCopy;
-                    core::Log_Error("%sFailed code snippet: %s", logMsg.c_str(), code_snippet.c_str());
-                    core::Log_Error("%sCode length: %zu bytes, recursion: %d", 
+                    SCAN_LOG_ERROR("%sFailed code snippet: %s", logMsg.c_str(), code_snippet.c_str());
+                    SCAN_LOG_ERROR("%sCode length: %zu bytes, recursion: %d", 
                                    logMsg.c_str(), jsCodeCopy.length(), g_execute_recursion_depth);
-                    core::Log_Error("%s========================================", logMsg.c_str());
+                    SCAN_LOG_ERROR("%s========================================", logMsg.c_str());
                     
                     findings.push_back(htmljs_scanner::Detection{0, error_msg, "script_error"});
                     JS_FreeCString(ctx, error_msg);
@@ -955,7 +1135,10 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
             }
             
             // 🔥 실행 실패 시 정적 패턴 검사 수행
-            core::Log_Warn("%sScript execution failed, performing static pattern analysis...", logMsg.c_str());
+            SCAN_LOG_WARN("%sScript execution failed, performing static pattern analysis...", logMsg.c_str());
+            static MetricCounter& script_error_metric = MetricsRegistry::instance().counter(
+                "jsscanner_block_script_errors_total", {}, "Dynamic blocks that threw during evaluation");
+            script_error_metric.inc();
             performStaticPatternAnalysis(jsCodeCopy, findings);
             g_execution_started = false;
             if (a_ctx) a_ctx->runtime_corrupted = true;
@@ -967,18 +1150,36 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
         JS_ComputeMemoryUsage(rt, &mem_usage_after);
         
         int64_t mem_increase = mem_usage_after.memory_used_size - mem_usage_before.memory_used_size;
+
+        // 🔥 QuickJS 메모리 통계 (마지막 블록 기준 gauge + 블록별 분포)
+        static MetricGauge& mem_used_gauge = MetricsRegistry::instance().gauge(
+            "jsscanner_js_memory_used_bytes", {}, "QuickJS memory_used_size after the last executed block");
+        static MetricGauge& mem_malloc_gauge = MetricsRegistry::instance().gauge(
+            "jsscanner_js_malloc_bytes", {}, "QuickJS malloc_size after the last executed block");
+        static MetricGauge& obj_count_gauge = MetricsRegistry::instance().gauge(
+            "jsscanner_js_objects", {}, "QuickJS live object count after the last executed block");
+        static MetricGauge& mem_peak_gauge = MetricsRegistry::instance().gauge(
+            "jsscanner_js_memory_used_peak_bytes", {}, "Largest QuickJS memory_used_size observed");
+        static MetricHistogram& mem_histogram = MetricsRegistry::instance().histogram(
+            "jsscanner_js_block_memory_used_bytes", {}, MetricsRegistry::memoryBuckets(),
+            "QuickJS memory_used_size after each executed block");
+        mem_used_gauge.set(static_cast<double>(mem_usage_after.memory_used_size));
+        mem_malloc_gauge.set(static_cast<double>(mem_usage_after.malloc_size));
+        obj_count_gauge.set(static_cast<double>(mem_usage_after.obj_count));
+        mem_peak_gauge.setMax(static_cast<double>(mem_usage_after.memory_used_size));
+        mem_histogram.observe(static_cast<double>(mem_usage_after.memory_used_size));
         if (mem_increase > 30 * 1024 * 1024) {  // 50MB → 30MB로 감소
-            core::Log_Warn("%sMemory increased significantly: %lld bytes", 
+            SCAN_LOG_WARN("%sMemory increased significantly: %lld bytes", 
                           logMsg.c_str(), (long long)mem_increase);
         }
         
     } catch (const std::exception& e) {
-        core::Log_Error("%sC++ Exception in executeJavaScriptBlock: %s", logMsg.c_str(), e.what());
+        SCAN_LOG_ERROR("%sC++ Exception in executeJavaScriptBlock: %s", logMsg.c_str(), e.what());
         findings.push_back(htmljs_scanner::Detection{0, "Internal error: " + std::string(e.what()), "internal_error"});
         g_execution_started = false;
         if (a_ctx) a_ctx->runtime_corrupted = true;
     } catch (...) {
-        core::Log_Error("%sUnknown C++ Exception in executeJavaScriptBlock", logMsg.c_str());
+        SCAN_LOG_ERROR("%sUnknown C++ Exception in executeJavaScriptBlock", logMsg.c_str());
         findings.push_back(htmljs_scanner::Detection{0, "Internal unknown error", "internal_error"});
         g_execution_started = false;
         if (a_ctx) a_ctx->runtime_corrupted = true;
@@ -986,6 +1187,7 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
 
     // Pending Job 실행 (try-catch로 보호)
     try {
+        STAGE_SCOPE("pending_jobs");
         JSContext* pctx = nullptr;
         int err;
         int job_count = 0;
@@ -996,12 +1198,12 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
             auto now = std::chrono::steady_clock::now();
             auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - g_execution_start).count();
             if (elapsed > MAX_EXECUTION_TIME_MS) {
-                core::Log_Warn("%sPending job timeout (%lld ms), breaking loop", logMsg.c_str(), (long long)elapsed);
+                SCAN_LOG_WARN("%sPending job timeout (%lld ms), breaking loop", logMsg.c_str(), (long long)elapsed);
                 break;
             }
             
             if (job_count++ > MAX_JOBS) {
-                core::Log_Warn("%sToo many pending jobs (%d), breaking loop", logMsg.c_str(), job_count);
+                SCAN_LOG_WARN("%sToo many pending jobs (%d), breaking loop", logMsg.c_str(), job_count);
                 break;
             }
             
@@ -1031,9 +1233,9 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
         // QuickJS는 자체적으로 필요할 때 GC를 실행함
         
     } catch (const std::exception& e) {
-        core::Log_Error("%sC++ Exception in JS_ExecutePendingJob: %s", logMsg.c_str(), e.what());
+        SCAN_LOG_ERROR("%sC++ Exception in JS_ExecutePendingJob: %s", logMsg.c_str(), e.what());
     } catch (...) {
-        core::Log_Error("%sUnknown C++ Exception in JS_ExecutePendingJob", logMsg.c_str());
+        SCAN_LOG_ERROR("%sUnknown C++ Exception in JS_ExecutePendingJob", logMsg.c_str());
     }
     
     // 🔥 NEW: 실행 완료 후 플래그 리셋
@@ -1044,14 +1246,20 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
     // 💡 변수 스캐닝: 실행 후 전역 변수에 남아있는 의심스러운 코드 탐지
     // ========================================================================
     if (a_ctx) {
-        core::Log_Info("%sStarting variable scanning...", logMsg.c_str());
+        SCAN_LOG_DEBUG("%sStarting variable scanning...", logMsg.c_str());
 
         // 1. 전역 변수 스캔
-        std::vector<ScannedVariable> scannedVars = VariableScanner::scanGlobalVariables(ctx);
-        core::Log_Info("%sFound %zu suspicious global variables", logMsg.c_str(), scannedVars.size());
+        std::vector<ScannedVariable> scannedVars;
+        {
+            STAGE_SCOPE("variable_scan");
+            scannedVars = VariableScanner::scanGlobalVariables(ctx, a_ctx->globalScanState);
+        }
+        SCAN_LOG_DEBUG("%sVariable scan: %zu properties visited, %zu values examined", logMsg.c_str(),
+                       a_ctx->globalScanState.lastVisited, a_ctx->globalScanState.lastExamined);
+        SCAN_LOG_DEBUG("%sFound %zu suspicious global variables", logMsg.c_str(), scannedVars.size());
 
         for (const auto& var : scannedVars) {
-            core::Log_Info("%sGlobal variable: %s (level: %d)", logMsg.c_str(), var.name.c_str(), var.suspicionLevel);
+            SCAN_LOG_DEBUG("%sGlobal variable: %s (level: %d)", logMsg.c_str(), var.name.c_str(), var.suspicionLevel);
 
             // 🔥 중요: 모든 변수를 DynamicStringTracker에 전달하여 난독화 패턴 탐지
             if (a_ctx->dynamicStringTracker && !var.value.empty()) {
@@ -1064,22 +1272,25 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
                     ", level: " + std::to_string(var.suspicionLevel) +
                     "): " + var.value.substr(0, 200);
 
-                core::Log_Warn("%s%s", logMsg.c_str(), detectionMsg.c_str());
-                findings.push_back({ 0, detectionMsg, "suspicious_variable_content" });
+                // 이미 보고된 동일 값이면 재분석도 생략
+                if (!addFindingOnce(a_ctx, findings, { 0, detectionMsg, "suspicious_variable_content" })) {
+                    continue;
+                }
+                SCAN_LOG_WARN("%s%s", logMsg.c_str(), detectionMsg.c_str());
 
                 // 🔥 재귀 실행 조건 강화
                 if (var.type == "potential_js" && 
                     var.value.length() < 100000 &&
                     g_execute_recursion_depth < MAX_EXECUTE_RECURSION - 1) {  // 🔥 재귀 깊이 체크
                     
-                    core::Log_Info("%sRe-analyzing suspicious variable: %s (depth: %d)", 
+                    SCAN_LOG_INFO("%sRe-analyzing suspicious variable: %s (depth: %d)", 
                                   logMsg.c_str(), var.name.c_str(), g_execute_recursion_depth);
                     
                     // 재귀 실행
                     executeJavaScriptBlock(var.value, findings, a_ctx);
                 } else if (var.type == "potential_js" && 
                           g_execute_recursion_depth >= MAX_EXECUTE_RECURSION - 1) {
-                    core::Log_Warn("%sSkipping re-analysis of '%s' - recursion limit would be exceeded", 
+                    SCAN_LOG_WARN("%sSkipping re-analysis of '%s' - recursion limit would be exceeded", 
                                   logMsg.c_str(), var.name.c_str());
                 }
             }
@@ -1087,43 +1298,28 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
 
         // 2. DynamicStringTracker에서 추적된 문자열 검사
         if (a_ctx->dynamicStringTracker) {
-            core::Log_Info("%sChecking DynamicStringTracker...", logMsg.c_str());
-            const auto& events = a_ctx->dynamicStringTracker->getDetectedEvents();
-            core::Log_Info("%sFound %zu tracked string events", logMsg.c_str(), events.size());
-
-            for (const auto& event : events) {
-                core::Log_Info("%sTracked string event: %s - %s", logMsg.c_str(), event.type.c_str(), event.varName.c_str());
+            STAGE_SCOPE("string_events");
+            SCAN_LOG_DEBUG("%sChecking DynamicStringTracker...", logMsg.c_str());
+            DynamicStringTracker* tracker = a_ctx->dynamicStringTracker;
+
+            // 🔥 지난 체크포인트 이후 생긴 이벤트만 처리
+            // 재귀 실행이 같은 이벤트를 다시 처리하지 않도록 커서를 먼저 이동
+            size_t begin = (std::max)(a_ctx->stringEventCursor, tracker->getFirstEventCursor());
+            size_t end = tracker->getEventCursor();
+            a_ctx->stringEventCursor = end;
+            SCAN_LOG_DEBUG("%sFound %zu new tracked string events", logMsg.c_str(), end - begin);
+
+            for (size_t cursor = begin; cursor < end; ++cursor) {
+                // 재귀 실행 중 이벤트 벡터가 재할당될 수 있으므로 복사본 사용
+                const DynamicStringTracker::SensitiveStringEvent event = tracker->getEventAt(cursor);
+                SCAN_LOG_DEBUG("%sTracked string event: %s - %s", logMsg.c_str(), event.type.c_str(), event.varName.c_str());
 
                 // 🔥 새로 추가한 난독화 패턴 탐지 이벤트를 Detection으로 변환
-                if (event.type == "javascript_code_in_variable" ||
-                    event.type == "html_code_in_variable" ||
-                    event.type == "malicious_pattern_detected" ||
-                    event.type == "decoding_chain_detected" ||
-                    event.type == "obfuscated_variables" ||
-                    event.type == "array_obfuscation" ||
-                    event.type == "large_encoded_data" ||
-                    event.type == "anti_analysis_detected" ||
-                    event.type == "iife_obfuscation") {
-
-                    // Severity 매핑
-                    int severity = 5;
-                    if (event.type == "malicious_pattern_detected" ||
-                        event.type == "anti_analysis_detected") {
-                        severity = 9;
-                    }
-                    else if (event.type == "decoding_chain_detected" ||
-                        event.type == "large_encoded_data") {
-                        severity = 8;
-                    }
-                    else if (event.type == "obfuscated_variables" ||
-                        event.type == "array_obfuscation" ||
-                        event.type == "iife_obfuscation") {
-                        severity = 7;
-                    }
-
+                if (int severity = trackedEventSeverity(event.type)) {
                     std::string detectionMsg =event.description + " [Variable: " + event.varName + "]";
-                    core::Log_Warn("%s%s", logMsg.c_str(), detectionMsg.c_str());
-                    findings.push_back({ severity, detectionMsg, event.type });
+                    if (addFindingOnce(a_ctx, findings, { severity, detectionMsg, event.type })) {
+                        SCAN_LOG_WARN("%s%s", logMsg.c_str(), detectionMsg.c_str());
+                    }
                 }
 
                 // 기존 로직: atob 결과나 기타 추적된 문자열 검사
@@ -1135,12 +1331,14 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
                             "' (level: " + std::to_string(suspicionLevel) +
                             "): " + event.value.substr(0, 200);
 
-                        core::Log_Warn("%s%s", logMsg.c_str(), detectionMsg.c_str());
-                        findings.push_back({ 0, detectionMsg, "suspicious_tracked_string" });
+                        if (!addFindingOnce(a_ctx, findings, { 0, detectionMsg, "suspicious_tracked_string" })) {
+                            continue;
+                        }
+                        SCAN_LOG_WARN("%s%s", logMsg.c_str(), detectionMsg.c_str());
 
                         // JavaScript 코드로 보이면 재분석
                         if (VariableScanner::looksLikeJavaScript(event.value) && event.value.length() < 100000) {
-                            core::Log_Info("%sRe-analyzing tracked string: %s", logMsg.c_str(), event.varName.c_str());
+                            SCAN_LOG_INFO("%sRe-analyzing tracked string: %s", logMsg.c_str(), event.varName.c_str());
                             static thread_local int _recur_depth_event = 0;
                             if (_recur_depth_event < 1) {
                                 _recur_depth_event++;
@@ -1153,7 +1351,88 @@ void JSAnalyzer::executeJavaScriptBlock(const std::string& jsCode, std::vector<h
             }
         }
 
-        core::Log_Info("%sVariable scanning completed", logMsg.c_str());
+        SCAN_LOG_DEBUG("%sVariable scanning completed", logMsg.c_str());
+    }
+}
+
+// 🔥 document.write / innerHTML / appendChild 로 DOM 에 들어간 script 를 삽입 순서대로 실행
+// - 외부 src 는 저장된 응답이 있을 때만 실행 (없으면 URL 만 수집)
+// - 실행한 script 도 블록 예산을 쓰고, 실행 중 새로 삽입된 script 는 같은 루프에서 이어서 처리
+void JSAnalyzer::runInjectedScripts(JSContext* task_ctx, JSAnalyzerContext* a_ctx, int& executedCount, int maxBlocksToExecute) {
+    static MetricCounter& inline_metric = MetricsRegistry::instance().counter("jsscanner_dom_injected_scripts_total",
+        {{"outcome", "inline"}}, "Scripts inserted into the task DOM by outcome");
+    static MetricCounter& stored_metric = MetricsRegistry::instance().counter("jsscanner_dom_injected_scripts_total",
+        {{"outcome", "stored_response"}}, "Scripts inserted into the task DOM by outcome");
+    static MetricCounter& unresolved_metric = MetricsRegistry::instance().counter("jsscanner_dom_injected_scripts_total",
+        {{"outcome", "unresolved"}}, "Scripts inserted into the task DOM by outcome");
+
+    DocumentObject::flushPendingWrites(task_ctx);
+    while (executedCount < maxBlocksToExecute && !a_ctx->runtime_corrupted) {
+        std::optional<DomTree::PendingScript> script = a_ctx->dom.nextScript();
+        if (!script) {
+            break;
+        }
+
+        // src 가 있으면 inline 내용은 무시 (브라우저와 동일)
+        std::string code;
+        const char* outcome = "inline";
+        if (!script->src.empty()) {
+            if (a_ctx->urlCollector) {
+                a_ctx->urlCollector->addUrlWithMetadata(script->src, "dom_script", 0);
+            }
+            std::optional<ResponseCorpus::Response> stored = a_ctx->serveStoredResponse("script", "GET", script->src);
+            if (stored) {
+                code = std::move(stored->body);
+                outcome = "stored_response";
+                stored_metric.inc();
+            } else {
+                outcome = "unresolved";
+                unresolved_metric.inc();
+            }
+        } else {
+            code = std::move(script->source);
+            inline_metric.inc();
+        }
+
+        // 광고 / 분석 로더도 script 를 삽입하므로 finding 이 아니라 진단 기록만 (내용은 실행하면서 분석)
+        HOOK_TRACE("dom", "injected_script", {"origin", script->origin}, {"outcome", outcome},
+                   {"src", script->src}, {"bytes", code.size()});
+        std::string summary = script->src.empty() ? code.substr(0, 200) : script->src;
+        if (a_ctx->dynamicAnalyzer) {
+            a_ctx->hookBus.emit(HookType::DOM_MANIPULATION, script->src.empty() ? 4 : 6, [&] {
+                std::map<std::string, JsValue> metadata;
+                metadata["origin"] = JsValue(script->origin);
+                metadata["outcome"] = JsValue(outcome);
+                metadata["length"] = JsValue(static_cast<double>(code.length()));
+                if (!script->src.empty()) {
+                    metadata["src"] = JsValue(script->src);
+                }
+                return HookPayload{"dom.injected_script", {JsValue(summary)}, JsValue(std::monostate()), metadata};
+            });
+        }
+        if (code.empty()) {
+            continue;
+        }
+
+        try {
+            this->executeJavaScriptBlock(code, *(a_ctx->findings), a_ctx);
+        } catch (const std::exception& e) {
+            SCAN_LOG_ERROR("%sInjected script execution FAILED: %s - marking runtime as corrupted", logMsg.c_str(), e.what());
+            a_ctx->runtime_corrupted = true;
+            performStaticPatternAnalysis(code, *(a_ctx->findings));
+        } catch (...) {
+            SCAN_LOG_ERROR("%sUnknown exception during injected script - marking runtime as corrupted", logMsg.c_str());
+            a_ctx->runtime_corrupted = true;
+            performStaticPatternAnalysis(code, *(a_ctx->findings));
+        }
+        executedCount++;
+        if (!a_ctx->runtime_corrupted) {
+            DocumentObject::flushPendingWrites(task_ctx);
+        }
+    }
+
+    if (executedCount >= maxBlocksToExecute && a_ctx->dom.pendingScripts() > 0) {
+        SCAN_LOG_WARN("%sBlock limit reached with %zu injected scripts pending", logMsg.c_str(), a_ctx->dom.pendingScripts());
     }
 }
 
@@ -1162,6 +1441,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
     // 로그 제거 - 너무 많은 출력
     // core::Log_Info("%sPerforming static pattern analysis on source code...",logMsg);
     
+    STAGE_SCOPE("static_analysis");
     int detectionCount = 0;
     
     // 🔥 NEW: URL 추출 (정적 분석)
@@ -1183,15 +1463,75 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
     std::vector<std::string> stringLiterals = StringDeobfuscator::extractStringLiterals(jsCode);
     // 로그 제거 - 너무 많은 출력
     // core::Log_Info("%sExtracted %s" ,logMsg, std::to_string(stringLiterals.size()) + " string literals");
+
+    // 🔥 NEW: 실행 없이 문자열 조립(연결, fromCharCode, _0x 배열, reverse) 복원
+    // 복원된 문자열은 리터럴과 같은 검사를 받고 DynamicStringTracker 에도 전달
+    {
+        STAGE_SCOPE("static_string_eval");
+        StaticStringEvaluator::Result folded = StaticStringEvaluator::evaluate(jsCode);
+        static MetricCounter& resolved_metric = MetricsRegistry::instance().counter(
+            "jsscanner_static_strings_resolved_total", {}, "Strings reconstructed by the static partial evaluator");
+        static MetricCounter& truncated_metric = MetricsRegistry::instance().counter(
+            "jsscanner_static_eval_truncated_total", {}, "Static partial evaluations stopped by the token/step budget");
+        resolved_metric.inc(folded.strings.size());
+        if (folded.truncated) truncated_metric.inc();
+
+        DynamicStringTracker* tracker = a_ctx ? a_ctx->dynamicStringTracker : nullptr;
+        size_t eventBegin = tracker ? tracker->getEventCursor() : 0;
+        for (auto& resolved : folded.strings) {
+            SCAN_LOG_DEBUG("%sStatically resolved %s (%s): %s", logMsg.c_str(), resolved.name.c_str(),
+                           resolved.describeTechniques().c_str(), resolved.value.substr(0, 100).c_str());
+            if (tracker) {
+                tracker->trackString("static:" + resolved.name, resolved.value);
+            }
+            stringLiterals.push_back(std::move(resolved.value));
+        }
+        if (folded.stringArrays > 0) {
+            findings.push_back({7, "Rotated string array decoded statically (" + std::to_string(folded.stringArrays) + " arrays)", "array_obfuscation"});
+            detectionCount++;
+        }
+
+        // 정적 경로에서는 변수 스캔 단계가 없으므로 여기서 바로 Detection 으로 변환
+        if (tracker) {
+            for (size_t cursor = (std::max)(eventBegin, tracker->getFirstEventCursor()); cursor < tracker->getEventCursor(); ++cursor) {
+                const DynamicStringTracker::SensitiveStringEvent& event = tracker->getEventAt(cursor);
+                if (int severity = trackedEventSeverity(event.type)) {
+                    std::string detectionMsg = event.description + " [Variable: " + event.varName + "]";
+                    if (addFindingOnce(a_ctx, findings, { severity, detectionMsg, event.type })) {
+                        detectionCount++;
+                    }
+                }
+            }
+            a_ctx->stringEventCursor = (std::max)(a_ctx->stringEventCursor, tracker->getEventCursor());
+        }
+    }
     
-    for (const auto& literal : stringLiterals) {
+    // 🔥 XOR/ROT/shift 로 가려진 리터럴은 복호화한 평문을 목록 뒤에 추가해서 같은 검사를 받게 함
+    // (예산은 Task 단위로 DynamicStringTracker 와 공유)
+    BruteForceDecoder* bruteForce = (a_ctx && a_ctx->dynamicStringTracker)
+        ? &a_ctx->dynamicStringTracker->getBruteForceDecoder() : nullptr;
+    const size_t literalCount = stringLiterals.size();
+
+    for (size_t index = 0; index < stringLiterals.size(); ++index) {
+        const std::string literal = stringLiterals[index];
+
+        if (bruteForce && index < literalCount && literal.length() >= BruteForceDecoder::MIN_LENGTH) {
+            if (auto candidate = bruteForce->tryDecode(BruteForceDecoder::unescapeJsLiteral(literal))) {
+                std::string snippet = candidate->decoded.substr(0, std::min(size_t(200), candidate->decoded.length()));
+                SCAN_LOG_WARN("%sObfuscated string literal decoded (%s): %s", logMsg.c_str(), candidate->describe().c_str(), snippet.substr(0, 100).c_str());
+                findings.push_back({8, "Obfuscated string decoded (" + candidate->describe() + "): " + snippet, "brute_force_decoded"});
+                detectionCount++;
+                stringLiterals.push_back(std::move(candidate->decoded));
+            }
+        }
+
         // 짧은 문자열은 스킵 (최소 20자)
         if (literal.length() < 20) continue;
         
         // 악성 명령어 탐지
         if (StringDeobfuscator::containsMaliciousCommand(literal)) {
             std::string snippet = literal.substr(0, std::min(size_t(300), literal.length()));
-            core::Log_Warn("Malicious command detected in string literal: %s" , snippet.substr(0, 100));
+            SCAN_LOG_WARN("Malicious command detected in string literal: %s" , snippet.substr(0, 100));
             findings.push_back({9, "Malicious system command in string: %s" , snippet, "malicious_command_in_string"});
             detectionCount++;
         }
@@ -1199,7 +1539,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
         // 스크립트 인젝션 탐지
         if (StringDeobfuscator::containsScriptInjection(literal)) {
             std::string snippet = literal.substr(0, std::min(size_t(200), literal.length()));
-            core::Log_Warn("%sScript injection pattern detected: %s"  ,logMsg,snippet.substr(0, 100));
+            SCAN_LOG_WARN("%sScript injection pattern detected: %s"  ,logMsg,snippet.substr(0, 100));
             findings.push_back({8, "Script injection pattern in string: " , snippet, "script_injection_in_string"});
             detectionCount++;
         }
@@ -1207,7 +1547,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
         // 원격 악성 파일 다운로드 탐지
         if (StringDeobfuscator::containsRemoteMaliciousFile(literal)) {
             std::string snippet = literal.substr(0, std::min(size_t(200), literal.length()));
-            core::Log_Warn("%sRemote malicious file detected: %s" ,logMsg,snippet);
+            SCAN_LOG_WARN("%sRemote malicious file detected: %s" ,logMsg,snippet);
             findings.push_back({9, "Remote malicious file URL detected: " + snippet, "remote_malicious_file"});
             detectionCount++;
         }
@@ -1215,7 +1555,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
         // 클립보드 하이재킹 (클립보드 API + 악성 페이로드)
         if (StringDeobfuscator::containsClipboardHijacking(literal)) {
             std::string snippet = literal.substr(0, std::min(size_t(300), literal.length()));
-            core::Log_Warn("%sClipboard hijacking detected: %s" ,logMsg,snippet.substr(0, 100));
+            SCAN_LOG_WARN("%sClipboard hijacking detected: %s" ,logMsg,snippet.substr(0, 100));
             findings.push_back({10, "CRITICAL: Clipboard hijacking with malicious payload: " + snippet, "clipboard_hijacking_critical"});
             detectionCount++;
         }
@@ -1244,7 +1584,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
     // Execute() 패턴 - REMOVED (너무 일반적인 함수명, False Positive 많음)
     /*
     if (lowerCode.find("execute(") != std::string::npos) {
-        core::Log_Warn("%sExecute() pattern detected", logMsg);
+        SCAN_LOG_WARN("%sExecute() pattern detected", logMsg);
         findings.push_back({7, "Dynamic code execution detected (Execute)", "execute_pattern"});
         detectionCount++;
     }
@@ -1252,7 +1592,7 @@ void JSAnalyzer::performStaticPatternAnalysis(const std::string& jsCode, std::ve
     
     // 로그를 간단하게 - 탐지된 경우만 출력
     if (detectionCount > 0) {
-        core::Log_Info("%sStatic analysis: %d patterns detected", logMsg, detectionCount);
+        SCAN_LOG_INFO("%sStatic analysis: %d patterns detected", logMsg, detectionCount);
     }
 }
 // analyzeFiles 함수, 반환값을 메서드 이름에 넣어야하나
@@ -1262,32 +1602,156 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
     ).count();
 
     lastSavedReportPathUtf8.clear();
+    lastBinaryReport_.clear();
 
-    auto buildAndSerialize = [&](const AnalysisResponse& analysisResponse) -> std::string {
+    // 🔥 처리량/소요 시간 메트릭
+    TaskMetricsScope taskMetrics;
+
+    // 🔥 단계별 시간 측정기 (Task 단위, 현재 스레드에 설치)
+    StageProfiler stageProfiler(stageTraceEnabled_);
+    StageProfiler::Activation profilerActivation(&stageProfiler);
+
+    // 🔥 Chrome trace 저장 (옵션)
+    auto writeStageTrace = [&]() {
+        if (!stageProfiler.isTraceEnabled()) {
+            return;
+        }
+        std::tstring exeDir = ExtractDirectory(GetFileName());
+        std::tstring outputDir = exeDir + TEXT("/scan_report");
+        CreateDirectory(outputDir.c_str());
+        std::string tracePath = UTF8FromTCS(outputDir + TEXT("/") + TCSFromMBS(taskId) + TEXT(".trace.json"));
+        if (!stageProfiler.writeChromeTrace(tracePath, taskId)) {
+            SCAN_LOG_WARN("%sFailed to write stage trace: %s", logMsg.c_str(), tracePath.c_str());
+        }
+    };
+
+    // 🔥 hook 진단 trace (옵션 - 비활성 시 hook 은 포인터 검사만 수행)
+    std::unique_ptr<HookTrace> hookTrace;
+    if (hookTraceEnabled_) {
+        hookTrace = std::make_unique<HookTrace>();
+    }
+    HookTrace::Activation hookTraceActivation(hookTrace.get());
+
+    auto writeHookTrace = [&]() {
+        if (!hookTrace) {
+            return;
+        }
+        std::tstring exeDir = ExtractDirectory(GetFileName());
+        std::tstring outputDir = exeDir + TEXT("/scan_report");
+        CreateDirectory(outputDir.c_str());
+        std::string tracePath = UTF8FromTCS(outputDir + TEXT("/") + TCSFromMBS(taskId) + TEXT(".hooks.ndjson"));
+        if (!hookTrace->writeNdjson(tracePath, taskId)) {
+            SCAN_LOG_WARN("%sFailed to write hook trace: %s", logMsg.c_str(), tracePath.c_str());
+        }
+    };
+
+    // 🔥 가상 파일시스템에 떨어뜨린 파일을 scan_report/<taskId>.files/<sha256> 로 저장하고 경로를 응답에 첨부
+    auto exportDroppedFiles = [&](AnalysisResponse& analysisResponse, const VirtualFileSystem& fileSystem) {
+        if (fileSystem.fileCount() == 0) {
+            return;
+        }
+        STAGE_SCOPE("dropped_files");
+        std::tstring exeDir = ExtractDirectory(GetFileName());
+        std::tstring outputDir = exeDir + TEXT("/scan_report");
+        CreateDirectory(outputDir.c_str());
+        std::tstring filesDir = outputDir + TEXT("/") + TCSFromMBS(taskId) + TEXT(".files");
+        CreateDirectory(filesDir.c_str());
+
+        // 같은 내용 (sha256) 은 한 번만 저장 / 첨부 - 저장에 성공한 뒤에만 기록 (실패한 내용은 다음 사본에서 재시도)
+        std::set<std::string> exported;
+        for (const auto& artifact : fileSystem.artifacts()) {
+            if (exported.count(artifact.sha256)) {
+                continue;
+            }
+            std::tstring filePath = filesDir + TEXT("/") + TCSFromMBS(artifact.sha256);
+            std::string path = UTF8FromTCS(filePath);
+            std::ofstream out(filePath, std::ios::binary | std::ios::trunc);
+            if (artifact.data) {
+                out.write(artifact.data->data(), static_cast<std::streamsize>(artifact.data->size()));
+            }
+            out.close();
+            if (!out) {
+                SCAN_LOG_WARN("%sFailed to write dropped file: %s", logMsg.c_str(), path.c_str());
+                continue;
+            }
+            exported.insert(artifact.sha256);
+            analysisResponse.addExtractedFile(path);
+        }
+        SCAN_LOG_INFO("%sDropped files: %zu (%zu unique exported)", logMsg.c_str(), fileSystem.fileCount(), exported.size());
+    };
+
+    // 🔥 응답 객체에 단계별 시간 첨부
+    auto attachStageTimings = [&](AnalysisResponse& analysisResponse) {
+        if (analysisResponse.Timings.empty()) {
+            analysisResponse.Timings.emplace_back(0);
+        }
+        stageProfiler.fillTiming(analysisResponse.Timings.front());
+    };
+
+    // 🔥 CBOR + LZ4 보고서 저장 (JSON 보고서 파일 대신)
+    // - analyzeFiles() 가 반환하는 보고서 JSON 을 그대로 옮김 (decodeToJson 으로 같은 JSON)
+    auto saveBinaryReport = [&](const std::string& analysisJson) {
+        STAGE_SCOPE("binary_report");
+        std::string error;
+        lastSavedReportPathUtf8.clear();
+        if (!BinaryReport::encode(analysisJson, lastBinaryReport_, &error)) {
+            SCAN_LOG_WARN("%sBinary report encoding failed: %s", logMsg.c_str(), error.c_str());
+            lastBinaryReport_.clear();
+            return;
+        }
+        std::tstring outputDir = ExtractDirectory(GetFileName()) + TEXT("/scan_report");
+        CreateDirectory(outputDir.c_str());
+        std::tstring reportPath = outputDir + TEXT("/") + TCSFromMBS(taskId) + TCSFromMBS(BinaryReport::FILE_EXTENSION);
+        std::ofstream out(reportPath, std::ios::binary | std::ios::trunc);
+        out.write(lastBinaryReport_.data(), static_cast<std::streamsize>(lastBinaryReport_.size()));
+        out.close();
+        if (!out) {
+            SCAN_LOG_WARN("%sFailed to write binary report: %s", logMsg.c_str(), UTF8FromTCS(reportPath).c_str());
+            return;
+        }
+        lastSavedReportPathUtf8 = UTF8FromTCS(reportPath);
+    };
+
+    auto serializeReport = [&](const AnalysisResponse& analysisResponse, bool binaryReport) -> std::string {
+        STAGE_SCOPE("json_serialization");
         std::string jsonOutput;
         std::string savedPath;
         std::string errorUtf8;
 
-        if (BuildHtmlJsReportJson(analysisResponse, taskId, jsonOutput, true, &savedPath, &errorUtf8)) {
-            lastSavedReportPathUtf8 = std::move(savedPath);
+        if (BuildHtmlJsReportJson(analysisResponse, taskId, jsonOutput, !binaryReport, &savedPath, &errorUtf8)) {
+            if (!binaryReport) {
+                lastSavedReportPathUtf8 = std::move(savedPath);
+            }
             return jsonOutput;
         }
 
-        lastSavedReportPathUtf8.clear();
+        if (!binaryReport) {
+            lastSavedReportPathUtf8.clear();
+        }
         if (!errorUtf8.empty()) {
-            core::Log_Warn("%sHtmlJsReport fallback serialization: %s",logMsg,errorUtf8);
+            SCAN_LOG_WARN("%sHtmlJsReport fallback serialization: %s",logMsg,errorUtf8);
         }
         if (!jsonOutput.empty()) {
             return jsonOutput;
         }
         try {
-            return analysisResponse.toJson().dump(4);
+            // 🔥 DOM 없이 바로 직렬화 (production 은 한 줄)
+            return analysisResponse.toJsonString();
         } catch (const std::exception& jsonEx) {
-            core::Log_Error("%sFallback analysisResponse serialization failed: %s",logMsg,jsonEx.what());
+            SCAN_LOG_ERROR("%sFallback analysisResponse serialization failed: %s",logMsg,jsonEx.what());
             return std::string("{}");
         }
     };
 
+    auto buildAndSerialize = [&](const AnalysisResponse& analysisResponse) -> std::string {
+        const bool binaryReport = reportFormat_ == ReportFormat::CborLz4;
+        std::string analysisJson = serializeReport(analysisResponse, binaryReport);
+        if (binaryReport) {
+            saveBinaryReport(analysisJson);
+        }
+        return analysisJson;
+    };
+
     // 🔥 CRITICAL FIX: Task별 독립 JSRuntime 생성 (멀티스레드 안전)
     // 🔥🔥 USE-AFTER-FREE FIX: ScopedJSRuntime을 나중에 생성하여 먼저 소멸되도록 함
     
@@ -1308,10 +1772,14 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
     std::vector<std::string> allExtractedUrls;
     
     // 🔥 먼저 파일 존재 여부 확인 (Runtime 생성 전)
-    std::vector<std::string> filesToProcess = collectFiles(inputPath);
+    std::vector<std::string> filesToProcess;
+    {
+        STAGE_SCOPE("file_collection");
+        filesToProcess = collectFiles(inputPath);
+    }
     
     if (filesToProcess.empty()) {
-        core::Log_Warn("%sNo valid files found to process - skipping Runtime creation", logMsg.c_str());
+        SCAN_LOG_WARN("%sNo valid files found to process - skipping Runtime creation", logMsg.c_str());
         debug_log("No valid files found to process");
         
         // Runtime 없이 바로 응답 생성
@@ -1327,19 +1795,39 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
         
         AnalysisResponse analysisResponse = responseGenerator->generateAnalysisResponseObject(
             taskId, allFindings, allExtractedUrls, 0, nullptr);
-        return buildAndSerialize(analysisResponse);
+        attachStageTimings(analysisResponse);
+        std::string emptyResult = buildAndSerialize(analysisResponse);
+        writeStageTrace();
+        writeHookTrace();
+        return emptyResult;
+    }
+
+    // 🔥 오프라인 응답 저장소: 크롤러가 저장한 리소스 / HAR 매니페스트 색인 (fetch·XHR·$.ajax·importScripts)
+    ResponseCorpus responseCorpus;
+    {
+        STAGE_SCOPE("response_corpus_index");
+        std::string corpusDir = MakeFormalPath(inputPath.c_str());
+        if (!IsDirectoryA(corpusDir.c_str())) {
+            corpusDir = corpusDir.substr(0, corpusDir.find_last_of('/'));
+        }
+        responseCorpus.indexDirectory(corpusDir);
+        SCAN_LOG_DEBUG("%sResponse corpus: %zu files, %zu manifest entries", logMsg.c_str(),
+                       responseCorpus.indexedFiles(), responseCorpus.manifestEntries());
     }
     
     // 파일이 있으면 Runtime 생성
-    core::Log_Info("%sFiles to process: %zu - creating JSRuntime", logMsg.c_str(), filesToProcess.size());
+    SCAN_LOG_INFO("%sFiles to process: %zu - creating JSRuntime", logMsg.c_str(), filesToProcess.size());
     
     // 🔥🔥 FIX: ScopedJSRuntime을 내부 스코프에서 생성하여 먼저 소멸되도록 함
     {
         // JSRuntime 생성 (이 스코프를 벗어나면 자동으로 소멸됨)
+        std::optional<ScopedStage> setupStage;
+        setupStage.emplace("context_setup");
+        auto setupStart = std::chrono::steady_clock::now();
         ScopedJSRuntime scopedRuntime;
         
         if (!scopedRuntime.IsInitialized()) {
-            core::Log_Error("%sFailed to initialize JSRuntime for this task", logMsg.c_str());
+            SCAN_LOG_ERROR("%sFailed to initialize JSRuntime for this task", logMsg.c_str());
             
             // ⚠️ 정리: Runtime이 생성되지 않았으므로 classIDs는 마지막에 삭제
             if (tracker) delete tracker;
@@ -1370,6 +1858,9 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
         JS_NewClassID(task_rt, &classIDs->activex_class_id);
         JS_SetRuntimeOpaque(task_rt, classIDs);
 
+        // 🔥 Worker / SharedWorker 스크립트 실행기 (Runtime 정리 전에 finish)
+        WorkerHost workerHost(&browserConfig, &responseCorpus);
+
         // 🔥 JSAnalyzerContext 생성 (Task별 독립적)
         a_ctx = new JSAnalyzerContext{
             &task_findings,
@@ -1380,8 +1871,14 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
             tagParser,
             &browserConfig
         };
+        a_ctx->responseCorpus = &responseCorpus;
+        a_ctx->workerHost = &workerHost;
+        if (this->dynamicAnalyzer) {
+            this->dynamicAnalyzer->subscribe(a_ctx->hookBus);
+        }
 
         JS_SetContextOpaque(task_ctx, a_ctx);
+        a_ctx->atoms.init(task_ctx);
 
         // 🔥 글로벌 객체 가져오기 및 등록
         JSValue global_obj = JS_GetGlobalObject(task_ctx);
@@ -1396,11 +1893,13 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
         // Proxy Fallback 설치
         ProxyFallbackObject::installProxyFallback(task_ctx, global_obj);
 
-        // JavaScript 환경 초기화 (BrowserConfig 사용)
-        browserConfig.initializeJSEnvironment(task_ctx);
-
         JS_FreeValue(task_ctx, global_obj);
 
+        // JavaScript 환경 초기화 (BrowserConfig 사용, 실패 시 예외 - 아래 catch 에서 오류 보고)
+        browserConfig.initializeJSEnvironment(task_ctx);
+        setupStage.reset();
+        recordContextBaseline(task_rt, setupStart);
+
         // 🔥 이제 기존 분석 로직 수행
         task_findings.clear();
         if (a_ctx->findings) {
@@ -1414,7 +1913,7 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
         try {
             // filesToProcess는 이미 위에서 가져왔음 (Runtime 생성 전)
             
-            core::Log_Info("%sFiles to process: %zu", logMsg.c_str(), filesToProcess.size());
+            SCAN_LOG_INFO("%sFiles to process: %zu", logMsg.c_str(), filesToProcess.size());
             debug_log( "Files to process: " + std::to_string(filesToProcess.size()));
             for (const auto& f : filesToProcess) {
                 debug_log("  - " + f);
@@ -1438,6 +1937,7 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                 std::vector<std::string> extractedJs = processHtmlFile(a_ctx, filePath);
                 allJsCodeList.insert(allJsCodeList.end(), extractedJs.begin(), extractedJs.end());
             } else if (actualFileName.ends_with(".js")) {
+                STAGE_SCOPE("js_file_read");
                 std::vector<std::string> extractedJs = processJsFile(filePath);
                 allJsCodeList.insert(allJsCodeList.end(), extractedJs.begin(), extractedJs.end());
             }
@@ -1445,7 +1945,7 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
             }
 
             if (!allJsCodeList.empty()) {
-                core::Log_Info("%sAnalyzing %zu JavaScript blocks", logMsg.c_str(), allJsCodeList.size());
+                SCAN_LOG_INFO("%sAnalyzing %zu JavaScript blocks", logMsg.c_str(), allJsCodeList.size());
                 debug_log( "Analyzing " + std::to_string(allJsCodeList.size()) + " JavaScript blocks");
 
                 // Reset collectors
@@ -1466,16 +1966,18 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                 
                 for (const std::string& jsCode : allJsCodeList) {
                     if (executedCount >= maxBlocksToExecute) {
-                        core::Log_Warn("%sMaximum JS block execution limit reached: %d", logMsg.c_str(), maxBlocksToExecute);
+                        SCAN_LOG_WARN("%sMaximum JS block execution limit reached: %d", logMsg.c_str(), maxBlocksToExecute);
                         break;
                     }
                     
                     // Runtime이 손상되었으면 정적 분석만 수행
                     if (a_ctx->runtime_corrupted) {
                         if (!logged_corruption) {
-                            core::Log_Warn("%sRuntime corrupted, switching to static analysis for remaining blocks", logMsg.c_str());
+                            SCAN_LOG_WARN("%sRuntime corrupted, switching to static analysis for remaining blocks", logMsg.c_str());
                             logged_corruption = true;
                         }
+                        static MetricCounter& corrupted_metric = blockMetric("static_only", "runtime_corrupted");
+                        corrupted_metric.inc();
                         performStaticPatternAnalysis(jsCode, *(a_ctx->findings));
                         executedCount++;
                         continue;
@@ -1485,19 +1987,38 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                     try {
                         this->executeJavaScriptBlock(jsCode, *(a_ctx->findings), a_ctx);
                     } catch (const std::exception& e) {
-                        core::Log_Error("%sJavaScript block execution FAILED: %s - marking runtime as corrupted", 
+                        SCAN_LOG_ERROR("%sJavaScript block execution FAILED: %s - marking runtime as corrupted", 
                                        logMsg.c_str(), e.what());
                         a_ctx->runtime_corrupted = true;
                         performStaticPatternAnalysis(jsCode, *(a_ctx->findings));
                     } catch (...) {
-                        core::Log_Error("%sUnknown exception during JS execution - marking runtime as corrupted", logMsg.c_str());
+                        SCAN_LOG_ERROR("%sUnknown exception during JS execution - marking runtime as corrupted", logMsg.c_str());
                         a_ctx->runtime_corrupted = true;
                         performStaticPatternAnalysis(jsCode, *(a_ctx->findings));
                     }
                     executedCount++;
+
+                    // 🔥 이 블록이 DOM 에 삽입한 script 를 다음 블록 전에 실행 (브라우저 파싱 순서와 동일)
+                    if (!a_ctx->runtime_corrupted) {
+                        STAGE_SCOPE("dom_scripts");
+                        runInjectedScripts(task_ctx, a_ctx, executedCount, maxBlocksToExecute);
+                    }
+
+                    // Worker 가 보낸 메시지를 다음 블록 전에 부모 onmessage 로 전달
+                    if (!a_ctx->runtime_corrupted && workerHost.workerCount() > 0) {
+                        STAGE_SCOPE("worker_messages");
+                        workerHost.deliverMessages(task_ctx);
+                    }
                 }
                 
-                core::Log_Info("%sProcessed %d JS blocks", logMsg.c_str(), executedCount);
+                SCAN_LOG_INFO("%sProcessed %d JS blocks", logMsg.c_str(), executedCount);
+
+                // 🔥 Worker 종료 대기 후 이벤트 / finding / URL 병합 (findings 수집 전)
+                if (!a_ctx->runtime_corrupted && workerHost.workerCount() > 0) {
+                    STAGE_SCOPE("worker_merge");
+                    workerHost.finish(task_ctx, a_ctx);
+                    SCAN_LOG_INFO("%sMerged %zu workers", logMsg.c_str(), workerHost.workerCount());
+                }
 
                 // Collect findings and URLs (실행 실패해도 항상 수집)
                 allFindings.insert(allFindings.end(), a_ctx->findings->begin(), a_ctx->findings->end());
@@ -1507,8 +2028,8 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                     allExtractedUrls.insert(allExtractedUrls.end(), collectedUrls.begin(), collectedUrls.end());
                 }
 
-                core::Log_Info("%sDetections: %zu", logMsg.c_str(), allFindings.size());
-                core::Log_Info("%sCollected URLs: %zu", logMsg.c_str(), allExtractedUrls.size());
+                SCAN_LOG_INFO("%sDetections: %zu", logMsg.c_str(), allFindings.size());
+                SCAN_LOG_INFO("%sCollected URLs: %zu", logMsg.c_str(), allExtractedUrls.size());
                 debug_log( "Found " + std::to_string(allFindings.size()) + " Detections");
                 debug_log( "Found " + std::to_string(allExtractedUrls.size()) + " URLs");
 
@@ -1521,17 +2042,26 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                     responseGenerator->setScanTargetUrl(scanTargetUrl_);
                 }
 
-                AnalysisResponse analysisResponse = responseGenerator->generateAnalysisResponseObject(taskId, allFindings, allExtractedUrls, executionTime, a_ctx);
+                AnalysisResponse analysisResponse = [&] {
+                    STAGE_SCOPE("response_generation");
+                    return responseGenerator->generateAnalysisResponseObject(taskId, allFindings, allExtractedUrls, executionTime, a_ctx);
+                }();
+                exportDroppedFiles(analysisResponse, a_ctx->fileSystem);
+                attachStageTimings(analysisResponse);
                 
                 // 🔥🔥 FIX: analysisResult를 저장하고 스코프 종료 후 반환
                 analysisResult = buildAndSerialize(analysisResponse);
             } else {
-                core::Log_Warn("%sNo JavaScript code found after extraction", logMsg.c_str());
+                SCAN_LOG_WARN("%sNo JavaScript code found after extraction", logMsg.c_str());
                 debug_log( "No JavaScript code found");
                 long long executionTime = std::chrono::duration_cast<std::chrono::milliseconds>(
                     std::chrono::system_clock::now().time_since_epoch()
                 ).count() - startTime;
-                AnalysisResponse analysisResponse = responseGenerator->generateAnalysisResponseObject(taskId, allFindings, allExtractedUrls, executionTime, a_ctx);
+                AnalysisResponse analysisResponse = [&] {
+                    STAGE_SCOPE("response_generation");
+                    return responseGenerator->generateAnalysisResponseObject(taskId, allFindings, allExtractedUrls, executionTime, a_ctx);
+                }();
+                attachStageTimings(analysisResponse);
                 
                 // 🔥🔥 FIX: analysisResult를 저장하고 스코프 종료 후 반환
                 analysisResult = buildAndSerialize(analysisResponse);
@@ -1539,20 +2069,38 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
 
         } catch (const std::exception& e) {
             debug_log( "ERROR in analyzeFiles: " + std::string(e.what()));
-            core::Log_Error("%sanalyzeFiles failed: %s",logMsg,e.what());
-        
+            SCAN_LOG_ERROR("%sanalyzeFiles failed: %s", logMsg.c_str(), e.what());
+
+            // 🔥 예외 전에 시작한 Worker 도 여기서 병합 (정리 단계의 finish 는 병합 후라 무시됨)
+            if (!a_ctx->runtime_corrupted && workerHost.workerCount() > 0) {
+                workerHost.finish(task_ctx, a_ctx);
+            }
+            // 수집 전에 실패했으면 지금까지의 finding (Worker 포함) 으로 보고서 생성
+            if (allFindings.empty() && a_ctx->findings) {
+                allFindings = *a_ctx->findings;
+            }
+
             // 🔥🔥 FIX: 에러 발생 시에도 analysisResult 저장
-            AnalysisResponse fallbackResponse(taskId);
-            fallbackResponse.addError(std::string("analyzeFiles failed: ") + e.what());
-            fallbackResponse.setExtractedUrls(allExtractedUrls);
-            fallbackResponse.setTimings({ Timing(0) });
-            analysisResult = buildAndSerialize(fallbackResponse);
+            try {
+                AnalysisResponse partialResponse = responseGenerator->generateAnalysisResponseObject(
+                    taskId, allFindings, allExtractedUrls, 0, a_ctx);
+                partialResponse.addError(std::string("analyzeFiles failed: ") + e.what());
+                attachStageTimings(partialResponse);
+                analysisResult = buildAndSerialize(partialResponse);
+            } catch (const std::exception& fallbackEx) {
+                SCAN_LOG_ERROR("%sPartial response generation failed: %s", logMsg.c_str(), fallbackEx.what());
+                AnalysisResponse fallbackResponse(taskId);
+                fallbackResponse.addError(std::string("analyzeFiles failed: ") + e.what());
+                fallbackResponse.setExtractedUrls(allExtractedUrls);
+                fallbackResponse.setTimings({ Timing(0) });
+                analysisResult = buildAndSerialize(fallbackResponse);
+            }
         }
         
         // 🔥 Runtime 해제 전 안전한 정리
         if (a_ctx) {
             if (a_ctx->runtime_corrupted) {
-                core::Log_Warn("%sRuntime corrupted, marking for safe cleanup", logMsg.c_str());
+                SCAN_LOG_WARN("%sRuntime corrupted, marking for safe cleanup", logMsg.c_str());
                 scopedRuntime.MarkCorrupted();
             } else {
                 // Runtime이 정상이면 준비 작업
@@ -1560,6 +2108,13 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                 JSRuntime* task_rt = scopedRuntime.GetRuntime();
                 
                 if (task_ctx && task_rt) {
+                    // 0. Worker 정리 (이미 병합했으면 무시) 후 pre-interned atom 해제
+                    workerHost.finish(task_ctx, a_ctx);
+                    a_ctx->atoms.release(task_rt);
+                    a_ctx->windowPropertyCache.release(task_rt);
+                    a_ctx->domWrappers.release(task_rt);
+                    a_ctx->globalScanState.release(task_rt);
+
                     // 1. Context Opaque 초기화
                     JS_SetContextOpaque(task_ctx, nullptr);
                     
@@ -1568,7 +2123,9 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
                 }
             }
             
-            // a_ctx 삭제 (Runtime 해제 전)
+            // hook bus 통계 반영 후 a_ctx 삭제 (Runtime 해제 전)
+            a_ctx->hookBus.exportMetrics();
+            a_ctx->windowPropertyCache.exportMetrics();
             delete a_ctx;
             a_ctx = nullptr;
         }
@@ -1600,6 +2157,10 @@ std::string JSAnalyzer::analyzeFiles(const std::string& inputPath, const std::st
     }
 
     
+    // 🔥 Chrome trace 저장 (직렬화 구간 포함)
+    writeStageTrace();
+    writeHookTrace();
+
     // 🔥🔥 FIX: 결과 반환
     if (!analysisResult.empty()) {
         return analysisResult;
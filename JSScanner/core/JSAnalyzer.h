@@ -9,8 +9,24 @@
 #include "../model/Detection.h"
 #include "../quickjs.h"
 #include "ScopedJSRuntime.h"  // 🔥 Task별 독립 JSRuntime
+#include "RegexCache.h"
+#include "HookCallCounters.h"
+#include "FindingIndex.h"
+#include "HookBus.h"
+#include "JSAtomTable.h"
+#include "WindowPropertyCache.h"
+#include "ResponseCorpus.h"
+#include "WorkerHost.h"
+#include "DomTree.h"
+#include "DomWrapperCache.h"
+#include "VirtualFileSystem.h"
+#include "BrowserStorage.h"
+#include "VariableScanner.h"
+#include "../reporters/BinaryReport.h"
 #include <string>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 class ResponseGenerator;
 
@@ -23,10 +39,67 @@ struct JSAnalyzerContext {
     TagParser* tagParser;
     BrowserConfig* browserConfig;
 
-    std::map<std::string, int> functionCallCounts;
-    static const int MAX_FUNCTION_CALLS = 1000;
+    // 🔥 hook 이벤트 버스 (구독자가 없는 이벤트는 생성하지 않음)
+    HookBus hookBus;
+
+    // 🔥 hook API 별 호출 카운터 (정책은 hooks/HookApi.h 의 HOOK_API_POLICIES)
+    HookCallCounters callCounters;
     bool analysisLimitExceeded = false;
     bool runtime_corrupted = false;
+
+    // 🔥 블록 간 전역 변수 스캔 상태 (바뀐 값만 재검사)
+    GlobalScanState globalScanState;
+
+    // 🔥 DynamicStringTracker 이벤트 처리 위치 (이 커서 이후 이벤트만 처리)
+    size_t stringEventCursor = 0;
+
+    // 🔥 finding 중복 제거 인덱스 (reason + 메시지)
+    FindingIndex findingIndex;
+
+    // 🔥 hook / 등록 코드용 pre-interned atom (Task 런타임과 수명이 같음)
+    JSAtomTable atoms;
+
+    // 🔥 RegExp hook 용 컴파일된 RE2 캐시 (Task 런타임과 수명이 같음)
+    RegexCache regexCache;
+
+    // 🔥 window Proxy get 트랩의 미존재 property 캐시 (Task 런타임과 수명이 같음)
+    WindowPropertyCache windowPropertyCache;
+
+    // 🔥 Task 디렉터리의 오프라인 응답 저장소 (없으면 모든 요청에 mock 응답)
+    ResponseCorpus* responseCorpus = nullptr;
+
+    // 🔥 Worker 실행기 (부모 Task 컨텍스트에만 설정 - Worker 안의 new Worker 는 기록만 함)
+    WorkerHost* workerHost = nullptr;
+    // 🔥 Worker 컨텍스트에서 부모로 가는 메시지 채널 (부모 Task 컨텍스트에서는 nullptr)
+    WorkerHost::Channel* workerChannel = nullptr;
+
+    // 🔥 URL.createObjectURL 로 만든 blob: URL → Blob 내용 (Worker 스크립트 해석용)
+    static constexpr size_t MAX_BLOB_URLS = 1024;
+    std::unordered_map<std::string, std::string> blobUrls;
+    uint32_t blobUrlCount = 0;
+    // Blob 내용을 opaque 로 담는 class (첫 new Blob 에서 등록, 0 이면 미등록)
+    JSClassID blobClassID = 0;
+
+    // 🔥 Task 단위 경량 DOM (document.write / innerHTML / appendChild 대상, 삽입된 script 대기열)
+    DomTree dom;
+    // 🔥 DOM 노드 → JS wrapper (Task 런타임과 수명이 같음)
+    DomWrapperCache domWrappers;
+    // 노드 serial 을 opaque 로 담는 wrapper class (첫 wrapper 생성 시 등록, 0 이면 미등록)
+    JSClassID domElementClassID = 0;
+
+    // 🔥 ActiveX FileSystemObject / ADODB.Stream 이 쓰는 가상 파일시스템 (떨어뜨린 파일은 보고서에 첨부)
+    VirtualFileSystem fileSystem;
+
+    // 🔥 cookie / localStorage / sessionStorage / IndexedDB (Task 간 공유 없음, reset() 은 O(1))
+    BrowserStorage storage;
+
+    // hook 호출을 카운트하고 이벤트를 기록할지 반환
+    // 제한을 처음 넘는 호출에서는 경고 이벤트를 1회 기록하고 analysisLimitExceeded 설정
+    bool admitCall(HookApiId id);
+
+    // 저장된 응답 조회 (적중 / 미적중은 HOOK_TRACE 와 jsscanner_offline_responses_total 로만 기록)
+    std::optional<ResponseCorpus::Response> serveStoredResponse(const char* api, const std::string& method,
+                                                                const std::string& url);
 };
 
 class JSAnalyzer {
@@ -43,11 +116,25 @@ public:
     void setScanTargetUrl(const std::string& url) { scanTargetUrl_ = url; }
     const std::string& getScanTargetUrl() const { return scanTargetUrl_; }
 
+    // 🔥 NEW: 단계별 Chrome trace JSON 저장 여부 (scan_report/<taskId>.trace.json)
+    void setStageTraceEnabled(bool enabled) { stageTraceEnabled_ = enabled; }
+    bool isStageTraceEnabled() const { return stageTraceEnabled_; }
+
+    // 🔥 NEW: hook 진단 NDJSON 저장 여부 (scan_report/<taskId>.hooks.ndjson)
+    void setHookTraceEnabled(bool enabled) { hookTraceEnabled_ = enabled; }
+    bool isHookTraceEnabled() const { return hookTraceEnabled_; }
+
+    // 🔥 NEW: 보고서 형식 (CborLz4 면 scan_report/<taskId>.js.result.cbor.lz4 저장)
+    void setReportFormat(ReportFormat format) { reportFormat_ = format; }
+    ReportFormat getReportFormat() const { return reportFormat_; }
+
     std::vector<htmljs_scanner::Detection> detect(const std::string& input);
     std::vector<htmljs_scanner::Detection> detectFromHtml(const std::string& htmlContent);
 
     std::string analyzeFiles(const std::string& inputPath, const std::string& taskId);
     const std::string& getLastSavedReportPath() const { return lastSavedReportPathUtf8; }
+    // CborLz4 형식일 때 마지막 analyzeFiles 의 바이너리 보고서 (Json 형식이면 비어 있음)
+    const std::string& getLastBinaryReport() const { return lastBinaryReport_; }
 
 private:
     JSRuntime* rt;
@@ -59,6 +146,10 @@ private:
     bool ownsDynamicAnalyzer;  // dynamicAnalyzer가 내부에서 생성되었는지 여부
     BrowserConfig browserConfig;  // 추가
     std::string scanTargetUrl_;  // 🔥 NEW: 검사 대상 URL
+    bool stageTraceEnabled_ = false;  // 🔥 NEW: Chrome trace 출력 여부
+    bool hookTraceEnabled_ = false;   // 🔥 NEW: hook trace(NDJSON) 출력 여부
+    ReportFormat reportFormat_ = ReportFormat::Json;  // 🔥 NEW: 보고서 형식
+    std::string lastBinaryReport_;
     
     // 🔥 인스턴스별 뮤텍스 (멀티스레드 안전성)
     std::mutex instance_mutex;
@@ -69,6 +160,8 @@ private:
 
     void analyzeDynamically(const std::string& jsCode);
     void executeJavaScriptBlock(const std::string& jsCode, std::vector<htmljs_scanner::Detection>& findings, JSAnalyzerContext* a_ctx);
+    // 🔥 블록 실행 중 DOM 에 삽입된 script 를 블록 예산 안에서 실행
+    void runInjectedScripts(JSContext* task_ctx, JSAnalyzerContext* a_ctx, int& executedCount, int maxBlocksToExecute);
     void performStaticPatternAnalysis(const std::string& jsCode, std::vector<htmljs_scanner::Detection>& findings);
     
     // 🔥 클래스 등록 헬퍼
@@ -0,0 +1,72 @@
+#include "pch.h"
+#include "JSAtomTable.h"
+#include "JSAnalyzer.h"
+
+namespace {
+const char* const ATOM_NAMES[JS_ATOM_ID_COUNT] = {
+#define JSSCANNER_ATOM_NAME(name) #name,
+    JSSCANNER_ATOM_LIST(JSSCANNER_ATOM_NAME)
+#undef JSSCANNER_ATOM_NAME
+};
+}
+
+void JSAtomTable::init(JSContext* ctx) {
+    if (ready_) {
+        return;
+    }
+    for (size_t i = 0; i < JS_ATOM_ID_COUNT; ++i) {
+        atoms_[i] = JS_NewAtom(ctx, ATOM_NAMES[i]);
+    }
+    ready_ = true;
+}
+
+void JSAtomTable::release(JSRuntime* rt) {
+    if (!ready_) {
+        return;
+    }
+    for (JSAtom& atom : atoms_) {
+        if (atom != JS_ATOM_NULL) {
+            JS_FreeAtomRT(rt, atom);
+            atom = JS_ATOM_NULL;
+        }
+    }
+    ready_ = false;
+}
+
+const char* JSAtomTable::name(JSAtomId id) {
+    return ATOM_NAMES[static_cast<size_t>(id)];
+}
+
+namespace JSAtoms {
+    const JSAtomTable* table(JSContext* ctx) {
+        JSAnalyzerContext* a_ctx = static_cast<JSAnalyzerContext*>(JS_GetContextOpaque(ctx));
+        if (a_ctx && a_ctx->atoms.ready()) {
+            return &a_ctx->atoms;
+        }
+        return nullptr;
+    }
+
+    JSValue getProperty(JSContext* ctx, JSValueConst obj, JSAtomId id) {
+        if (const JSAtomTable* atoms = table(ctx)) {
+            return JS_GetProperty(ctx, obj, (*atoms)[id]);
+        }
+        return JS_GetPropertyStr(ctx, obj, JSAtomTable::name(id));
+    }
+
+    int setProperty(JSContext* ctx, JSValueConst obj, JSAtomId id, JSValue val) {
+        if (const JSAtomTable* atoms = table(ctx)) {
+            return JS_SetProperty(ctx, obj, (*atoms)[id], val);
+        }
+        return JS_SetPropertyStr(ctx, obj, JSAtomTable::name(id), val);
+    }
+
+    int defineGetSet(JSContext* ctx, JSValueConst obj, JSAtomId id, JSValue getter, JSValue setter, int flags) {
+        if (const JSAtomTable* atoms = table(ctx)) {
+            return JS_DefinePropertyGetSet(ctx, obj, (*atoms)[id], getter, setter, flags);
+        }
+        JSAtom atom = JS_NewAtom(ctx, JSAtomTable::name(id));
+        int ret = JS_DefinePropertyGetSet(ctx, obj, atom, getter, setter, flags);
+        JS_FreeAtom(ctx, atom);
+        return ret;
+    }
+}
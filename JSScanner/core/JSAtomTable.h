@@ -0,0 +1,96 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "../quickjs.h"
+
+// ========================================
+// 자주 쓰는 property 이름의 pre-interned atom
+// - hook 에서 JS_GetPropertyStr / JS_SetPropertyStr 로 매번 atom 을 만들지 않도록
+//   Task 런타임 생성 시 1회 intern 후 JSAnalyzerContext 에 보관
+// - 새 이름은 아래 목록에만 추가 (enum / 문자열 테이블 자동 생성)
+// ========================================
+#define JSSCANNER_ATOM_LIST(X) \
+    X(length)                  \
+    X(prototype)               \
+    X(source)                  \
+    X(flags)                   \
+    X(lastIndex)               \
+    X(index)                   \
+    X(input)                   \
+    X(groups)                  \
+    X(then)                    \
+    X(_selector)               \
+    X(cookie)                  \
+    X(innerHTML)               \
+    X(onmessage)               \
+    X(onerror)                 \
+    X(onopen)                  \
+    X(onclose)                 \
+    X(readyState)              \
+    X(url)                     \
+    X(href)                    \
+    X(userAgent)               \
+    X(platform)                \
+    X(vendor)                  \
+    X(language)                \
+    X(hardwareConcurrency)     \
+    X(deviceMemory)            \
+    X(maxTouchPoints)          \
+    X(width)                   \
+    X(height)                  \
+    X(availWidth)              \
+    X(availHeight)             \
+    X(colorDepth)              \
+    X(pixelDepth)              \
+    X(innerWidth)              \
+    X(innerHeight)             \
+    X(window)                  \
+    X(self)                    \
+    X(top)                     \
+    X(parent)                  \
+    X(frames)                  \
+    X(globalThis)
+
+enum class JSAtomId : uint16_t {
+#define JSSCANNER_ATOM_ENUM(name) name,
+    JSSCANNER_ATOM_LIST(JSSCANNER_ATOM_ENUM)
+#undef JSSCANNER_ATOM_ENUM
+    COUNT
+};
+
+constexpr size_t JS_ATOM_ID_COUNT = static_cast<size_t>(JSAtomId::COUNT);
+
+class JSAtomTable {
+public:
+    JSAtomTable() { atoms_.fill(JS_ATOM_NULL); }
+    JSAtomTable(const JSAtomTable&) = delete;
+    JSAtomTable& operator=(const JSAtomTable&) = delete;
+
+    // 컨텍스트 생성 직후 1회 호출
+    void init(JSContext* ctx);
+    // JS_FreeRuntime 전에 호출 (런타임이 이미 손상된 경우 생략 가능)
+    void release(JSRuntime* rt);
+
+    bool ready() const { return ready_; }
+    JSAtom operator[](JSAtomId id) const { return atoms_[static_cast<size_t>(id)]; }
+
+    static const char* name(JSAtomId id);
+
+private:
+    std::array<JSAtom, JS_ATOM_ID_COUNT> atoms_;
+    bool ready_ = false;
+};
+
+// hook 용 property 접근 helper
+// - 분석 컨텍스트의 atom 테이블을 사용하고, 없으면 (테스트용 런타임 등) 문자열 API 로 처리
+namespace JSAtoms {
+    // ctx 의 atom 테이블 (없으면 nullptr)
+    const JSAtomTable* table(JSContext* ctx);
+
+    JSValue getProperty(JSContext* ctx, JSValueConst obj, JSAtomId id);
+    // val 의 소유권을 가져감 (JS_SetPropertyStr 와 동일)
+    int setProperty(JSContext* ctx, JSValueConst obj, JSAtomId id, JSValue val);
+    // getter / setter 의 소유권을 가져감 (JS_DefinePropertyGetSet 과 동일)
+    int defineGetSet(JSContext* ctx, JSValueConst obj, JSAtomId id, JSValue getter, JSValue setter, int flags);
+}
@@ -0,0 +1,145 @@
+#include "pch.h"
+#include "MetricsExporter.h"
+#include "MetricsRegistry.h"
+#include <cstdlib>
+#include <thread>
+
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+static const SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+static void CloseSocket(SocketHandle s) { closesocket(s); }
+static void ShutdownSocket(SocketHandle s) { shutdown(s, SD_BOTH); }
+// 리스너가 닫혔거나 shutdown 된 경우 (재시도해도 소용없음)
+static bool IsListenerGone() {
+    int err = WSAGetLastError();
+    return err == WSAENOTSOCK || err == WSAEINVAL || err == WSANOTINITIALISED || err == WSAESHUTDOWN;
+}
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+using SocketHandle = int;
+static const SocketHandle INVALID_SOCKET_HANDLE = -1;
+static void CloseSocket(SocketHandle s) { close(s); }
+static void ShutdownSocket(SocketHandle s) { shutdown(s, SHUT_RDWR); }
+// 리스너가 닫혔거나 shutdown 된 경우 (재시도해도 소용없음)
+static bool IsListenerGone() {
+    return errno == EBADF || errno == EINVAL || errno == ENOTSOCK;
+}
+#endif
+
+namespace MetricsExporter {
+
+static void sendAll(SocketHandle client, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        int n = send(client, data.data() + sent, static_cast<int>(data.size() - sent), 0);
+        if (n <= 0) {
+            return;
+        }
+        sent += static_cast<size_t>(n);
+    }
+}
+
+static std::atomic<bool> g_stopping{false};
+static std::atomic<SocketHandle> g_listener{INVALID_SOCKET_HANDLE};
+
+// accept() 연속 실패 시 대기 (EMFILE 등 일시적 오류에서 CPU 를 태우지 않도록)
+static constexpr int ACCEPT_BACKOFF_MIN_MS = 10;
+static constexpr int ACCEPT_BACKOFF_MAX_MS = 1000;
+
+static void serve(SocketHandle listener) {
+    int backoffMs = 0;
+    while (!g_stopping.load(std::memory_order_acquire)) {
+        SocketHandle client = accept(listener, nullptr, nullptr);
+        if (client == INVALID_SOCKET_HANDLE) {
+            if (g_stopping.load(std::memory_order_acquire) || IsListenerGone()) {
+                break;
+            }
+            backoffMs = backoffMs == 0 ? ACCEPT_BACKOFF_MIN_MS : (std::min)(backoffMs * 2, ACCEPT_BACKOFF_MAX_MS);
+            std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
+            continue;
+        }
+        backoffMs = 0;
+
+        // 요청 내용은 사용하지 않음 (헤더 한 번만 읽고 버림)
+        char buffer[1024];
+        recv(client, buffer, sizeof(buffer), 0);
+
+        std::string body = MetricsRegistry::instance().renderPrometheus();
+        std::string response =
+            "HTTP/1.0 200 OK\r\n"
+            "Content-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            "Connection: close\r\n\r\n" + body;
+        sendAll(client, response);
+        CloseSocket(client);
+    }
+    CloseSocket(listener);
+    core::Log_Info("%sMetrics exporter stopped", logMsg.c_str());
+}
+
+static void start(int port) {
+#ifdef _WIN32
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        core::Log_Warn("%sMetrics exporter: WSAStartup failed", logMsg.c_str());
+        return;
+    }
+#endif
+
+    SocketHandle listener = socket(AF_INET, SOCK_STREAM, 0);
+    if (listener == INVALID_SOCKET_HANDLE) {
+        core::Log_Warn("%sMetrics exporter: socket() failed", logMsg.c_str());
+        return;
+    }
+
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<unsigned short>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);  // 로컬 전용
+
+    if (bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        listen(listener, 8) != 0) {
+        core::Log_Warn("%sMetrics exporter: failed to listen on 127.0.0.1:%d", logMsg.c_str(), port);
+        CloseSocket(listener);
+        return;
+    }
+
+    core::Log_Info("%sMetrics exporter listening on 127.0.0.1:%d", logMsg.c_str(), port);
+    g_listener.store(listener, std::memory_order_release);
+    std::thread(serve, listener).detach();
+}
+
+void startIfConfigured() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        const char* portEnv = std::getenv("JSSCANNER_METRICS_PORT");
+        if (!portEnv || !*portEnv) {
+            return;
+        }
+        int port = std::atoi(portEnv);
+        if (port <= 0 || port > 65535) {
+            core::Log_Warn("%sInvalid JSSCANNER_METRICS_PORT: %s", logMsg.c_str(), portEnv);
+            return;
+        }
+        start(port);
+    });
+}
+
+void stop() {
+    SocketHandle listener = g_listener.exchange(INVALID_SOCKET_HANDLE, std::memory_order_acq_rel);
+    if (listener == INVALID_SOCKET_HANDLE) {
+        return;
+    }
+    // 블록된 accept() 를 깨우고, 닫기는 serve 스레드가 담당
+    g_stopping.store(true, std::memory_order_release);
+    ShutdownSocket(listener);
+}
+
+} // namespace MetricsExporter
@@ -0,0 +1,12 @@
+#pragma once
+
+// 🔥 메트릭 노출 (daemon 모드)
+// - JSSCANNER_METRICS_PORT 가 설정되면 127.0.0.1:<port> 에서 Prometheus text format 을 제공
+//   (GET 요청 경로와 무관하게 MetricsRegistry::renderPrometheus() 결과를 HTTP/1.0 으로 응답)
+// - 프로세스당 한 번만 시작되며, 설정이 없으면 아무 동작도 하지 않음
+// - accept() 실패 시 지수 backoff (최대 1초), 리스너가 닫히면 serve 스레드 종료
+namespace MetricsExporter {
+    void startIfConfigured();
+    // 리스너를 shutdown 해 serve 스레드를 끝냄 (시작되지 않았으면 무시)
+    void stop();
+}
@@ -0,0 +1,294 @@
+#include "pch.h"
+#include "MetricsRegistry.h"
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+
+// ============================================================================
+// MetricGauge / MetricHistogram
+// ============================================================================
+
+void MetricGauge::add(double v) {
+    double current = value_.load(std::memory_order_relaxed);
+    while (!value_.compare_exchange_weak(current, current + v, std::memory_order_relaxed)) {
+    }
+}
+
+void MetricGauge::setMax(double v) {
+    double current = value_.load(std::memory_order_relaxed);
+    while (current < v && !value_.compare_exchange_weak(current, v, std::memory_order_relaxed)) {
+    }
+}
+
+MetricHistogram::MetricHistogram(std::vector<double> upperBounds)
+    : bounds_(std::move(upperBounds)),
+      buckets_(new std::atomic<uint64_t>[bounds_.size() + 1]) {
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+        buckets_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricHistogram::observe(double v) {
+    // 버킷 수가 적으므로 선형 탐색 (누적은 render 시점에 계산)
+    size_t idx = 0;
+    while (idx < bounds_.size() && v > bounds_[idx]) {
+        ++idx;
+    }
+    buckets_[idx].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    double current = sum_.load(std::memory_order_relaxed);
+    while (!sum_.compare_exchange_weak(current, current + v, std::memory_order_relaxed)) {
+    }
+}
+
+// ============================================================================
+// MetricsRegistry
+// ============================================================================
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricsRegistry::MetricsRegistry()
+    : hookEvents_(new std::atomic<uint64_t>[HOOK_TYPE_COUNT]) {
+    for (size_t i = 0; i < HOOK_TYPE_COUNT; ++i) {
+        hookEvents_[i].store(0, std::memory_order_relaxed);
+    }
+
+    // 처리량(tasks/sec) 계산용 기준 시각
+    double startSeconds = std::chrono::duration<double>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    gauge("jsscanner_process_start_time_seconds", {},
+          "Start time of the scanner process since unix epoch").set(startSeconds);
+}
+
+const std::vector<double>& MetricsRegistry::latencyBuckets() {
+    static const std::vector<double> buckets = {
+        0.0001, 0.0005, 0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0
+    };
+    return buckets;
+}
+
+const std::vector<double>& MetricsRegistry::memoryBuckets() {
+    static const std::vector<double> buckets = {
+        256.0 * 1024, 1024.0 * 1024, 2.0 * 1024 * 1024, 4.0 * 1024 * 1024, 8.0 * 1024 * 1024,
+        16.0 * 1024 * 1024, 32.0 * 1024 * 1024, 64.0 * 1024 * 1024, 128.0 * 1024 * 1024
+    };
+    return buckets;
+}
+
+std::string MetricsRegistry::formatLabels(const MetricLabels& labels) {
+    if (labels.empty()) {
+        return "";
+    }
+    std::string out = "{";
+    bool first = true;
+    for (const auto& [key, value] : labels) {
+        if (!first) out += ',';
+        first = false;
+        out += key;
+        out += "=\"";
+        for (char c : value) {
+            if (c == '\\' || c == '"') {
+                out += '\\';
+                out += c;
+            } else if (c == '\n') {
+                out += "\\n";
+            } else {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+    out += '}';
+    return out;
+}
+
+MetricsRegistry::Family& MetricsRegistry::family(const std::string& name, Kind kind, const char* help) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        Family fam;
+        fam.kind = kind;
+        fam.help = help ? help : "";
+        it = families_.emplace(name, std::move(fam)).first;
+    } else if (it->second.help.empty() && help) {
+        it->second.help = help;
+    }
+    return it->second;
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name, const MetricLabels& labels, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Family& fam = family(name, Kind::Counter, help);
+    std::string labelText = formatLabels(labels);
+    Series& series = fam.series[labelText];
+    if (!series.counter) {
+        series.labelText = labelText;
+        series.counter = std::make_unique<MetricCounter>();
+    }
+    return *series.counter;
+}
+
+MetricGauge& MetricsRegistry::gauge(const std::string& name, const MetricLabels& labels, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Family& fam = family(name, Kind::Gauge, help);
+    std::string labelText = formatLabels(labels);
+    Series& series = fam.series[labelText];
+    if (!series.gauge) {
+        series.labelText = labelText;
+        series.gauge = std::make_unique<MetricGauge>();
+    }
+    return *series.gauge;
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const MetricLabels& labels,
+                                            const std::vector<double>& bounds, const char* help) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Family& fam = family(name, Kind::Histogram, help);
+    std::string labelText = formatLabels(labels);
+    Series& series = fam.series[labelText];
+    if (!series.histogram) {
+        series.labelText = labelText;
+        series.histogram = std::make_unique<MetricHistogram>(bounds);
+    }
+    return *series.histogram;
+}
+
+void MetricsRegistry::recordHookEvent(HookType type) {
+    size_t idx = static_cast<size_t>(type);
+    if (idx < HOOK_TYPE_COUNT) {
+        hookEvents_[idx].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MetricsRegistry::recordCacheLookup(const char* cacheName, bool hit) {
+    // 캐시 이름 종류가 적으므로 (이름, 결과) 쌍을 작은 테이블에 캐시
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        MetricCounter* hits = nullptr;
+        MetricCounter* misses = nullptr;
+    };
+    static Slot slots[16];
+    static std::mutex slotMutex;
+
+    for (auto& slot : slots) {
+        const char* name = slot.name.load(std::memory_order_acquire);
+        if (name == nullptr) {
+            break;
+        }
+        if (name == cacheName || std::strcmp(name, cacheName) == 0) {
+            (hit ? slot.hits : slot.misses)->inc();
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(slotMutex);
+    for (auto& slot : slots) {
+        const char* name = slot.name.load(std::memory_order_acquire);
+        if (name != nullptr && std::strcmp(name, cacheName) != 0) {
+            continue;
+        }
+        if (name == nullptr) {
+            slot.hits = &counter("jsscanner_cache_lookups_total", {{"cache", cacheName}, {"result", "hit"}},
+                                 "Cache lookups by cache and result");
+            slot.misses = &counter("jsscanner_cache_lookups_total", {{"cache", cacheName}, {"result", "miss"}});
+            slot.name.store(cacheName, std::memory_order_release);
+        }
+        (hit ? slot.hits : slot.misses)->inc();
+        return;
+    }
+
+    // 슬롯이 가득 찬 경우 (느린 경로)
+    counter("jsscanner_cache_lookups_total", {{"cache", cacheName}, {"result", hit ? "hit" : "miss"}}).inc();
+}
+
+static std::string formatDouble(double v) {
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.17g", v);
+    return buf;
+}
+
+static std::string mergeLabels(const std::string& labelText, const std::string& extra) {
+    if (labelText.empty()) {
+        return "{" + extra + "}";
+    }
+    return labelText.substr(0, labelText.size() - 1) + "," + extra + "}";
+}
+
+std::string MetricsRegistry::renderPrometheus() const {
+    std::ostringstream out;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& [name, fam] : families_) {
+        const char* typeName = fam.kind == Kind::Counter ? "counter"
+                             : fam.kind == Kind::Gauge ? "gauge" : "histogram";
+        if (!fam.help.empty()) {
+            out << "# HELP " << name << ' ' << fam.help << '\n';
+        }
+        out << "# TYPE " << name << ' ' << typeName << '\n';
+
+        for (const auto& [labelText, series] : fam.series) {
+            if (series.counter) {
+                out << name << labelText << ' ' << series.counter->value() << '\n';
+            } else if (series.gauge) {
+                out << name << labelText << ' ' << formatDouble(series.gauge->value()) << '\n';
+            } else if (series.histogram) {
+                const MetricHistogram& h = *series.histogram;
+                uint64_t cumulative = 0;
+                for (size_t i = 0; i < h.bounds().size(); ++i) {
+                    cumulative += h.bucketCount(i);
+                    out << name << "_bucket" << mergeLabels(labelText, "le=\"" + formatDouble(h.bounds()[i]) + "\"")
+                        << ' ' << cumulative << '\n';
+                }
+                cumulative += h.bucketCount(h.bounds().size());
+                out << name << "_bucket" << mergeLabels(labelText, "le=\"+Inf\"") << ' ' << cumulative << '\n';
+                out << name << "_sum" << labelText << ' ' << formatDouble(h.sum()) << '\n';
+                out << name << "_count" << labelText << ' ' << h.count() << '\n';
+            }
+        }
+    }
+
+    // HookType 별 이벤트 수 (0 인 타입은 생략)
+    bool headerWritten = false;
+    for (size_t i = 0; i < HOOK_TYPE_COUNT; ++i) {
+        uint64_t value = hookEvents_[i].load(std::memory_order_relaxed);
+        if (value == 0) continue;
+        if (!headerWritten) {
+            out << "# HELP jsscanner_hook_events_total Hook events recorded by HookType\n";
+            out << "# TYPE jsscanner_hook_events_total counter\n";
+            headerWritten = true;
+        }
+        out << "jsscanner_hook_events_total{type=\"" << HookTypeToString(static_cast<HookType>(i))
+            << "\"} " << value << '\n';
+    }
+
+    return out.str();
+}
+
+bool MetricsRegistry::writePrometheusFile(const std::string& path) const {
+    std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out << renderPrometheus();
+        if (!out.good()) {
+            return false;
+        }
+    }
+    std::remove(path.c_str());
+    return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
+
+void MetricsRegistry::writeConfiguredFile() const {
+    const char* path = std::getenv("JSSCANNER_METRICS_FILE");
+    if (!path || !*path) {
+        return;
+    }
+    if (!writePrometheusFile(path)) {
+        core::Log_Warn("%sFailed to write metrics file: %s", logMsg.c_str(), path);
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include "../hooks/HookType.h"
+
+// 🔥 프로세스 전역 메트릭 레지스트리 (Prometheus text format)
+// - 값 갱신(inc/set/observe)은 모두 atomic 연산만 사용 (lock-free)
+// - 메트릭 등록/조회와 출력(render)만 뮤텍스로 보호
+// - 호출 지점에서는 등록 결과(참조)를 static 으로 캐시해서 사용하는 것을 권장
+//     static MetricCounter& c = MetricsRegistry::instance().counter("name", {{"k", "v"}});
+//     c.inc();
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+class MetricCounter {
+public:
+    void inc(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    uint64_t value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+class MetricGauge {
+public:
+    void set(double v) { value_.store(v, std::memory_order_relaxed); }
+    void add(double v);
+    void setMax(double v);
+    double value() const { return value_.load(std::memory_order_relaxed); }
+private:
+    std::atomic<double> value_{0.0};
+};
+
+class MetricHistogram {
+public:
+    explicit MetricHistogram(std::vector<double> upperBounds);
+
+    void observe(double v);
+
+    const std::vector<double>& bounds() const { return bounds_; }
+    uint64_t bucketCount(size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    double sum() const { return sum_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic<uint64_t>[]> buckets_;  // bounds_.size() + 1 (+Inf)
+    std::atomic<uint64_t> count_{0};
+    std::atomic<double> sum_{0.0};
+};
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance();
+
+    MetricCounter& counter(const std::string& name, const MetricLabels& labels = {},
+                           const char* help = nullptr);
+    MetricGauge& gauge(const std::string& name, const MetricLabels& labels = {},
+                       const char* help = nullptr);
+    MetricHistogram& histogram(const std::string& name, const MetricLabels& labels,
+                               const std::vector<double>& bounds, const char* help = nullptr);
+
+    // HookType 별 이벤트 수 (고정 배열 - 조회 없이 바로 증가)
+    void recordHookEvent(HookType type);
+
+    // 캐시 적중률 (jsscanner_cache_lookups_total{cache, result})
+    void recordCacheLookup(const char* cacheName, bool hit);
+
+    // 공통 버킷
+    static const std::vector<double>& latencyBuckets();   // seconds
+    static const std::vector<double>& memoryBuckets();    // bytes
+
+    std::string renderPrometheus() const;
+
+    // 임시 파일에 쓴 뒤 rename (node_exporter textfile collector 호환)
+    bool writePrometheusFile(const std::string& path) const;
+
+    // JSSCANNER_METRICS_FILE 이 설정된 경우에만 저장
+    void writeConfiguredFile() const;
+
+private:
+    MetricsRegistry();
+
+    enum class Kind { Counter, Gauge, Histogram };
+
+    struct Series {
+        std::string labelText;  // {k="v",...}
+        std::unique_ptr<MetricCounter> counter;
+        std::unique_ptr<MetricGauge> gauge;
+        std::unique_ptr<MetricHistogram> histogram;
+    };
+
+    struct Family {
+        Kind kind;
+        std::string help;
+        std::map<std::string, Series> series;
+    };
+
+    Family& family(const std::string& name, Kind kind, const char* help);
+    static std::string formatLabels(const MetricLabels& labels);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> hookEvents_;
+};
@@ -0,0 +1,83 @@
+#include "pch.h"
+#include "RegexCache.h"
+#include "MetricsRegistry.h"
+
+RegexCache::RegexCache()
+    : RegexCache(DEFAULT_MAX_BYTES, DEFAULT_MAX_ENTRIES) {
+}
+
+RegexCache::RegexCache(size_t maxBytes, size_t maxEntries)
+    : maxBytes_(maxBytes), maxEntries_(maxEntries) {
+}
+
+size_t RegexCache::estimateCost(const std::string& key, const re2::RE2* re) {
+    // RE2 내부 메모리는 직접 조회할 수 없으므로 프로그램 크기로 근사
+    size_t cost = sizeof(Entry) + key.size() * 2;
+    if (re) {
+        cost += sizeof(re2::RE2) + static_cast<size_t>((std::max)(re->ProgramSize(), 0)) * 64;
+    }
+    return cost;
+}
+
+std::shared_ptr<const re2::RE2> RegexCache::get(const std::string& pattern, const std::string& flags) {
+    bool ignoreCase = flags.find('i') != std::string::npos;
+    bool multiline = flags.find('m') != std::string::npos;
+    bool dotAll = flags.find('s') != std::string::npos;
+
+    std::string key;
+    key.reserve(pattern.size() + 4);
+    key += ignoreCase ? 'i' : '-';
+    key += multiline ? 'm' : '-';
+    key += dotAll ? 's' : '-';
+    key += '/';
+    key += pattern;
+
+    auto found = index_.find(key);
+    if (found != index_.end()) {
+        hits_++;
+        MetricsRegistry::instance().recordCacheLookup("regex", true);
+        lru_.splice(lru_.begin(), lru_, found->second);
+        return found->second->re;
+    }
+
+    misses_++;
+    MetricsRegistry::instance().recordCacheLookup("regex", false);
+
+    re2::RE2::Options options;
+    options.set_case_sensitive(!ignoreCase);
+    options.set_dot_nl(dotAll);
+    options.set_max_mem(8 << 20);
+    options.set_log_errors(false);
+
+    // one_line 옵션은 posix_syntax 모드에서만 적용되므로 m 플래그는 (?m) 으로 지정
+    std::shared_ptr<const re2::RE2> compiled =
+        std::make_shared<re2::RE2>(multiline ? "(?m)" + pattern : pattern, options);
+    if (!compiled->ok()) {
+        compiled.reset();
+    }
+
+    Entry entry{key, compiled, 0};
+    entry.cost = estimateCost(key, compiled.get());
+    bytes_ += entry.cost;
+    lru_.push_front(std::move(entry));
+    index_[lru_.front().key] = lru_.begin();
+
+    evict();
+    return compiled;
+}
+
+void RegexCache::evict() {
+    // 방금 추가한 항목(맨 앞)은 남겨둠
+    while (lru_.size() > 1 && (bytes_ > maxBytes_ || lru_.size() > maxEntries_)) {
+        Entry& victim = lru_.back();
+        bytes_ -= victim.cost;
+        index_.erase(victim.key);
+        lru_.pop_back();
+    }
+}
+
+void RegexCache::clear() {
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include <re2/re2.h>
+
+// 🔥 컴파일된 RE2 프로그램 LRU 캐시 (런타임/컨텍스트 단위, 단일 스레드)
+// - key: (pattern, flags) - 컴파일 결과에 영향을 주는 플래그(i, m, s)만 사용
+// - 메모리 예산(maxBytes)과 항목 수(maxEntries)를 넘으면 가장 오래 사용되지 않은 항목부터 제거
+// - RE2 가 표현할 수 없는 패턴(역참조, lookaround 등)도 "실패"로 캐시하여
+//   호출자가 매번 컴파일을 시도하지 않고 바로 QuickJS 기본 엔진으로 fallback 하게 함
+class RegexCache {
+public:
+    static constexpr size_t DEFAULT_MAX_BYTES = 16 * 1024 * 1024;
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 256;
+
+    RegexCache();
+    RegexCache(size_t maxBytes, size_t maxEntries);
+
+    // 컴파일된 정규식 (RE2 로 표현 불가하면 nullptr)
+    // shared_ptr 로 반환하므로 사용 중 제거되어도 안전
+    std::shared_ptr<const re2::RE2> get(const std::string& pattern, const std::string& flags);
+
+    void clear();
+
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+    size_t size() const { return index_.size(); }
+    size_t memoryBytes() const { return bytes_; }
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const re2::RE2> re;
+        size_t cost;
+    };
+
+    static size_t estimateCost(const std::string& key, const re2::RE2* re);
+    void evict();
+
+    size_t maxBytes_;
+    size_t maxEntries_;
+    size_t bytes_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+
+    std::list<Entry> lru_;  // 앞쪽이 최근 사용
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
@@ -0,0 +1,345 @@
+#include "pch.h"
+#include "ResponseCorpus.h"
+#include "../builtin/helpers/Base64Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+
+namespace {
+std::string toLower(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return s;
+}
+
+std::string toUpper(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return s;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string percentDecode(const std::string& s) {
+    std::string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == '%' && i + 2 < s.size() && hexValue(s[i + 1]) >= 0 && hexValue(s[i + 2]) >= 0) {
+            out += static_cast<char>(hexValue(s[i + 1]) * 16 + hexValue(s[i + 2]));
+            i += 2;
+        } else {
+            out += s[i];
+        }
+    }
+    return out;
+}
+
+std::string stripFragment(const std::string& url) {
+    size_t hash = url.find('#');
+    return hash == std::string::npos ? url : url.substr(0, hash);
+}
+
+// "scheme://" 또는 "//" 뒤의 host 시작 위치 (상대 URL 이면 npos)
+size_t authorityStart(const std::string& url) {
+    if (url.compare(0, 2, "//") == 0) {
+        return 2;
+    }
+    size_t colon = url.find("://");
+    if (colon == std::string::npos || colon == 0) {
+        return std::string::npos;
+    }
+    for (size_t i = 0; i < colon; ++i) {
+        unsigned char c = static_cast<unsigned char>(url[i]);
+        if (!std::isalnum(c) && c != '+' && c != '-' && c != '.') {
+            return std::string::npos;
+        }
+    }
+    return colon + 3;
+}
+
+std::string joinSuffix(const std::vector<std::string>& segments, size_t from) {
+    std::string key;
+    for (size_t i = from; i < segments.size(); ++i) {
+        if (!key.empty()) key += '/';
+        key += segments[i];
+    }
+    return key;
+}
+
+// HAR entry 1개 적재 (request.url 이 없으면 false)
+bool loadHarEntry(ResponseCorpus& corpus, const nlohmann::json& request, const nlohmann::json& response,
+                  const std::string& baseDir) {
+    std::string url = request.value("url", "");
+    if (url.empty()) {
+        return false;
+    }
+
+    ResponseCorpus::Response stored;
+    stored.source = "har";
+    stored.status = response.value("status", 200);
+    auto content = response.find("content");
+    if (content != response.end() && content->is_object()) {
+        stored.contentType = content->value("mimeType", "");
+        std::string text = content->value("text", "");
+        if (content->value("encoding", "") == "base64") {
+            text = Base64Utils::decode(text);
+        }
+        stored.body = std::move(text);
+        std::string file = content->value("_file", "");
+        if (!file.empty() && stored.body.empty()) {
+            bool absolute = file[0] == '/' || file[0] == '\\' || (file.size() > 1 && file[1] == ':');
+            stored.file = (baseDir.empty() || absolute) ? file : baseDir + "/" + file;
+        }
+    }
+    if (stored.body.size() > ResponseCorpus::MAX_BODY_BYTES) {
+        stored.body.resize(ResponseCorpus::MAX_BODY_BYTES);
+    }
+    corpus.addResponse(request.value("method", "GET"), url, std::move(stored));
+    return true;
+}
+}
+
+std::string ResponseCorpus::normalizeUrl(const std::string& url) {
+    std::string out = stripFragment(url);
+    size_t start = authorityStart(out);
+    if (start == std::string::npos) {
+        return out;
+    }
+    size_t end = out.find_first_of("/?", start);
+    if (end == std::string::npos) {
+        end = out.size();
+    }
+    std::string head = toLower(out.substr(0, end));
+    std::string rest = out.substr(end);
+    if (rest.empty() || rest[0] == '?') {
+        rest.insert(0, "/");
+    }
+    return head + rest;
+}
+
+std::vector<std::string> ResponseCorpus::pathSegments(const std::string& url) {
+    std::string path = stripFragment(url);
+    size_t query = path.find('?');
+    if (query != std::string::npos) {
+        path.resize(query);
+    }
+
+    std::vector<std::string> segments;
+    size_t start = authorityStart(path);
+    if (start != std::string::npos) {
+        size_t slash = path.find('/', start);
+        std::string host = path.substr(start, slash == std::string::npos ? std::string::npos : slash - start);
+        size_t at = host.rfind('@');
+        if (at != std::string::npos) host.erase(0, at + 1);
+        size_t port = host.find(':');
+        if (port != std::string::npos) host.resize(port);
+        if (!host.empty()) segments.push_back(toLower(host));
+        path = slash == std::string::npos ? "/" : path.substr(slash);
+    }
+
+    size_t pos = 0;
+    bool trailingSlash = path.empty() || path.back() == '/';
+    while (pos <= path.size()) {
+        size_t next = path.find('/', pos);
+        if (next == std::string::npos) next = path.size();
+        std::string part = toLower(percentDecode(path.substr(pos, next - pos)));
+        if (part == "..") {
+            if (!segments.empty() && (start == std::string::npos || segments.size() > 1)) {
+                segments.pop_back();
+            }
+        } else if (!part.empty() && part != ".") {
+            segments.push_back(std::move(part));
+        }
+        pos = next + 1;
+    }
+    if (trailingSlash) {
+        segments.push_back("index.html");
+    }
+    return segments;
+}
+
+std::string ResponseCorpus::exactKey(const std::string& method, const std::string& url) {
+    return toUpper(method.empty() ? std::string("GET") : method) + ' ' + url;
+}
+
+void ResponseCorpus::addResponse(const std::string& method, const std::string& url, Response response) {
+    std::string normalized = normalizeUrl(url);
+    // 상대 URL 요청도 찾을 수 있도록 host 를 뺀 경로로도 등록 (먼저 등록된 항목 우선)
+    std::vector<std::string> segments = pathSegments(url);
+    size_t from = authorityStart(stripFragment(url)) != std::string::npos ? 1 : 0;
+    std::string pathKey = exactKey(method, "/" + joinSuffix(segments, from));
+    exact_.emplace(pathKey, response);
+    exact_[exactKey(method, normalized)] = std::move(response);
+}
+
+void ResponseCorpus::addFile(const std::string& relativePath, const std::string& absolutePath) {
+    if (fileCount_ >= MAX_INDEXED_FILES) {
+        return;
+    }
+    std::vector<std::string> segments = pathSegments(relativePath);
+    if (segments.empty()) {
+        return;
+    }
+    fileCount_++;
+    for (size_t from = 0; from < segments.size(); ++from) {
+        auto inserted = files_.emplace(joinSuffix(segments, from), absolutePath);
+        if (!inserted.second && inserted.first->second != absolutePath) {
+            inserted.first->second.clear();     // 같은 suffix 의 다른 파일 - 모호
+        }
+    }
+}
+
+size_t ResponseCorpus::loadHar(const std::string& harJson, const std::string& baseDir) {
+    nlohmann::json har = nlohmann::json::parse(harJson, nullptr, false);
+    if (har.is_discarded() || !har.is_object()) {
+        return 0;
+    }
+    auto log = har.find("log");
+    if (log == har.end() || !log->is_object()) {
+        return 0;
+    }
+    auto entries = log->find("entries");
+    if (entries == log->end() || !entries->is_array()) {
+        return 0;
+    }
+
+    size_t loaded = 0;
+    for (const auto& entry : *entries) {
+        if (!entry.is_object() || !entry.contains("request") || !entry.contains("response")) {
+            continue;
+        }
+        const auto& request = entry["request"];
+        const auto& response = entry["response"];
+        if (!request.is_object() || !response.is_object()) {
+            continue;
+        }
+        // 필드 타입이 다른 항목(value() 의 type_error)은 건너뜀
+        try {
+            loaded += loadHarEntry(*this, request, response, baseDir) ? 1 : 0;
+        } catch (const nlohmann::json::exception&) {
+        }
+    }
+    return loaded;
+}
+
+bool ResponseCorpus::readFile(const std::string& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    in.seekg(0, std::ios::end);
+    std::streamoff size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    if (size < 0) {
+        return false;
+    }
+    out.resize(std::min(static_cast<size_t>(size), MAX_BODY_BYTES));
+    if (!out.empty()) {
+        in.read(&out[0], static_cast<std::streamsize>(out.size()));
+        out.resize(static_cast<size_t>(in.gcount()));
+    }
+    return true;
+}
+
+std::optional<ResponseCorpus::Response> ResponseCorpus::lookup(const std::string& method, const std::string& url) {
+    if (url.empty() || empty()) {
+        misses_++;
+        return std::nullopt;
+    }
+
+    const Response* found = nullptr;
+    auto it = exact_.find(exactKey(method, normalizeUrl(url)));
+    if (it == exact_.end()) {
+        // query 가 다른 요청 / 상대 URL 요청 → host 를 뺀 경로로 재조회
+        std::vector<std::string> segments = pathSegments(url);
+        size_t from = authorityStart(stripFragment(url)) != std::string::npos ? 1 : 0;
+        it = exact_.find(exactKey(method, "/" + joinSuffix(segments, from)));
+    }
+    if (it != exact_.end()) {
+        found = &it->second;
+    }
+
+    if (found) {
+        Response response = *found;
+        if (!response.file.empty() && !readFile(response.file, response.body)) {
+            misses_++;
+            return std::nullopt;
+        }
+        hits_++;
+        return response;
+    }
+
+    // 디렉터리 파일 색인은 GET 계열만 (가장 긴 경로 suffix 우선)
+    std::string upper = toUpper(method.empty() ? std::string("GET") : method);
+    if (upper == "GET" || upper == "HEAD") {
+        std::vector<std::string> segments = pathSegments(url);
+        for (size_t from = 0; from < segments.size(); ++from) {
+            auto file = files_.find(joinSuffix(segments, from));
+            if (file == files_.end()) {
+                continue;
+            }
+            if (file->second.empty()) {
+                break;      // 모호한 suffix - 더 짧은 suffix 는 더 모호함
+            }
+            Response response;
+            response.source = "file";
+            response.file = file->second;
+            if (readFile(response.file, response.body)) {
+                hits_++;
+                return response;
+            }
+            break;
+        }
+    }
+
+    misses_++;
+    return std::nullopt;
+}
+
+void ResponseCorpus::indexDirectory(const std::string& directory) {
+    std::string normalizedDir = MakeFormalPath(directory.c_str());
+    if (normalizedDir.empty()) {
+        return;
+    }
+    indexDirectoryRecursive(normalizedDir, "");
+}
+
+void ResponseCorpus::indexDirectoryRecursive(const std::string& directory, const std::string& relativeDir) {
+    std::string searchBase = directory;
+    if (searchBase.back() != '/') {
+        searchBase.push_back('/');
+    }
+
+    core::ST_FILE_FINDDATAA findData;
+    HANDLE hFind = core::FindFirstFileA((searchBase + "*").c_str(), &findData);
+    if (hFind == NULL || hFind == reinterpret_cast<HANDLE>(-1)) {
+        return;
+    }
+
+    do {
+        const std::string& name = findData.strFileName;
+        if (name == "." || name == "..") {
+            continue;
+        }
+        std::string fullPath = MakeFormalPath((searchBase + name).c_str());
+        std::string relativePath = relativeDir.empty() ? name : relativeDir + "/" + name;
+
+        if (findData.bIsDirectory) {
+            indexDirectoryRecursive(fullPath, relativePath);
+            continue;
+        }
+        if (toLower(name).ends_with(".har")) {
+            std::string har;
+            if (readFile(fullPath, har)) {
+                loadHar(har, directory);
+            }
+            continue;
+        }
+        addFile(relativePath, fullPath);
+    } while (fileCount_ < MAX_INDEXED_FILES && core::FindNextFileA(hFind, &findData));
+
+    core::FindClose(hFind);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 🔥 오프라인 응답 저장소 (네트워크 없이 다단계 로더 추적)
+// - 크롤러가 HTML 옆에 저장한 리소스를 Task 디렉터리에서 색인해서
+//   fetch / XHR / $.ajax / importScripts 의 (method, URL) 요청에 저장된 본문을 돌려줌
+// - 색인 1: HAR 형식 매니페스트 (*.har - log.entries[].request / response.content)
+//          content.text (encoding "base64" 지원) 또는 content._file (HAR 파일 기준 상대 경로)
+// - 색인 2: 디렉터리 파일의 경로 suffix ("host/js/a.js", "js/a.js", "a.js") → 파일 경로
+//          URL 경로의 가장 긴 suffix 부터 조회, 같은 suffix 가 여러 파일이면 그 suffix 는 사용하지 않음
+// - 본문은 조회 시에만 읽음 (색인에는 경로만 보관)
+// - 색인 후 lookup 은 여러 스레드(Worker)에서 동시에 호출 가능 (카운터만 갱신)
+class ResponseCorpus {
+public:
+    static constexpr size_t MAX_BODY_BYTES = 8 * 1024 * 1024;
+    static constexpr size_t MAX_INDEXED_FILES = 20000;
+
+    struct Response {
+        int status = 200;
+        std::string contentType;
+        std::string body;
+        std::string source;     // "har" 또는 "file"
+        std::string file;       // 본문을 조회 시 읽을 파일 (비어 있으면 body 사용)
+    };
+
+    // Task 디렉터리(하위 포함) 색인 - *.har 는 매니페스트로도 적재
+    void indexDirectory(const std::string& directory);
+
+    // HAR JSON 적재 (적재한 항목 수 반환, 파싱 실패 시 0)
+    size_t loadHar(const std::string& harJson, const std::string& baseDir = "");
+
+    void addResponse(const std::string& method, const std::string& url, Response response);
+    // relativePath: 색인 기준 디렉터리에서의 상대 경로 ('/' 구분)
+    void addFile(const std::string& relativePath, const std::string& absolutePath);
+
+    // 저장된 응답 조회 (없으면 nullopt)
+    std::optional<Response> lookup(const std::string& method, const std::string& url);
+
+    bool empty() const { return exact_.empty() && files_.empty(); }
+    size_t manifestEntries() const { return exact_.size(); }
+    size_t indexedFiles() const { return fileCount_; }
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+    // 매니페스트 키용 URL 정규화 (scheme / host 소문자, fragment 제거)
+    static std::string normalizeUrl(const std::string& url);
+    // 파일 색인 조회용 경로 구성 요소 (host 포함, query / fragment 제거, %XX 해제, 소문자)
+    static std::vector<std::string> pathSegments(const std::string& url);
+
+private:
+    static std::string exactKey(const std::string& method, const std::string& url);
+    static bool readFile(const std::string& path, std::string& out);
+    void indexDirectoryRecursive(const std::string& directory, const std::string& relativeDir);
+
+    std::unordered_map<std::string, Response> exact_;      // "METHOD url" → 응답
+    std::unordered_map<std::string, std::string> files_;   // 경로 suffix → 파일 (빈 문자열 = 모호함)
+    size_t fileCount_ = 0;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
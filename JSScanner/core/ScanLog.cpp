@@ -0,0 +1,220 @@
+#include "pch.h"
+#include "ScanLog.h"
+#include "MetricsRegistry.h"
+#include <thread>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+
+namespace ScanLog {
+
+static int levelFromEnv() {
+    const char* env = std::getenv("JSSCANNER_LOG_LEVEL");
+    if (!env || !*env) {
+        return static_cast<int>(ScanLogLevel::Info);
+    }
+    std::string value(env);
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    if (value == "debug") return static_cast<int>(ScanLogLevel::Debug);
+    if (value == "warn" || value == "warning") return static_cast<int>(ScanLogLevel::Warn);
+    if (value == "error") return static_cast<int>(ScanLogLevel::Error);
+    if (value == "off" || value == "none") return static_cast<int>(ScanLogLevel::Off);
+    return static_cast<int>(ScanLogLevel::Info);
+}
+
+std::atomic<int> g_level{levelFromEnv()};
+
+void setLevel(ScanLogLevel level) {
+    g_level.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+ScanLogLevel getLevel() {
+    return static_cast<ScanLogLevel>(g_level.load(std::memory_order_relaxed));
+}
+
+// ============================================================================
+// Bounded MPMC ring buffer (셀별 sequence 번호로 생산자/소비자 동기화)
+// ============================================================================
+
+class LogRing {
+public:
+    static constexpr size_t CAPACITY = 8192;  // 2의 거듭제곱
+
+    LogRing() {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(ScanLogLevel level, std::string&& message) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & (CAPACITY - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 가득 참
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->level = level;
+        cell->message = std::move(message);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(ScanLogLevel& level, std::string& message) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & (CAPACITY - 1)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 비어 있음
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        level = cell->level;
+        message = std::move(cell->message);
+        cell->message.clear();
+        cell->sequence.store(pos + CAPACITY, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        ScanLogLevel level = ScanLogLevel::Info;
+        std::string message;
+    };
+
+    Cell cells_[CAPACITY];
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+};
+
+// ============================================================================
+// 백그라운드 출력 스레드
+// ============================================================================
+
+class LogWorker {
+public:
+    void start() {
+        std::thread(&LogWorker::run, this).detach();
+    }
+
+    void push(ScanLogLevel level, std::string&& message) {
+        if (!ring_.tryPush(level, std::move(message))) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            static MetricCounter& droppedMetric = MetricsRegistry::instance().counter(
+                "jsscanner_log_records_dropped_total", {}, "Log records dropped because the ring buffer was full");
+            droppedMetric.inc();
+            return;
+        }
+        submitted_.fetch_add(1, std::memory_order_release);
+        if (sleeping_.load(std::memory_order_acquire)) {
+            cv_.notify_one();
+        }
+    }
+
+    void flush(int timeoutMs) {
+        uint64_t target = submitted_.load(std::memory_order_acquire);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        cv_.notify_one();
+        while (written_.load(std::memory_order_acquire) < target) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    unsigned long long dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    void run() {
+        ScanLogLevel level;
+        std::string message;
+        uint64_t reportedDrops = 0;
+
+        while (true) {
+            bool any = false;
+            while (ring_.tryPop(level, message)) {
+                any = true;
+                emit(level, message);
+                written_.fetch_add(1, std::memory_order_release);
+            }
+
+            uint64_t drops = dropped_.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                core::Log_Warn("%s%llu log records dropped (ring buffer full)", logMsg.c_str(),
+                               static_cast<unsigned long long>(drops - reportedDrops));
+                reportedDrops = drops;
+            }
+
+            if (!any) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                sleeping_.store(true, std::memory_order_release);
+                cv_.wait_for(lock, std::chrono::milliseconds(10));
+                sleeping_.store(false, std::memory_order_release);
+            }
+        }
+    }
+
+    static void emit(ScanLogLevel level, const std::string& message) {
+        switch (level) {
+            case ScanLogLevel::Debug: core::Log_Debug("%s", message.c_str()); break;
+            case ScanLogLevel::Info:  core::Log_Info("%s", message.c_str()); break;
+            case ScanLogLevel::Warn:  core::Log_Warn("%s", message.c_str()); break;
+            case ScanLogLevel::Error: core::Log_Error("%s", message.c_str()); break;
+            default: break;
+        }
+    }
+
+    LogRing ring_;
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> sleeping_{false};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+// 프로세스 종료 시 detach 된 스레드가 참조할 수 있으므로 의도적으로 해제하지 않음
+static LogWorker* worker() {
+    static LogWorker* instance = [] {
+        LogWorker* w = new LogWorker();
+        w->start();
+        return w;
+    }();
+    return instance;
+}
+
+void submit(ScanLogLevel level, std::string&& message) {
+    worker()->push(level, std::move(message));
+}
+
+void flush(int timeoutMs) {
+    worker()->flush(timeoutMs);
+}
+
+unsigned long long droppedCount() {
+    return worker()->dropped();
+}
+
+} // namespace ScanLog
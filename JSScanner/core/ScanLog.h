@@ -0,0 +1,102 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+// 🔥 비동기 로깅 Facade
+// - 레벨 검사를 먼저 수행하고, 통과한 경우에만 문자열을 포맷함
+// - 포맷된 레코드는 lock-free ring buffer 로 백그라운드 스레드에 전달되어 core::Log_* 로 출력됨
+//   (분석 스레드는 파일/콘솔 I/O 를 기다리지 않음, 버퍼가 가득 차면 레코드를 버리고 개수만 기록)
+// - Release(NDEBUG) 빌드에서는 SCAN_LOG_DEBUG 가 인자 평가 없이 제거됨
+//   (JSSCANNER_DEBUG_LOG 를 정의하면 Release 에서도 유지)
+// - 실행 시 레벨: JSSCANNER_LOG_LEVEL = debug | info | warn | error | off (기본 info)
+
+enum class ScanLogLevel : int {
+    Debug = 0,
+    Info = 1,
+    Warn = 2,
+    Error = 3,
+    Off = 4
+};
+
+namespace ScanLog {
+
+    extern std::atomic<int> g_level;
+
+    inline bool enabled(ScanLogLevel level) {
+        return static_cast<int>(level) >= g_level.load(std::memory_order_relaxed);
+    }
+
+    void setLevel(ScanLogLevel level);
+    ScanLogLevel getLevel();
+
+    // 포맷 완료된 레코드를 큐에 넣음 (절대 블록되지 않음)
+    void submit(ScanLogLevel level, std::string&& message);
+
+    // 현재까지 제출된 레코드가 출력될 때까지 대기 (최대 timeoutMs)
+    void flush(int timeoutMs = 2000);
+
+    // 큐가 가득 차서 버려진 레코드 수
+    unsigned long long droppedCount();
+
+    namespace detail {
+        // std::string 인자를 %s 에 그대로 넘겨도 안전하도록 변환
+        template <typename T>
+        inline auto arg(const T& value) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                return value.c_str();
+            } else {
+                return value;
+            }
+        }
+
+        template <typename... Args>
+        std::string format(const char* fmt, const Args&... args) {
+            char stackBuf[512];
+            int n;
+            if constexpr (sizeof...(Args) == 0) {
+                n = std::snprintf(stackBuf, sizeof(stackBuf), "%s", fmt);
+            } else {
+                n = std::snprintf(stackBuf, sizeof(stackBuf), fmt, arg(args)...);
+            }
+            if (n < 0) {
+                return fmt;
+            }
+            if (static_cast<size_t>(n) < sizeof(stackBuf)) {
+                return std::string(stackBuf, static_cast<size_t>(n));
+            }
+            std::string out(static_cast<size_t>(n) + 1, '\0');
+            if constexpr (sizeof...(Args) == 0) {
+                std::snprintf(&out[0], out.size(), "%s", fmt);
+            } else {
+                std::snprintf(&out[0], out.size(), fmt, arg(args)...);
+            }
+            out.resize(static_cast<size_t>(n));
+            return out;
+        }
+    }
+
+    template <typename... Args>
+    void write(ScanLogLevel level, const char* fmt, const Args&... args) {
+        submit(level, detail::format(fmt, args...));
+    }
+
+} // namespace ScanLog
+
+#define SCAN_LOG_AT(level, ...) \
+    do { \
+        if (ScanLog::enabled(level)) { \
+            ScanLog::write(level, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#if defined(NDEBUG) && !defined(JSSCANNER_DEBUG_LOG)
+#define SCAN_LOG_DEBUG(...) do { } while (0)
+#else
+#define SCAN_LOG_DEBUG(...) SCAN_LOG_AT(ScanLogLevel::Debug, __VA_ARGS__)
+#endif
+#define SCAN_LOG_INFO(...)  SCAN_LOG_AT(ScanLogLevel::Info, __VA_ARGS__)
+#define SCAN_LOG_WARN(...)  SCAN_LOG_AT(ScanLogLevel::Warn, __VA_ARGS__)
+#define SCAN_LOG_ERROR(...) SCAN_LOG_AT(ScanLogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,31 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// 🔥 SHA-256 (FIPS 180-4) - VFS 산출물 / 보고서용 hash
+// - 외부 의존성 없는 단일 구현, update() 로 나눠 넣을 수 있음
+class Sha256 {
+public:
+    using Digest = std::array<uint8_t, 32>;
+
+    Sha256();
+    void update(const void* data, size_t size);
+    void update(std::string_view data) { update(data.data(), data.size()); }
+    Digest finish();
+
+    static Digest digest(std::string_view data);
+    // 소문자 16진수 64글자
+    static std::string hex(std::string_view data);
+    static std::string toHex(const Digest& digest);
+
+private:
+    void compress(const uint8_t* block);
+
+    std::array<uint32_t, 8> state_;
+    std::array<uint8_t, 64> buffer_;
+    size_t buffered_ = 0;
+    uint64_t totalBytes_ = 0;
+};
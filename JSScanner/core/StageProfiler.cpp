@@ -0,0 +1,210 @@
+#include "pch.h"
+#include "StageProfiler.h"
+#include "../reporters/metadata/Timing.h"
+#include "MetricsRegistry.h"
+#include <cstring>
+
+static thread_local StageProfiler* g_current_profiler = nullptr;
+
+StageProfiler::StageProfiler(bool keepTrace)
+    : keepTrace_(keepTrace), origin_(std::chrono::steady_clock::now()) {
+    nodes_.reserve(32);
+    stack_.reserve(16);
+}
+
+StageProfiler* StageProfiler::current() {
+    return g_current_profiler;
+}
+
+StageProfiler::Activation::Activation(StageProfiler* profiler)
+    : previous_(g_current_profiler) {
+    g_current_profiler = profiler;
+}
+
+StageProfiler::Activation::~Activation() {
+    g_current_profiler = previous_;
+}
+
+int64_t StageProfiler::nowUs() const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - origin_).count();
+}
+
+int StageProfiler::findOrCreateNode(int parent, const char* name) {
+    // 자식 수가 적으므로 선형 탐색 (이름은 문자열 리터럴 - 포인터 비교 후 내용 비교)
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        const StageNode& node = nodes_[i];
+        if (node.parent == parent &&
+            (node.name == name || std::strcmp(node.name, name) == 0)) {
+            return static_cast<int>(i);
+        }
+    }
+    StageNode node;
+    node.name = name;
+    node.parent = parent;
+    node.depth = (parent < 0) ? 0 : nodes_[parent].depth + 1;
+    nodes_.push_back(node);
+    int index = static_cast<int>(nodes_.size() - 1);
+
+    // 노드 생성 시 한 번만 레지스트리 조회, 이후 leave()는 atomic 갱신만 수행
+    nodes_[index].latency = &MetricsRegistry::instance().histogram(
+        "jsscanner_stage_duration_seconds", {{"stage", getPath(index)}},
+        MetricsRegistry::latencyBuckets(), "Latency of analysis stages");
+    return index;
+}
+
+void StageProfiler::enter(const char* name) {
+    int parent = stack_.empty() ? -1 : stack_.back().node;
+    int node = findOrCreateNode(parent, name);
+    stack_.push_back({node, nowUs()});
+}
+
+void StageProfiler::leave() {
+    if (stack_.empty()) {
+        return;
+    }
+    OpenStage open = stack_.back();
+    stack_.pop_back();
+
+    int64_t duration = nowUs() - open.startUs;
+    StageNode& node = nodes_[open.node];
+    node.count++;
+    node.totalUs += duration;
+    node.maxUs = (std::max)(node.maxUs, duration);
+    if (node.latency) {
+        node.latency->observe(duration / 1e6);
+    }
+
+    // 블록 바로 아래 단계만 블록별로 합산 ("block" 구간 자신은 stack_ 의 blockStackBase_ 위치)
+    if (blockDepth_ > 0 && !blocks_.empty() &&
+        static_cast<int>(stack_.size()) == blockStackBase_ + 1) {
+        auto& stages = blocks_.back().stages;
+        auto it = std::find_if(stages.begin(), stages.end(),
+            [&](const std::pair<const char*, int64_t>& s) {
+                return s.first == node.name || std::strcmp(s.first, node.name) == 0;
+            });
+        if (it != stages.end()) {
+            it->second += duration;
+        } else {
+            stages.emplace_back(node.name, duration);
+        }
+    }
+
+    if (keepTrace_ && trace_.size() < MAX_TRACE_RECORDS) {
+        trace_.push_back({node.name, blockDepth_ > 0 ? static_cast<int>(blocks_.size()) - 1 : -1,
+                          node.depth, open.startUs, duration});
+    }
+}
+
+void StageProfiler::beginBlock() {
+    if (blockDepth_++ > 0) {
+        return;  // 재귀 실행은 바깥 블록에 포함
+    }
+    BlockRecord block;
+    block.index = static_cast<int>(blocks_.size());
+    blocks_.push_back(std::move(block));
+    blockStackBase_ = static_cast<int>(stack_.size());
+    blockStartUs_ = nowUs();
+}
+
+void StageProfiler::endBlock() {
+    if (blockDepth_ <= 0) {
+        return;
+    }
+    if (--blockDepth_ > 0) {
+        return;
+    }
+    if (!blocks_.empty()) {
+        blocks_.back().totalUs = nowUs() - blockStartUs_;
+    }
+}
+
+std::string StageProfiler::getPath(int nodeIndex) const {
+    std::vector<const char*> parts;
+    for (int i = nodeIndex; i >= 0; i = nodes_[i].parent) {
+        parts.push_back(nodes_[i].name);
+    }
+    std::string path;
+    for (auto it = parts.rbegin(); it != parts.rend(); ++it) {
+        if (!path.empty()) path += '/';
+        path += *it;
+    }
+    return path;
+}
+
+void StageProfiler::fillTiming(Timing& timing) const {
+    std::vector<StageTiming> stages;
+    stages.reserve(nodes_.size());
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        const StageNode& node = nodes_[i];
+        if (node.count == 0) continue;
+        StageTiming stage;
+        stage.path = getPath(static_cast<int>(i));
+        stage.depth = node.depth;
+        stage.count = static_cast<long long>(node.count);
+        stage.totalMs = node.totalUs / 1000.0;
+        stage.maxMs = node.maxUs / 1000.0;
+        stages.push_back(std::move(stage));
+    }
+    // 경로 순으로 정렬하면 부모 바로 뒤에 자식이 위치함
+    std::sort(stages.begin(), stages.end(),
+        [](const StageTiming& a, const StageTiming& b) { return a.path < b.path; });
+
+    std::vector<BlockTiming> blocks;
+    blocks.reserve(blocks_.size());
+    for (const auto& record : blocks_) {
+        BlockTiming block;
+        block.index = record.index;
+        block.totalMs = record.totalUs / 1000.0;
+        for (const auto& [name, us] : record.stages) {
+            block.stages.emplace_back(name, us / 1000.0);
+        }
+        blocks.push_back(std::move(block));
+    }
+
+    timing.setStages(std::move(stages));
+    timing.setBlocks(std::move(blocks));
+}
+
+std::string StageProfiler::toChromeTraceJson(const std::string& taskId) const {
+    nlohmann::json events = nlohmann::json::array();
+
+    nlohmann::json meta;
+    meta["name"] = "process_name";
+    meta["ph"] = "M";
+    meta["pid"] = 1;
+    meta["tid"] = 1;
+    meta["args"] = {{"name", "JSScanner task " + taskId}};
+    events.push_back(std::move(meta));
+
+    for (const auto& record : trace_) {
+        nlohmann::json ev;
+        ev["name"] = record.name;
+        ev["cat"] = "stage";
+        ev["ph"] = "X";
+        ev["ts"] = record.startUs;
+        ev["dur"] = record.durationUs;
+        ev["pid"] = 1;
+        ev["tid"] = 1;
+        if (record.block >= 0) {
+            ev["args"] = {{"block", record.block}, {"depth", record.depth}};
+        } else {
+            ev["args"] = {{"depth", record.depth}};
+        }
+        events.push_back(std::move(ev));
+    }
+
+    nlohmann::json root;
+    root["traceEvents"] = std::move(events);
+    root["displayTimeUnit"] = "ms";
+    return root.dump();
+}
+
+bool StageProfiler::writeChromeTrace(const std::string& path, const std::string& taskId) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out << toChromeTraceJson(taskId);
+    return out.good();
+}
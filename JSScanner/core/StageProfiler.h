@@ -0,0 +1,135 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+class Timing;
+class MetricHistogram;
+
+// 🔥 Task 단위 단계별 실행 시간 측정기
+// - ScopedStage(RAII)로 구간을 열고 닫으면 steady_clock 기준으로 누적됨
+// - 중첩된 구간은 호출 트리(부모/자식)로 집계되어 계층 구조가 유지됨
+// - 블록(executeJavaScriptBlock) 단위 집계와 Task 전체 집계를 함께 제공
+// - 활성화된 Profiler가 없으면 ScopedStage는 thread_local 포인터 검사 한 번만 수행
+class StageProfiler {
+public:
+    // 호출 트리 노드 (동일 부모 아래 동일 이름은 하나의 노드로 합산)
+    struct StageNode {
+        const char* name;
+        int parent;          // -1 = 루트
+        int depth;
+        uint64_t count = 0;
+        int64_t totalUs = 0;
+        int64_t maxUs = 0;
+        MetricHistogram* latency = nullptr;  // jsscanner_stage_duration_seconds{stage=<path>}
+    };
+
+    // 블록별 집계 (블록 내부에서 열린 구간의 이름별 합계)
+    struct BlockRecord {
+        int index;
+        int64_t totalUs = 0;
+        std::vector<std::pair<const char*, int64_t>> stages;
+    };
+
+    // Chrome trace 용 개별 구간 기록 (trace 활성화 시에만 저장)
+    struct TraceRecord {
+        const char* name;
+        int block;
+        int depth;
+        int64_t startUs;
+        int64_t durationUs;
+    };
+
+    explicit StageProfiler(bool keepTrace = false);
+
+    // 현재 스레드에 활성화된 Profiler (없으면 nullptr)
+    static StageProfiler* current();
+
+    // 현재 스레드에 Profiler를 설치/해제하는 RAII 가드
+    class Activation {
+    public:
+        explicit Activation(StageProfiler* profiler);
+        ~Activation();
+        Activation(const Activation&) = delete;
+        Activation& operator=(const Activation&) = delete;
+    private:
+        StageProfiler* previous_;
+    };
+
+    void enter(const char* name);
+    void leave();
+
+    // 블록 경계 (재귀 실행 시 가장 바깥 블록만 집계 대상)
+    void beginBlock();
+    void endBlock();
+
+    const std::vector<StageNode>& getNodes() const { return nodes_; }
+    const std::vector<BlockRecord>& getBlocks() const { return blocks_; }
+    bool isTraceEnabled() const { return keepTrace_; }
+
+    // 노드의 전체 경로 (예: "block/js_eval")
+    std::string getPath(int nodeIndex) const;
+
+    // 집계 결과를 보고서용 Timing에 채움
+    void fillTiming(Timing& timing) const;
+
+    // chrome://tracing / Perfetto 에서 열 수 있는 Trace Event JSON
+    std::string toChromeTraceJson(const std::string& taskId) const;
+    bool writeChromeTrace(const std::string& path, const std::string& taskId) const;
+
+private:
+    struct OpenStage {
+        int node;
+        int64_t startUs;
+    };
+
+    int64_t nowUs() const;
+    int findOrCreateNode(int parent, const char* name);
+
+    bool keepTrace_;
+    std::chrono::steady_clock::time_point origin_;
+    std::vector<StageNode> nodes_;
+    std::vector<OpenStage> stack_;
+    std::vector<BlockRecord> blocks_;
+    std::vector<TraceRecord> trace_;
+    int blockDepth_ = 0;
+    int blockStackBase_ = 0;
+    int64_t blockStartUs_ = 0;
+
+    static constexpr size_t MAX_TRACE_RECORDS = 200000;
+};
+
+// 🔥 구간 측정 RAII 헬퍼
+class ScopedStage {
+public:
+    explicit ScopedStage(const char* name) : profiler_(StageProfiler::current()) {
+        if (profiler_) profiler_->enter(name);
+    }
+    ~ScopedStage() {
+        if (profiler_) profiler_->leave();
+    }
+    ScopedStage(const ScopedStage&) = delete;
+    ScopedStage& operator=(const ScopedStage&) = delete;
+private:
+    StageProfiler* profiler_;
+};
+
+// 블록 경계 RAII 헬퍼
+class ScopedStageBlock {
+public:
+    ScopedStageBlock() : profiler_(StageProfiler::current()) {
+        if (profiler_) profiler_->beginBlock();
+    }
+    ~ScopedStageBlock() {
+        if (profiler_) profiler_->endBlock();
+    }
+    ScopedStageBlock(const ScopedStageBlock&) = delete;
+    ScopedStageBlock& operator=(const ScopedStageBlock&) = delete;
+private:
+    StageProfiler* profiler_;
+};
+
+#define STAGE_CONCAT_INNER(a, b) a##b
+#define STAGE_CONCAT(a, b) STAGE_CONCAT_INNER(a, b)
+#define STAGE_SCOPE(name) ScopedStage STAGE_CONCAT(_stage_scope_, __LINE__)(name)
@@ -0,0 +1,1464 @@
+#include "pch.h"
+#include "StaticStringEvaluator.h"
+#include "BruteForceDecoder.h"
+#include "../builtin/helpers/Base64Utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// ============================================================================
+// 토큰화 (주석 제거, 문자열 escape 해제, regex / template 은 불투명 토큰)
+// ============================================================================
+enum class TokenType { Identifier, Number, String, Template, Regex, Punct, End };
+
+struct Token {
+    TokenType type = TokenType::End;
+    std::string text;           // 식별자 / 구두점 원문, 문자열은 escape 해제된 값
+    double number = 0;
+    size_t offset = 0;
+    bool newlineBefore = false; // ASI 판단용
+};
+
+const char* const PUNCTUATORS[] = {
+    ">>>=", "...", "===", "!==", "**=", "<<=", ">>=", ">>>", "&&=", "||=", "?\?=",
+    "=>", "==", "!=", "<=", ">=", "&&", "||", "??", "?.", "++", "--",
+    "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "**", "<<", ">>"
+};
+
+bool isIdentStart(unsigned char c) { return std::isalpha(c) || c == '_' || c == '$' || c >= 0x80; }
+bool isIdentPart(unsigned char c) { return isIdentStart(c) || std::isdigit(c); }
+
+// 직전 토큰 기준으로 '/' 가 regex 리터럴의 시작인지
+bool regexAllowedAfter(const std::vector<Token>& tokens) {
+    static const std::unordered_set<std::string> KEYWORDS = {
+        "return", "typeof", "case", "do", "else", "in", "of", "new", "delete",
+        "void", "throw", "yield", "await", "instanceof"
+    };
+    if (tokens.empty()) return true;
+    const Token& prev = tokens.back();
+    switch (prev.type) {
+    case TokenType::Identifier: return KEYWORDS.count(prev.text) > 0;
+    case TokenType::Punct: return prev.text != ")" && prev.text != "]" && prev.text != "}";
+    default: return false;
+    }
+}
+
+double parseNumberLiteral(std::string text) {
+    text.erase(std::remove(text.begin(), text.end(), '_'), text.end());
+    if (!text.empty() && text.back() == 'n') text.pop_back();   // BigInt
+    if (text.size() > 2 && text[0] == '0') {
+        char prefix = static_cast<char>(std::tolower(static_cast<unsigned char>(text[1])));
+        int base = prefix == 'x' ? 16 : prefix == 'o' ? 8 : prefix == 'b' ? 2 : 0;
+        if (base) return static_cast<double>(std::strtoull(text.c_str() + 2, nullptr, base));
+    }
+    return std::strtod(text.c_str(), nullptr);
+}
+
+// MAX_TOKENS 를 넘으면 false (앞부분만 평가)
+bool tokenize(std::string_view src, std::vector<Token>& tokens) {
+    const size_t n = src.size();
+    size_t i = 0;
+    bool newline = false;
+
+    while (i < n) {
+        if (tokens.size() >= StaticStringEvaluator::MAX_TOKENS) return false;
+        unsigned char c = static_cast<unsigned char>(src[i]);
+
+        if (c == '\n' || c == '\r') { newline = true; ++i; continue; }
+        if (std::isspace(c)) { ++i; continue; }
+        if (c == '/' && i + 1 < n && src[i + 1] == '/') {
+            while (i < n && src[i] != '\n') ++i;
+            continue;
+        }
+        if (c == '/' && i + 1 < n && src[i + 1] == '*') {
+            size_t end = src.find("*/", i + 2);
+            end = end == std::string_view::npos ? n : end + 2;
+            if (src.substr(i, end - i).find('\n') != std::string_view::npos) newline = true;
+            i = end;
+            continue;
+        }
+        if (c == '<' && src.substr(i, 4) == "<!--") {
+            while (i < n && src[i] != '\n') ++i;
+            continue;
+        }
+
+        Token token;
+        token.offset = i;
+        token.newlineBefore = newline;
+        newline = false;
+
+        if (isIdentStart(c)) {
+            size_t j = i;
+            while (j < n && isIdentPart(static_cast<unsigned char>(src[j]))) ++j;
+            token.type = TokenType::Identifier;
+            token.text.assign(src.substr(i, j - i));
+            i = j;
+        } else if (std::isdigit(c) || (c == '.' && i + 1 < n && std::isdigit(static_cast<unsigned char>(src[i + 1])))) {
+            size_t j = i;
+            if (c == '0' && j + 1 < n && std::isalpha(static_cast<unsigned char>(src[j + 1]))) {
+                j += 2;
+                while (j < n && (std::isalnum(static_cast<unsigned char>(src[j])) || src[j] == '_')) ++j;
+            } else {
+                while (j < n && (std::isdigit(static_cast<unsigned char>(src[j])) || src[j] == '.' || src[j] == '_')) ++j;
+                if (j < n && (src[j] == 'e' || src[j] == 'E')) {
+                    ++j;
+                    if (j < n && (src[j] == '+' || src[j] == '-')) ++j;
+                    while (j < n && std::isdigit(static_cast<unsigned char>(src[j]))) ++j;
+                }
+                if (j < n && src[j] == 'n') ++j;
+            }
+            token.type = TokenType::Number;
+            token.text.assign(src.substr(i, j - i));
+            token.number = parseNumberLiteral(token.text);
+            i = j;
+        } else if (c == '"' || c == '\'') {
+            size_t j = i + 1;
+            while (j < n && src[j] != static_cast<char>(c) && src[j] != '\n') {
+                if (src[j] == '\\') ++j;
+                ++j;
+            }
+            j = (std::min)(j, n);
+            token.type = TokenType::String;
+            token.text = BruteForceDecoder::unescapeJsLiteral(src.substr(i + 1, j - i - 1));
+            i = (std::min)(j + 1, n);
+        } else if (c == '`') {
+            size_t j = i + 1;
+            bool interpolated = false;
+            while (j < n && src[j] != '`') {
+                if (src[j] == '\\') {
+                    j += 2;
+                    continue;
+                }
+                if (src[j] == '$' && j + 1 < n && src[j + 1] == '{') {
+                    interpolated = true;
+                    int depth = 0;
+                    for (++j; j < n; ++j) {
+                        if (src[j] == '{') depth++;
+                        else if (src[j] == '}' && --depth == 0) break;
+                    }
+                }
+                ++j;
+            }
+            j = (std::min)(j, n);
+            if (interpolated) {
+                token.type = TokenType::Template;
+            } else {
+                token.type = TokenType::String;
+                token.text = BruteForceDecoder::unescapeJsLiteral(src.substr(i + 1, j - i - 1));
+            }
+            i = (std::min)(j + 1, n);
+        } else if (c == '/' && regexAllowedAfter(tokens)) {
+            size_t j = i + 1;
+            bool inClass = false;
+            while (j < n && src[j] != '\n') {
+                if (src[j] == '\\') { j += 2; continue; }
+                if (src[j] == '[') inClass = true;
+                else if (src[j] == ']') inClass = false;
+                else if (src[j] == '/' && !inClass) break;
+                ++j;
+            }
+            ++j;
+            while (j < n && isIdentPart(static_cast<unsigned char>(src[j]))) ++j;
+            token.type = TokenType::Regex;
+            i = (std::min)(j, n);
+        } else {
+            token.type = TokenType::Punct;
+            size_t len = 1;
+            for (const char* p : PUNCTUATORS) {
+                std::string_view punct(p);
+                if (src.substr(i, punct.size()) == punct) {
+                    len = punct.size();
+                    break;
+                }
+            }
+            token.text.assign(src.substr(i, len));
+            i += len;
+        }
+        tokens.push_back(std::move(token));
+    }
+    return true;
+}
+
+// ============================================================================
+// 값 / 변환 (JS 의미론 중 문자열 조립에 필요한 부분만)
+// ============================================================================
+struct Value;
+using ArrayPtr = std::shared_ptr<std::vector<Value>>;
+
+struct Value {
+    enum class Kind { Null, Number, String, Array, Function, Builtin, Method };
+    Kind kind = Kind::Null;
+    double number = 0;
+    std::string str;                    // String 값 / Builtin·Method 이름
+    ArrayPtr array;                     // 배열은 참조 공유 (회전 / reverse 가 바인딩에 반영됨)
+    int function = -1;                  // Evaluator::functions_ 인덱스
+    std::shared_ptr<Value> receiver;    // Method 호출 대상
+    uint32_t techniques = 0;            // 0 이면 리터럴 그대로
+};
+
+Value makeNumber(double number, uint32_t techniques = 0) {
+    Value v;
+    v.kind = Value::Kind::Number;
+    v.number = number;
+    v.techniques = techniques;
+    return v;
+}
+
+Value makeString(std::string str, uint32_t techniques = 0) {
+    Value v;
+    v.kind = Value::Kind::String;
+    v.str = std::move(str);
+    v.techniques = techniques;
+    return v;
+}
+
+Value makeArray(ArrayPtr array, uint32_t techniques = 0) {
+    Value v;
+    v.kind = Value::Kind::Array;
+    v.array = std::move(array);
+    v.techniques = techniques;
+    return v;
+}
+
+Value makeNamed(Value::Kind kind, std::string name) {
+    Value v;
+    v.kind = kind;
+    v.str = std::move(name);
+    return v;
+}
+
+std::string numberToString(double d) {
+    if (std::isnan(d)) return "NaN";
+    if (std::isinf(d)) return d > 0 ? "Infinity" : "-Infinity";
+    if (d == 0) return "0";
+    char buf[40];
+    if (d == std::floor(d) && std::fabs(d) < 1e21) {
+        std::snprintf(buf, sizeof(buf), "%.0f", d);
+        return buf;
+    }
+    for (int precision = 1; precision <= 17; ++precision) {
+        std::snprintf(buf, sizeof(buf), "%.*g", precision, d);
+        if (std::strtod(buf, nullptr) == d) break;
+    }
+    return buf;
+}
+
+std::string trimmed(const std::string& s) {
+    size_t begin = s.find_first_not_of(" \t\r\n\f\v");
+    if (begin == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\r\n\f\v");
+    return s.substr(begin, end - begin + 1);
+}
+
+double stringToNumber(const std::string& text) {
+    std::string s = trimmed(text);
+    if (s.empty()) return 0;
+    if (s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        char* end = nullptr;
+        double v = static_cast<double>(std::strtoull(s.c_str() + 2, &end, 16));
+        return *end ? NAN : v;
+    }
+    char* end = nullptr;
+    double v = std::strtod(s.c_str(), &end);
+    return *end ? NAN : v;
+}
+
+double toNumber(const Value& v) {
+    switch (v.kind) {
+    case Value::Kind::Number: return v.number;
+    case Value::Kind::String: return stringToNumber(v.str);
+    case Value::Kind::Null: return 0;
+    case Value::Kind::Array:
+        if (v.array->empty()) return 0;
+        if (v.array->size() == 1) return toNumber((*v.array)[0]);
+        return NAN;
+    default: return NAN;
+    }
+}
+
+int32_t toInt32(double d) {
+    if (!std::isfinite(d)) return 0;
+    double m = std::fmod(std::trunc(d), 4294967296.0);
+    if (m < 0) m += 4294967296.0;
+    return static_cast<int32_t>(static_cast<uint32_t>(m));
+}
+
+std::optional<std::string> toStringValue(const Value& v, int depth = 0) {
+    switch (v.kind) {
+    case Value::Kind::String: return v.str;
+    case Value::Kind::Number: return numberToString(v.number);
+    case Value::Kind::Array: {
+        if (depth > 8) return std::nullopt;
+        std::string out;
+        for (size_t i = 0; i < v.array->size(); ++i) {
+            if (i) out += ',';
+            const Value& element = (*v.array)[i];
+            if (element.kind == Value::Kind::Null) continue;
+            auto s = toStringValue(element, depth + 1);
+            if (!s) return std::nullopt;
+            out += *s;
+            if (out.size() > StaticStringEvaluator::MAX_STRING_LENGTH) return std::nullopt;
+        }
+        return out;
+    }
+    default: return std::nullopt;
+    }
+}
+
+// fromCharCode 결과: Latin-1 범위는 바이트 그대로 (XOR 페이로드 보존), 그 이상은 UTF-8
+void appendCodeUnit(std::string& out, uint32_t unit) {
+    if (unit <= 0xFF) {
+        out += static_cast<char>(unit);
+    } else if (unit <= 0x7FF) {
+        out += static_cast<char>(0xC0 | (unit >> 6));
+        out += static_cast<char>(0x80 | (unit & 0x3F));
+    } else {
+        out += static_cast<char>(0xE0 | (unit >> 12));
+        out += static_cast<char>(0x80 | ((unit >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (unit & 0x3F));
+    }
+}
+
+int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return (c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+}
+
+// %XX (unescape 는 %uXXXX 도) 해제, 형식이 틀린 부분은 그대로 둠
+std::string percentDecode(const std::string& s, bool allowUnicode) {
+    std::string out;
+    out.reserve(s.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (s[i] == '%') {
+            if (allowUnicode && i + 5 < s.size() && s[i + 1] == 'u') {
+                int d[4] = {hexDigit(s[i + 2]), hexDigit(s[i + 3]), hexDigit(s[i + 4]), hexDigit(s[i + 5])};
+                if (d[0] >= 0 && d[1] >= 0 && d[2] >= 0 && d[3] >= 0) {
+                    appendCodeUnit(out, static_cast<uint32_t>((d[0] << 12) | (d[1] << 8) | (d[2] << 4) | d[3]));
+                    i += 5;
+                    continue;
+                }
+            }
+            if (i + 2 < s.size() && hexDigit(s[i + 1]) >= 0 && hexDigit(s[i + 2]) >= 0) {
+                out += static_cast<char>((hexDigit(s[i + 1]) << 4) | hexDigit(s[i + 2]));
+                i += 2;
+                continue;
+            }
+        }
+        out += s[i];
+    }
+    return out;
+}
+
+double jsParseInt(const std::string& text, int radix) {
+    std::string s = trimmed(text);
+    size_t i = 0;
+    bool negative = false;
+    if (i < s.size() && (s[i] == '+' || s[i] == '-')) negative = s[i++] == '-';
+    if ((radix == 0 || radix == 16) && i + 1 < s.size() && s[i] == '0' && (s[i + 1] == 'x' || s[i + 1] == 'X')) {
+        radix = 16;
+        i += 2;
+    }
+    if (radix == 0) radix = 10;
+    if (radix < 2 || radix > 36) return NAN;
+
+    double value = 0;
+    size_t digits = 0;
+    for (; i < s.size(); ++i, ++digits) {
+        unsigned char c = static_cast<unsigned char>(s[i]);
+        int d = std::isdigit(c) ? c - '0' : std::isalpha(c) ? std::tolower(c) - 'a' + 10 : 99;
+        if (d >= radix) break;
+        value = value * radix + d;
+    }
+    if (digits == 0) return NAN;
+    return negative ? -value : value;
+}
+
+// JS 문자열 인덱스 정규화 (음수는 길이 기준, 범위로 clamp)
+size_t relativeIndex(double d, size_t size) {
+    if (std::isnan(d)) return 0;
+    d = std::trunc(d);
+    if (d < 0) d = (std::max)(0.0, static_cast<double>(size) + d);
+    return static_cast<size_t>((std::min)(d, static_cast<double>(size)));
+}
+
+size_t clampIndex(double d, size_t size) {
+    if (std::isnan(d) || d < 0) return 0;
+    return static_cast<size_t>((std::min)(std::trunc(d), static_cast<double>(size)));
+}
+
+const char OBFUSCATOR_BASE64_ALPHABET[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// ============================================================================
+// 함수 (본문 토큰 범위만 기억하고 첫 호출 때 역할을 분류)
+// ============================================================================
+struct FunctionInfo {
+    enum class Role { Unclassified, Classifying, Plain, ArrayProvider, Accessor, Opaque };
+
+    std::vector<std::string> params;
+    size_t bodyBegin = 0;           // 블록 본문: '{' 다음 토큰, 식 본문: 식 첫 토큰
+    size_t bodyEnd = 0;             // 블록 본문: '}' 위치, 식 본문: 식 끝 다음
+    bool expressionBody = false;
+
+    Role role = Role::Unclassified;
+    size_t returnBegin = 0;         // Plain: return 식 시작
+    ArrayPtr array;                 // ArrayProvider / Accessor 대상 배열
+    double offset = 0;              // Accessor: index - offset
+    bool base64Strings = false;     // Accessor: obfuscator.io base64 문자열 배열
+};
+
+constexpr int MAX_PARSE_DEPTH = 200;
+constexpr int MAX_CALL_DEPTH = 16;
+constexpr size_t MAX_REPEAT = 4096;
+
+class Evaluator {
+public:
+    Evaluator(std::vector<Token> tokens, StaticStringEvaluator::Result& result)
+        : tokens_(std::move(tokens)), result_(result) {
+        maxSteps_ = tokens_.size() * 32 + 1000000;
+        end_.offset = tokens_.empty() ? 0 : tokens_.back().offset;
+        matchBrackets();
+    }
+
+    void run();
+
+private:
+    using Technique = StaticStringEvaluator::Technique;
+
+    // 함수 호출 동안 매개변수 / 지역 별칭을 덮어쓰고 끝나면 복원
+    class BindingScope {
+    public:
+        explicit BindingScope(std::unordered_map<std::string, Value>& env) : env_(env) {}
+        ~BindingScope() {
+            for (auto it = saved_.rbegin(); it != saved_.rend(); ++it) {
+                if (it->second) env_[it->first] = std::move(*it->second);
+                else env_.erase(it->first);
+            }
+        }
+        void bind(const std::string& name, Value value) {
+            auto it = env_.find(name);
+            saved_.emplace_back(name, it == env_.end() ? std::nullopt : std::optional<Value>(it->second));
+            env_[name] = std::move(value);
+        }
+    private:
+        std::unordered_map<std::string, Value>& env_;
+        std::vector<std::pair<std::string, std::optional<Value>>> saved_;
+    };
+
+    struct DepthGuard {
+        int& depth;
+        explicit DepthGuard(int& d) : depth(d) { ++depth; }
+        ~DepthGuard() { --depth; }
+    };
+
+    const Token& tok(size_t i) const { return i < tokens_.size() ? tokens_[i] : end_; }
+    bool isPunct(size_t i, const char* p) const { const Token& t = tok(i); return t.type == TokenType::Punct && t.text == p; }
+    bool isIdent(size_t i, const char* name) const { const Token& t = tok(i); return t.type == TokenType::Identifier && t.text == name; }
+    bool budgetLeft() { return ++steps_ <= maxSteps_; }
+
+    void matchBrackets();
+    size_t closing(size_t open) const { return open < match_.size() ? match_[open] : std::string::npos; }
+    bool atTerminator(size_t pos) const;
+    size_t skipExpression(size_t pos) const;
+    bool rangeHasFunction(size_t begin, size_t end) const;
+
+    std::optional<Value> parseExpression(size_t& pos) { return parseBinary(pos, 1); }
+    std::optional<Value> parseBinary(size_t& pos, int minPrecedence);
+    std::optional<Value> parseUnary(size_t& pos);
+    std::optional<Value> parsePostfix(size_t& pos);
+    std::optional<Value> parsePrimary(size_t& pos);
+    bool parseArguments(size_t& pos, std::vector<Value>& args);
+    std::optional<int> parseFunction(size_t& pos);
+    std::optional<int> parseArrow(size_t& pos);
+    std::vector<std::string> collectParams(size_t open, size_t close) const;
+
+    std::optional<Value> applyBinary(const std::string& op, const Value& lhs, const Value& rhs);
+    std::optional<Value> member(const Value& object, const std::string& name);
+    std::optional<Value> index(const Value& object, const Value& key);
+    std::optional<Value> call(const Value& callee, std::vector<Value>& args);
+    std::optional<Value> callMethod(const Value& method, std::vector<Value>& args);
+    std::optional<Value> callBuiltin(const std::string& name, std::vector<Value>& args);
+    std::optional<Value> callFunction(int id, std::vector<Value>& args);
+
+    void classify(FunctionInfo& fn);
+    ArrayPtr resolveArray(const Value& v);
+    void hoistDeclarations();
+    void handleFunctionKeyword(size_t i);
+    void tryRotation(int id, std::vector<Value>& args);
+    size_t handleAssignment(size_t i);
+    size_t tryRecordExpression(size_t start);
+    std::string expressionName(size_t start) const;
+    void record(const std::string& name, const Value& value, size_t offset);
+
+    std::vector<Token> tokens_;
+    Token end_;
+    StaticStringEvaluator::Result& result_;
+    std::vector<size_t> match_;
+    std::unordered_map<std::string, Value> env_;
+    std::deque<FunctionInfo> functions_;           // 평가 중 추가되어도 참조가 유지되도록 deque
+    std::unordered_map<size_t, int> functionAt_;    // function 키워드 / arrow 시작 위치 → 인덱스
+    std::unordered_set<std::string> recorded_;
+    size_t steps_ = 0;
+    size_t maxSteps_ = 0;
+    int parseDepth_ = 0;
+    int callDepth_ = 0;
+};
+
+void Evaluator::matchBrackets() {
+    match_.assign(tokens_.size(), std::string::npos);
+    std::vector<size_t> stack;
+    for (size_t i = 0; i < tokens_.size(); ++i) {
+        const Token& t = tokens_[i];
+        if (t.type != TokenType::Punct || t.text.size() != 1) continue;
+        char c = t.text[0];
+        if (c == '(' || c == '[' || c == '{') {
+            stack.push_back(i);
+        } else if (c == ')' || c == ']' || c == '}') {
+            char open = c == ')' ? '(' : c == ']' ? '[' : '{';
+            // 짝이 맞는 여는 괄호까지 되감기 (깨진 입력 허용)
+            while (!stack.empty() && tokens_[stack.back()].text[0] != open) stack.pop_back();
+            if (!stack.empty()) {
+                match_[stack.back()] = i;
+                stack.pop_back();
+            }
+        }
+    }
+}
+
+bool Evaluator::atTerminator(size_t pos) const {
+    const Token& t = tok(pos);
+    if (t.type == TokenType::End || t.newlineBefore) return true;
+    if (t.type != TokenType::Punct) return false;
+    return t.text == ";" || t.text == "," || t.text == ")" || t.text == "]" || t.text == "}" || t.text == ":";
+}
+
+size_t Evaluator::skipExpression(size_t pos) const {
+    while (pos < tokens_.size()) {
+        const Token& t = tokens_[pos];
+        if (t.type == TokenType::Punct) {
+            if (t.text == "," || t.text == ")" || t.text == "]" || t.text == "}" || t.text == ";") break;
+            if (t.text == "(" || t.text == "[" || t.text == "{") {
+                size_t close = closing(pos);
+                if (close == std::string::npos) return tokens_.size();
+                pos = close + 1;
+                continue;
+            }
+        }
+        ++pos;
+    }
+    return pos;
+}
+
+bool Evaluator::rangeHasFunction(size_t begin, size_t end) const {
+    for (size_t i = begin; i < end && i < tokens_.size(); ++i) {
+        if (isIdent(i, "function") || isPunct(i, "=>")) return true;
+    }
+    return false;
+}
+
+std::vector<std::string> Evaluator::collectParams(size_t open, size_t close) const {
+    std::vector<std::string> params;
+    for (size_t i = open + 1; i < close; ++i) {
+        if (tokens_[i].type == TokenType::Identifier && (isPunct(i + 1, ",") || i + 1 == close) &&
+            (i == open + 1 || isPunct(i - 1, ","))) {
+            params.push_back(tokens_[i].text);
+        }
+    }
+    return params;
+}
+
+// ----------------------------------------------------------------------------
+// 식 파싱 + 평가 (지원하지 않는 구문이면 nullopt)
+// ----------------------------------------------------------------------------
+int binaryPrecedence(const Token& t) {
+    if (t.type != TokenType::Punct) return -1;
+    const std::string& op = t.text;
+    if (op == "|") return 1;
+    if (op == "^") return 2;
+    if (op == "&") return 3;
+    if (op == "<<" || op == ">>" || op == ">>>") return 5;
+    if (op == "+" || op == "-") return 6;
+    if (op == "*" || op == "/" || op == "%") return 7;
+    return -1;
+}
+
+std::optional<Value> Evaluator::parseBinary(size_t& pos, int minPrecedence) {
+    DepthGuard guard(parseDepth_);
+    if (parseDepth_ > MAX_PARSE_DEPTH) return std::nullopt;
+
+    auto lhs = parseUnary(pos);
+    while (lhs) {
+        int precedence = binaryPrecedence(tok(pos));
+        if (precedence < minPrecedence) break;
+        std::string op = tok(pos).text;
+        ++pos;
+        auto rhs = parseBinary(pos, precedence + 1);
+        if (!rhs) return std::nullopt;
+        lhs = applyBinary(op, *lhs, *rhs);
+    }
+    return lhs;
+}
+
+std::optional<Value> Evaluator::parseUnary(size_t& pos) {
+    if (isPunct(pos, "-") || isPunct(pos, "+") || isPunct(pos, "~")) {
+        std::string op = tok(pos).text;
+        ++pos;
+        DepthGuard guard(parseDepth_);
+        if (parseDepth_ > MAX_PARSE_DEPTH) return std::nullopt;
+        auto operand = parseUnary(pos);
+        if (!operand) return std::nullopt;
+        double n = toNumber(*operand);
+        if (op == "-") return makeNumber(-n, operand->techniques);
+        if (op == "~") return makeNumber(~toInt32(n), operand->techniques);
+        return makeNumber(n, operand->techniques);
+    }
+    return parsePostfix(pos);
+}
+
+std::optional<Value> Evaluator::parsePostfix(size_t& pos) {
+    auto value = parsePrimary(pos);
+    while (value) {
+        if (isPunct(pos, ".") || isPunct(pos, "?.")) {
+            if (tok(pos + 1).type != TokenType::Identifier) return std::nullopt;
+            value = member(*value, tok(pos + 1).text);
+            pos += 2;
+        } else if (isPunct(pos, "[")) {
+            ++pos;
+            auto key = parseExpression(pos);
+            if (!key || !isPunct(pos, "]")) return std::nullopt;
+            ++pos;
+            value = index(*value, *key);
+        } else if (isPunct(pos, "(")) {
+            std::vector<Value> args;
+            if (!parseArguments(pos, args)) return std::nullopt;
+            value = call(*value, args);
+        } else {
+            break;
+        }
+    }
+    return value;
+}
+
+std::optional<Value> Evaluator::parsePrimary(size_t& pos) {
+    if (!budgetLeft()) return std::nullopt;
+    const Token& t = tok(pos);
+
+    switch (t.type) {
+    case TokenType::String:
+        ++pos;
+        return makeString(t.text);
+    case TokenType::Number:
+        ++pos;
+        return makeNumber(t.number);
+    case TokenType::Punct:
+        if (t.text == "[") {
+            auto array = std::make_shared<std::vector<Value>>();
+            uint32_t techniques = 0;
+            ++pos;
+            while (!isPunct(pos, "]")) {
+                if (tok(pos).type == TokenType::End) return std::nullopt;
+                if (isPunct(pos, ",")) {    // 빈 원소
+                    array->push_back(Value{});
+                    ++pos;
+                    continue;
+                }
+                bool spread = isPunct(pos, "...");
+                if (spread) ++pos;
+                auto element = parseExpression(pos);
+                if (!element) return std::nullopt;
+                techniques |= element->techniques;
+                if (spread) {
+                    if (element->kind != Value::Kind::Array) return std::nullopt;
+                    array->insert(array->end(), element->array->begin(), element->array->end());
+                } else {
+                    array->push_back(std::move(*element));
+                }
+                if (isPunct(pos, ",")) ++pos;
+                else if (!isPunct(pos, "]")) return std::nullopt;
+            }
+            ++pos;
+            return makeArray(std::move(array), techniques);
+        }
+        if (t.text == "(") {
+            size_t close = closing(pos);
+            if (close != std::string::npos && isPunct(close + 1, "=>")) {
+                auto id = parseArrow(pos);
+                if (!id) return std::nullopt;
+                Value fn = makeNamed(Value::Kind::Function, "");
+                fn.function = *id;
+                return fn;
+            }
+            ++pos;
+            auto inner = parseExpression(pos);
+            if (!inner || !isPunct(pos, ")")) return std::nullopt;
+            ++pos;
+            return inner;
+        }
+        return std::nullopt;
+    case TokenType::Identifier: {
+        if (t.text == "function" || isPunct(pos + 1, "=>")) {
+            auto id = t.text == "function" ? parseFunction(pos) : parseArrow(pos);
+            if (!id) return std::nullopt;
+            Value fn = makeNamed(Value::Kind::Function, "");
+            fn.function = *id;
+            return fn;
+        }
+        auto it = env_.find(t.text);
+        if (it != env_.end()) {
+            ++pos;
+            return it->second;
+        }
+        static const std::unordered_set<std::string> BUILTINS = {
+            "String", "atob", "unescape", "decodeURIComponent", "decodeURI", "parseInt"
+        };
+        if (BUILTINS.count(t.text)) {
+            ++pos;
+            return makeNamed(Value::Kind::Builtin, t.text);
+        }
+        if (t.text == "null" || t.text == "undefined" || t.text == "this") {
+            ++pos;
+            return Value{};
+        }
+        return std::nullopt;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+bool Evaluator::parseArguments(size_t& pos, std::vector<Value>& args) {
+    ++pos;  // '('
+    while (!isPunct(pos, ")")) {
+        bool spread = isPunct(pos, "...");
+        if (spread) ++pos;
+        auto arg = parseExpression(pos);
+        if (!arg) return false;
+        if (spread) {
+            if (arg->kind != Value::Kind::Array) return false;
+            args.insert(args.end(), arg->array->begin(), arg->array->end());
+        } else {
+            args.push_back(std::move(*arg));
+        }
+        if (isPunct(pos, ",")) ++pos;
+        else if (!isPunct(pos, ")")) return false;
+    }
+    ++pos;
+    return true;
+}
+
+std::optional<int> Evaluator::parseFunction(size_t& pos) {
+    size_t start = pos;
+    size_t p = pos + 1;
+    if (isPunct(p, "*")) ++p;
+    if (tok(p).type == TokenType::Identifier) ++p;
+    size_t paramsClose = isPunct(p, "(") ? closing(p) : std::string::npos;
+    if (paramsClose == std::string::npos || !isPunct(paramsClose + 1, "{")) return std::nullopt;
+    size_t bodyClose = closing(paramsClose + 1);
+    if (bodyClose == std::string::npos) return std::nullopt;
+    pos = bodyClose + 1;
+
+    auto cached = functionAt_.find(start);
+    if (cached != functionAt_.end()) return cached->second;
+
+    FunctionInfo fn;
+    fn.params = collectParams(p, paramsClose);
+    fn.bodyBegin = paramsClose + 2;
+    fn.bodyEnd = bodyClose;
+    functions_.push_back(std::move(fn));
+    int id = static_cast<int>(functions_.size() - 1);
+    functionAt_[start] = id;
+    return id;
+}
+
+std::optional<int> Evaluator::parseArrow(size_t& pos) {
+    size_t start = pos;
+    std::vector<std::string> params;
+    size_t p;
+    if (isPunct(pos, "(")) {
+        size_t close = closing(pos);
+        if (close == std::string::npos) return std::nullopt;
+        params = collectParams(pos, close);
+        p = close + 1;
+    } else {
+        params.push_back(tok(pos).text);
+        p = pos + 1;
+    }
+    if (!isPunct(p, "=>")) return std::nullopt;
+    ++p;
+
+    FunctionInfo fn;
+    fn.params = std::move(params);
+    if (isPunct(p, "{")) {
+        size_t close = closing(p);
+        if (close == std::string::npos) return std::nullopt;
+        fn.bodyBegin = p + 1;
+        fn.bodyEnd = close;
+        pos = close + 1;
+    } else {
+        fn.expressionBody = true;
+        fn.bodyBegin = p;
+        fn.bodyEnd = skipExpression(p);
+        pos = fn.bodyEnd;
+    }
+
+    auto cached = functionAt_.find(start);
+    if (cached != functionAt_.end()) return cached->second;
+    functions_.push_back(std::move(fn));
+    int id = static_cast<int>(functions_.size() - 1);
+    functionAt_[start] = id;
+    return id;
+}
+
+std::optional<Value> Evaluator::applyBinary(const std::string& op, const Value& lhs, const Value& rhs) {
+    uint32_t techniques = lhs.techniques | rhs.techniques;
+    if (op == "+") {
+        bool stringy = lhs.kind == Value::Kind::String || rhs.kind == Value::Kind::String ||
+                       lhs.kind == Value::Kind::Array || rhs.kind == Value::Kind::Array;
+        if (!stringy) return makeNumber(toNumber(lhs) + toNumber(rhs), techniques);
+        auto l = toStringValue(lhs);
+        auto r = toStringValue(rhs);
+        if (!l || !r || l->size() + r->size() > StaticStringEvaluator::MAX_STRING_LENGTH) return std::nullopt;
+        return makeString(*l + *r, techniques | Technique::Concat);
+    }
+
+    double a = toNumber(lhs);
+    double b = toNumber(rhs);
+    if (op == "-") return makeNumber(a - b, techniques);
+    if (op == "*") return makeNumber(a * b, techniques);
+    if (op == "/") return makeNumber(a / b, techniques);
+    if (op == "%") return makeNumber(std::fmod(a, b), techniques);
+    int32_t x = toInt32(a);
+    uint32_t shift = static_cast<uint32_t>(toInt32(b)) & 31;
+    if (op == "|") return makeNumber(x | toInt32(b), techniques);
+    if (op == "^") return makeNumber(x ^ toInt32(b), techniques);
+    if (op == "&") return makeNumber(x & toInt32(b), techniques);
+    if (op == "<<") return makeNumber(static_cast<int32_t>(static_cast<uint32_t>(x) << shift), techniques);
+    if (op == ">>") return makeNumber(x >> shift, techniques);
+    if (op == ">>>") return makeNumber(static_cast<uint32_t>(x) >> shift, techniques);
+    return std::nullopt;
+}
+
+std::optional<Value> Evaluator::member(const Value& object, const std::string& name) {
+    static const std::unordered_set<std::string> STRING_METHODS = {
+        "split", "charAt", "charCodeAt", "substr", "substring", "slice", "toLowerCase", "toUpperCase",
+        "trim", "concat", "replace", "replaceAll", "indexOf", "repeat", "toString"
+    };
+    static const std::unordered_set<std::string> ARRAY_METHODS = {
+        "reverse", "join", "concat", "slice", "map", "toString"
+    };
+
+    switch (object.kind) {
+    case Value::Kind::String:
+        if (name == "length") return makeNumber(static_cast<double>(object.str.size()), object.techniques);
+        if (!STRING_METHODS.count(name)) return std::nullopt;
+        break;
+    case Value::Kind::Array:
+        if (name == "length") return makeNumber(static_cast<double>(object.array->size()), object.techniques);
+        if (!ARRAY_METHODS.count(name)) return std::nullopt;
+        break;
+    case Value::Kind::Builtin:
+        if ((object.str == "String" && name == "fromCharCode") ||
+            (object.str == "String.fromCharCode" && (name == "apply" || name == "call"))) {
+            return makeNamed(Value::Kind::Builtin, object.str + "." + name);
+        }
+        return std::nullopt;
+    default:
+        return std::nullopt;
+    }
+
+    Value method = makeNamed(Value::Kind::Method, name);
+    method.receiver = std::make_shared<Value>(object);
+    return method;
+}
+
+std::optional<Value> Evaluator::index(const Value& object, const Value& key) {
+    double n = NAN;
+    if (key.kind == Value::Kind::Number) {
+        n = key.number;
+    } else if (key.kind == Value::Kind::String && !key.str.empty() &&
+               std::all_of(key.str.begin(), key.str.end(), [](unsigned char c) { return std::isdigit(c) != 0; })) {
+        n = stringToNumber(key.str);
+    } else if (key.kind == Value::Kind::String) {
+        return member(object, key.str);     // 'abc'['split']('')
+    }
+    if (std::isnan(n) || n < 0 || n != std::floor(n)) return std::nullopt;
+    size_t i = static_cast<size_t>(n);
+
+    if (object.kind == Value::Kind::String) {
+        if (i >= object.str.size()) return std::nullopt;
+        return makeString(std::string(1, object.str[i]), object.techniques | key.techniques | Technique::StringMethod);
+    }
+    if (object.kind == Value::Kind::Array) {
+        if (i >= object.array->size()) return std::nullopt;
+        Value element = (*object.array)[i];
+        if (element.kind == Value::Kind::String) element.techniques |= Technique::StringArray;
+        element.techniques |= key.techniques;
+        return element;
+    }
+    return std::nullopt;
+}
+
+std::optional<Value> Evaluator::call(const Value& callee, std::vector<Value>& args) {
+    switch (callee.kind) {
+    case Value::Kind::Method: return callMethod(callee, args);
+    case Value::Kind::Builtin: return callBuiltin(callee.str, args);
+    case Value::Kind::Function: return callFunction(callee.function, args);
+    default: return std::nullopt;
+    }
+}
+
+std::optional<Value> Evaluator::callMethod(const Value& method, std::vector<Value>& args) {
+    const Value& receiver = *method.receiver;
+    const std::string& name = method.str;
+    auto arg = [&](size_t i) -> const Value* { return i < args.size() ? &args[i] : nullptr; };
+    uint32_t techniques = receiver.techniques;
+    for (const Value& a : args) techniques |= a.techniques;
+
+    if (receiver.kind == Value::Kind::String) {
+        const std::string& s = receiver.str;
+        if (name == "split") {
+            auto array = std::make_shared<std::vector<Value>>();
+            if (!arg(0)) {
+                array->push_back(makeString(s));
+            } else {
+                auto sep = toStringValue(*arg(0));
+                if (!sep) return std::nullopt;
+                if (sep->empty()) {
+                    for (char c : s) array->push_back(makeString(std::string(1, c)));
+                } else {
+                    size_t from = 0;
+                    for (size_t at; (at = s.find(*sep, from)) != std::string::npos; from = at + sep->size()) {
+                        array->push_back(makeString(s.substr(from, at - from)));
+                    }
+                    array->push_back(makeString(s.substr(from)));
+                }
+            }
+            return makeArray(std::move(array), techniques | Technique::Reverse);
+        }
+        if (name == "charAt") {
+            size_t i = clampIndex(arg(0) ? toNumber(*arg(0)) : 0, s.size());
+            return makeString(i < s.size() ? std::string(1, s[i]) : "", techniques | Technique::StringMethod);
+        }
+        if (name == "charCodeAt") {
+            size_t i = clampIndex(arg(0) ? toNumber(*arg(0)) : 0, s.size());
+            return makeNumber(i < s.size() ? static_cast<unsigned char>(s[i]) : NAN, techniques);
+        }
+        if (name == "substr") {
+            size_t start = relativeIndex(arg(0) ? toNumber(*arg(0)) : 0, s.size());
+            size_t length = arg(1) ? clampIndex(toNumber(*arg(1)), s.size()) : s.size();
+            return makeString(s.substr(start, length), techniques | Technique::StringMethod);
+        }
+        if (name == "substring") {
+            size_t a = clampIndex(arg(0) ? toNumber(*arg(0)) : 0, s.size());
+            size_t b = arg(1) ? clampIndex(toNumber(*arg(1)), s.size()) : s.size();
+            if (a > b) std::swap(a, b);
+            return makeString(s.substr(a, b - a), techniques | Technique::StringMethod);
+        }
+        if (name == "slice") {
+            size_t a = relativeIndex(arg(0) ? toNumber(*arg(0)) : 0, s.size());
+            size_t b = arg(1) ? relativeIndex(toNumber(*arg(1)), s.size()) : s.size();
+            return makeString(a < b ? s.substr(a, b - a) : "", techniques | Technique::StringMethod);
+        }
+        if (name == "toLowerCase" || name == "toUpperCase") {
+            std::string out = s;
+            bool lower = name == "toLowerCase";
+            for (char& c : out) c = static_cast<char>(lower ? std::tolower(static_cast<unsigned char>(c)) : std::toupper(static_cast<unsigned char>(c)));
+            return makeString(std::move(out), techniques | Technique::StringMethod);
+        }
+        if (name == "trim") return makeString(trimmed(s), techniques | Technique::StringMethod);
+        if (name == "toString") return makeString(s, techniques);
+        if (name == "concat") {
+            std::string out = s;
+            for (const Value& a : args) {
+                auto part = toStringValue(a);
+                if (!part) return std::nullopt;
+                out += *part;
+            }
+            if (out.size() > StaticStringEvaluator::MAX_STRING_LENGTH) return std::nullopt;
+            return makeString(std::move(out), techniques | Technique::Concat);
+        }
+        if (name == "replace" || name == "replaceAll") {
+            // 문자열 패턴 + 문자열 치환만 (regex / 콜백은 불투명)
+            if (!arg(0) || !arg(1) || arg(0)->kind != Value::Kind::String) return std::nullopt;
+            auto replacement = toStringValue(*arg(1));
+            if (!replacement) return std::nullopt;
+            const std::string& pattern = arg(0)->str;
+            std::string out = s;
+            if (!pattern.empty()) {
+                size_t from = 0;
+                for (size_t at; (at = out.find(pattern, from)) != std::string::npos;) {
+                    out.replace(at, pattern.size(), *replacement);
+                    from = at + replacement->size();
+                    if (name == "replace" || out.size() > StaticStringEvaluator::MAX_STRING_LENGTH) break;
+                }
+            }
+            return makeString(std::move(out), techniques | Technique::StringMethod);
+        }
+        if (name == "indexOf") {
+            auto needle = arg(0) ? toStringValue(*arg(0)) : std::nullopt;
+            if (!needle) return std::nullopt;
+            size_t at = s.find(*needle);
+            return makeNumber(at == std::string::npos ? -1.0 : static_cast<double>(at), techniques);
+        }
+        if (name == "repeat") {
+            double count = arg(0) ? toNumber(*arg(0)) : 0;
+            if (!(count >= 0) || count > MAX_REPEAT || s.size() * static_cast<size_t>(count) > StaticStringEvaluator::MAX_STRING_LENGTH) {
+                return std::nullopt;
+            }
+            std::string out;
+            for (size_t i = 0; i < static_cast<size_t>(count); ++i) out += s;
+            return makeString(std::move(out), techniques | Technique::StringMethod);
+        }
+        return std::nullopt;
+    }
+
+    if (receiver.kind == Value::Kind::Array) {
+        const ArrayPtr& array = receiver.array;
+        if (name == "reverse") {
+            std::reverse(array->begin(), array->end());
+            return makeArray(array, techniques | Technique::Reverse);
+        }
+        if (name == "join" || name == "toString") {
+            std::string sep = ",";
+            if (name == "join" && arg(0) && arg(0)->kind != Value::Kind::Null) {
+                auto s = toStringValue(*arg(0));
+                if (!s) return std::nullopt;
+                sep = *s;
+            }
+            std::string out;
+            uint32_t elementTechniques = 0;
+            for (size_t i = 0; i < array->size(); ++i) {
+                if (i) out += sep;
+                const Value& element = (*array)[i];
+                elementTechniques |= element.techniques;
+                if (element.kind == Value::Kind::Null) continue;
+                auto s = toStringValue(element);
+                if (!s) return std::nullopt;
+                out += *s;
+                if (out.size() > StaticStringEvaluator::MAX_STRING_LENGTH) return std::nullopt;
+            }
+            return makeString(std::move(out), techniques | elementTechniques | Technique::Concat);
+        }
+        if (name == "concat") {
+            auto out = std::make_shared<std::vector<Value>>(*array);
+            for (const Value& a : args) {
+                if (a.kind == Value::Kind::Array) out->insert(out->end(), a.array->begin(), a.array->end());
+                else out->push_back(a);
+            }
+            return makeArray(std::move(out), techniques);
+        }
+        if (name == "slice") {
+            size_t a = relativeIndex(arg(0) ? toNumber(*arg(0)) : 0, array->size());
+            size_t b = arg(1) ? relativeIndex(toNumber(*arg(1)), array->size()) : array->size();
+            auto out = std::make_shared<std::vector<Value>>();
+            if (a < b) out->assign(array->begin() + a, array->begin() + b);
+            return makeArray(std::move(out), techniques);
+        }
+        if (name == "map") {
+            if (!arg(0) || arg(0)->kind != Value::Kind::Function) return std::nullopt;
+            int fn = arg(0)->function;
+            auto out = std::make_shared<std::vector<Value>>();
+            out->reserve(array->size());
+            for (size_t i = 0; i < array->size(); ++i) {
+                std::vector<Value> callArgs{(*array)[i], makeNumber(static_cast<double>(i))};
+                auto mapped = callFunction(fn, callArgs);
+                if (!mapped) return std::nullopt;
+                out->push_back(std::move(*mapped));
+            }
+            return makeArray(std::move(out), techniques | Technique::FunctionCall);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Value> Evaluator::callBuiltin(const std::string& name, std::vector<Value>& args) {
+    uint32_t techniques = 0;
+    for (const Value& a : args) techniques |= a.techniques;
+
+    if (name == "String.fromCharCode.apply" || name == "String.fromCharCode.call") {
+        std::vector<Value> codes;
+        if (name == "String.fromCharCode.apply") {
+            if (args.size() < 2 || args[1].kind != Value::Kind::Array) return std::nullopt;
+            codes = *args[1].array;
+        } else if (!args.empty()) {
+            codes.assign(args.begin() + 1, args.end());
+        }
+        return callBuiltin("String.fromCharCode", codes);
+    }
+    if (name == "String.fromCharCode") {
+        std::string out;
+        out.reserve(args.size());
+        for (const Value& a : args) {
+            appendCodeUnit(out, static_cast<uint32_t>(toInt32(toNumber(a))) & 0xFFFF);
+        }
+        return makeString(std::move(out), techniques | Technique::FromCharCode);
+    }
+    if (args.empty()) return std::nullopt;
+    auto text = toStringValue(args[0]);
+    if (!text) return std::nullopt;
+
+    if (name == "String") return makeString(*text, techniques);
+    if (name == "atob") return makeString(Base64Utils::decode(*text), techniques | Technique::Decode);
+    if (name == "unescape") return makeString(percentDecode(*text, true), techniques | Technique::Decode);
+    if (name == "decodeURIComponent" || name == "decodeURI") {
+        return makeString(percentDecode(*text, false), techniques | Technique::Decode);
+    }
+    if (name == "parseInt") {
+        int radix = args.size() > 1 ? toInt32(toNumber(args[1])) : 0;
+        return makeNumber(jsParseInt(*text, radix), techniques);
+    }
+    return std::nullopt;
+}
+
+std::optional<Value> Evaluator::callFunction(int id, std::vector<Value>& args) {
+    if (id < 0 || static_cast<size_t>(id) >= functions_.size() || callDepth_ >= MAX_CALL_DEPTH) return std::nullopt;
+    DepthGuard guard(callDepth_);
+    classify(functions_[id]);
+    const FunctionInfo& fn = functions_[id];
+
+    switch (fn.role) {
+    case FunctionInfo::Role::ArrayProvider:
+        return makeArray(fn.array);
+    case FunctionInfo::Role::Accessor: {
+        if (args.empty()) return std::nullopt;
+        double i = toNumber(args[0]) - fn.offset;
+        if (!(i >= 0) || i != std::floor(i) || i >= static_cast<double>(fn.array->size())) return std::nullopt;
+        Value element = (*fn.array)[static_cast<size_t>(i)];
+        element.techniques |= Technique::StringArray;
+        if (fn.base64Strings && element.kind == Value::Kind::String) {
+            // obfuscator.io base64 배열: 소문자 우선 알파벳 → 대소문자 교환 후 표준 디코딩
+            std::string swapped = element.str;
+            for (char& c : swapped) {
+                unsigned char u = static_cast<unsigned char>(c);
+                c = static_cast<char>(std::islower(u) ? std::toupper(u) : std::tolower(u));
+            }
+            element.str = Base64Utils::decode(swapped);
+            element.techniques |= Technique::Decode;
+        }
+        return element;
+    }
+    case FunctionInfo::Role::Plain: {
+        BindingScope scope(env_);
+        for (size_t i = 0; i < fn.params.size(); ++i) {
+            scope.bind(fn.params[i], i < args.size() ? args[i] : Value{});
+        }
+        size_t pos = fn.returnBegin;
+        auto result = parseExpression(pos);
+        if (!result) return std::nullopt;
+        bool complete = fn.expressionBody ? pos == fn.bodyEnd : (isPunct(pos, ";") || pos == fn.bodyEnd);
+        if (!complete) return std::nullopt;
+        result->techniques |= Technique::FunctionCall;
+        return result;
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+ArrayPtr Evaluator::resolveArray(const Value& v) {
+    if (v.kind == Value::Kind::Array) return v.array;
+    if (v.kind == Value::Kind::Function) {
+        classify(functions_[v.function]);
+        const FunctionInfo& fn = functions_[v.function];
+        if (fn.role == FunctionInfo::Role::ArrayProvider) return fn.array;
+    }
+    return nullptr;
+}
+
+// 본문 모양으로 역할 결정
+// - ArrayProvider: 첫 문장이 상수 배열 선언 (function _0x2b3c(){ var a = ['..']; ...; return ...; })
+// - Accessor: "p = p - 0x1d2" (또는 p -= N) + 배열 / 배열 제공 함수 참조
+// - Plain: 식 본문 또는 "{ return 식; }"
+void Evaluator::classify(FunctionInfo& fn) {
+    if (fn.role != FunctionInfo::Role::Unclassified) return;
+    fn.role = FunctionInfo::Role::Classifying;     // 자기 참조 분류 순환 방지
+
+    if (fn.expressionBody) {
+        fn.returnBegin = fn.bodyBegin;
+        fn.role = FunctionInfo::Role::Plain;
+        return;
+    }
+
+    const size_t begin = fn.bodyBegin;
+    const size_t end = fn.bodyEnd;
+    auto isParam = [&](const std::string& name) {
+        return std::find(fn.params.begin(), fn.params.end(), name) != fn.params.end();
+    };
+
+    if ((isIdent(begin, "var") || isIdent(begin, "let") || isIdent(begin, "const")) &&
+        tok(begin + 1).type == TokenType::Identifier && isPunct(begin + 2, "=") && isPunct(begin + 3, "[")) {
+        size_t pos = begin + 3;
+        auto array = parsePrimary(pos);
+        if (array && array->kind == Value::Kind::Array && !array->array->empty() &&
+            std::all_of(array->array->begin(), array->array->end(), [](const Value& v) {
+                return v.kind == Value::Kind::String || v.kind == Value::Kind::Number;
+            })) {
+            fn.array = array->array;
+            fn.role = FunctionInfo::Role::ArrayProvider;
+            return;
+        }
+    }
+
+    bool hasOffset = false;
+    bool rc4 = false;
+    for (size_t i = begin; i < end; ++i) {
+        const Token& t = tokens_[i];
+        if (!hasOffset && t.type == TokenType::Identifier) {
+            if (isPunct(i + 1, "=") && tok(i + 2).text == t.text && isPunct(i + 3, "-") && tok(i + 4).type == TokenType::Number) {
+                fn.offset = tok(i + 4).number;
+                hasOffset = true;
+            } else if (isPunct(i + 1, "-=") && tok(i + 2).type == TokenType::Number) {
+                fn.offset = tok(i + 2).number;
+                hasOffset = true;
+            }
+        }
+        if (t.type == TokenType::String && t.text.rfind(OBFUSCATOR_BASE64_ALPHABET, 0) == 0) fn.base64Strings = true;
+        if (t.type == TokenType::Number && t.number == 256) rc4 = true;     // RC4 키 스케줄 (미지원)
+        if (!fn.array && t.type == TokenType::Identifier && !isParam(t.text) && !isPunct(i - 1, ".")) {
+            auto it = env_.find(t.text);
+            if (it != env_.end() && (it->second.kind == Value::Kind::Array || it->second.kind == Value::Kind::Function) &&
+                !(it->second.kind == Value::Kind::Function && &functions_[it->second.function] == &fn)) {
+                ArrayPtr array = resolveArray(it->second);
+                if (array && !array->empty()) fn.array = array;
+            }
+        }
+    }
+    if (hasOffset && fn.array && !rc4) {
+        fn.role = FunctionInfo::Role::Accessor;
+        return;
+    }
+    fn.array.reset();
+
+    if (isIdent(begin, "return")) {
+        fn.returnBegin = begin + 1;
+        fn.role = FunctionInfo::Role::Plain;
+        return;
+    }
+    fn.role = FunctionInfo::Role::Opaque;
+}
+
+// ----------------------------------------------------------------------------
+// 문장 단위 스캔
+// ----------------------------------------------------------------------------
+void Evaluator::hoistDeclarations() {
+    for (size_t i = 0; i < tokens_.size(); ++i) {
+        if (!isIdent(i, "function") || tok(i + 1).type != TokenType::Identifier || !isPunct(i + 2, "(")) continue;
+        // 함수 선언만 (이름 있는 함수 식은 제외)
+        if (i > 0) {
+            const Token& prev = tokens_[i - 1];
+            bool expression = prev.type == TokenType::Punct && prev.text != ";" && prev.text != "}" && prev.text != "{" && prev.text != ")";
+            if (expression || (prev.type == TokenType::Identifier && prev.text == "return")) continue;
+        }
+        size_t pos = i;
+        if (auto id = parseFunction(pos)) {
+            Value fn = makeNamed(Value::Kind::Function, "");
+            fn.function = *id;
+            env_[tok(i + 1).text] = fn;
+        }
+    }
+}
+
+void Evaluator::handleFunctionKeyword(size_t i) {
+    bool anonymous = isPunct(i + 1, "(");
+    if (!anonymous) return;     // 선언은 hoistDeclarations 에서 바인딩
+    if (!(isPunct(i - 1, "(") || isPunct(i - 1, "!") || isPunct(i - 1, "~") || isPunct(i - 1, "+"))) return;
+
+    // IIFE: (function(a, b){...}(X, N)) 또는 (function(a, b){...})(X, N)
+    size_t pos = i;
+    auto id = parseFunction(pos);
+    if (!id) return;
+    if (isPunct(pos, ")") && isPunct(pos + 1, "(")) ++pos;
+    if (!isPunct(pos, "(")) return;
+
+    std::vector<Value> args;
+    if (parseArguments(pos, args)) tryRotation(*id, args);
+}
+
+// push(shift()) 회전 IIFE 를 재현
+// - 체크섬 없음: 두 번째 인자만큼 회전
+// - parseInt 체크섬: 본문의 체크섬 식이 두 번째 인자와 같아질 때까지 한 칸씩 회전
+void Evaluator::tryRotation(int id, std::vector<Value>& args) {
+    if (args.size() < 2 || args[1].kind != Value::Kind::Number) return;
+    ArrayPtr array = resolveArray(args[0]);
+    if (!array || array->size() < 2) return;
+
+    const FunctionInfo fn = functions_[id];
+    bool hasPush = false, hasShift = false, hasParseInt = false;
+    for (size_t i = fn.bodyBegin; i < fn.bodyEnd; ++i) {
+        const Token& t = tokens_[i];
+        if (t.type != TokenType::Identifier && t.type != TokenType::String) continue;
+        hasPush |= t.text == "push";
+        hasShift |= t.text == "shift";
+        hasParseInt |= t.type == TokenType::Identifier && t.text == "parseInt";
+    }
+    if (!hasPush || !hasShift) return;
+
+    if (!hasParseInt) {
+        size_t count = static_cast<size_t>(std::fmod(std::fabs(args[1].number), static_cast<double>(array->size())));
+        std::rotate(array->begin(), array->begin() + count, array->end());
+        result_.stringArrays++;
+        return;
+    }
+
+    BindingScope scope(env_);
+    for (size_t i = 0; i < fn.params.size() && i < args.size(); ++i) scope.bind(fn.params[i], args[i]);
+
+    // 본문의 단순 별칭 선언 (var f = _0x3f1a, arr = _0x2b3c();) 과 체크섬 식 위치
+    size_t checksumBegin = std::string::npos;
+    for (size_t p = fn.bodyBegin; p < fn.bodyEnd; ++p) {
+        if (!isPunct(p, "=") || tok(p - 1).type != TokenType::Identifier) continue;
+        size_t q = p + 1;
+        size_t statementEnd = skipExpression(q);
+        bool usesParseInt = false;
+        for (size_t k = q; k < statementEnd; ++k) usesParseInt |= isIdent(k, "parseInt");
+        if (usesParseInt) {
+            checksumBegin = q;
+            break;
+        }
+        if (auto v = parseExpression(q)) scope.bind(tok(p - 1).text, *v);
+    }
+    if (checksumBegin == std::string::npos) return;
+
+    const double target = args[1].number;
+    std::vector<Value> original = *array;
+    for (size_t attempt = 0; attempt < original.size(); ++attempt) {
+        size_t pos = checksumBegin;
+        auto checksum = parseExpression(pos);
+        if (checksum && checksum->kind == Value::Kind::Number && checksum->number == target) {
+            result_.stringArrays++;
+            return;
+        }
+        if (steps_ > maxSteps_) break;
+        std::rotate(array->begin(), array->begin() + 1, array->end());
+    }
+    *array = std::move(original);   // 체크섬 불일치: 원래 순서 유지
+}
+
+size_t Evaluator::handleAssignment(size_t i) {
+    const std::string& op = tokens_[i].text;
+    bool simpleTarget = i > 0 && tokens_[i - 1].type == TokenType::Identifier &&
+                        !(i > 1 && (isPunct(i - 2, ".") || isPunct(i - 2, "?.")));
+    if (!simpleTarget) return tryRecordExpression(i + 1);
+
+    const std::string name = tokens_[i - 1].text;
+
+    // 자기 자신을 재정의하는 memoization 패턴 (_0x2b3c = function(){ return a; }) 은 무시
+    if (op == "=" && isIdent(i + 1, "function")) {
+        auto it = env_.find(name);
+        if (it != env_.end() && it->second.kind == Value::Kind::Function) {
+            const FunctionInfo& current = functions_[it->second.function];
+            if (!current.expressionBody && current.bodyBegin <= i && i < current.bodyEnd) return i;
+        }
+    }
+
+    size_t pos = i + 1;
+    auto value = parseExpression(pos);
+    if (!value || !atTerminator(pos)) {
+        env_.erase(name);
+        return i;
+    }
+    if (op == "+=") {
+        auto it = env_.find(name);
+        value = it == env_.end() ? std::nullopt : applyBinary("+", it->second, *value);
+        if (!value) {
+            env_.erase(name);
+            return i;
+        }
+    }
+    env_[name] = *value;
+    if (value->kind == Value::Kind::String && value->techniques) record(name, *value, tok(i + 1).offset);
+
+    // 함수 본문이 있으면 안쪽 문장도 스캔해야 하므로 건너뛰지 않음
+    return rangeHasFunction(i + 1, pos) ? i : pos - 1;
+}
+
+// 기록용 이름: eval(...) → "eval()", window[...] → "window[]", 그 외 "expr@offset"
+std::string Evaluator::expressionName(size_t start) const {
+    const Token& open = tok(start - 1);
+    if ((open.text == "(" || open.text == "[") && start >= 2 && tok(start - 2).type == TokenType::Identifier) {
+        return tok(start - 2).text + (open.text == "(" ? "()" : "[]");
+    }
+    return (open.text == "return" ? "return@" : "expr@") + std::to_string(tok(start).offset);
+}
+
+size_t Evaluator::tryRecordExpression(size_t start) {
+    size_t pos = start;
+    auto value = parseExpression(pos);
+    if (!value || pos == start || !atTerminator(pos)) return start - 1;
+    if (value->kind == Value::Kind::String && value->techniques) record(expressionName(start), *value, tok(start).offset);
+    return rangeHasFunction(start, pos) ? start - 1 : pos - 1;
+}
+
+void Evaluator::record(const std::string& name, const Value& value, size_t offset) {
+    if (result_.strings.size() >= StaticStringEvaluator::MAX_RESOLVED || value.str.size() < 2) return;
+    if (!recorded_.insert(value.str).second) return;
+    StaticStringEvaluator::ResolvedString resolved;
+    resolved.name = name;
+    resolved.value = value.str;
+    resolved.techniques = value.techniques;
+    resolved.offset = offset;
+    result_.strings.push_back(std::move(resolved));
+}
+
+void Evaluator::run() {
+    hoistDeclarations();
+
+    for (size_t i = 0; i < tokens_.size(); ++i) {
+        if (steps_ > maxSteps_) {
+            result_.truncated = true;
+            break;
+        }
+        const Token& t = tokens_[i];
+        if (t.type == TokenType::Identifier) {
+            if (t.text == "function") handleFunctionKeyword(i);
+            else if (t.text == "return") i = tryRecordExpression(i + 1);
+            continue;
+        }
+        if (t.type != TokenType::Punct) continue;
+
+        if (t.text == "=" || t.text == "+=") {
+            i = handleAssignment(i);
+        } else if (t.text == "(" || t.text == "[" || t.text == "," || t.text == ":" || t.text == "?" || t.text == "=>") {
+            // 호출 인자 / 계산된 속성 / 배열 원소 등 식이 시작되는 위치
+            i = tryRecordExpression(i + 1);
+        }
+    }
+}
+
+} // namespace
+
+std::string StaticStringEvaluator::ResolvedString::describeTechniques() const {
+    static const std::pair<uint32_t, const char*> NAMES[] = {
+        {Concat, "concat"}, {FromCharCode, "fromCharCode"}, {StringArray, "string_array"},
+        {Reverse, "reverse"}, {Decode, "decode"}, {FunctionCall, "function"}, {StringMethod, "string_method"}
+    };
+    std::string out;
+    for (const auto& [bit, name] : NAMES) {
+        if (techniques & bit) {
+            if (!out.empty()) out += '+';
+            out += name;
+        }
+    }
+    return out;
+}
+
+StaticStringEvaluator::Result StaticStringEvaluator::evaluate(std::string_view code) {
+    Result result;
+    std::vector<Token> tokens;
+    result.truncated = !tokenize(code, tokens);
+    result.tokens = tokens.size();
+
+    Evaluator evaluator(std::move(tokens), result);
+    evaluator.run();
+    return result;
+}
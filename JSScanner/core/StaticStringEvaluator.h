@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 🔥 문자열 조립 난독화 정적 부분 평가기 (스크립트를 실행하지 않음)
+// - 토큰 스트림 위에서 상수 전파 + 상수 접기: 리터럴 연결, String.fromCharCode(배열),
+//   split('').reverse().join(''), atob / unescape, 한 줄 return 함수 호출
+// - _0x 문자열 배열: 배열 제공 함수 / 접근 함수(index - offset) / push(shift()) 회전 IIFE
+//   (회전 횟수 인자 방식과 parseInt 체크섬 방식 모두)
+// - 동적 실행이 거부된 블록(대용량, 런타임 손상 등)에서도 조립된 문자열을 복원해
+//   DynamicStringTracker 와 정적 탐지 규칙에 전달
+class StaticStringEvaluator {
+public:
+    static constexpr size_t MAX_TOKENS = 1000000;
+    static constexpr size_t MAX_RESOLVED = 5000;
+    static constexpr size_t MAX_STRING_LENGTH = 1024 * 1024;
+
+    // 복원에 사용된 기법 (비트 조합)
+    enum Technique : uint32_t {
+        Concat = 1u << 0,           // 'ev' + 'al', +=, concat()
+        FromCharCode = 1u << 1,     // String.fromCharCode(...)
+        StringArray = 1u << 2,      // _0x 배열 접근 함수
+        Reverse = 1u << 3,          // split / reverse / join
+        Decode = 1u << 4,           // atob / unescape / decodeURIComponent
+        FunctionCall = 1u << 5,     // 사용자 정의 한 줄 함수 / map 콜백
+        StringMethod = 1u << 6      // substr / slice / replace / charAt ...
+    };
+
+    struct ResolvedString {
+        std::string name;           // 대입된 변수명, 또는 "eval()" / "window[]" / "expr@offset"
+        std::string value;
+        uint32_t techniques = 0;
+        size_t offset = 0;          // 소스 내 식 시작 위치
+
+        // 예: "fromCharCode+reverse"
+        std::string describeTechniques() const;
+    };
+
+    struct Result {
+        std::vector<ResolvedString> strings;
+        size_t tokens = 0;
+        size_t stringArrays = 0;    // 회전까지 복원한 _0x 배열 수
+        bool truncated = false;     // 토큰 / 평가 예산 초과로 중단
+    };
+
+    static Result evaluate(std::string_view code);
+};
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "StringDeobfuscator.h"
 #include "../parser/js/UrlCollector.h" // For URL_PATTERN
+#include "../builtin/helpers/Base64Utils.h"
+#include "BruteForceDecoder.h"
 
 // Initialize static sensitive functions
 const std::set<std::string> StringDeobfuscator::SENSITIVE_FUNCTIONS = {
@@ -64,11 +66,19 @@ bool StringDeobfuscator::isLikelyPlaintext(const std::string& str) {
 
 std::vector<std::string> StringDeobfuscator::tryCommonXorKeys(const std::string& encoded) {
     std::vector<std::string> results;
+
+    // 🔥 키 공간 전체 (단일/반복 XOR, ROT, shift) 탐색 결과를 가장 앞에
+    BruteForceDecoder decoder;
+    if (auto candidate = decoder.tryDecode(encoded)) {
+        results.push_back(candidate->decoded);
+    }
+
+    // 짧은 문자열 등 엔진 대상이 아닌 입력을 위한 기존 고정 키
     int commonKeys[] = {0x69, 0x42, 0xFF, 0x55, 0xAA};
     
     for (int key : commonKeys) {
         std::string decoded = tryXorDecode(encoded, key);
-        if (isLikelyPlaintext(decoded)) {
+        if (isLikelyPlaintext(decoded) && std::find(results.begin(), results.end(), decoded) == results.end()) {
             results.push_back(decoded);
         }
     }
@@ -98,7 +108,7 @@ bool StringDeobfuscator::looksLikeHex(const std::string& str) {
 bool StringDeobfuscator::looksLikeBase64(const std::string& str) {
     if (str.length() < 4) return false;
     // Basic check for Base64 characters and padding
-    return RE2::FullMatch(str, "[A-Za-z0-9+/]+={0,2}");
+    return Base64Utils::isBase64(str, 2);
 }
 
 std::string StringDeobfuscator::tryReverse(const std::string& str) {
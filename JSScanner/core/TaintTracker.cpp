@@ -3,7 +3,7 @@
 
 // debug_taint 함수
 static void debug_taint(const std::string& message) {
-    core::Log_Debug("%s[TAINT] %s", logMsg.c_str(), message.c_str());
+    SCAN_LOG_DEBUG("%s[TAINT] %s", logMsg.c_str(), message.c_str());
 }
 
 TaintTracker::TaintTracker() {
@@ -1,6 +1,7 @@
 // VariableScanner.cpp - 전역 변수 스캐너 구현
 #include "pch.h"
 #include "VariableScanner.h"
+#include "../builtin/helpers/Base64Utils.h"
 #include <algorithm>
 
 // JavaScript 키워드
@@ -23,92 +24,203 @@ const std::vector<std::string> VariableScanner::MALICIOUS_PATTERNS = {
     ".vbs", ".bat", "CreateObject", "Execute", "WScript.Shell"
 };
 
+// 내장 객체 (검사 제외)
+static bool isBuiltinGlobalName(const std::string& varName) {
+    return varName == "window" || varName == "document" ||
+           varName == "navigator" || varName == "console" ||
+           varName == "Math" || varName == "JSON" ||
+           varName == "Array" || varName == "Object" ||
+           varName == "String" || varName == "Number";
+}
+
+static std::string atomToString(JSContext* ctx, JSAtom atom) {
+    const char* name_cstr = JS_AtomToCString(ctx, atom);
+    if (!name_cstr) return "";
+    std::string name = name_cstr;
+    JS_FreeCString(ctx, name_cstr);
+    return name;
+}
+
+// 부모 항목 id 와 atom 으로 속성 key 생성 (최상위는 부모 id 0 = atom 그대로)
+static uint64_t childKey(uint32_t parentId, JSAtom atom) {
+    return (static_cast<uint64_t>(parentId) << 32) | atom;
+}
+
+void GlobalScanState::release(JSRuntime* rt) {
+    for (auto& [key, entry] : entries) {
+        JS_FreeValueRT(rt, entry.held);
+        entry.held = JS_UNDEFINED;
+    }
+    entries.clear();
+    nextId = 1;
+}
+
 std::vector<ScannedVariable> VariableScanner::scanGlobalVariables(JSContext* ctx) {
+    // 상태 없이 호출하면 모든 전역 변수를 새 값으로 보고 검사
+    GlobalScanState state;
+    state.maxNestedDepth = 0;
+    std::vector<ScannedVariable> results = scanGlobalVariables(ctx, state);
+    state.release(JS_GetRuntime(ctx));
+    return results;
+}
+
+std::vector<ScannedVariable> VariableScanner::scanGlobalVariables(JSContext* ctx, GlobalScanState& state) {
     std::vector<ScannedVariable> results;
-    
+
+    state.epoch++;
+    state.lastVisited = 0;
+    state.lastExamined = 0;
+
     // 전역 객체 가져오기
     JSValue global = JS_GetGlobalObject(ctx);
-    
+    size_t budget = state.nestedBudget;
+    scanObject(ctx, global, 0, "", 0, state, budget, results);
+    JS_FreeValue(ctx, global);
+
+    // 오래 보이지 않은 항목 정리 (삭제된 변수, 예산 밖 중첩 속성)
+    const uint32_t STALE_EPOCHS = 64;
+    if (state.epoch % STALE_EPOCHS == 0) {
+        for (auto it = state.entries.begin(); it != state.entries.end();) {
+            if (state.epoch - it->second.lastSeenEpoch >= STALE_EPOCHS) {
+                JS_FreeValue(ctx, it->second.held);
+                it = state.entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    return results;
+}
+
+void VariableScanner::scanObject(JSContext* ctx, JSValueConst obj, uint32_t parentId, const std::string& prefix,
+                                 int depth, GlobalScanState& state, size_t& budget,
+                                 std::vector<ScannedVariable>& results) {
     // 모든 속성 이름 가져오기
     JSPropertyEnum* props;
     uint32_t prop_count;
-    
-    if (JS_GetOwnPropertyNames(ctx, &props, &prop_count, global, 
+
+    if (JS_GetOwnPropertyNames(ctx, &props, &prop_count, obj,
         JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
-        JS_FreeValue(ctx, global);
-        return results;
+        return;
     }
-    
+
     // 각 속성 검사
     for (uint32_t i = 0; i < prop_count; i++) {
         JSAtom atom = props[i].atom;
-        const char* name_cstr = JS_AtomToCString(ctx, atom);
-        if (!name_cstr) continue;
-        
-        std::string varName = name_cstr;
-        JS_FreeCString(ctx, name_cstr);
-        
-        // 내장 객체 제외
-        if (varName == "window" || varName == "document" || 
-            varName == "navigator" || varName == "console" ||
-            varName == "Math" || varName == "JSON" ||
-            varName == "Array" || varName == "Object" ||
-            varName == "String" || varName == "Number") {
+
+        if (depth > 0) {
+            if (budget == 0) break;
+            budget--;
+        }
+        state.lastVisited++;
+
+        auto [it, isNew] = state.entries.try_emplace(childKey(parentId, atom));
+        GlobalScanState::Entry& entry = it->second;
+        entry.lastSeenEpoch = state.epoch;
+
+        if (isNew) {
+            entry.id = state.nextId++;
+            entry.name = prefix + atomToString(ctx, atom);
+            entry.ignored = entry.name.empty() || (depth == 0 && isBuiltinGlobalName(entry.name));
+        }
+        if (entry.ignored) {
             continue;
         }
-        
-        // 속성 값 가져오기
-        JSValue val = JS_GetProperty(ctx, global, atom);
-        
-        // 문자열인 경우만 검사
+
+        // 중첩 객체는 데이터 속성만 (getter 실행 방지)
+        JSValue val;
+        if (depth > 0) {
+            JSPropertyDescriptor desc;
+            int has = JS_GetOwnProperty(ctx, &desc, obj, atom);
+            if (has <= 0) {
+                continue;
+            }
+            JS_FreeValue(ctx, desc.getter);
+            JS_FreeValue(ctx, desc.setter);
+            if (desc.flags & JS_PROP_GETSET) {
+                JS_FreeValue(ctx, desc.value);
+                continue;
+            }
+            val = desc.value;
+        } else {
+            val = JS_GetProperty(ctx, obj, atom);
+        }
+
+        // held 가 참조를 잡고 있으므로 같은 주소면 같은 (불변) 문자열
+        bool sameIdentity = !isNew && JS_IsString(val) && JS_IsString(entry.held) &&
+                            JS_VALUE_GET_PTR(entry.held) == JS_VALUE_GET_PTR(val);
+
         if (JS_IsString(val)) {
-            const char* str_cstr = JS_ToCString(ctx, val);
-            if (str_cstr) {
-                std::string value = str_cstr;
-                JS_FreeCString(ctx, str_cstr);
-                
-                // 최소 길이 체크 (너무 짧은 문자열 제외)
-                if (value.length() >= 20) {
-                    ScannedVariable scanned;
-                    scanned.name = varName;
-                    scanned.value = value;
-                    
-                    // JavaScript 코드인지 확인
-                    if (looksLikeJavaScript(value)) {
-                        scanned.type = "potential_js";
-                        scanned.suspicionLevel = calculateSuspicionLevel(value);
-                        results.push_back(scanned);
-                    }
-                    // Base64인지 확인
-                    else if (looksLikeBase64(value) && value.length() > 100) {
-                        scanned.type = "base64";
-                        scanned.suspicionLevel = 5; // Base64는 중간 위험도
-                        results.push_back(scanned);
+            // 동일한 문자열 객체면 변환 없이 건너뜀
+            if (!sameIdentity) {
+                // 다른 문자열 객체라도 내용이 같으면 변환 없이 건너뜀
+                bool sameContent = !isNew && JS_IsString(entry.held) && JS_IsStrictEqual(ctx, entry.held, val);
+                size_t len = 0;
+                const char* str_cstr = sameContent ? nullptr : JS_ToCStringLen(ctx, &len, val);
+                if (str_cstr) {
+                    std::string value(str_cstr, len);
+                    JS_FreeCString(ctx, str_cstr);
+
+                    // atom 재사용 가능성이 있으므로 값이 바뀌면 이름도 다시 확인
+                    if (!isNew) {
+                        entry.name = prefix + atomToString(ctx, atom);
                     }
-                    // 악성 패턴 확인
-                    else {
-                        int suspicion = calculateSuspicionLevel(value);
-                        if (suspicion >= 7) {
-                            scanned.type = "malicious_pattern";
-                            scanned.suspicionLevel = suspicion;
-                            results.push_back(scanned);
-                        }
+                    state.lastExamined++;
+                    ScannedVariable scanned;
+                    if (classifyValue(entry.name, value, scanned)) {
+                        results.push_back(std::move(scanned));
                     }
                 }
             }
+        } else if (JS_IsObject(val) && depth < state.maxNestedDepth && !JS_IsFunction(ctx, val)) {
+            // 객체 내용은 identity 로 판단할 수 없으므로 매번 내려가되 예산으로 제한
+            scanObject(ctx, val, entry.id, entry.name + ".", depth + 1, state, budget, results);
+        }
+
+        if (!sameIdentity) {
+            JS_FreeValue(ctx, entry.held);
+            entry.held = JS_IsString(val) ? JS_DupValue(ctx, val) : JS_UNDEFINED;
         }
-        
         JS_FreeValue(ctx, val);
     }
-    
+
     // 정리
     for (uint32_t i = 0; i < prop_count; i++) {
         JS_FreeAtom(ctx, props[i].atom);
     }
     js_free(ctx, props);
-    JS_FreeValue(ctx, global);
-    
-    return results;
+}
+
+bool VariableScanner::classifyValue(const std::string& name, const std::string& value, ScannedVariable& out) {
+    // 최소 길이 체크 (너무 짧은 문자열 제외)
+    if (value.length() < 20) {
+        return false;
+    }
+
+    out.name = name;
+    out.value = value;
+
+    // JavaScript 코드인지 확인
+    if (looksLikeJavaScript(value)) {
+        out.type = "potential_js";
+        out.suspicionLevel = calculateSuspicionLevel(value);
+        return true;
+    }
+    // Base64인지 확인
+    if (looksLikeBase64(value) && value.length() > 100) {
+        out.type = "base64";
+        out.suspicionLevel = 5; // Base64는 중간 위험도
+        return true;
+    }
+    // 악성 패턴 확인
+    int suspicion = calculateSuspicionLevel(value);
+    if (suspicion >= 7) {
+        out.type = "malicious_pattern";
+        out.suspicionLevel = suspicion;
+        return true;
+    }
+    return false;
 }
 
 bool VariableScanner::looksLikeJavaScript(const std::string& str) {
@@ -158,8 +270,7 @@ bool VariableScanner::looksLikeBase64(const std::string& str) {
     if (str.length() < 4) return false;
 
     // Base64 문자만 포함 (A-Z, a-z, 0-9, +, /, =)
-    RE2 base64Pattern("^[A-Za-z0-9+/]+=*$");
-    return RE2::FullMatch(str, base64Pattern);
+    return Base64Utils::isBase64(str);
 }
 
 int VariableScanner::calculateSuspicionLevel(const std::string& str) {
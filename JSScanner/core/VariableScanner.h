@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <cstdint>
 #include "quickjs.h"
 
 struct ScannedVariable {
@@ -12,10 +14,43 @@ struct ScannedVariable {
     int suspicionLevel; // 1-10
 };
 
+// 🔥 증분 스캔 상태 (블록 간 유지)
+// - 속성별 (atom, 값 identity, 값 내용)을 기억해 새로 생기거나 바뀐 값만 검사
+// - 문자열 값은 참조를 보관해 identity 를 비교 (해제 후 같은 주소 재사용 방지) → JS_FreeRuntime 전에 release()
+//   identity 가 다르면 보관한 문자열과 내용을 직접 비교 (hash 충돌로 바뀐 값을 놓치지 않음)
+// - key 는 (부모 항목 id, atom) - 항목 id 는 재사용하지 않으므로 서로 다른 경로가 같은 key 가 되지 않음
+// - 중첩 객체는 maxNestedDepth 까지, 스캔 1회당 nestedBudget 개 속성까지만 내려감
+struct GlobalScanState {
+    struct Entry {
+        std::string name;           // 전체 경로 (예: "cfg.payload")
+        JSValue held = JS_UNDEFINED; // 마지막으로 검사한 문자열 (참조 보관 = identity)
+        uint32_t id = 0;            // 중첩 속성 key 의 부모 id (0 = 전역 객체)
+        uint32_t lastSeenEpoch = 0;
+        bool ignored = false;       // 내장 객체 등 검사 제외 대상
+    };
+
+    int maxNestedDepth = 1;
+    size_t nestedBudget = 256;
+
+    std::unordered_map<uint64_t, Entry> entries;
+    uint32_t nextId = 1;
+    uint32_t epoch = 0;
+
+    // 마지막 스캔 통계
+    size_t lastVisited = 0;
+    size_t lastExamined = 0;
+
+    // 보관 중인 문자열 참조 해제 (JS_FreeRuntime 전에 호출)
+    void release(JSRuntime* rt);
+};
+
 class VariableScanner {
 public:
     // QuickJS 전역 객체의 모든 변수를 스캔
     static std::vector<ScannedVariable> scanGlobalVariables(JSContext* ctx);
+
+    // 이전 스캔 이후 새로 생기거나 값이 바뀐 변수만 검사
+    static std::vector<ScannedVariable> scanGlobalVariables(JSContext* ctx, GlobalScanState& state);
     
     // 문자열이 JavaScript 코드인지 판단
     static bool looksLikeJavaScript(const std::string& str);
@@ -27,6 +62,13 @@ public:
     static int calculateSuspicionLevel(const std::string& str);
     
 private:
+    // 문자열 값 분류 (검사 대상이면 true)
+    static bool classifyValue(const std::string& name, const std::string& value, ScannedVariable& out);
+
+    static void scanObject(JSContext* ctx, JSValueConst obj, uint32_t parentId, const std::string& prefix,
+                           int depth, GlobalScanState& state, size_t& budget,
+                           std::vector<ScannedVariable>& results);
+
     // JavaScript 키워드 목록
     static const std::vector<std::string> JS_KEYWORDS;
     
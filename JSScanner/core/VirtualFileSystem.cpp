@@ -0,0 +1,381 @@
+#include "pch.h"
+#include "VirtualFileSystem.h"
+#include "Sha256.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace {
+
+struct EnvVar {
+    const char* name;       // 소문자
+    const char* value;
+};
+
+// 분석 대상이 보는 고정 환경 (실제 호스트 값은 노출하지 않음)
+constexpr EnvVar ENVIRONMENT[] = {
+    { "temp",            "C:\\Users\\user\\AppData\\Local\\Temp" },
+    { "tmp",             "C:\\Users\\user\\AppData\\Local\\Temp" },
+    { "appdata",         "C:\\Users\\user\\AppData\\Roaming" },
+    { "localappdata",    "C:\\Users\\user\\AppData\\Local" },
+    { "userprofile",     "C:\\Users\\user" },
+    { "public",          "C:\\Users\\Public" },
+    { "programdata",     "C:\\ProgramData" },
+    { "allusersprofile", "C:\\ProgramData" },
+    { "programfiles",    "C:\\Program Files" },
+    { "windir",          "C:\\Windows" },
+    { "systemroot",      "C:\\Windows" },
+    { "comspec",         "C:\\Windows\\system32\\cmd.exe" },
+    { "systemdrive",     "C:" },
+    { "homedrive",       "C:" },
+    { "homepath",        "\\Users\\user" },
+    { "username",        "user" },
+    { "computername",    "DESKTOP-1" },
+};
+
+constexpr const char* WORKING_DIRECTORY = "c:\\users\\user";
+
+std::string toLower(std::string_view text) {
+    std::string out(text);
+    for (char& c : out) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return out;
+}
+
+bool startsWith(std::string_view data, std::string_view prefix) {
+    return data.size() >= prefix.size() && data.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool hasDrive(std::string_view path) {
+    return path.size() >= 2 && std::isalpha(static_cast<unsigned char>(path[0])) && path[1] == ':';
+}
+
+std::string_view baseName(std::string_view path) {
+    size_t slash = path.find_last_of('\\');
+    return slash == std::string_view::npos ? path : path.substr(slash + 1);
+}
+
+// 명령줄 토큰 (큰따옴표 안의 공백은 유지, 셸 구분자에서 끊음)
+std::vector<std::string> splitCommandLine(std::string_view commandLine) {
+    std::vector<std::string> tokens;
+    std::string current;
+    bool quoted = false;
+    for (char c : commandLine) {
+        if (c == '"') {
+            quoted = !quoted;
+            continue;
+        }
+        if (!quoted && (std::isspace(static_cast<unsigned char>(c)) || c == '&' || c == '|' ||
+                        c == '<' || c == '>' || c == ',' || c == ';' || c == '\'')) {
+            if (!current.empty()) tokens.push_back(std::move(current));
+            current.clear();
+            continue;
+        }
+        current.push_back(c);
+    }
+    if (!current.empty()) tokens.push_back(std::move(current));
+    return tokens;
+}
+
+bool containsNoCase(std::string_view haystack, std::string_view needle) {
+    auto it = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end(),
+        [](char a, char b) {
+            return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+        });
+    return it != haystack.end();
+}
+
+}  // namespace
+
+void VirtualFileSystem::appendTo(Buffer& buffer, std::string_view data) {
+    // makeBuffer() 로 만든 non-const string 이므로 단독 소유일 때 const 를 벗겨도 안전
+    if (buffer && buffer.use_count() == 1) {
+        std::const_pointer_cast<std::string>(buffer)->append(data);
+        return;
+    }
+    auto next = std::make_shared<std::string>();
+    next->reserve((buffer ? buffer->size() : 0) + data.size());
+    if (buffer) next->append(*buffer);
+    next->append(data);
+    buffer = std::move(next);
+}
+
+std::string VirtualFileSystem::expandEnvironment(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t open = text.find('%', pos);
+        if (open == std::string_view::npos) break;
+        size_t close = text.find('%', open + 1);
+        if (close == std::string_view::npos) break;
+
+        std::string name = toLower(text.substr(open + 1, close - open - 1));
+        const EnvVar* found = nullptr;
+        for (const auto& var : ENVIRONMENT) {
+            if (name == var.name) {
+                found = &var;
+                break;
+            }
+        }
+        out.append(text.substr(pos, open - pos));
+        if (found) {
+            out.append(found->value);
+            pos = close + 1;
+        } else {
+            // 알 수 없는 변수: '%' 하나만 넘기고 닫는 '%' 를 다음 변수의 시작으로 재사용
+            out.push_back('%');
+            pos = open + 1;
+        }
+    }
+    out.append(text.substr(pos));
+    return out;
+}
+
+std::string VirtualFileSystem::tempFolder() {
+    return ENVIRONMENT[0].value;
+}
+
+std::string VirtualFileSystem::normalizePath(std::string_view path) {
+    std::string raw = toLower(expandEnvironment(path));
+    // 앞뒤 공백 / 따옴표 제거
+    size_t begin = raw.find_first_not_of(" \t\r\n\"");
+    if (begin == std::string::npos) return {};
+    size_t end = raw.find_last_not_of(" \t\r\n\"");
+    raw = raw.substr(begin, end - begin + 1);
+    std::replace(raw.begin(), raw.end(), '/', '\\');
+
+    if (startsWith(raw, "file:\\\\\\")) raw.erase(0, 8);
+    else if (startsWith(raw, "file:\\\\")) raw.erase(0, 7);
+    if (startsWith(raw, "\\\\?\\")) raw.erase(0, 4);
+
+    std::string prefix;
+    std::string_view rest = raw;
+    if (startsWith(raw, "\\\\")) {
+        prefix = "\\\\";                                    // UNC
+        rest.remove_prefix(2);
+    } else if (hasDrive(raw)) {
+        prefix = raw.substr(0, 2);
+        rest.remove_prefix(2);
+    } else if (startsWith(raw, "\\")) {
+        prefix = "c:";                                      // 현재 드라이브 기준
+    } else {
+        prefix = "c:";
+        raw = std::string(WORKING_DIRECTORY + 2) + "\\" + raw;
+        rest = raw;
+    }
+
+    std::vector<std::string_view> parts;
+    size_t pos = 0;
+    while (pos <= rest.size()) {
+        size_t next = rest.find('\\', pos);
+        if (next == std::string_view::npos) next = rest.size();
+        std::string_view part = rest.substr(pos, next - pos);
+        if (part == "..") {
+            if (!parts.empty()) parts.pop_back();
+        } else if (!part.empty() && part != ".") {
+            parts.push_back(part);
+        }
+        pos = next + 1;
+    }
+
+    std::string out = prefix;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        if (i > 0 || prefix != "\\\\") out.push_back('\\');
+        out.append(parts[i]);
+    }
+    if (parts.empty() && prefix != "\\\\") out.push_back('\\');
+    return out;
+}
+
+VirtualFileSystem::File* VirtualFileSystem::lookup(std::string_view path) {
+    auto it = files_.find(normalizePath(path));
+    return it == files_.end() ? nullptr : &it->second;
+}
+
+size_t VirtualFileSystem::admit(size_t oldSize, size_t newSize, bool* truncated) {
+    size_t available = MAX_TOTAL_BYTES - (totalBytes_ - oldSize);
+    size_t allowed = std::min({ newSize, MAX_FILE_BYTES, available });
+    *truncated = allowed < newSize;
+    if (*truncated) limitReached_ = true;
+    return allowed;
+}
+
+bool VirtualFileSystem::writeFile(std::string_view path, Buffer data, const char* writer) {
+    std::string key = normalizePath(path);
+    if (key.empty()) return false;
+    if (!data) data = makeBuffer({});
+
+    auto it = files_.find(key);
+    if (it == files_.end()) {
+        if (files_.size() >= MAX_FILES) {
+            limitReached_ = true;
+            return false;
+        }
+        it = files_.emplace(std::move(key), File{ std::string(path) }).first;
+    }
+
+    File& file = it->second;
+    size_t oldSize = file.data ? file.data->size() : 0;
+    bool truncated = false;
+    size_t keep = admit(oldSize, data->size(), &truncated);
+    if (truncated) {
+        data = makeBuffer(data->substr(0, keep));
+    }
+    totalBytes_ = totalBytes_ - oldSize + data->size();
+    file.data = std::move(data);
+    file.writer = writer ? writer : "";
+    file.writes++;
+    file.truncated = truncated;
+    file.sha256.clear();
+    return true;
+}
+
+bool VirtualFileSystem::appendFile(std::string_view path, std::string_view data, const char* writer) {
+    File* file = lookup(path);
+    if (!file) {
+        return writeFile(path, makeBuffer(std::string(data)), writer);
+    }
+
+    size_t oldSize = file->data ? file->data->size() : 0;
+    bool truncated = false;
+    size_t keep = admit(oldSize, oldSize + data.size(), &truncated);
+    if (keep > oldSize) {
+        appendTo(file->data, data.substr(0, keep - oldSize));
+    }
+    totalBytes_ = totalBytes_ - oldSize + (file->data ? file->data->size() : 0);
+    file->writer = writer ? writer : "";
+    file->writes++;
+    file->truncated = file->truncated || truncated;
+    file->sha256.clear();
+    return true;
+}
+
+VirtualFileSystem::Buffer VirtualFileSystem::readFile(std::string_view path) const {
+    auto it = files_.find(normalizePath(path));
+    if (it == files_.end()) return nullptr;
+    return it->second.data ? it->second.data : makeBuffer({});
+}
+
+bool VirtualFileSystem::exists(std::string_view path) const {
+    return files_.count(normalizePath(path)) > 0;
+}
+
+bool VirtualFileSystem::deleteFile(std::string_view path) {
+    auto it = files_.find(normalizePath(path));
+    if (it == files_.end()) return false;
+    totalBytes_ -= it->second.data ? it->second.data->size() : 0;
+    files_.erase(it);
+    return true;
+}
+
+bool VirtualFileSystem::copyFile(std::string_view from, std::string_view to, bool overwrite) {
+    File* source = lookup(from);
+    if (!source) return false;
+    if (!overwrite && exists(to)) return false;
+    // 버퍼를 공유하므로 내용 복사 없음 (이후 어느 쪽이든 추가하면 그때 분리)
+    return writeFile(to, source->data, "FileSystemObject.CopyFile");
+}
+
+bool VirtualFileSystem::moveFile(std::string_view from, std::string_view to) {
+    std::string source = normalizePath(from);
+    std::string target = normalizePath(to);
+    auto it = files_.find(source);
+    if (it == files_.end() || target.empty() || files_.count(target)) return false;
+    if (source == target) return true;
+
+    auto node = files_.extract(it);
+    node.key() = std::move(target);
+    node.mapped().writer = "FileSystemObject.MoveFile";
+    files_.insert(std::move(node));
+    return true;
+}
+
+std::vector<std::string> VirtualFileSystem::recordCommand(const char* api, std::string_view commandLine) {
+    std::vector<std::string> matched;
+    auto addMatch = [&](const std::string& key, File& file) {
+        if (std::find(matched.begin(), matched.end(), key) != matched.end()) return;
+        file.executed = true;
+        matched.push_back(key);
+    };
+
+    for (const std::string& token : splitCommandLine(expandEnvironment(commandLine))) {
+        std::string key = normalizePath(token);
+        auto it = files_.find(key);
+        if (it != files_.end()) {
+            addMatch(it->first, it->second);
+            continue;
+        }
+        // 디렉터리 없는 이름 ("payload.exe") 은 어느 폴더에 떨어뜨렸든 파일 이름으로 맞춤
+        if (token.find_first_of("\\/:") != std::string::npos) continue;
+        std::string name = toLower(token);
+        for (auto& [path, file] : files_) {
+            if (baseName(path) == name) {
+                addMatch(path, file);
+            }
+        }
+    }
+
+    if (commands_.size() < MAX_COMMANDS) {
+        commands_.push_back(Command{ api ? api : "", std::string(commandLine), matched });
+    } else {
+        limitReached_ = true;
+    }
+    return matched;
+}
+
+std::vector<VirtualFileSystem::Artifact> VirtualFileSystem::artifacts() const {
+    std::vector<Artifact> out;
+    out.reserve(files_.size());
+    for (const auto& [path, file] : files_) {
+        Artifact artifact;
+        std::string_view content = file.data ? std::string_view(*file.data) : std::string_view();
+        artifact.path = path;
+        artifact.originalPath = file.path;
+        artifact.writer = file.writer;
+        if (file.sha256.empty()) file.sha256 = Sha256::hex(content);
+        artifact.sha256 = file.sha256;
+        artifact.type = sniffType(content);
+        artifact.size = content.size();
+        artifact.truncated = file.truncated;
+        artifact.executed = file.executed;
+        artifact.data = file.data;
+        out.push_back(std::move(artifact));
+    }
+    return out;
+}
+
+std::string VirtualFileSystem::sniffType(std::string_view data) {
+    if (data.empty()) return "empty";
+
+    static constexpr std::pair<std::string_view, const char*> MAGIC[] = {
+        { std::string_view("MZ", 2), "pe" },
+        { std::string_view("\x7f" "ELF", 4), "elf" },
+        { std::string_view("PK\x03\x04", 4), "zip" },
+        { std::string_view("\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8), "ole" },
+        { std::string_view("%PDF", 4), "pdf" },
+        { std::string_view("{\\rtf", 5), "rtf" },
+    };
+    for (const auto& [magic, type] : MAGIC) {
+        if (startsWith(data, magic)) return type;
+    }
+
+    // 앞부분만 보고 텍스트 / 스크립트 / 바이너리 판단
+    std::string_view head = data.substr(0, 4096);
+    size_t control = 0;
+    for (unsigned char c : head) {
+        if (c == 0) return "binary";
+        if (c < 0x20 && c != '\t' && c != '\r' && c != '\n' && c != '\f') ++control;
+    }
+    if (control * 10 > head.size()) return "binary";
+
+    static constexpr std::string_view SCRIPT_MARKERS[] = {
+        "#!", "@echo", "<script", "powershell", "wscript", "cscript", "createobject",
+        "function", "var ", "dim ", "set-", "invoke-",
+    };
+    for (std::string_view marker : SCRIPT_MARKERS) {
+        if (containsNoCase(head, marker)) return "script";
+    }
+    return "text";
+}
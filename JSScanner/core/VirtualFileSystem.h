@@ -0,0 +1,101 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 🔥 Task 단위 가상 파일시스템 (ActiveX FileSystemObject / ADODB.Stream / WScript.Shell)
+// - 경로는 Windows 규칙으로 정규화 (대소문자 무시, '/' → '\', %TEMP% 등 환경 변수 확장, . / .. 처리)
+// - 내용은 공유 버퍼: 읽기 / CopyFile / LoadFromFile 은 참조만 넘기고, 쓰는 쪽이 copy-on-write
+// - 파일 수 / 전체 크기 / 파일 하나 크기 한도를 넘는 쓰기는 잘라서 저장하고 truncated 표시
+// - Run / Exec 명령줄의 토큰을 가상 파일과 맞춰 실행된 산출물을 기록
+// - 단일 스레드 (Task 컨텍스트에서만 사용)
+class VirtualFileSystem {
+public:
+    // 읽기 전용으로 공유하는 내용 - makeBuffer() 로만 생성 (appendTo 가 단독 소유일 때 제자리 추가)
+    using Buffer = std::shared_ptr<const std::string>;
+
+    static Buffer makeBuffer(std::string data) { return std::make_shared<std::string>(std::move(data)); }
+    // copy-on-write 추가 (buffer 를 호출자만 갖고 있으면 복사 없음)
+    static void appendTo(Buffer& buffer, std::string_view data);
+
+    static constexpr size_t MAX_FILES = 512;
+    static constexpr size_t MAX_FILE_BYTES = 32 * 1024 * 1024;
+    static constexpr size_t MAX_TOTAL_BYTES = 64 * 1024 * 1024;
+    static constexpr size_t MAX_COMMANDS = 256;
+
+    struct File {
+        std::string path;           // 처음 쓴 경로 (표시용, 정규화 전)
+        Buffer data;
+        std::string writer;         // 마지막으로 쓴 API ("TextStream.Close", "ADODB.Stream.SaveToFile" ...)
+        uint32_t writes = 0;
+        bool truncated = false;
+        bool executed = false;      // Run / Exec 명령줄에서 참조됨
+        mutable std::string sha256; // artifacts() 에서 계산해 두고 쓰기 시 비움
+    };
+
+    struct Artifact {
+        std::string path;           // 정규화된 가상 경로
+        std::string originalPath;
+        std::string writer;
+        std::string sha256;
+        std::string type;           // sniffType() 결과
+        size_t size = 0;
+        bool truncated = false;
+        bool executed = false;
+        Buffer data;
+    };
+
+    struct Command {
+        std::string api;            // "WScript.Shell.Run" ...
+        std::string commandLine;
+        std::vector<std::string> files;     // 명령줄에서 찾은 가상 파일 (정규화 경로)
+    };
+
+    VirtualFileSystem() = default;
+    VirtualFileSystem(const VirtualFileSystem&) = delete;
+    VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+    static std::string normalizePath(std::string_view path);
+    // %TEMP% / %APPDATA% 등 (알 수 없는 변수는 그대로)
+    static std::string expandEnvironment(std::string_view text);
+    static std::string tempFolder();
+
+    // 내용 교체 (data 는 공유 - 복사하지 않음)
+    bool writeFile(std::string_view path, Buffer data, const char* writer);
+    // 끝에 추가 (다른 곳에서 공유 중인 버퍼면 복사 후 추가)
+    bool appendFile(std::string_view path, std::string_view data, const char* writer);
+    // 없으면 nullptr
+    Buffer readFile(std::string_view path) const;
+    bool exists(std::string_view path) const;
+    bool deleteFile(std::string_view path);
+    bool copyFile(std::string_view from, std::string_view to, bool overwrite);
+    bool moveFile(std::string_view from, std::string_view to);
+
+    // 명령을 기록하고 명령줄에 나온 가상 파일 목록 반환 (정규화 경로)
+    std::vector<std::string> recordCommand(const char* api, std::string_view commandLine);
+
+    // 정규화 경로 순 (sha256 은 내용이 바뀐 파일만 다시 계산)
+    std::vector<Artifact> artifacts() const;
+    const std::vector<Command>& commands() const { return commands_; }
+
+    size_t fileCount() const { return files_.size(); }
+    size_t totalBytes() const { return totalBytes_; }
+    bool limitReached() const { return limitReached_; }
+
+    // 매직 바이트 / 내용 기반 형식 ("pe", "zip", "ole", "pdf", "elf", "rtf", "script", "text", "binary", "empty")
+    static std::string sniffType(std::string_view data);
+
+private:
+    File* lookup(std::string_view path);
+    // 한도 안에서 저장할 수 있는 길이
+    size_t admit(size_t oldSize, size_t newSize, bool* truncated);
+
+    std::map<std::string, File> files_;     // 정규화 경로 → 파일
+    std::vector<Command> commands_;
+    size_t totalBytes_ = 0;
+    bool limitReached_ = false;
+};
@@ -0,0 +1,592 @@
+#include "pch.h"
+#include "WasmModuleParser.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+enum class Leb { Ok, Truncated, Malformed };
+
+// 범위 검사 바이트 리더 - 실패하면 이후 읽기도 모두 실패
+struct Reader {
+    const uint8_t* p;
+    const uint8_t* end;
+
+    Reader(const uint8_t* data, size_t size) : p(data), end(data + size) {}
+
+    size_t remaining() const { return static_cast<size_t>(end - p); }
+
+    bool byte(uint8_t& out) {
+        if (p >= end) return false;
+        out = *p++;
+        return true;
+    }
+
+    bool skip(uint64_t n) {
+        if (n > remaining()) return false;
+        p += n;
+        return true;
+    }
+
+    Leb leb(uint64_t& out, unsigned maxBytes) {
+        uint64_t value = 0;
+        for (unsigned i = 0; i < maxBytes; ++i) {
+            if (p + i >= end) return Leb::Truncated;
+            uint8_t b = p[i];
+            value |= static_cast<uint64_t>(b & 0x7F) << (7 * i);
+            if ((b & 0x80) == 0) {
+                p += i + 1;
+                out = value;
+                return Leb::Ok;
+            }
+        }
+        return Leb::Malformed;
+    }
+
+    bool u32(uint32_t& out) {
+        uint64_t value = 0;
+        if (leb(value, 5) != Leb::Ok || value > UINT32_MAX) return false;
+        out = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    bool u64(uint64_t& out) { return leb(out, 10) == Leb::Ok; }
+
+    bool skipLeb(unsigned maxBytes) {
+        uint64_t ignored = 0;
+        return leb(ignored, maxBytes) == Leb::Ok;
+    }
+
+    bool name(std::string& out) {
+        uint32_t len = 0;
+        if (!u32(len) || len > remaining()) return false;
+        out.assign(reinterpret_cast<const char*>(p), len);
+        p += len;
+        return true;
+    }
+
+    // vec 개수 - 원소는 최소 1바이트이므로 남은 길이보다 크면 변조
+    bool count(uint32_t& out) { return u32(out) && out <= remaining(); }
+};
+
+// valtype (ref null / ref 는 heaptype 이 뒤따름)
+bool skipValType(Reader& r) {
+    uint8_t type = 0;
+    if (!r.byte(type)) return false;
+    if (type == 0x63 || type == 0x64) return r.skipLeb(5);
+    return true;
+}
+
+// limits: flags(bit0 = max 존재, bit2 = memory64) min [max]
+bool readLimits(Reader& r, uint64_t& min) {
+    uint8_t flags = 0;
+    if (!r.byte(flags) || flags > 0x07) return false;
+    if (!r.u64(min)) return false;
+    return (flags & 0x01) == 0 || r.skipLeb(10);
+}
+
+// memarg: align [memidx (align bit6)] offset
+bool skipMemArg(Reader& r) {
+    uint32_t align = 0;
+    if (!r.u32(align)) return false;
+    if ((align & 0x40) && !r.skipLeb(5)) return false;
+    return r.skipLeb(10);
+}
+
+bool skipFcImmediates(Reader& r) {
+    uint32_t sub = 0;
+    if (!r.u32(sub)) return false;
+    switch (sub) {
+    case 0: case 1: case 2: case 3: case 4: case 5: case 6: case 7:     // trunc_sat
+        return true;
+    case 8:                     // memory.init data mem
+    case 10:                    // memory.copy mem mem
+    case 12:                    // table.init elem table
+    case 14:                    // table.copy table table
+        return r.skipLeb(5) && r.skipLeb(5);
+    case 9: case 11: case 13: case 15: case 16: case 17:
+        return r.skipLeb(5);
+    default:
+        return false;
+    }
+}
+
+bool skipSimdImmediates(Reader& r) {
+    uint32_t sub = 0;
+    if (!r.u32(sub)) return false;
+    if (sub <= 11 || sub == 92 || sub == 93) return skipMemArg(r);        // v128.load* / store / load*_zero
+    if (sub == 12 || sub == 13) return r.skip(16);                         // v128.const / i8x16.shuffle
+    if (sub >= 21 && sub <= 34) return r.skip(1);                          // extract / replace lane
+    if (sub >= 84 && sub <= 91) return skipMemArg(r) && r.skip(1);         // load / store lane
+    return true;                                                           // 나머지 산술은 immediate 없음
+}
+
+bool skipAtomicImmediates(Reader& r) {
+    uint32_t sub = 0;
+    if (!r.u32(sub)) return false;
+    if (sub == 0x03) return r.skip(1);                                     // atomic.fence
+    if (sub <= 0x02 || (sub >= 0x10 && sub <= 0x4E)) return skipMemArg(r);
+    return false;
+}
+
+// opcode 뒤의 immediate 를 건너뜀 (알 수 없는 opcode / 잘린 immediate 는 false)
+bool skipImmediates(Reader& r, uint8_t op) {
+    if (op >= 0x45 && op <= 0xC4) return true;        // 비교 / 산술 / 변환
+    if (op >= 0x28 && op <= 0x3E) return skipMemArg(r);
+
+    switch (op) {
+    case 0x00: case 0x01: case 0x05: case 0x0A: case 0x0B: case 0x0F:
+    case 0x19: case 0x1A: case 0x1B: case 0xD1: case 0xD3: case 0xD4:
+        return true;
+    case 0x02: case 0x03: case 0x04: case 0x06:         // block / loop / if / try: blocktype (s33)
+        return r.skipLeb(5);
+    case 0x07: case 0x08: case 0x09: case 0x0C: case 0x0D: case 0x10: case 0x12:
+    case 0x14: case 0x15: case 0x18: case 0x20: case 0x21: case 0x22: case 0x23:
+    case 0x24: case 0x25: case 0x26: case 0x3F: case 0x40: case 0xD2: case 0xD5: case 0xD6:
+        return r.skipLeb(5);
+    case 0x11: case 0x13:                               // call_indirect type table
+        return r.skipLeb(5) && r.skipLeb(5);
+    case 0x0E: {                                        // br_table vec(label) default
+        uint32_t n = 0;
+        if (!r.count(n)) return false;
+        for (uint32_t i = 0; i <= n; ++i) {
+            if (!r.skipLeb(5)) return false;
+        }
+        return true;
+    }
+    case 0x1C: {                                        // select t*
+        uint32_t n = 0;
+        if (!r.count(n)) return false;
+        for (uint32_t i = 0; i < n; ++i) {
+            if (!skipValType(r)) return false;
+        }
+        return true;
+    }
+    case 0x1F: {                                        // try_table blocktype vec(catch)
+        uint32_t n = 0;
+        if (!r.skipLeb(5) || !r.count(n)) return false;
+        for (uint32_t i = 0; i < n; ++i) {
+            uint8_t kind = 0;
+            if (!r.byte(kind) || kind > 0x03) return false;
+            if (kind <= 0x01 && !r.skipLeb(5)) return false;
+            if (!r.skipLeb(5)) return false;
+        }
+        return true;
+    }
+    case 0x41: return r.skipLeb(5);                     // i32.const
+    case 0x42: return r.skipLeb(10);                    // i64.const
+    case 0x43: return r.skip(4);                        // f32.const
+    case 0x44: return r.skip(8);                        // f64.const
+    case 0xD0: return r.skipLeb(5);                     // ref.null heaptype
+    case 0xFC: return skipFcImmediates(r);
+    case 0xFD: return skipSimdImmediates(r);
+    case 0xFE: return skipAtomicImmediates(r);
+    default:
+        return false;                                   // GC(0xFB) / 예약 opcode
+    }
+}
+
+bool isBufferedSection(uint8_t id) {
+    return id >= 1 && id <= 7;      // type / import / function / table / memory / global / export
+}
+
+bool containsMinerName(std::string name) {
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    static const char* const NAMES[] = {"cryptonight", "cn_hash", "hash_cn", "cn_slow", "randomx", "coinhive", "cryptoloot"};
+    for (const char* n : NAMES) {
+        if (name.find(n) != std::string::npos) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+void WasmModuleParser::feed(const uint8_t* data, size_t size) {
+    if (state_ == State::Failed || state_ == State::Finished || size == 0) {
+        return;
+    }
+    summary_.byteSize += size;
+
+    // 남은 조각이 없으면 입력을 그대로 해석하고 끝나지 않은 꼬리만 보관
+    if (pending_.empty()) {
+        size_t used = consume(data, size);
+        if (state_ != State::Failed) {
+            pending_.assign(data + used, data + size);
+        }
+        return;
+    }
+
+    pending_.insert(pending_.end(), data, data + size);
+    size_t used = consume(pending_.data(), pending_.size());
+    if (state_ != State::Failed) {
+        pending_.erase(pending_.begin(), pending_.begin() + used);
+    }
+}
+
+size_t WasmModuleParser::consume(const uint8_t* data, size_t size) {
+    size_t offset = 0;
+    while (offset < size && state_ != State::Failed) {
+        size_t used = step(data + offset, size - offset);
+        if (used == 0) {
+            break;
+        }
+        offset += used;
+    }
+    return offset;
+}
+
+size_t WasmModuleParser::step(const uint8_t* data, size_t size) {
+    switch (state_) {
+    case State::Header: {
+        if (size < 8) return 0;
+        static const uint8_t MAGIC[4] = {0x00, 0x61, 0x73, 0x6D};
+        if (std::memcmp(data, MAGIC, 4) != 0) {
+            fail("bad magic");
+            return 0;
+        }
+        summary_.version = static_cast<uint32_t>(data[4]) | (static_cast<uint32_t>(data[5]) << 8) |
+                           (static_cast<uint32_t>(data[6]) << 16) | (static_cast<uint32_t>(data[7]) << 24);
+        if (summary_.version != 1) {
+            fail("unsupported version");
+            return 0;
+        }
+        state_ = State::SectionHeader;
+        return 8;
+    }
+
+    case State::SectionHeader: {
+        Reader r(data, size);
+        uint8_t id = 0;
+        uint64_t length = 0;
+        r.byte(id);
+        Leb st = r.leb(length, 5);
+        if (st == Leb::Truncated) return 0;
+        if (st == Leb::Malformed || length > UINT32_MAX) {
+            fail("malformed section size");
+            return 0;
+        }
+        if (id > 13) {
+            fail("unknown section id");
+            return 0;
+        }
+        sectionId_ = id;
+        sectionRemaining_ = length;
+        if (id == 10) {
+            state_ = State::CodeCount;
+        } else if (isBufferedSection(id)) {
+            if (length > MAX_BUFFERED_UNIT) {
+                fail("section too large");
+                return 0;
+            }
+            state_ = State::Section;
+        } else if (length > 0) {
+            state_ = State::Skip;
+        }
+        return size - r.remaining();
+    }
+
+    case State::Section: {
+        if (size < sectionRemaining_) return 0;
+        size_t length = static_cast<size_t>(sectionRemaining_);
+        parseSection(data, length);
+        if (state_ != State::Failed) {
+            state_ = State::SectionHeader;
+        }
+        return length;
+    }
+
+    case State::Skip: {
+        size_t n = static_cast<size_t>(std::min<uint64_t>(size, sectionRemaining_));
+        sectionRemaining_ -= n;
+        if (sectionRemaining_ == 0) {
+            state_ = State::SectionHeader;
+        }
+        return n;
+    }
+
+    case State::CodeCount: {
+        size_t limit = static_cast<size_t>(std::min<uint64_t>(size, sectionRemaining_));
+        Reader r(data, limit);
+        uint64_t count = 0;
+        Leb st = r.leb(count, 5);
+        if (st == Leb::Truncated && limit < sectionRemaining_) return 0;
+        if (st != Leb::Ok || count > UINT32_MAX || count > sectionRemaining_) {
+            fail("malformed code section");
+            return 0;
+        }
+        size_t used = limit - r.remaining();
+        sectionRemaining_ -= used;
+        bodiesRemaining_ = static_cast<uint32_t>(count);
+        summary_.codeBodyCount = bodiesRemaining_;
+        if (bodiesRemaining_ > 0) {
+            state_ = State::CodeBody;
+        } else if (sectionRemaining_ == 0) {
+            state_ = State::SectionHeader;
+        } else {
+            fail("trailing bytes in code section");
+        }
+        return used;
+    }
+
+    case State::CodeBody: {
+        size_t limit = static_cast<size_t>(std::min<uint64_t>(size, sectionRemaining_));
+        Reader r(data, limit);
+        uint64_t bodySize = 0;
+        Leb st = r.leb(bodySize, 5);
+        if (st == Leb::Truncated && limit < sectionRemaining_) return 0;
+        if (st != Leb::Ok) {
+            fail("malformed function body size");
+            return 0;
+        }
+        size_t header = limit - r.remaining();
+        if (bodySize > sectionRemaining_ - header) {
+            fail("function body exceeds code section");
+            return 0;
+        }
+        if (bodySize > MAX_BUFFERED_UNIT) {
+            fail("function body too large");
+            return 0;
+        }
+        if (r.remaining() < bodySize) return 0;
+
+        decodeBody(data + header, static_cast<size_t>(bodySize));
+        size_t used = header + static_cast<size_t>(bodySize);
+        sectionRemaining_ -= used;
+        if (--bodiesRemaining_ == 0) {
+            if (sectionRemaining_ != 0) {
+                fail("trailing bytes in code section");
+                return 0;
+            }
+            state_ = State::SectionHeader;
+        }
+        return used;
+    }
+
+    case State::Failed:
+    case State::Finished:
+        return 0;
+    }
+    return 0;
+}
+
+void WasmModuleParser::parseSection(const uint8_t* data, size_t size) {
+    Reader r(data, size);
+    uint32_t count = 0;
+    if (!r.count(count)) {
+        fail("malformed section");
+        return;
+    }
+
+    switch (sectionId_) {
+    case 1: {   // type: func 형식만 해석 (GC rec / sub 형식은 개수만)
+        summary_.typeCount = count;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint8_t form = 0;
+            if (!r.byte(form)) break;
+            if (form != 0x60) return;
+            for (int list = 0; list < 2; ++list) {
+                uint32_t n = 0;
+                if (!r.count(n)) {
+                    fail("malformed type section");
+                    return;
+                }
+                for (uint32_t j = 0; j < n; ++j) {
+                    if (!skipValType(r)) {
+                        fail("malformed type section");
+                        return;
+                    }
+                }
+            }
+        }
+        break;
+    }
+
+    case 2: {   // import: module name kind desc
+        summary_.importCount = count;
+        for (uint32_t i = 0; i < count; ++i) {
+            Import entry;
+            bool ok = r.name(entry.module) && r.name(entry.name) && r.byte(entry.kind);
+            uint64_t min = 0;
+            if (ok) {
+                switch (entry.kind) {
+                case KIND_FUNCTION:
+                    ok = r.skipLeb(5);
+                    summary_.importedFunctionCount++;
+                    break;
+                case KIND_TABLE:
+                    ok = skipValType(r) && readLimits(r, min);
+                    summary_.hasTable = true;
+                    break;
+                case KIND_MEMORY:
+                    ok = readLimits(r, min);
+                    if (ok && !summary_.hasMemory) {
+                        summary_.initialMemoryPages = min;
+                    }
+                    summary_.hasMemory = true;
+                    break;
+                case KIND_GLOBAL:
+                    ok = skipValType(r) && r.skip(1);
+                    break;
+                case KIND_TAG:
+                    ok = r.skip(1) && r.skipLeb(5);
+                    break;
+                default:
+                    ok = false;
+                    break;
+                }
+            }
+            if (!ok) {
+                fail("malformed import section");
+                return;
+            }
+            if (summary_.imports.size() < MAX_RECORDED_NAMES) {
+                summary_.imports.push_back(std::move(entry));
+            }
+        }
+        break;
+    }
+
+    case 3:     // function: typeidx 목록
+        summary_.functionCount = count;
+        break;
+
+    case 4:
+        summary_.hasTable |= count > 0;
+        break;
+
+    case 5: {
+        uint64_t min = 0;
+        if (count > 0 && !readLimits(r, min)) {
+            fail("malformed memory section");
+            return;
+        }
+        if (count > 0 && !summary_.hasMemory) {
+            summary_.initialMemoryPages = min;
+        }
+        summary_.hasMemory |= count > 0;
+        break;
+    }
+
+    case 7: {   // export: name kind index
+        summary_.exportCount = count;
+        for (uint32_t i = 0; i < count; ++i) {
+            Export entry;
+            if (!r.name(entry.name) || !r.byte(entry.kind) || !r.u32(entry.index)) {
+                fail("malformed export section");
+                return;
+            }
+            if (summary_.exports.size() < MAX_RECORDED_NAMES) {
+                summary_.exports.push_back(std::move(entry));
+            }
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void WasmModuleParser::decodeBody(const uint8_t* data, size_t size) {
+    if (decodedBytes_ >= MAX_DECODED_BYTES) {
+        summary_.undecodedBytes += size;
+        return;
+    }
+    decodedBytes_ += size;
+
+    Reader r(data, size);
+    uint32_t groups = 0;
+    bool ok = r.count(groups);
+    for (uint32_t i = 0; ok && i < groups; ++i) {
+        ok = r.skipLeb(5) && skipValType(r);
+    }
+    if (!ok) {
+        summary_.undecodedBytes += size;
+        return;
+    }
+
+    // 히스토그램은 지역 배열에 모은 뒤 한 번에 합산
+    std::array<uint64_t, 256> histogram{};
+    uint64_t instructions = 0;
+    while (r.remaining() > 0) {
+        uint8_t op = *r.p++;
+        if (!skipImmediates(r, op)) {
+            summary_.undecodedBytes += r.remaining() + 1;
+            break;
+        }
+        histogram[op]++;
+        instructions++;
+    }
+
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        summary_.opcodeHistogram[i] += histogram[i];
+    }
+    summary_.instructionCount += instructions;
+}
+
+void WasmModuleParser::fail(const char* reason) {
+    if (state_ == State::Failed) {
+        return;
+    }
+    state_ = State::Failed;
+    summary_.valid = false;
+    summary_.error = reason;
+    pending_.clear();
+    pending_.shrink_to_fit();
+}
+
+const WasmModuleParser::Summary& WasmModuleParser::finish() {
+    if (state_ == State::Failed || state_ == State::Finished) {
+        return summary_;
+    }
+    if (state_ == State::Header) {
+        fail("truncated header");
+    } else if (state_ != State::SectionHeader || !pending_.empty()) {
+        fail("truncated module");
+    } else if (summary_.functionCount != summary_.codeBodyCount) {
+        fail("function and code section counts differ");
+    } else {
+        state_ = State::Finished;
+        summary_.valid = true;
+    }
+    return summary_;
+}
+
+WasmModuleParser::Summary WasmModuleParser::parse(const uint8_t* data, size_t size) {
+    WasmModuleParser parser;
+    parser.feed(data, size);
+    parser.finish();
+    return std::move(parser.summary_);
+}
+
+WasmModuleParser::HashLoopProfile WasmModuleParser::profile(const Summary& summary) {
+    HashLoopProfile out;
+    const auto& h = summary.opcodeHistogram;
+    out.rotate = h[0x77] + h[0x78] + h[0x89] + h[0x8A];                 // i32/i64 rotl / rotr
+    out.xorOps = h[0x73] + h[0x85];
+    out.shift = h[0x74] + h[0x75] + h[0x76] + h[0x86] + h[0x87] + h[0x88];
+    out.add = h[0x6A] + h[0x7C];
+
+    if (summary.instructionCount > 0) {
+        double total = static_cast<double>(summary.instructionCount);
+        out.rotateDensity = out.rotate / total;
+        out.xorDensity = out.xorOps / total;
+        out.mixDensity = (out.rotate + out.xorOps + out.shift) / total;
+    }
+
+    for (const auto& e : summary.exports) {
+        out.minerExport |= containsMinerName(e.name);
+    }
+    for (const auto& i : summary.imports) {
+        out.minerExport |= containsMinerName(i.name);
+    }
+
+    // 해시 라운드: 회전이 꾸준히 나오고 xor / shift 가 명령어의 상당 비율
+    bool hashLoop = summary.instructionCount >= MIN_PROFILED_INSTRUCTIONS &&
+                    out.rotate >= 64 &&
+                    out.rotateDensity >= 0.004 &&
+                    out.xorDensity >= 0.03 &&
+                    out.mixDensity >= 0.08;
+    out.looksLikeMiner = out.minerExport || hashLoop;
+    return out;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 🔥 WebAssembly 바이너리 파서 (스트리밍, 범위 검사)
+// - 인스턴스화 없이 type / import / function / table / memory / export / code 섹션 해석
+// - 섹션 크기 / 개수 / 인덱스는 모두 LEB128, 모든 읽기는 남은 길이를 확인한 뒤 수행
+//   (잘리거나 변조된 모듈은 error 에 첫 오류를 남기고 중단 - 그때까지의 정보는 유지)
+// - code 섹션은 함수 본문 단위로 명령어를 디코딩해서 opcode 히스토그램 작성 (immediate 는 건너뜀)
+// - feed() 로 나눠 넣을 수 있음: 보관하는 것은 끝나지 않은 섹션 / 함수 본문뿐
+//   (data / custom 섹션은 버퍼링 없이 건너뜀, 한 번에 넣으면 복사 없음)
+class WasmModuleParser {
+public:
+    static constexpr size_t MAX_RECORDED_NAMES = 256;                   // 보관하는 import / export 수
+    static constexpr size_t MAX_BUFFERED_UNIT = 16 * 1024 * 1024;       // 섹션 / 함수 본문 하나의 최대 크기
+    static constexpr uint64_t MAX_DECODED_BYTES = 64 * 1024 * 1024;     // opcode 디코딩 상한
+    static constexpr uint64_t MIN_PROFILED_INSTRUCTIONS = 2000;
+
+    enum ExternalKind : uint8_t { KIND_FUNCTION = 0, KIND_TABLE = 1, KIND_MEMORY = 2, KIND_GLOBAL = 3, KIND_TAG = 4 };
+
+    struct Import {
+        std::string module;
+        std::string name;
+        uint8_t kind = KIND_FUNCTION;
+    };
+
+    struct Export {
+        std::string name;
+        uint8_t kind = KIND_FUNCTION;
+        uint32_t index = 0;
+    };
+
+    struct Summary {
+        bool valid = false;                 // 헤더 확인 + 모든 섹션을 끝까지 해석
+        std::string error;                  // 첫 오류 (valid 가 false 일 때)
+        uint64_t byteSize = 0;
+        uint32_t version = 0;
+
+        uint32_t typeCount = 0;
+        uint32_t importCount = 0;
+        uint32_t importedFunctionCount = 0;
+        uint32_t functionCount = 0;         // 모듈이 정의한 함수 (function 섹션)
+        uint32_t exportCount = 0;
+        uint32_t codeBodyCount = 0;
+        bool hasMemory = false;
+        bool hasTable = false;
+        uint64_t initialMemoryPages = 0;
+        std::vector<Import> imports;        // 앞에서부터 MAX_RECORDED_NAMES 개
+        std::vector<Export> exports;
+
+        // 1바이트 opcode 별 실행 명령 수 (0xFC / 0xFD / 0xFE 접두 명령은 접두 바이트로 집계)
+        std::array<uint64_t, 256> opcodeHistogram{};
+        uint64_t instructionCount = 0;
+        uint64_t undecodedBytes = 0;        // 알 수 없는 opcode 이후 / 디코딩 상한 초과로 건너뛴 본문
+
+        uint64_t count(uint8_t opcode) const { return opcodeHistogram[opcode]; }
+        uint32_t totalFunctionCount() const { return importedFunctionCount + functionCount; }
+    };
+
+    // 🔥 해시 루프 지표: CryptoNight / Keccak / Blake 류 루프는 i32·i64 rotl / xor / shift 밀도가 높음
+    struct HashLoopProfile {
+        uint64_t rotate = 0;
+        uint64_t xorOps = 0;
+        uint64_t shift = 0;
+        uint64_t add = 0;
+        double rotateDensity = 0;           // 명령어 대비 비율
+        double xorDensity = 0;
+        double mixDensity = 0;              // (rotate + xor + shift) / 명령어
+        bool minerExport = false;           // cryptonight / cn_hash 등 export 이름
+        bool looksLikeMiner = false;
+    };
+
+    // 바이트 조각 입력 (finish 이후 / 오류 이후 입력은 무시)
+    void feed(const uint8_t* data, size_t size);
+    // 입력 종료 - 잘린 모듈이면 error 설정
+    const Summary& finish();
+
+    static Summary parse(const uint8_t* data, size_t size);
+    static HashLoopProfile profile(const Summary& summary);
+
+private:
+    enum class State { Header, SectionHeader, Section, Skip, CodeCount, CodeBody, Failed, Finished };
+
+    size_t consume(const uint8_t* data, size_t size);
+    size_t step(const uint8_t* data, size_t size);     // 처리한 바이트 수 (0 = 입력 더 필요)
+    void parseSection(const uint8_t* data, size_t size);
+    void decodeBody(const uint8_t* data, size_t size);
+    void fail(const char* reason);
+
+    State state_ = State::Header;
+    std::vector<uint8_t> pending_;      // 아직 처리하지 못한 입력 (끝나지 않은 단위)
+    uint8_t sectionId_ = 0;
+    uint64_t sectionRemaining_ = 0;
+    uint32_t bodiesRemaining_ = 0;
+    uint64_t decodedBytes_ = 0;
+    Summary summary_;
+};
@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "WindowPropertyCache.h"
+#include "MetricsRegistry.h"
+
+void WindowPropertyCache::attach(JSContext* ctx, JSValueConst objectProto) {
+    if (attached_) {
+        return;
+    }
+    objectProto_ = JS_DupValue(ctx, objectProto);
+    attached_ = true;
+}
+
+void WindowPropertyCache::release(JSRuntime* rt) {
+    if (!attached_) {
+        return;
+    }
+    clear(rt);
+    JS_FreeValueRT(rt, objectProto_);
+    objectProto_ = JS_UNDEFINED;
+    attached_ = false;
+}
+
+void WindowPropertyCache::clear(JSRuntime* rt) {
+    for (const auto& entry : missing_) {
+        JS_FreeAtomRT(rt, entry.first);
+    }
+    missing_.clear();
+}
+
+bool WindowPropertyCache::isKnownMissing(JSContext* ctx, JSAtom atom) {
+    if (!attached_) {
+        return false;
+    }
+    auto it = missing_.find(atom);
+    if (it == missing_.end() || it->second != generation_) {
+        misses_++;
+        return false;
+    }
+    // window 트랩을 거치지 않는 Object.prototype 변경 확인 (prototype 체인 탐색 없이 1회 조회)
+    if (JS_IsObject(objectProto_) && JS_GetOwnProperty(ctx, nullptr, objectProto_, atom) != 0) {
+        it->second = 0;
+        misses_++;
+        return false;
+    }
+    hits_++;
+    return true;
+}
+
+void WindowPropertyCache::markMissing(JSContext* ctx, JSAtom atom) {
+    if (!attached_) {
+        return;
+    }
+    auto it = missing_.find(atom);
+    if (it != missing_.end()) {
+        it->second = generation_;
+        return;
+    }
+    if (missing_.size() >= MAX_ENTRIES) {
+        clear(JS_GetRuntime(ctx));
+    }
+    missing_.emplace(JS_DupAtom(ctx, atom), generation_);
+}
+
+void WindowPropertyCache::exportMetrics() {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    if (hits_) {
+        registry.counter("jsscanner_window_proxy_cache_total", {{"outcome", "hit"}},
+                         "window Proxy missing-property cache lookups").inc(hits_);
+    }
+    if (misses_) {
+        registry.counter("jsscanner_window_proxy_cache_total", {{"outcome", "miss"}},
+                         "window Proxy missing-property cache lookups").inc(misses_);
+    }
+    if (invalidations_) {
+        registry.counter("jsscanner_window_proxy_cache_invalidations_total", {},
+                         "window Proxy cache invalidations by property definition").inc(invalidations_);
+    }
+    hits_ = misses_ = invalidations_ = 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include "../quickjs.h"
+
+// 🔥 window Proxy get 트랩용 미존재 property 캐시 (컨텍스트 단위, 단일 스레드)
+// - window 대상 객체에 없던 이름을 atom → 세대(generation) 로 기억해서
+//   기능 탐지 루프(window.chrome, window.opera, window._phantom ...) 의 반복 조회를 건너뜀
+// - window Proxy 의 set / defineProperty / deleteProperty / setPrototypeOf 트랩이 invalidate() 호출
+// - Object.prototype 에 나중에 추가된 이름은 캐시 적중 시 Object.prototype own property 로 한 번 더 확인
+class WindowPropertyCache {
+public:
+    static constexpr size_t MAX_ENTRIES = 1024;
+
+    WindowPropertyCache() = default;
+    WindowPropertyCache(const WindowPropertyCache&) = delete;
+    WindowPropertyCache& operator=(const WindowPropertyCache&) = delete;
+
+    // window 등록 시 1회 호출 (objectProto 참조를 보관)
+    void attach(JSContext* ctx, JSValueConst objectProto);
+    // JS_FreeRuntime 전에 호출 (보관 중인 atom / Object.prototype 해제)
+    void release(JSRuntime* rt);
+
+    bool attached() const { return attached_; }
+
+    // 현재 세대에서 미존재로 기록된 이름인지 (Object.prototype 확인 포함)
+    bool isKnownMissing(JSContext* ctx, JSAtom atom);
+    // 미존재 기록 (atom 참조를 복제해서 보관, 가득 차면 전체 비움)
+    void markMissing(JSContext* ctx, JSAtom atom);
+    // window 에 property 가 정의/삭제될 때 호출 (기존 기록은 모두 무효)
+    void invalidate() { ++generation_; ++invalidations_; }
+
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+    uint64_t invalidations() const { return invalidations_; }
+    size_t size() const { return missing_.size(); }
+
+    void exportMetrics();
+
+private:
+    void clear(JSRuntime* rt);
+
+    std::unordered_map<JSAtom, uint32_t> missing_;   // atom → 기록 당시 세대
+    JSValue objectProto_ = JS_UNDEFINED;
+    uint32_t generation_ = 1;
+    bool attached_ = false;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t invalidations_ = 0;
+};
@@ -0,0 +1,445 @@
+#include "pch.h"
+#include "WorkerHost.h"
+#include "JSAnalyzer.h"
+#include "MetricsRegistry.h"
+#include "../builtin/BuiltinObject.h"
+#include "../builtin/helpers/Base64Utils.h"
+#include "../builtin/objects/XMLHTTPRequestObject.h"
+#include "../builtin/objects/ActiveXObject.h"
+#include <set>
+#include <system_error>
+#include <thread>
+
+// 🔥 런타임에서 Class ID 가져오기 위한 구조체 (JSAnalyzer.cpp에 정의됨)
+struct RuntimeClassIDs {
+    JSClassID xhr_class_id;
+    JSClassID activex_class_id;
+};
+
+struct WorkerHost::Worker {
+    int id = -1;
+    std::string url;
+    std::string label;                  // 보고용 URL (data: URL 은 길이 제한)
+    std::string source;
+    bool shared = false;
+    JSValue target = JS_UNDEFINED;      // 부모 컨텍스트 값 - 부모 스레드에서만 사용
+    Channel channel;
+
+    // 현재 실행 구간의 종료 시각 (Worker 스레드에서만 사용)
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+    std::atomic<bool> interrupt{false};
+    std::atomic<bool> timedOut{false};
+    std::thread thread;
+    bool finished = false;              // WorkerHost::mutex_ 보호
+
+    // 실행 결과 (finished 이후 부모 스레드에서만 읽음)
+    std::vector<HookEvent> events;
+    std::vector<htmljs_scanner::Detection> findings;
+    std::set<std::string> urls;
+};
+
+namespace {
+const size_t MAX_WORKER_JOBS = 300;
+
+MetricCounter& workerMetric(const char* outcome) {
+    return MetricsRegistry::instance().counter("jsscanner_workers_total", {{"outcome", outcome}},
+        "Worker / SharedWorker scripts by execution outcome");
+}
+
+MetricCounter& droppedMessageMetric(const char* direction) {
+    return MetricsRegistry::instance().counter("jsscanner_worker_messages_dropped_total", {{"direction", direction}},
+        "Worker postMessage data dropped (queue full, closed or oversized)");
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// 대기 중인 Promise job 실행 (최대 maxJobs, 예외는 버림)
+void runPendingJobs(JSContext* ctx, size_t maxJobs) {
+    JSRuntime* rt = JS_GetRuntime(ctx);
+    for (size_t i = 0; i < maxJobs; ++i) {
+        JSContext* pctx = nullptr;
+        int err = JS_ExecutePendingJob(rt, &pctx);
+        if (err <= 0) {
+            if (err < 0 && pctx) {
+                JS_FreeValue(pctx, JS_GetException(pctx));
+            }
+            break;
+        }
+    }
+}
+
+std::string exceptionMessage(JSContext* ctx) {
+    JSValue exception = JS_GetException(ctx);
+    const char* message = JS_ToCString(ctx, exception);
+    std::string out = message ? message : "unknown error";
+    if (message) JS_FreeCString(ctx, message);
+    JS_FreeValue(ctx, exception);
+    return out;
+}
+}
+
+WorkerHost::WorkerHost(BrowserConfig* browserConfig, ResponseCorpus* responseCorpus)
+    : browserConfig_(browserConfig), responseCorpus_(responseCorpus) {
+}
+
+WorkerHost::~WorkerHost() {
+    // finish() 없이 정리되는 경우(예외 경로) 스레드만 정리 - 부모 JSValue 는 런타임과 함께 버려짐
+    shutdown();
+}
+
+int WorkerHost::start(JSContext* ctx, JSValueConst target, const std::string& url, std::string source, bool shared) {
+    if (stopped_ || workers_.size() >= MAX_WORKERS) {
+        static MetricCounter& limited = workerMetric("limit");
+        limited.inc();
+        return -1;
+    }
+
+    auto worker = std::make_unique<Worker>();
+    worker->id = static_cast<int>(workers_.size());
+    worker->url = url;
+    worker->label = url.size() > 128 ? url.substr(0, 128) + "..." : url;
+    worker->source = std::move(source);
+    worker->shared = shared;
+    worker->target = JS_DupValue(ctx, target);
+
+    Worker* raw = worker.get();
+    workers_.push_back(std::move(worker));
+    try {
+        raw->thread = std::thread(&WorkerHost::run, this, raw);
+    } catch (const std::system_error& e) {
+        SCAN_LOG_WARN("[WorkerHost] Failed to start worker thread: %s", e.what());
+        std::lock_guard<std::mutex> lock(mutex_);
+        raw->finished = true;
+        static MetricCounter& failed = workerMetric("thread_failed");
+        failed.inc();
+        return -1;
+    }
+
+    static MetricCounter& started = workerMetric("started");
+    started.inc();
+    return raw->id;
+}
+
+bool WorkerHost::postMessage(int id, std::string message) {
+    if (id < 0 || static_cast<size_t>(id) >= workers_.size()) {
+        return false;
+    }
+    if (message.size() > MAX_MESSAGE_BYTES || !workers_[id]->channel.inbox.push(std::move(message))) {
+        static MetricCounter& dropped = droppedMessageMetric("to_worker");
+        dropped.inc();
+        return false;
+    }
+    return true;
+}
+
+void WorkerHost::terminate(int id) {
+    if (id < 0 || static_cast<size_t>(id) >= workers_.size()) {
+        return;
+    }
+    workers_[id]->interrupt = true;
+    workers_[id]->channel.inbox.close();
+}
+
+size_t WorkerHost::deliverMessages(JSContext* ctx) {
+    size_t delivered = 0;
+    for (auto& worker : workers_) {
+        if (JS_IsUndefined(worker->target)) {
+            continue;
+        }
+        while (std::optional<std::string> message = worker->channel.outbox.tryPop()) {
+            JSValue event = WorkerObject::createMessageEvent(ctx, *message);
+            WorkerObject::dispatchEvent(ctx, worker->target, "message", event);
+            JS_FreeValue(ctx, event);
+            delivered++;
+        }
+    }
+    if (delivered > 0) {
+        runPendingJobs(ctx, MAX_WORKER_JOBS);
+    }
+    return delivered;
+}
+
+void WorkerHost::shutdown() {
+    if (stopped_) {
+        return;
+    }
+    stopped_ = true;
+
+    // 남은 메시지는 처리하도록 inbox 만 닫고 잠시 대기 → 그래도 실행 중이면 인터럽트
+    for (auto& worker : workers_) {
+        worker->channel.inbox.close();
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait_for(lock, SHUTDOWN_GRACE, [this] {
+            for (const auto& worker : workers_) {
+                if (!worker->finished) return false;
+            }
+            return true;
+        });
+    }
+    {
+        // 유예 후에도 실행 중인 Worker 는 인터럽트만 함 - 시간 예산 초과 (timedOut) 는
+        // interruptHandler 가 실제로 예산을 다 쓴 경우에만 설정 (메시지 처리 중이던 Worker 는 제외)
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& worker : workers_) {
+            if (!worker->finished) {
+                static MetricCounter& interrupted = workerMetric("interrupted");
+                interrupted.inc();
+            }
+            worker->interrupt = true;
+        }
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void WorkerHost::finish(JSContext* ctx, JSAnalyzerContext* parent) {
+    if (merged_) {
+        return;
+    }
+    merged_ = true;
+    shutdown();
+    deliverMessages(ctx);
+
+    for (auto& worker : workers_) {
+        if (parent) {
+            for (HookEvent& event : worker->events) {
+                event.tags.insert("worker");
+                event.features["worker_url"] = JsValue(worker->label);
+                if (parent->dynamicAnalyzer) {
+                    parent->dynamicAnalyzer->recordEvent(event);
+                }
+            }
+            if (parent->findings) {
+                for (auto& finding : worker->findings) {
+                    finding.snippet = "[worker " + worker->label + "] " + finding.snippet;
+                    parent->findings->push_back(std::move(finding));
+                }
+                if (worker->timedOut) {
+                    parent->findings->push_back({0, "Worker exceeded its time budget: " + worker->label,
+                                                 "worker_time_budget_exceeded"});
+                }
+            }
+            if (parent->urlCollector) {
+                for (const auto& url : worker->urls) {
+                    parent->urlCollector->addUrlWithMetadata(url, "worker", 0);
+                }
+            }
+        }
+
+        uint64_t droppedFromWorker = worker->channel.outbox.dropped();
+        if (droppedFromWorker > 0) {
+            static MetricCounter& dropped = droppedMessageMetric("from_worker");
+            dropped.inc(droppedFromWorker);
+        }
+        if (worker->timedOut) {
+            static MetricCounter& timedOut = workerMetric("timed_out");
+            timedOut.inc();
+        }
+
+        JS_FreeValue(ctx, worker->target);
+        worker->target = JS_UNDEFINED;
+        worker->events.clear();
+        worker->findings.clear();
+    }
+}
+
+int WorkerHost::interruptHandler(JSRuntime* rt, void* opaque) {
+    Worker* worker = static_cast<Worker*>(opaque);
+    if (std::chrono::steady_clock::now() > worker->deadline) {
+        worker->timedOut = true;
+        return 1;
+    }
+    return worker->interrupt ? 1 : 0;
+}
+
+void WorkerHost::run(Worker* worker) {
+    try {
+        // 런타임 / 컨텍스트 opaque 가 가리키는 상태는 런타임보다 먼저 선언 (소멸은 런타임 해제 후
+        // - 예외로 빠져나가도 finalizer 가 해제된 classIDs / a_ctx 를 보지 않음)
+        RuntimeClassIDs classIDs{0, 0};
+
+        // Worker 전용 분석 상태 (부모 Task 와 공유하지 않음 - 종료 후 병합)
+        std::vector<htmljs_scanner::Detection> findings;
+        DynamicAnalyzer analyzer;
+        DynamicStringTracker tracker;
+        ChainTrackerManager chainManager;
+        UrlCollector urlCollector;
+        TagParser tagParser(&urlCollector);
+        std::unique_ptr<JSAnalyzerContext> a_ctx(new JSAnalyzerContext{
+            &findings, &analyzer, &tracker, &chainManager, &urlCollector, &tagParser, browserConfig_
+        });
+        a_ctx->responseCorpus = responseCorpus_;
+        a_ctx->workerChannel = &worker->channel;
+        analyzer.subscribe(a_ctx->hookBus);
+
+        ScopedJSRuntime scopedRuntime(TIME_BUDGET);
+        JSContext* ctx = scopedRuntime.GetContext();
+        JSRuntime* rt = scopedRuntime.GetRuntime();
+
+        // Task 런타임과 같은 제한 + Worker 전용 인터럽트 (terminate / 시간 예산)
+        JS_SetMemoryLimit(rt, 32 * 1024 * 1024);
+        JS_SetMaxStackSize(rt, 64 * 1024);
+        JS_SetGCThreshold(rt, 512 * 1024);
+        JS_SetInterruptHandler(rt, interruptHandler, worker);
+
+        JS_NewClassID(rt, &classIDs.xhr_class_id);
+        JS_NewClassID(rt, &classIDs.activex_class_id);
+        JS_SetRuntimeOpaque(rt, &classIDs);
+
+        JS_SetContextOpaque(ctx, a_ctx.get());
+        a_ctx->atoms.init(ctx);
+
+        // 시간 예산은 JS 실행 구간에만 소모 (메시지 대기 시간 제외)
+        std::chrono::steady_clock::duration budgetLeft = TIME_BUDGET;
+        std::chrono::steady_clock::time_point sliceStart;
+        auto beginSlice = [&] {
+            sliceStart = std::chrono::steady_clock::now();
+            worker->deadline = sliceStart + budgetLeft;
+        };
+        auto endSlice = [&] {
+            budgetLeft -= std::chrono::steady_clock::now() - sliceStart;
+            worker->deadline = std::chrono::steady_clock::time_point::max();
+        };
+
+        beginSlice();
+        JSValue global_obj = JS_GetGlobalObject(ctx);
+        BuiltinObjects::registerAll(ctx, global_obj);
+        XMLHTTPRequestObject::registerClass(ctx, rt, global_obj, classIDs.xhr_class_id);
+        ActiveXObject::registerClass(ctx, rt, global_obj, classIDs.activex_class_id);
+        if (browserConfig_) {
+            // shim 설치 실패는 예외 - 런타임 해제 전에 global 참조를 남기지 않도록 먼저 해제
+            JS_FreeValue(ctx, global_obj);
+            browserConfig_->initializeJSEnvironment(ctx);
+            global_obj = JS_GetGlobalObject(ctx);
+        }
+        WorkerObject::installWorkerScope(ctx, global_obj);
+
+        JSValue result = GlobalObject::evalLoadedScript(ctx, worker->label, worker->source);
+        if (JS_IsException(result)) {
+            static MetricCounter& scriptError = workerMetric("script_error");
+            scriptError.inc();
+            findings.push_back({0, "Worker script error: " + exceptionMessage(ctx), "worker_script_error"});
+        }
+        JS_FreeValue(ctx, result);
+        runPendingJobs(ctx, MAX_WORKER_JOBS);
+        endSlice();
+
+        // SharedWorker: 부모 연결을 connect 이벤트로 알리고 이후 메시지는 port 로 전달
+        JSValue port = JS_UNDEFINED;
+        if (worker->shared && !worker->timedOut) {
+            beginSlice();
+            port = WorkerObject::createWorkerPort(ctx);
+            JSValue event = WorkerObject::createConnectEvent(ctx, port);
+            WorkerObject::dispatchEvent(ctx, global_obj, "connect", event);
+            JS_FreeValue(ctx, event);
+            runPendingJobs(ctx, MAX_WORKER_JOBS);
+            endSlice();
+        }
+
+        JSValueConst receiver = worker->shared ? port : global_obj;
+        while (!worker->interrupt && !worker->timedOut) {
+            std::optional<std::string> message = worker->channel.inbox.pop();
+            if (!message) {
+                break;      // 부모 종료 / terminate() / close()
+            }
+            beginSlice();
+            JSValue event = WorkerObject::createMessageEvent(ctx, *message);
+            WorkerObject::dispatchEvent(ctx, receiver, "message", event);
+            JS_FreeValue(ctx, event);
+            runPendingJobs(ctx, MAX_WORKER_JOBS);
+            endSlice();
+        }
+
+        worker->events = analyzer.getHookEvents();
+        worker->findings = std::move(findings);
+        worker->urls = urlCollector.getExtractedUrls();
+
+        JS_FreeValue(ctx, port);
+        JS_FreeValue(ctx, global_obj);
+        a_ctx->atoms.release(rt);
+        a_ctx->windowPropertyCache.release(rt);
+        a_ctx->domWrappers.release(rt);
+        a_ctx->hookBus.exportMetrics();
+        a_ctx->windowPropertyCache.exportMetrics();
+        JS_SetContextOpaque(ctx, nullptr);
+        JS_SetRuntimeOpaque(rt, nullptr);
+    } catch (const std::exception& e) {
+        SCAN_LOG_ERROR("[WorkerHost] Worker %s failed: %s", worker->label.c_str(), e.what());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        worker->finished = true;
+    }
+    finished_.notify_all();
+}
+
+bool WorkerHost::decodeDataUrl(const std::string& url, std::string& body) {
+    if (url.compare(0, 5, "data:") != 0) {
+        return false;
+    }
+    size_t comma = url.find(',', 5);
+    if (comma == std::string::npos) {
+        return false;
+    }
+
+    std::string meta = url.substr(5, comma - 5);
+    std::string payload = url.substr(comma + 1);
+    if (meta.size() >= 7 && meta.compare(meta.size() - 7, 7, ";base64") == 0) {
+        body = Base64Utils::decode(payload);
+        return true;
+    }
+
+    body.clear();
+    body.reserve(payload.size());
+    for (size_t i = 0; i < payload.size(); ++i) {
+        if (payload[i] == '%' && i + 2 < payload.size() && hexValue(payload[i + 1]) >= 0 && hexValue(payload[i + 2]) >= 0) {
+            body += static_cast<char>(hexValue(payload[i + 1]) * 16 + hexValue(payload[i + 2]));
+            i += 2;
+        } else {
+            body += payload[i];
+        }
+    }
+    return true;
+}
+
+std::string WorkerHost::serializeMessage(JSContext* ctx, JSValueConst value) {
+    JSValue json = JS_JSONStringify(ctx, value, JS_UNDEFINED, JS_UNDEFINED);
+    if (JS_IsException(json)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));     // 순환 참조 등 - undefined 로 전달
+        return "";
+    }
+    std::string out;
+    if (JS_IsString(json)) {
+        size_t len = 0;
+        const char* str = JS_ToCStringLen(ctx, &len, json);
+        if (str) {
+            out.assign(str, len);
+            JS_FreeCString(ctx, str);
+        }
+    }
+    JS_FreeValue(ctx, json);
+    return out;
+}
+
+JSValue WorkerHost::deserializeMessage(JSContext* ctx, const std::string& message) {
+    if (message.empty()) {
+        return JS_UNDEFINED;
+    }
+    JSValue value = JS_ParseJSON(ctx, message.c_str(), message.size(), "<message>");
+    if (JS_IsException(value)) {
+        JS_FreeValue(ctx, JS_GetException(ctx));
+        return JS_NewStringLen(ctx, message.c_str(), message.size());
+    }
+    return value;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "../quickjs.h"
+#include "WorkerMessageQueue.h"
+
+struct JSAnalyzerContext;
+class BrowserConfig;
+class ResponseCorpus;
+
+// 🔥 Worker / SharedWorker 스크립트 실행기 (Task 단위)
+// - new Worker(url) 의 스크립트(blob: / data: / 저장된 응답)를 별도 JSRuntime 에서 전용 스레드로 실행
+//   (Worker 컨텍스트도 Task 와 같은 빌트인 hook 을 사용, window / document 는 없음)
+// - 부모 ↔ Worker postMessage 는 JSON 직렬화 후 크기 제한 큐로 전달 (가득 차면 버림)
+// - Worker 의 hook 이벤트 / finding / URL 은 종료 후 부모 Task 에 "worker" 태그로 병합
+// - start / postMessage / deliverMessages / finish 는 부모 스레드에서만 호출
+class WorkerHost {
+public:
+    static constexpr size_t MAX_WORKERS = 4;                    // Task 당 실행하는 Worker 수
+    static constexpr size_t QUEUE_CAPACITY = 256;               // 방향별 대기 메시지 수
+    static constexpr size_t MAX_MESSAGE_BYTES = 1024 * 1024;    // 직렬화된 메시지 크기
+    static constexpr std::chrono::milliseconds TIME_BUDGET{5000};
+    static constexpr std::chrono::milliseconds SHUTDOWN_GRACE{500};
+
+    // Worker 1개의 메시지 채널 (Worker 컨텍스트에서는 JSAnalyzerContext::workerChannel)
+    struct Channel {
+        Channel() : inbox(QUEUE_CAPACITY), outbox(QUEUE_CAPACITY) {}
+
+        WorkerMessageQueue inbox;       // 부모 → Worker
+        WorkerMessageQueue outbox;      // Worker → 부모
+    };
+
+    WorkerHost(BrowserConfig* browserConfig, ResponseCorpus* responseCorpus);
+    ~WorkerHost();
+
+    WorkerHost(const WorkerHost&) = delete;
+    WorkerHost& operator=(const WorkerHost&) = delete;
+
+    // Worker 실행 시작 - target: 메시지를 받을 부모 객체 (Worker 또는 SharedWorker.port)
+    // 반환: worker id (한도 초과 / 스레드 생성 실패 시 -1)
+    int start(JSContext* ctx, JSValueConst target, const std::string& url, std::string source, bool shared);
+    bool postMessage(int id, std::string message);
+    void terminate(int id);
+
+    // Worker 가 보낸 메시지를 부모 target 의 onmessage / message listener 로 전달 (전달한 개수)
+    size_t deliverMessages(JSContext* ctx);
+
+    // 모든 Worker 종료를 기다린 뒤 hook 이벤트 / finding / URL 을 parent 에 병합
+    // 보관 중인 부모 JSValue 도 해제하므로 부모 런타임 정리 전에 호출 (두 번째 호출부터는 무시)
+    void finish(JSContext* ctx, JSAnalyzerContext* parent);
+
+    size_t workerCount() const { return workers_.size(); }
+
+    // "data:[<mime>][;base64],<data>" 의 본문 (data: URL 이 아니면 false)
+    static bool decodeDataUrl(const std::string& url, std::string& body);
+
+    // postMessage 데이터 직렬화 (JSON - undefined / 직렬화 불가 값은 빈 문자열)
+    static std::string serializeMessage(JSContext* ctx, JSValueConst value);
+    static JSValue deserializeMessage(JSContext* ctx, const std::string& message);
+
+private:
+    struct Worker;
+
+    void run(Worker* worker);
+    void shutdown();
+    static int interruptHandler(JSRuntime* rt, void* opaque);
+
+    BrowserConfig* browserConfig_;
+    ResponseCorpus* responseCorpus_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::mutex mutex_;                      // Worker::finished 보호
+    std::condition_variable finished_;
+    bool stopped_ = false;
+    bool merged_ = false;
+};
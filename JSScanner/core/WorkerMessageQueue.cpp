@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "WorkerMessageQueue.h"
+
+WorkerMessageQueue::WorkerMessageQueue(size_t capacity)
+    : capacity_(capacity) {
+}
+
+bool WorkerMessageQueue::push(std::string message) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_ || messages_.size() >= capacity_) {
+            dropped_++;
+            return false;
+        }
+        messages_.push_back(std::move(message));
+    }
+    ready_.notify_one();
+    return true;
+}
+
+std::optional<std::string> WorkerMessageQueue::pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_.wait(lock, [this] { return closed_ || !messages_.empty(); });
+    if (messages_.empty()) {
+        return std::nullopt;
+    }
+    std::string message = std::move(messages_.front());
+    messages_.pop_front();
+    return message;
+}
+
+std::optional<std::string> WorkerMessageQueue::tryPop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (messages_.empty()) {
+        return std::nullopt;
+    }
+    std::string message = std::move(messages_.front());
+    messages_.pop_front();
+    return message;
+}
+
+void WorkerMessageQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    ready_.notify_all();
+}
+
+void WorkerMessageQueue::recordDropped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropped_++;
+}
+
+bool WorkerMessageQueue::closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+size_t WorkerMessageQueue::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return messages_.size();
+}
+
+uint64_t WorkerMessageQueue::dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+
+// 🔥 Worker 메시지 큐 (크기 제한, 스레드 안전)
+// - 부모 ↔ Worker 사이 postMessage 데이터(JSON 문자열)를 전달
+// - 가득 차거나 닫힌 큐에 넣은 메시지는 버리고 dropped 로 집계 (송신 측은 막히지 않음)
+// - 수신 측은 pop() 으로 대기하거나 tryPop() 으로 비워 감
+class WorkerMessageQueue {
+public:
+    explicit WorkerMessageQueue(size_t capacity);
+
+    // 넣지 못하면 false (가득 참 / 닫힘)
+    bool push(std::string message);
+
+    // 메시지가 올 때까지 대기 - 닫히고 비어 있으면 nullopt
+    std::optional<std::string> pop();
+    // 대기 없이 꺼냄 - 비어 있으면 nullopt
+    std::optional<std::string> tryPop();
+
+    // 이후 push 는 모두 실패, 대기 중인 pop 은 남은 메시지를 꺼낸 뒤 nullopt
+    void close();
+
+    // 큐에 넣기 전에 거른 메시지 (크기 초과 등) 도 dropped 로 집계
+    void recordDropped();
+
+    bool closed() const;
+    size_t size() const;
+    size_t capacity() const { return capacity_; }
+    uint64_t dropped() const;
+
+private:
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::string> messages_;
+    bool closed_ = false;
+    uint64_t dropped_ = 0;
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "HookType.h"
+
+// ========================================
+// HookApiId: 호출 횟수를 추적하는 hook API 의 고정 id
+// - HookCallCounters 의 배열 slot 번호로 사용 (문자열 map 조회 없음)
+// - 새 API 를 추가할 때는 HOOK_API_POLICIES 에도 같은 순서로 추가
+// ========================================
+enum class HookApiId : uint16_t {
+    EVAL,
+    ATOB,
+    STRING_FROM_CHAR_CODE,
+    ARRAY_JOIN,
+    ESCAPE,
+    UNESCAPE,
+    SET_TIMEOUT,
+    SET_INTERVAL,
+    DOCUMENT_WRITE,
+    FETCH,
+    XHR_SEND,
+    COUNT
+};
+
+constexpr size_t HOOK_API_COUNT = static_cast<size_t>(HookApiId::COUNT);
+
+// API 별 호출 정책
+// - maxCalls: 이 횟수를 넘으면 이벤트 기록/추적 중단 (0 = 제한 없음)
+// - sampleAfter / sampleEvery: sampleAfter 회 이후에는 sampleEvery 회마다 1번만 기록
+// - countsAsActivity: fetch/XHR 의 "과도한 함수 호출" 판단에 쓰이는 전체 호출 수에 포함 여부
+// - limitEventType: 제한 초과 이벤트의 HookType
+struct HookApiPolicy {
+    HookApiId id;
+    const char* name;
+    uint32_t maxCalls;
+    uint32_t sampleAfter;
+    uint32_t sampleEvery;
+    bool countsAsActivity;
+    HookType limitEventType;
+};
+
+inline constexpr HookApiPolicy HOOK_API_POLICIES[HOOK_API_COUNT] = {
+    // id                              name                    maxCalls sampleAfter sampleEvery activity limitEventType
+    {HookApiId::EVAL,                  "eval",                 0,       0,          1,          true,    HookType::FUNCTION_CALL},
+    {HookApiId::ATOB,                  "atob",                 1000,    0,          1,          true,    HookType::CRYPTO_OPERATION},
+    {HookApiId::STRING_FROM_CHAR_CODE, "String.fromCharCode",  1000,    0,          1,          false,   HookType::FUNCTION_CALL},
+    {HookApiId::ARRAY_JOIN,            "Array.join",           0,       1000,       16,         false,   HookType::FUNCTION_CALL},
+    {HookApiId::ESCAPE,                "escape",               0,       1000,       16,         false,   HookType::CRYPTO_OPERATION},
+    {HookApiId::UNESCAPE,              "unescape",             0,       1000,       16,         false,   HookType::CRYPTO_OPERATION},
+    {HookApiId::SET_TIMEOUT,           "setTimeout",           0,       0,          1,          false,   HookType::FUNCTION_CALL},
+    {HookApiId::SET_INTERVAL,          "setInterval",          0,       0,          1,          false,   HookType::FUNCTION_CALL},
+    {HookApiId::DOCUMENT_WRITE,        "document.write",       10000,   0,          1,          false,   HookType::DOM_MANIPULATION},
+    {HookApiId::FETCH,                 "fetch",                0,       0,          1,          false,   HookType::FETCH_REQUEST},
+    {HookApiId::XHR_SEND,              "XMLHttpRequest.send",  0,       0,          1,          true,    HookType::FETCH_REQUEST},
+};
+
+// 테이블 순서가 enum 순서와 일치하는지 컴파일 시점에 확인
+constexpr bool hookApiPoliciesOrdered() {
+    for (size_t i = 0; i < HOOK_API_COUNT; ++i) {
+        if (static_cast<size_t>(HOOK_API_POLICIES[i].id) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(hookApiPoliciesOrdered(), "HOOK_API_POLICIES must follow HookApiId order");
+
+constexpr const HookApiPolicy& hookApiPolicy(HookApiId id) {
+    return HOOK_API_POLICIES[static_cast<size_t>(id)];
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <utility>
+#include <cstddef>
 
 // ========================================
 // HookType: 후킹 이벤트 타입 & Feature 키 & Detection 이름 통합
@@ -119,6 +120,9 @@ enum class HookType {
     CHAIN_COUNT                 // 체인 개수
 };
 
+// HookType 개수 (HookType 으로 색인하는 배열 크기)
+inline constexpr size_t HOOK_TYPE_COUNT = static_cast<size_t>(HookType::CHAIN_COUNT) + 1;
+
 // Helper function to convert HookType enum to string
 inline std::string HookTypeToString(HookType type) {
     switch (type) {
@@ -361,6 +365,7 @@ inline std::pair<HookType, int> ReasonToDetectionType(const std::string& reason)
     if (reason == "malicious_pattern_detected") return {HookType::MALICIOUS_PATTERN, 9};
     if (reason == "malicious_pattern_blocked") return {HookType::MALICIOUS_PATTERN_BLOCKED, 10};
     if (reason == "decoding_chain_detected") return {HookType::DECODING_CHAIN, 8};
+    if (reason == "brute_force_decoded") return {HookType::DECODING_CHAIN, 8};
     if (reason == "obfuscated_variables") return {HookType::OBFUSCATED_VARIABLES, 7};
     if (reason == "array_obfuscation") return {HookType::ARRAY_OBFUSCATION, 7};
     if (reason == "large_encoded_data") return {HookType::LARGE_ENCODED_DATA, 8};
@@ -2,6 +2,7 @@
 #include "core/JSAnalyzer.h"
 #include "core/DynamicAnalyzer.h"
 #include "core/DynamicStringTracker.h"
+#include "core/MetricsExporter.h"
 #include "../../Getter/Peeker/GetterData.h"
 
 #ifdef _WIN32
@@ -47,7 +48,25 @@ SCANNER_EXPORT void Scan(const getter::GetterData* data, const char* task_id)
             return;
         }
 
+        // 🔥 NEW: JSSCANNER_METRICS_PORT 설정 시 로컬 메트릭 엔드포인트 시작 (최초 1회)
+        MetricsExporter::startIfConfigured();
+
         JSAnalyzer jsAnalyzer;
+
+        // 🔥 NEW: JSSCANNER_STAGE_TRACE=1 이면 단계별 Chrome trace JSON 저장
+        const char* stageTrace = std::getenv("JSSCANNER_STAGE_TRACE");
+        if (stageTrace && *stageTrace && std::string(stageTrace) != "0") {
+            jsAnalyzer.setStageTraceEnabled(true);
+        }
+
+        // 🔥 NEW: JSSCANNER_REPORT_FORMAT=cbor 이면 CBOR + LZ4 보고서 저장
+        jsAnalyzer.setReportFormat(BinaryReport::parseFormat(std::getenv("JSSCANNER_REPORT_FORMAT")));
+
+        // 🔥 NEW: JSSCANNER_HOOK_TRACE=1 이면 hook 진단 NDJSON 저장
+        const char* hookTrace = std::getenv("JSSCANNER_HOOK_TRACE");
+        if (hookTrace && *hookTrace && std::string(hookTrace) != "0") {
+            jsAnalyzer.setHookTraceEnabled(true);
+        }
         
         if (!scanUrl.empty()) {
             jsAnalyzer.setScanTargetUrl(scanUrl);
@@ -56,22 +75,48 @@ SCANNER_EXPORT void Scan(const getter::GetterData* data, const char* task_id)
         }
         
         jsAnalyzer.analyzeFiles(inputPath, taskIdStr);
+
+        // 비동기 로그 큐에 남은 레코드 출력
+        ScanLog::flush();
         
         Log_Info(TEXT("[Task-%s] JSScanner - Scan finished"), TCSFromMBS(taskIdStr).c_str());
     }
     catch (const std::exception& e)
     {
+        ScanLog::flush();
         core::Log_Error("JS Scanner - failed: %s", e.what());
     }
 }
 
+// 🔥 NEW: 바이너리 보고서 (*.js.result.cbor.lz4) 를 JSON 으로 출력
+static int decodeReport(const std::string& path, bool pretty) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::string json;
+    std::string error;
+    if (!BinaryReport::decodeToJson(bytes, json, pretty ? 4 : -1, &error)) {
+        std::cerr << "Decode failed: " << error << std::endl;
+        return 1;
+    }
+    std::cout << json << std::endl;
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
+    if (argc >= 3 && std::string(argv[1]) == "--decode-report") {
+        return decodeReport(argv[2], argc > 3 && std::string(argv[3]) == "--pretty");
+    }
     if (argc < 2) {
         std::cerr << "Usage: " << argv[0] << " <file_path> [task_id] [url]" << std::endl;
         std::cerr << "  file_path: Path to HTML/JS file or directory" << std::endl;
         std::cerr << "  task_id: Task ID (optional, default: local-task-12345)" << std::endl;
         std::cerr << "  url: Scan target URL for external communication detection (optional)" << std::endl;
         std::cerr << "Example: " << argv[0] << " malware.html 1234 https://legitimate-site.com" << std::endl;
+        std::cerr << "       " << argv[0] << " --decode-report <report.js.result.cbor.lz4> [--pretty]" << std::endl;
         return 1;
     }
 
@@ -102,6 +147,7 @@ int main(int argc, char* argv[]) {
     }
     try {
         Scan(&data, taskId.c_str());
+        MetricsExporter::stop();
         return 0;
     }
     catch (const std::exception& e) {
@@ -23,7 +23,7 @@ std::string BackgroundImageParser::getAttributeValue(const GumboNode* node, cons
 std::string BackgroundImageParser::fetchUrlContent(const std::string& url) const {
     // In a real application, this would use an HTTP client library (e.g., libcurl)
     // For migration purposes, we'll just return an empty string or a mock response.
-    std::cerr << "[WARN] Attempted to fetch external CSS from: " << url << " (HTTP client not implemented)" << std::endl;
+    SCAN_LOG_WARN("%sAttempted to fetch external CSS from: %s (HTTP client not implemented)", logMsg.c_str(), url.c_str());
     return ""; 
 }
 
@@ -64,3 +64,76 @@ std::vector<std::string> TagParser::scriptTagParser(const std::string& htmlConte
     gumbo_destroy_output(&kGumboDefaultOptions, output);
     return findings;
 }
+
+std::vector<DomNode*> TagParser::parseIntoDom(const std::string& htmlContent, DomTree& tree, DomNode* parent) {
+    std::vector<DomNode*> inserted;
+    if (!parent || htmlContent.empty()) return inserted;
+    GumboOutput* output = gumbo_parse(htmlContent.c_str());
+    if (!output) return inserted;
+
+    auto createNode = [&](const GumboNode* node) -> DomNode* {
+        switch (node->type) {
+        case GUMBO_NODE_ELEMENT:
+        case GUMBO_NODE_TEMPLATE: {
+            std::string tag;
+            if (node->v.element.tag != GUMBO_TAG_UNKNOWN) {
+                tag = gumbo_normalized_tagname(node->v.element.tag);
+            } else {
+                GumboStringPiece original = node->v.element.original_tag;
+                gumbo_tag_from_original_text(&original);
+                tag.assign(original.data ? original.data : "", original.length);
+            }
+            DomNode* element = tree.createElement(tag);
+            if (!element) return nullptr;
+            const GumboVector* attrs = &node->v.element.attributes;
+            for (unsigned int i = 0; i < attrs->length; ++i) {
+                GumboAttribute* attr = static_cast<GumboAttribute*>(attrs->data[i]);
+                if (attr && attr->name) {
+                    tree.setAttribute(element, attr->name, attr->value ? attr->value : "");
+                }
+            }
+            return element;
+        }
+        case GUMBO_NODE_TEXT:
+        case GUMBO_NODE_CDATA:
+        case GUMBO_NODE_WHITESPACE:
+            return tree.createText(node->v.text.text ? node->v.text.text : "");
+        case GUMBO_NODE_COMMENT:
+            return tree.createComment(node->v.text.text ? node->v.text.text : "");
+        default:
+            return nullptr;
+        }
+    };
+
+    // 깊은 중첩에서도 스택을 쓰지 않도록 (gumbo 부모, DOM 부모) 목록으로 순회
+    std::vector<std::pair<const GumboNode*, DomNode*>> pending;
+    const GumboVector* sections = &output->root->v.element.children;
+    for (unsigned int s = 0; s < sections->length; ++s) {
+        const GumboNode* section = static_cast<const GumboNode*>(sections->data[s]);
+        if (section->type != GUMBO_NODE_ELEMENT) continue;      // head / body
+        const GumboVector* children = &section->v.element.children;
+        for (unsigned int i = 0; i < children->length; ++i) {
+            const GumboNode* child = static_cast<const GumboNode*>(children->data[i]);
+            DomNode* node = createNode(child);
+            if (!node || !tree.appendChild(parent, node)) break;
+            inserted.push_back(node);
+            if (node->isElement()) pending.emplace_back(child, node);
+        }
+    }
+
+    while (!pending.empty()) {
+        auto [source, target] = pending.back();
+        pending.pop_back();
+        const GumboVector* children = &source->v.element.children;
+        for (unsigned int i = 0; i < children->length; ++i) {
+            const GumboNode* child = static_cast<const GumboNode*>(children->data[i]);
+            DomNode* node = createNode(child);
+            if (!node) break;
+            tree.appendChild(target, node);
+            if (node->isElement()) pending.emplace_back(child, node);
+        }
+    }
+
+    gumbo_destroy_output(&kGumboDefaultOptions, output);
+    return inserted;
+}
@@ -8,6 +8,7 @@
 #include "../../../../mon47-opensrc/opensrc/gumbo/include/gumbo.h"
 
 #include "../js/UrlCollector.h"
+#include "../../core/DomTree.h"
 
 
 class TagParser {
@@ -23,4 +24,8 @@ public:
    
     // Parses <script> tags for src attributes and inline JavaScript content
     std::vector<std::string> scriptTagParser(const std::string& htmlContent);
+
+    // 🔥 NEW: HTML 조각을 DomTree 의 parent 아래에 추가 (document.write / innerHTML)
+    // gumbo 가 만든 head / body 의 자식을 순서대로 옮김 - 추가한 최상위 노드 반환
+    std::vector<DomNode*> parseIntoDom(const std::string& htmlContent, DomTree& tree, DomNode* parent);
 };
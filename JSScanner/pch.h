@@ -70,3 +70,6 @@ using namespace core;
 
 // Global log prefix
 extern std::string logMsg;
+
+// Async level-gated logging (SCAN_LOG_*)
+#include "core/ScanLog.h"
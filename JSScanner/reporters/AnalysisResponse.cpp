@@ -16,16 +16,16 @@ void AnalysisResponse::addExtractedUrl(std::string url) {
 }
 
 void AnalysisResponse::addDetection(const htmljs_scanner::Detection& detection) {
-    core::Log_Warn("%sAnalysisResponse::addDetection called for: %s - %s", 
+    SCAN_LOG_DEBUG("%sAnalysisResponse::addDetection called for: %s - %s", 
                    logMsg.c_str(), detection.analysisCode.c_str(), detection.name.c_str());
-    core::Log_Warn("%s  Current Detections count: %zu", logMsg.c_str(), Detections.size());
+    SCAN_LOG_DEBUG("%s  Current Detections count: %zu", logMsg.c_str(), Detections.size());
     
     auto it = std::find_if(Detections.begin(), Detections.end(),
         [&](const htmljs_scanner::Detection& d) {
             bool nameMatch = (d.name == detection.name);
             bool codeMatch = (d.analysisCode == detection.analysisCode);
             
-            core::Log_Debug("%s    Comparing with existing: %s - %s (nameMatch=%s, codeMatch=%s)", 
+            SCAN_LOG_DEBUG("%s    Comparing with existing: %s - %s (nameMatch=%s, codeMatch=%s)", 
                           logMsg.c_str(), d.analysisCode.c_str(), d.name.c_str(),
                           (nameMatch ? "true" : "false"), (codeMatch ? "true" : "false"));
             
@@ -33,7 +33,7 @@ void AnalysisResponse::addDetection(const htmljs_scanner::Detection& detection)
         });
 
     if (it != Detections.end()) {
-        core::Log_Warn("%s  DUPLICATE FOUND! Merging features...", logMsg.c_str());
+        SCAN_LOG_DEBUG("%s  DUPLICATE FOUND! Merging features...", logMsg.c_str());
         for (const auto& entry : detection.features) {
             it->addFeature(entry.first, entry.second);
         }
@@ -41,7 +41,7 @@ void AnalysisResponse::addDetection(const htmljs_scanner::Detection& detection)
             it->severity = detection.severity;
         }
     } else {
-        core::Log_Warn("%s  NO DUPLICATE. Adding new detection. Total will be: %zu", 
+        SCAN_LOG_DEBUG("%s  NO DUPLICATE. Adding new detection. Total will be: %zu", 
                       logMsg.c_str(), Detections.size() + 1);
         Detections.push_back(detection);
     }
@@ -66,6 +66,162 @@ void AnalysisResponse::addTaintStatistic(const std::string& key, const JsValue&
     TaintStatistics[key] = value;
 }
 
+namespace {
+
+// Detection 을 복사하지 않고 detectionOrder 순서로 정렬
+std::vector<const htmljs_scanner::Detection*> sortDetectionsByOrder(const std::vector<htmljs_scanner::Detection>& detections) {
+    std::vector<const htmljs_scanner::Detection*> sorted;
+    sorted.reserve(detections.size());
+    for (const auto& detection : detections) {
+        sorted.push_back(&detection);
+    }
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const htmljs_scanner::Detection* a, const htmljs_scanner::Detection* b) {
+            // detectionOrder가 0이 아닌 것들만 정렬 (0은 순서 정보 없음)
+            if (a->detectionOrder == 0 && b->detectionOrder == 0) return false;
+            if (a->detectionOrder == 0) return false;  // a는 뒤로
+            if (b->detectionOrder == 0) return true;   // b는 뒤로
+            return a->detectionOrder < b->detectionOrder;
+        });
+    return sorted;
+}
+
+// 🔥 아래 write* 는 toJson() 결과 (nlohmann::json, key 정렬) 와 같은 순서로 key 를 씀
+template <typename Writer>
+void writeDetection(Writer& w, const htmljs_scanner::Detection& detection) {
+    w.beginObject();
+    w.key("AnalysisCode").string(detection.analysisCode);
+    w.key("Features").beginArray();
+    for (const auto& [name, value] : detection.features) {
+        w.beginObject().key(name).value(value).endObject();
+    }
+    w.endArray();
+    w.key("Name").string(detection.name);
+    w.key("Severity").string(std::to_string(detection.severity));
+    w.endObject();
+}
+
+template <typename Writer>
+void writeRouteHint(Writer& w, const RouteHint& hint) {
+    w.beginObject();
+    w.key("Reason").string(hint.reason);
+    w.key("Target").string(hint.target);
+    w.key("Trigger").stringArray(hint.triggers);
+    w.endObject();
+}
+
+template <typename Writer>
+void writeTiming(Writer& w, const Timing& timing) {
+    w.beginObject();
+    if (!timing.stages.empty() || !timing.blocks.empty()) {
+        w.key("Blocks").beginArray();
+        for (const auto& block : timing.blocks) {
+            // 같은 이름은 뒤의 값 (nlohmann object 대입과 같음)
+            std::map<std::string_view, double> stages;
+            for (const auto& [name, ms] : block.stages) {
+                stages[name] = ms;
+            }
+            w.beginObject();
+            w.key("Block").integer(block.index);
+            w.key("Stages").beginObject();
+            for (const auto& [name, ms] : stages) {
+                w.key(name).number(ms);
+            }
+            w.endObject();
+            w.key("TotalMs").number(block.totalMs);
+            w.endObject();
+        }
+        w.endArray();
+
+        w.key("Stages").beginArray();
+        for (const auto& stage : timing.stages) {
+            w.beginObject();
+            w.key("Count").integer(stage.count);
+            w.key("Depth").integer(stage.depth);
+            w.key("MaxMs").number(stage.maxMs);
+            w.key("Stage").string(stage.path);
+            w.key("TotalMs").number(stage.totalMs);
+            w.endObject();
+        }
+        w.endArray();
+    }
+    w.key("TookMs").integer(timing.tookMs);
+    w.endObject();
+}
+
+template <typename Writer>
+void writeTaintedValue(Writer& w, const TaintedValue& taintedValue) {
+    w.beginObject();
+    w.key("parents").stringArray(taintedValue.parents);
+    w.key("propagatedToVariables").stringArray(taintedValue.propagatedToVariables);
+    w.key("reason").string(taintedValue.reason);
+    w.key("sourceFunction").string(taintedValue.sourceFunction);
+    w.key("taintLevel").integer(taintedValue.taintLevel);
+    w.key("value").value(taintedValue.value);
+    w.key("valueId").string(taintedValue.valueId);
+    w.endObject();
+}
+
+template <typename Writer>
+void writeResponse(Writer& w, const AnalysisResponse& r) {
+    w.beginObject();
+
+    w.key("ApiCallCounts").beginObject();
+    for (const auto& [name, count] : r.ApiCallCounts) {
+        w.key(name).unsignedInteger(count);
+    }
+    w.endObject();
+
+    w.key("Detection").beginArray();
+    for (const auto* detection : sortDetectionsByOrder(r.Detections)) {
+        writeDetection(w, *detection);
+    }
+    w.endArray();
+
+    w.key("Errors").string(r.errors);
+    w.key("ExtractedFile").stringArray(r.extractedFiles);
+    w.key("ExtractedURL").stringArray(r.extractedUrls);
+
+    w.key("RouteHints").beginArray();
+    for (const auto& hint : r.RouteHints) {
+        writeRouteHint(w, hint);
+    }
+    w.endArray();
+
+    w.key("Status").string(r.Status);
+
+    w.key("TaintStatistics").beginObject();
+    for (const auto& [key, value] : r.TaintStatistics) {
+        w.key(key).value(value);
+    }
+    w.endObject();
+
+    w.key("TaintedValues").beginArray();
+    for (const auto& taintedValue : r.TaintedValues) {
+        writeTaintedValue(w, taintedValue);
+    }
+    w.endArray();
+
+    w.key("TaskId").string(r.TaskId);
+
+    // Timing은 배열이 아닌 단일 객체
+    w.key("Timing");
+    if (!r.Timings.empty()) {
+        writeTiming(w, r.Timings[0]);
+    } else {
+        w.beginObject().endObject();
+    }
+
+    w.key("Version").beginObject();
+    w.key("Rules").string(r.version.rules);
+    w.key("Scanner").string(r.version.scanner);
+    w.endObject();
+
+    w.endObject();
+}
+
+}  // namespace
+
 nlohmann::json AnalysisResponse::toJson() const {
     // ordered_json을 사용하여 삽입 순서 보장
     nlohmann::ordered_json j;
@@ -77,20 +233,10 @@ nlohmann::json AnalysisResponse::toJson() const {
     j["ExtractedURL"] = extractedUrls;
     
     // Detection 배열을 detectionOrder로 정렬
-    std::vector<htmljs_scanner::Detection> sortedDetections = Detections;
-    std::stable_sort(sortedDetections.begin(), sortedDetections.end(),
-        [](const htmljs_scanner::Detection& a, const htmljs_scanner::Detection& b) {
-            // detectionOrder가 0이 아닌 것들만 정렬 (0은 순서 정보 없음)
-            if (a.detectionOrder == 0 && b.detectionOrder == 0) return false;
-            if (a.detectionOrder == 0) return false;  // a는 뒤로
-            if (b.detectionOrder == 0) return true;   // b는 뒤로
-            return a.detectionOrder < b.detectionOrder;
-        });
-    
     nlohmann::json Detections_array = nlohmann::json::array();
-    for (const auto& detection : sortedDetections) {
+    for (const auto* detection : sortDetectionsByOrder(Detections)) {
         nlohmann::json det_json;
-        to_json(det_json, detection);
+        to_json(det_json, *detection);
         Detections_array.push_back(det_json);
     }
     j["Detection"] = Detections_array;
@@ -133,6 +279,13 @@ nlohmann::json AnalysisResponse::toJson() const {
         taintStats_json[key] = JsValueToJson(value);
     }
     j["TaintStatistics"] = taintStats_json;
+
+    // hook API 별 호출 횟수
+    nlohmann::json apiCallCounts_json = nlohmann::json::object();
+    for (const auto& [name, count] : ApiCallCounts) {
+        apiCallCounts_json[name] = count;
+    }
+    j["ApiCallCounts"] = apiCallCounts_json;
     
     j["Errors"] = errors;
     
@@ -140,6 +293,17 @@ nlohmann::json AnalysisResponse::toJson() const {
     return nlohmann::json(j);
 }
 
+void AnalysisResponse::writeJson(JsonStreamWriter& writer) const {
+    writeResponse(writer, *this);
+}
+
+std::string AnalysisResponse::toJsonString(int indent) const {
+    std::string out;
+    JsonStreamWriter writer(out, indent);
+    writeJson(writer);
+    return out;
+}
+
 void to_json(nlohmann::json& j, const AnalysisResponse& p) {
     j = p.toJson();
 }
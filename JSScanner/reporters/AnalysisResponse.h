@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <cstdint>
 #include <utility> // For std::move
 #include <algorithm> // For std::max
 
@@ -14,6 +15,7 @@
 #include "../hooks/HookEvent.h"
 #include "../chain/AttackChain.h"
 #include "metadata/Version.h"
+#include "JsonStreamWriter.h"
 #include "../../../Getter/Resolver/ExternalLib_json.hpp"
 
 class AnalysisResponse {
@@ -39,6 +41,7 @@ public:
     std::vector<htmljs_scanner::Detection> Detections;
     std::vector<TaintedValue> TaintedValues;
     std::map<std::string, JsValue> TaintStatistics;
+    std::map<std::string, uint64_t> ApiCallCounts;   // hook API 별 호출 횟수
 
     // Members for task management and general response
 
@@ -72,6 +75,7 @@ public:
     const std::vector<Timing>& getTimings() const { return Timings; }
     const std::vector<TaintedValue>& getTaintedValues() const { return TaintedValues; }
     const std::map<std::string, JsValue>& getTaintStatistics() const { return TaintStatistics; }
+    const std::map<std::string, uint64_t>& getApiCallCounts() const { return ApiCallCounts; }
 
     // Setters
     void setUrl(std::string url) { this->url = std::move(url); }
@@ -88,6 +92,7 @@ public:
     void setDetections(std::vector<htmljs_scanner::Detection> Detections) { this->Detections = std::move(Detections); }
     void setTaintedValues(std::vector<TaintedValue> taintedValues) { this->TaintedValues = std::move(taintedValues); }
     void setTaintStatistics(std::map<std::string, JsValue> taintStatistics) { this->TaintStatistics = std::move(taintStatistics); }
+    void setApiCallCounts(std::map<std::string, uint64_t> apiCallCounts) { this->ApiCallCounts = std::move(apiCallCounts); }
 
 
     void setTaskId(std::string taskId) { this->TaskId = std::move(taskId); }
@@ -107,6 +112,9 @@ public:
 
     // JSON serialization
     nlohmann::json toJson() const;
+    // 🔥 toJson().dump(indent) 와 같은 결과를 DOM 없이 바로 씀
+    void writeJson(JsonStreamWriter& writer) const;
+    std::string toJsonString(int indent = -1) const;
 };
 
 // nlohmann/json serialization for AnalysisResponse
@@ -0,0 +1,415 @@
+#include "pch.h"
+#include "BinaryReport.h"
+#include "CborStreamWriter.h"
+#include "JsonStreamWriter.h"
+#include "../../../Getter/Resolver/ExternalLib_json.hpp"
+
+#include <lz4frame.h>
+
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace {
+
+constexpr int MAX_DEPTH = 256;
+constexpr unsigned char LZ4_FRAME_MAGIC[] = {0x04, 0x22, 0x4D, 0x18};
+
+void setError(std::string* error, std::string message) {
+    if (error) *error = std::move(message);
+}
+
+double halfToDouble(uint16_t half) {
+    int exponent = (half >> 10) & 0x1F;
+    int mantissa = half & 0x3FF;
+    double value;
+    if (exponent == 0) {
+        value = std::ldexp(mantissa, -24);
+    } else if (exponent != 31) {
+        value = std::ldexp(mantissa + 1024, exponent - 25);
+    } else {
+        value = mantissa == 0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+    }
+    return (half & 0x8000) ? -value : value;
+}
+
+// 🔥 nlohmann SAX 파서로 JSON 을 읽으면서 바로 CborStreamWriter 로 옮김 (중간 DOM 없음)
+// - 중첩은 CborToJson 이 다시 읽을 수 있는 깊이까지만 (self-describe tag 포함)
+class JsonToCbor {
+public:
+    using json = nlohmann::json;
+
+    explicit JsonToCbor(CborStreamWriter& writer) : writer_(writer) {}
+
+    bool null() { writer_.null(); return true; }
+    bool boolean(bool value) { writer_.boolean(value); return true; }
+    bool number_integer(json::number_integer_t value) { writer_.integer(value); return true; }
+    bool number_unsigned(json::number_unsigned_t value) { writer_.unsignedInteger(value); return true; }
+    bool number_float(json::number_float_t value, const json::string_t&) { writer_.number(value); return true; }
+    bool string(json::string_t& value) { writer_.string(value); return true; }
+    bool binary(json::binary_t&) { return fail("binary values are not part of the report schema"); }
+    bool key(json::string_t& name) { writer_.key(name); return true; }
+
+    bool start_object(std::size_t) {
+        if (++depth_ >= MAX_DEPTH) return fail("JSON nesting too deep");
+        writer_.beginObject();
+        return true;
+    }
+    bool end_object() { --depth_; writer_.endObject(); return true; }
+    bool start_array(std::size_t) {
+        if (++depth_ >= MAX_DEPTH) return fail("JSON nesting too deep");
+        writer_.beginArray();
+        return true;
+    }
+    bool end_array() { --depth_; writer_.endArray(); return true; }
+
+    bool parse_error(std::size_t, const std::string&, const json::exception& ex) { return fail(ex.what()); }
+
+    bool fail(const char* message) {
+        if (error_.empty()) error_ = message;
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    CborStreamWriter& writer_;
+    int depth_ = 0;
+    std::string error_;
+};
+
+// 🔥 CBOR 항목을 읽으면서 바로 JsonStreamWriter 로 옮김 (중간 트리 없음)
+class CborToJson {
+public:
+    CborToJson(std::string_view data, JsonStreamWriter& writer) : data_(data), writer_(writer) {}
+
+    bool run() {
+        if (!item(0)) return false;
+        if (pos_ != data_.size()) return fail("trailing bytes after CBOR item");
+        return true;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    bool fail(const char* message) {
+        if (error_.empty()) {
+            error_ = std::string(message) + " at offset " + std::to_string(pos_);
+        }
+        return false;
+    }
+
+    bool readByte(uint8_t& out) {
+        if (pos_ >= data_.size()) return fail("unexpected end of CBOR data");
+        out = static_cast<uint8_t>(data_[pos_++]);
+        return true;
+    }
+
+    bool readUint(size_t bytes, uint64_t& out) {
+        if (data_.size() - pos_ < bytes) return fail("unexpected end of CBOR data");
+        out = 0;
+        for (size_t i = 0; i < bytes; ++i) {
+            out = (out << 8) | static_cast<uint8_t>(data_[pos_++]);
+        }
+        return true;
+    }
+
+    // 추가 정보 (info) 에 따른 인자 - 31 (길이 미정) 은 호출하는 쪽에서 처리
+    bool readArgument(uint8_t info, uint64_t& out) {
+        if (info < 24) {
+            out = info;
+            return true;
+        }
+        switch (info) {
+        case 24: return readUint(1, out);
+        case 25: return readUint(2, out);
+        case 26: return readUint(4, out);
+        case 27: return readUint(8, out);
+        default: return fail("reserved CBOR additional info");
+        }
+    }
+
+    bool isBreak() const {
+        return pos_ < data_.size() && static_cast<uint8_t>(data_[pos_]) == 0xFF;
+    }
+
+    bool textString(bool indefinite, uint64_t length, std::string& out) {
+        if (!indefinite) {
+            if (length > data_.size() - pos_) return fail("CBOR string longer than input");
+            out.append(data_.data() + pos_, static_cast<size_t>(length));
+            pos_ += static_cast<size_t>(length);
+            return true;
+        }
+        // 길이 미정 문자열은 길이가 정해진 조각들의 연결
+        while (!isBreak()) {
+            uint8_t head;
+            uint64_t chunk;
+            if (!readByte(head)) return false;
+            if ((head >> 5) != 3 || (head & 0x1F) == 31) return fail("invalid chunk in indefinite CBOR string");
+            if (!readArgument(head & 0x1F, chunk) || !textString(false, chunk, out)) return false;
+        }
+        ++pos_;
+        return true;
+    }
+
+    bool key() {
+        uint8_t head;
+        uint64_t length = 0;
+        if (!readByte(head)) return false;
+        if ((head >> 5) != 3) return fail("CBOR map key is not a text string");
+        const bool indefinite = (head & 0x1F) == 31;
+        std::string name;
+        if (!indefinite && !readArgument(head & 0x1F, length)) return false;
+        if (!textString(indefinite, length, name)) return false;
+        writer_.key(name);
+        return true;
+    }
+
+    bool container(bool isMap, bool indefinite, uint64_t count, int depth) {
+        if (isMap) writer_.beginObject(); else writer_.beginArray();
+        if (indefinite) {
+            while (!isBreak()) {
+                if (pos_ >= data_.size()) return fail("unterminated CBOR container");
+                if (isMap && !key()) return false;
+                if (!item(depth + 1)) return false;
+            }
+            ++pos_;
+        } else {
+            // 항목마다 최소 1 바이트 - 길이 필드만 큰 입력 방어
+            if (count > data_.size() - pos_) return fail("CBOR container longer than input");
+            for (uint64_t i = 0; i < count; ++i) {
+                if (isMap && !key()) return false;
+                if (!item(depth + 1)) return false;
+            }
+        }
+        if (isMap) writer_.endObject(); else writer_.endArray();
+        return true;
+    }
+
+    bool simple(uint8_t info) {
+        uint64_t bits;
+        switch (info) {
+        case 20: writer_.boolean(false); return true;
+        case 21: writer_.boolean(true); return true;
+        case 22:
+        case 23: writer_.null(); return true;    // undefined 도 JSON 에서는 null
+        case 25: {
+            if (!readUint(2, bits)) return false;
+            writer_.number(halfToDouble(static_cast<uint16_t>(bits)));
+            return true;
+        }
+        case 26: {
+            if (!readUint(4, bits)) return false;
+            uint32_t raw = static_cast<uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &raw, sizeof(value));
+            writer_.number(value);
+            return true;
+        }
+        case 27: {
+            if (!readUint(8, bits)) return false;
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            writer_.number(value);
+            return true;
+        }
+        case 31: return fail("unexpected CBOR break");
+        default: return fail("unsupported CBOR simple value");
+        }
+    }
+
+    bool item(int depth) {
+        if (depth > MAX_DEPTH) return fail("CBOR nesting too deep");
+
+        uint8_t head;
+        if (!readByte(head)) return false;
+        const uint8_t major = head >> 5;
+        const uint8_t info = head & 0x1F;
+        if (major == 7) return simple(info);
+
+        const bool indefinite = info == 31;
+        if (indefinite && (major < 2 || major == 6)) return fail("indefinite length on CBOR scalar");
+        uint64_t argument = 0;
+        if (!indefinite && !readArgument(info, argument)) return false;
+
+        switch (major) {
+        case 0:
+            writer_.unsignedInteger(argument);
+            return true;
+        case 1:
+            if (argument > static_cast<uint64_t>(std::numeric_limits<long long>::max())) {
+                return fail("CBOR negative integer out of range");
+            }
+            writer_.integer(-1 - static_cast<long long>(argument));
+            return true;
+        case 2:
+            return fail("CBOR byte strings are not part of the report schema");
+        case 3: {
+            std::string text;
+            if (!textString(indefinite, argument, text)) return false;
+            writer_.string(text);
+            return true;
+        }
+        case 4:
+            return container(false, indefinite, argument, depth);
+        case 5:
+            return container(true, indefinite, argument, depth);
+        default:
+            // tag (self-describe 55799 등) 는 건너뛰고 내용만
+            return item(depth + 1);
+        }
+    }
+
+    std::string_view data_;
+    JsonStreamWriter& writer_;
+    size_t pos_ = 0;
+    std::string error_;
+};
+
+bool isLz4Frame(std::string_view bytes) {
+    return bytes.size() >= sizeof(LZ4_FRAME_MAGIC) &&
+           std::memcmp(bytes.data(), LZ4_FRAME_MAGIC, sizeof(LZ4_FRAME_MAGIC)) == 0;
+}
+
+}  // namespace
+
+namespace BinaryReport {
+
+ReportFormat parseFormat(const char* name) {
+    if (!name) return ReportFormat::Json;
+    std::string lower(name);
+    for (char& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    if (lower == "cbor" || lower == "cbor-lz4" || lower == "cbor+lz4") {
+        return ReportFormat::CborLz4;
+    }
+    return ReportFormat::Json;
+}
+
+bool encodeCbor(std::string_view json, std::string& out, std::string* error) {
+    out.clear();
+    out.reserve(json.size());
+    CborStreamWriter writer(out);
+    writer.selfDescribe();
+    JsonToCbor converter(writer);
+    bool ok;
+    try {
+        ok = nlohmann::json::sax_parse(json.begin(), json.end(), &converter);
+    } catch (const std::exception& ex) {
+        ok = converter.fail(ex.what());
+    }
+    if (!ok) {
+        out.clear();
+        setError(error, converter.error().empty() ? "invalid JSON report" : converter.error());
+        return false;
+    }
+    return true;
+}
+
+bool encode(std::string_view json, std::string& out, std::string* error) {
+    std::string cbor;
+    if (!encodeCbor(json, cbor, error)) {
+        out.clear();
+        return false;
+    }
+    return compressFrame(cbor, out, error);
+}
+
+bool compressFrame(std::string_view raw, std::string& out, std::string* error) {
+    LZ4F_preferences_t prefs;
+    std::memset(&prefs, 0, sizeof(prefs));
+    prefs.frameInfo.contentSize = raw.size();                          // 해제 시 한 번에 reserve
+    prefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;  // 손상 검출
+
+    out.resize(LZ4F_compressFrameBound(raw.size(), &prefs));
+    size_t written = LZ4F_compressFrame(out.data(), out.size(), raw.data(), raw.size(), &prefs);
+    if (LZ4F_isError(written)) {
+        out.clear();
+        setError(error, std::string("LZ4 compression failed: ") + LZ4F_getErrorName(written));
+        return false;
+    }
+    out.resize(written);
+    return true;
+}
+
+bool decompressFrame(std::string_view framed, std::string& out, std::string* error) {
+    LZ4F_dctx* rawContext = nullptr;
+    size_t status = LZ4F_createDecompressionContext(&rawContext, LZ4F_VERSION);
+    if (LZ4F_isError(status)) {
+        setError(error, std::string("LZ4 context creation failed: ") + LZ4F_getErrorName(status));
+        return false;
+    }
+    std::unique_ptr<LZ4F_dctx, decltype(&LZ4F_freeDecompressionContext)> context(rawContext, &LZ4F_freeDecompressionContext);
+
+    out.clear();
+    size_t srcPos = 0;
+    LZ4F_frameInfo_t info;
+    std::memset(&info, 0, sizeof(info));
+    size_t srcSize = framed.size();
+    status = LZ4F_getFrameInfo(context.get(), &info, framed.data(), &srcSize);
+    if (LZ4F_isError(status)) {
+        setError(error, std::string("invalid LZ4 frame header: ") + LZ4F_getErrorName(status));
+        return false;
+    }
+    srcPos = srcSize;
+    if (info.contentSize > MAX_DECODED_BYTES) {
+        setError(error, "LZ4 frame content exceeds decode limit");
+        return false;
+    }
+    out.reserve(static_cast<size_t>(info.contentSize));
+
+    std::string chunk(64 * 1024, '\0');
+    while (status != 0) {
+        size_t dstSize = chunk.size();
+        srcSize = framed.size() - srcPos;
+        status = LZ4F_decompress(context.get(), chunk.data(), &dstSize, framed.data() + srcPos, &srcSize, nullptr);
+        if (LZ4F_isError(status)) {
+            setError(error, std::string("LZ4 decompression failed: ") + LZ4F_getErrorName(status));
+            return false;
+        }
+        srcPos += srcSize;
+        if (out.size() + dstSize > MAX_DECODED_BYTES) {
+            setError(error, "LZ4 frame content exceeds decode limit");
+            return false;
+        }
+        out.append(chunk.data(), dstSize);
+        if (status != 0 && srcSize == 0 && dstSize == 0) {
+            setError(error, "truncated LZ4 frame");
+            return false;
+        }
+    }
+    if (srcPos != framed.size()) {
+        setError(error, "trailing bytes after LZ4 frame");
+        return false;
+    }
+    return true;
+}
+
+bool cborToJson(std::string_view cbor, std::string& outJson, int indent, std::string* error) {
+    outJson.clear();
+    JsonStreamWriter writer(outJson, indent);
+    CborToJson converter(cbor, writer);
+    if (!converter.run()) {
+        outJson.clear();
+        setError(error, converter.error());
+        return false;
+    }
+    return true;
+}
+
+bool decodeToJson(std::string_view bytes, std::string& outJson, int indent, std::string* error) {
+    if (!isLz4Frame(bytes)) {
+        return cborToJson(bytes, outJson, indent, error);
+    }
+    std::string cbor;
+    if (!decompressFrame(bytes, cbor, error)) {
+        outJson.clear();
+        return false;
+    }
+    return cborToJson(cbor, outJson, indent, error);
+}
+
+} // namespace BinaryReport
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// 🔥 보고서 출력 형식 (실행 단위로 선택 - JSSCANNER_REPORT_FORMAT)
+enum class ReportFormat {
+    Json,       // *.js.result.json
+    CborLz4     // *.js.result.cbor.lz4 (JSON 보고서와 같은 스키마)
+};
+
+// 🔥 대량 수집용 바이너리 보고서
+// - 보고서 JSON (SCANNER_REPORT, JSON 모드에서 저장하는 바이트) 을 CBOR (RFC 8949) 로 옮기고 LZ4 frame 으로 압축
+// - 표준 형식이라 lz4 / cbor 라이브러리로 바로 읽을 수 있음
+// - decodeToJson 은 key 순서를 유지한 같은 JSON 값으로 되돌림 (nlohmann dump() 형식의 입력이면 바이트까지 같음)
+// - 실패 시 false + error (예외 없음)
+namespace BinaryReport {
+
+    constexpr const char* FILE_EXTENSION = ".js.result.cbor.lz4";
+    // 압축 해제 한도 (손상 / 악의적 입력 방어)
+    constexpr size_t MAX_DECODED_BYTES = 512u * 1024 * 1024;
+
+    // "json" / "cbor" / "cbor-lz4" (대소문자 무시), 모르는 값은 Json
+    ReportFormat parseFormat(const char* name);
+
+    // JSON → self-describe tag 가 붙은 CBOR (압축 전, nlohmann SAX 로 스트리밍 변환)
+    bool encodeCbor(std::string_view json, std::string& out, std::string* error = nullptr);
+    // JSON → CBOR + LZ4 frame
+    bool encode(std::string_view json, std::string& out, std::string* error = nullptr);
+
+    bool compressFrame(std::string_view raw, std::string& out, std::string* error = nullptr);
+    bool decompressFrame(std::string_view framed, std::string& out, std::string* error = nullptr);
+
+    // CBOR → JSON (DOM 없이 JsonStreamWriter 로 바로 변환, indent 는 dump(indent) 와 같음)
+    bool cborToJson(std::string_view cbor, std::string& outJson, int indent = -1, std::string* error = nullptr);
+    // LZ4 frame 이면 풀고, 아니면 CBOR 그대로 해석
+    bool decodeToJson(std::string_view bytes, std::string& outJson, int indent = -1, std::string* error = nullptr);
+
+} // namespace BinaryReport
@@ -0,0 +1,156 @@
+#include "pch.h"
+#include "CborStreamWriter.h"
+#include "JsonStreamWriter.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+constexpr uint8_t MAJOR_UNSIGNED = 0;
+constexpr uint8_t MAJOR_NEGATIVE = 1;
+constexpr uint8_t MAJOR_TEXT = 3;
+constexpr uint8_t MAJOR_TAG = 6;
+
+constexpr char ARRAY_INDEFINITE = '\x9F';
+constexpr char MAP_INDEFINITE = '\xBF';
+constexpr char BREAK = '\xFF';
+
+template <typename T>
+void appendBigEndian(std::string& out, T value) {
+    for (int shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+}  // namespace
+
+void CborStreamWriter::writeHead(uint8_t major, uint64_t argument) {
+    const uint8_t type = static_cast<uint8_t>(major << 5);
+    if (argument < 24) {
+        out_.push_back(static_cast<char>(type | argument));
+    } else if (argument <= 0xFF) {
+        out_.push_back(static_cast<char>(type | 24));
+        out_.push_back(static_cast<char>(argument));
+    } else if (argument <= 0xFFFF) {
+        out_.push_back(static_cast<char>(type | 25));
+        appendBigEndian(out_, static_cast<uint16_t>(argument));
+    } else if (argument <= 0xFFFFFFFFull) {
+        out_.push_back(static_cast<char>(type | 26));
+        appendBigEndian(out_, static_cast<uint32_t>(argument));
+    } else {
+        out_.push_back(static_cast<char>(type | 27));
+        appendBigEndian(out_, argument);
+    }
+}
+
+CborStreamWriter& CborStreamWriter::selfDescribe() {
+    writeHead(MAJOR_TAG, 55799);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::beginObject() {
+    out_.push_back(MAP_INDEFINITE);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::endObject() {
+    out_.push_back(BREAK);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::beginArray() {
+    out_.push_back(ARRAY_INDEFINITE);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::endArray() {
+    out_.push_back(BREAK);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::null() {
+    out_.push_back('\xF6');
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::boolean(bool value) {
+    out_.push_back(value ? '\xF5' : '\xF4');
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::integer(long long value) {
+    if (value >= 0) {
+        writeHead(MAJOR_UNSIGNED, static_cast<uint64_t>(value));
+    } else {
+        // -1 - n 으로 인코딩 (overflow 없이)
+        writeHead(MAJOR_NEGATIVE, ~static_cast<uint64_t>(value));
+    }
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::unsignedInteger(unsigned long long value) {
+    writeHead(MAJOR_UNSIGNED, value);
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::number(double value) {
+    // JSON 출력과 같게 NaN / Infinity 는 null
+    if (!std::isfinite(value)) {
+        return null();
+    }
+    float narrow = static_cast<float>(value);
+    if (static_cast<double>(narrow) == value) {
+        uint32_t bits;
+        std::memcpy(&bits, &narrow, sizeof(bits));
+        out_.push_back('\xFA');
+        appendBigEndian(out_, bits);
+    } else {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out_.push_back('\xFB');
+        appendBigEndian(out_, bits);
+    }
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::string(std::string_view value) {
+    if (JsonStreamWriter::isValidUtf8(value)) {
+        writeHead(MAJOR_TEXT, value.size());
+        out_.append(value);
+    } else {
+        std::string replaced = JsonStreamWriter::replaceInvalidUtf8(value);
+        writeHead(MAJOR_TEXT, replaced.size());
+        out_.append(replaced);
+    }
+    return *this;
+}
+
+CborStreamWriter& CborStreamWriter::value(const JsValue& js) {
+    std::visit([this](const auto& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, std::monostate>) {
+            null();
+        } else if constexpr (std::is_same_v<T, bool>) {
+            boolean(arg);
+        } else if constexpr (std::is_same_v<T, double>) {
+            number(arg);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            string(arg);
+        } else if constexpr (std::is_same_v<T, std::vector<JsValue>>) {
+            beginArray();
+            for (const auto& item : arg) {
+                value(item);
+            }
+            endArray();
+        } else if constexpr (std::is_same_v<T, std::map<std::string, JsValue>>) {
+            beginObject();
+            for (const auto& [name, item] : arg) {
+                key(name);
+                value(item);
+            }
+            endObject();
+        }
+    }, js.value);
+    return *this;
+}
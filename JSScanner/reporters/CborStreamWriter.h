@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "../model/JsValueVariant.h"
+
+// 🔥 CBOR (RFC 8949) 스트리밍 출력기 - JsonStreamWriter 와 같은 호출 방식
+// - BinaryReport 가 보고서 JSON 을 SAX 로 읽으면서 호출 (JSON 과 같은 값)
+// - 객체 / 배열은 길이 미정 (0xBF / 0x9F ... 0xFF) 으로 써서 미리 개수를 셀 필요 없음
+// - 실수는 float32 로 손실 없이 표현되면 float32, 아니면 float64 (정수로 바꾸지 않음)
+// - 잘못된 UTF-8 은 JsonStreamWriter 와 똑같이 U+FFFD 로 바꿈
+class CborStreamWriter {
+public:
+    explicit CborStreamWriter(std::string& out) : out_(out) {}
+
+    CborStreamWriter(const CborStreamWriter&) = delete;
+    CborStreamWriter& operator=(const CborStreamWriter&) = delete;
+
+    // 파일 앞에 self-describe tag (55799) - 내용만 보고 CBOR 임을 알 수 있음
+    CborStreamWriter& selfDescribe();
+
+    CborStreamWriter& beginObject();
+    CborStreamWriter& endObject();
+    CborStreamWriter& beginArray();
+    CborStreamWriter& endArray();
+    CborStreamWriter& key(std::string_view name) { return string(name); }
+
+    CborStreamWriter& null();
+    CborStreamWriter& boolean(bool value);
+    CborStreamWriter& integer(long long value);
+    CborStreamWriter& unsignedInteger(unsigned long long value);
+    CborStreamWriter& number(double value);
+    CborStreamWriter& string(std::string_view value);
+    CborStreamWriter& value(const JsValue& js);
+
+    template <typename Range>
+    CborStreamWriter& stringArray(const Range& values) {
+        beginArray();
+        for (const auto& item : values) {
+            string(item);
+        }
+        return endArray();
+    }
+
+private:
+    void writeHead(uint8_t major, uint64_t argument);
+
+    std::string& out_;
+};
@@ -2,6 +2,7 @@
 #include "HtmlJsReportWriter.h"
 
 #include "../../../Getter/Resolver/ExternalLib_json.hpp"
+#include <fstream>
 #include <utility>
 
 namespace htmljs_schema {
@@ -13,6 +14,7 @@ using ScannerDetection = htmljs_schema::Detection;
 using ScannerRouteHints = htmljs_schema::RouteHints;
 
 #include "AnalysisResponse.h"
+#include "JsonStreamWriter.h"
 
 namespace {
 template <typename Container>
@@ -45,10 +47,12 @@ ScannerReport BuildHtmlJsReportInternal(const AnalysisResponse& response) {
         converted.Name = TCSFromMBS(det.name);
         converted.Severity = TCSFromMBS(std::to_string(det.severity));
 
+        // 🔥 feature 값마다 nlohmann::json 을 만들지 않고 바로 문자열로
+        converted.features.key.reserve(det.features.size());
+        converted.features.value.reserve(det.features.size());
         for (const auto& [key, value] : det.features) {
             converted.features.key.push_back(TCSFromMBS(key));
-            nlohmann::json jsonValue = value;
-            converted.features.value.push_back(TCSFromMBS(jsonValue.dump()));
+            converted.features.value.push_back(TCSFromMBS(JsonStreamWriter::toString(value)));
         }
 
         DetectionsOut.push_back(std::move(converted));
@@ -91,8 +95,9 @@ ScannerReport BuildHtmlJsReportInternal(const AnalysisResponse& response) {
             convertedHint.value.push_back(value);
         }
         if (!hint.triggers.empty()) {
-            nlohmann::json triggerJson = hint.triggers;
-            std::tstring value = TCSFromMBS(triggerJson.dump());
+            std::string triggerJson;
+            JsonStreamWriter(triggerJson).stringArray(hint.triggers);
+            std::tstring value = TCSFromMBS(triggerJson);
             convertedHint.RouteHints[TEXT("Trigger")] = value;
             convertedHint.key.push_back(TEXT("Trigger"));
             convertedHint.value.push_back(value);
@@ -121,6 +126,11 @@ ScannerReport BuildHtmlJsReportInternal(const AnalysisResponse& response) {
     if (!response.getTimings().empty()) {
         const auto& timing = response.getTimings().front();
         report.Timing[TEXT("TookMs")] = TCSFromMBS(std::to_string(timing.getTookMs()));
+        if (!timing.getStages().empty() || !timing.getBlocks().empty()) {
+            nlohmann::json breakdown = timing.stagesToJson();
+            report.Timing[TEXT("Stages")] = TCSFromMBS(breakdown["Stages"].dump());
+            report.Timing[TEXT("Blocks")] = TCSFromMBS(breakdown["Blocks"].dump());
+        }
     }
 
     const auto& version = response.getVersion();
@@ -144,14 +154,17 @@ std::tstring GenerateHtmlJsOutputPathT(const std::string& taskId) {
     return outputDir + TEXT("/") + fileName;
 }
 
-bool SaveHtmlJsReportT(const ScannerReport& report,
+// 이미 직렬화한 문자열을 그대로 저장 (보고서를 다시 만들거나 다시 직렬화하지 않음)
+bool SaveHtmlJsReportT(const std::string& json,
                        const std::string& taskId,
                        std::tstring& outPath,
                        std::tstring& outErrMsg) {
     outPath = GenerateHtmlJsOutputPathT(taskId);
-    std::tstring errMsg;
-    if (!UTF8::WriteJsonToFile(&report, outPath, &errMsg)) {
-        outErrMsg = errMsg;
+    std::ofstream out(outPath, std::ios::binary | std::ios::trunc);
+    out.write(json.data(), static_cast<std::streamsize>(json.size()));
+    out.close();
+    if (!out) {
+        outErrMsg = TEXT("Failed to write ") + outPath;
         return false;
     }
     return true;
@@ -188,10 +201,7 @@ bool BuildHtmlJsReportJson(const AnalysisResponse& response,
             return false;
         }
         if (saveToFile) {
-            
-            ScannerReport reportForFile = BuildHtmlJsReportInternal(response);
-
-            if (!SaveHtmlJsReportT(reportForFile, taskId, savedPath, err)) {
+            if (!SaveHtmlJsReportT(outJsonUtf8, taskId, savedPath, err)) {
                 if (outErrorUtf8) {
                     *outErrorUtf8 = UTF8FromTCS(err);
                 }
@@ -0,0 +1,294 @@
+#include "pch.h"
+#include "JsonStreamWriter.h"
+
+#include <charconv>
+#include <cmath>
+#include <map>
+
+namespace {
+
+// UTF-8 한 글자 길이 (잘못된 시퀀스면 0)
+// - invalidLength: U+FFFD 하나로 바꿀 길이 = 유효한 앞부분 (최소 1)
+//   nlohmann::json 의 error_handler_t::replace 와 같은 규칙 (거부된 바이트는 다음 글자로 다시 읽음)
+size_t utf8SequenceLength(const unsigned char* p, size_t remaining, size_t* invalidLength = nullptr) {
+    unsigned char lead = p[0];
+    size_t length;
+    unsigned char low = 0x80;
+    unsigned char high = 0xBF;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if (lead == 0xE0) low = 0xA0;        // overlong
+        if (lead == 0xED) high = 0x9F;       // surrogate
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if (lead == 0xF0) low = 0x90;        // overlong
+        if (lead == 0xF4) high = 0x8F;       // > U+10FFFF
+    } else {
+        if (invalidLength) *invalidLength = 1;
+        return 0;
+    }
+    size_t i = 1;
+    for (; i < length && i < remaining; ++i) {
+        if (p[i] < (i == 1 ? low : 0x80) || p[i] > (i == 1 ? high : 0xBF)) break;
+    }
+    if (i == length) return length;
+    if (invalidLength) *invalidLength = i;
+    return 0;
+}
+
+// nlohmann::json 의 실수 표기 (grisu2 최단 자릿수) 를 그대로 사용
+void appendDouble(std::string& out, double value) {
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    char buffer[64];
+    char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, end);
+}
+
+}  // namespace
+
+JsonStreamWriter::JsonStreamWriter(std::string& out, int indent)
+    : out_(out), indent_(indent) {
+}
+
+JsonStreamWriter::JsonStreamWriter(std::FILE* file, int indent)
+    : out_(buffer_), file_(file), indent_(indent) {
+    buffer_.reserve(FLUSH_BYTES + 4096);
+    ok_ = file_ != nullptr;
+}
+
+JsonStreamWriter::~JsonStreamWriter() {
+    flush();
+}
+
+bool JsonStreamWriter::flush() {
+    if (!file_ || buffer_.empty()) return ok_;
+    if (ok_ && std::fwrite(buffer_.data(), 1, buffer_.size(), file_) != buffer_.size()) {
+        ok_ = false;
+    }
+    buffer_.clear();
+    return ok_;
+}
+
+void JsonStreamWriter::maybeFlush() {
+    if (file_ && buffer_.size() >= FLUSH_BYTES) {
+        flush();
+    }
+}
+
+void JsonStreamWriter::newline(size_t depth) {
+    if (indent_ < 0) return;
+    out_.push_back('\n');
+    out_.append(depth * static_cast<size_t>(indent_), ' ');
+}
+
+void JsonStreamWriter::beforeValue() {
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+    if (counts_.empty()) return;
+    if (counts_.back()++ > 0) out_.push_back(',');
+    newline(counts_.size());
+}
+
+JsonStreamWriter& JsonStreamWriter::beginObject() {
+    beforeValue();
+    out_.push_back('{');
+    counts_.push_back(0);
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::endObject() {
+    size_t count = counts_.back();
+    counts_.pop_back();
+    if (count > 0) newline(counts_.size());
+    out_.push_back('}');
+    maybeFlush();
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::beginArray() {
+    beforeValue();
+    out_.push_back('[');
+    counts_.push_back(0);
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::endArray() {
+    size_t count = counts_.back();
+    counts_.pop_back();
+    if (count > 0) newline(counts_.size());
+    out_.push_back(']');
+    maybeFlush();
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::key(std::string_view name) {
+    beforeValue();
+    writeEscaped(name);
+    out_ += indent_ < 0 ? ":" : ": ";
+    afterKey_ = true;
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::null() {
+    beforeValue();
+    out_ += "null";
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::boolean(bool value) {
+    beforeValue();
+    out_ += value ? "true" : "false";
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::integer(long long value) {
+    beforeValue();
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::unsignedInteger(unsigned long long value) {
+    beforeValue();
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::number(double value) {
+    beforeValue();
+    appendDouble(out_, value);
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::string(std::string_view value) {
+    beforeValue();
+    writeEscaped(value);
+    maybeFlush();
+    return *this;
+}
+
+JsonStreamWriter& JsonStreamWriter::value(const JsValue& js) {
+    std::visit([this](const auto& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, std::monostate>) {
+            null();
+        } else if constexpr (std::is_same_v<T, bool>) {
+            boolean(arg);
+        } else if constexpr (std::is_same_v<T, double>) {
+            number(arg);
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            string(arg);
+        } else if constexpr (std::is_same_v<T, std::vector<JsValue>>) {
+            beginArray();
+            for (const auto& item : arg) {
+                value(item);
+            }
+            endArray();
+        } else if constexpr (std::is_same_v<T, std::map<std::string, JsValue>>) {
+            beginObject();
+            for (const auto& [name, item] : arg) {
+                key(name);
+                value(item);
+            }
+            endObject();
+        }
+    }, js.value);
+    return *this;
+}
+
+void JsonStreamWriter::writeEscaped(std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    const auto* p = reinterpret_cast<const unsigned char*>(text.data());
+    const size_t size = text.size();
+
+    out_.push_back('"');
+    size_t runStart = 0;
+    size_t i = 0;
+    while (i < size) {
+        unsigned char c = p[i];
+        if (c >= 0x20 && c != '"' && c != '\\' && c < 0x80) {
+            ++i;
+            continue;
+        }
+        size_t invalid = 0;
+        size_t length = c >= 0x80 ? utf8SequenceLength(p + i, size - i, &invalid) : 0;
+        if (length > 0) {
+            i += length;
+            continue;
+        }
+
+        // 안전한 구간은 한 번에 복사
+        out_.append(text.data() + runStart, i - runStart);
+        if (invalid > 0) {
+            out_ += "\xEF\xBF\xBD";   // 잘못된 UTF-8 시퀀스
+            runStart = i += invalid;
+            continue;
+        }
+        switch (c) {
+        case '"': out_ += "\\\""; break;
+        case '\\': out_ += "\\\\"; break;
+        case '\b': out_ += "\\b"; break;
+        case '\f': out_ += "\\f"; break;
+        case '\n': out_ += "\\n"; break;
+        case '\r': out_ += "\\r"; break;
+        case '\t': out_ += "\\t"; break;
+        default:
+            out_ += "\\u00";
+            out_.push_back(HEX[c >> 4]);
+            out_.push_back(HEX[c & 0xF]);
+            break;
+        }
+        runStart = ++i;
+    }
+    out_.append(text.data() + runStart, size - runStart);
+    out_.push_back('"');
+}
+
+bool JsonStreamWriter::isValidUtf8(std::string_view text) {
+    const auto* p = reinterpret_cast<const unsigned char*>(text.data());
+    for (size_t i = 0; i < text.size();) {
+        if (p[i] < 0x80) {
+            ++i;
+            continue;
+        }
+        size_t length = utf8SequenceLength(p + i, text.size() - i);
+        if (length == 0) return false;
+        i += length;
+    }
+    return true;
+}
+
+std::string JsonStreamWriter::replaceInvalidUtf8(std::string_view text) {
+    const auto* p = reinterpret_cast<const unsigned char*>(text.data());
+    std::string out;
+    out.reserve(text.size() + 8);
+    for (size_t i = 0; i < text.size();) {
+        size_t invalid = 0;
+        size_t length = p[i] < 0x80 ? 1 : utf8SequenceLength(p + i, text.size() - i, &invalid);
+        if (length == 0) {
+            out += "\xEF\xBF\xBD";
+            i += invalid;
+        } else {
+            out.append(text.data() + i, length);
+            i += length;
+        }
+    }
+    return out;
+}
+
+std::string JsonStreamWriter::toString(const JsValue& value) {
+    std::string out;
+    JsonStreamWriter writer(out);
+    writer.value(value);
+    return out;
+}
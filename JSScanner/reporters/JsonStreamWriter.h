@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../model/JsValueVariant.h"
+
+// 🔥 SAX 방식 JSON 출력기 (중간 nlohmann::json DOM 없이 바로 버퍼 / 파일에 씀)
+// - 출력 형식은 nlohmann::json::dump(indent) 와 같음 (숫자 표기, escape, 들여쓰기)
+// - 잘못된 UTF-8 은 예외 대신 U+FFFD 로 바꿈 (dump(-1, ' ', false, error_handler_t::replace) 와 같음)
+// - indent < 0 이면 한 줄 (production 기본값)
+// - 객체 key 순서는 호출 순서 그대로 (정렬이 필요하면 호출하는 쪽에서 맞춤)
+class JsonStreamWriter {
+public:
+    explicit JsonStreamWriter(std::string& out, int indent = -1);
+    // 파일 출력은 FLUSH_BYTES 단위로 모아서 씀 (file 은 호출하는 쪽이 닫음)
+    explicit JsonStreamWriter(std::FILE* file, int indent = -1);
+    ~JsonStreamWriter();
+
+    JsonStreamWriter(const JsonStreamWriter&) = delete;
+    JsonStreamWriter& operator=(const JsonStreamWriter&) = delete;
+
+    JsonStreamWriter& beginObject();
+    JsonStreamWriter& endObject();
+    JsonStreamWriter& beginArray();
+    JsonStreamWriter& endArray();
+    JsonStreamWriter& key(std::string_view name);
+
+    JsonStreamWriter& null();
+    JsonStreamWriter& boolean(bool value);
+    JsonStreamWriter& integer(long long value);
+    JsonStreamWriter& unsignedInteger(unsigned long long value);
+    JsonStreamWriter& number(double value);
+    JsonStreamWriter& string(std::string_view value);
+    JsonStreamWriter& value(const JsValue& js);
+
+    template <typename Range>
+    JsonStreamWriter& stringArray(const Range& values) {
+        beginArray();
+        for (const auto& item : values) {
+            string(item);
+        }
+        return endArray();
+    }
+
+    // 파일 출력 시 남은 버퍼를 씀 (쓰기 실패가 한 번이라도 있으면 false)
+    bool flush();
+    bool ok() const { return ok_; }
+
+    // feature 값 하나를 compact JSON 문자열로 (HtmlJsReportWriter 용)
+    static std::string toString(const JsValue& value);
+
+    // 잘못된 UTF-8 시퀀스마다 U+FFFD 하나로 (CborStreamWriter 도 같은 규칙 사용)
+    static bool isValidUtf8(std::string_view text);
+    static std::string replaceInvalidUtf8(std::string_view text);
+
+private:
+    static constexpr size_t FLUSH_BYTES = 64 * 1024;
+
+    void beforeValue();
+    void newline(size_t depth);
+    void writeEscaped(std::string_view text);
+    void maybeFlush();
+
+    std::string buffer_;
+    std::string& out_;
+    std::FILE* file_ = nullptr;
+    int indent_;
+    std::vector<size_t> counts_;   // 열린 객체 / 배열마다 지금까지 쓴 항목 수
+    bool afterKey_ = false;
+    bool ok_ = true;
+};
@@ -289,7 +289,7 @@ AnalysisResponse ResponseGenerator::buildAnalysisResponse(const std::string& tas
         
         // DOM에서 발견된 URL을 ExtractedUrls에 추가
         if (!domExtractedUrls_.empty()) {
-            core::Log_Info("%sAdding %s",logMsg,  std::to_string(domExtractedUrls_.size()) + 
+            SCAN_LOG_INFO("%sAdding %s",logMsg,  std::to_string(domExtractedUrls_.size()) + 
                         " URLs from DOM manipulation to ExtractedUrls");
             extractedUrls.insert(extractedUrls.end(), 
                                domExtractedUrls_.begin(), 
@@ -305,10 +305,18 @@ AnalysisResponse ResponseGenerator::buildAnalysisResponse(const std::string& tas
                 addExternalCommunicationDetection(response, urlMetadataList, orderCounter);
             }
         }
+
+        // 🔥 NEW: 가상 파일시스템에 떨어뜨린 파일 (내용은 JSAnalyzer 가 scan_report 에 저장)
+        if (a_ctx && a_ctx->fileSystem.fileCount() > 0) {
+            addDroppedFileDetection(response, a_ctx->fileSystem.artifacts(), orderCounter);
+        }
         
         response.setExtractedUrls(extractedUrls);
         addRouteHints(response, staticFindings);
         response.setTimings({ Timing(executionTimeMs) });
+        if (a_ctx) {
+            response.setApiCallCounts(a_ctx->callCounters.snapshot());
+        }
         return response;
     } catch (const std::exception& e) {
         AnalysisResponse fallback = createFallbackErrorResponseObject(taskId, e.what());
@@ -641,24 +649,24 @@ void ResponseGenerator::processStringEvents(htmljs_scanner::Detection& detection
 void ResponseGenerator::processTaintData(htmljs_scanner::Detection& detection, AnalysisResponse& response, TaintTracker* taintTracker, int& maxSeverity) {
     if (!taintTracker) return;
     
-    core::Log_Info("%sCollecting TaintTracker data...", logMsg.c_str());
+    SCAN_LOG_INFO("%sCollecting TaintTracker data...", logMsg.c_str());
     std::vector<TaintedValue*> taintedValues = taintTracker->getAllTaintedValues();
-    core::Log_Info("%sFound %zu tainted values", logMsg.c_str(), taintedValues.size());
+    SCAN_LOG_INFO("%sFound %zu tainted values", logMsg.c_str(), taintedValues.size());
     
     if (taintedValues.empty()) {
         // Taint 통계만 수집
         auto taintStats = taintTracker->getStatistics();
-        core::Log_Info("%sTaintTracker statistics: %zu items", logMsg.c_str(), taintStats.size());
+        SCAN_LOG_INFO("%sTaintTracker statistics: %zu items", logMsg.c_str(), taintStats.size());
         for (const auto& [key, value] : taintStats) {
             response.addTaintStatistic(key, value);
-            core::Log_Debug("%s  Taint stat: %s = %s", logMsg.c_str(), key.c_str(), JsValueToString(value).c_str());
+            SCAN_LOG_DEBUG("%s  Taint stat: %s = %s", logMsg.c_str(), key.c_str(), JsValueToString(value).c_str());
         }
         return;
     }
     
     // 🆕 Taint 그룹화 수행
     std::vector<TaintGroup> taintGroups = groupTaintedValues(taintedValues);
-    core::Log_Info("%sGrouped into %zu meaningful patterns", logMsg.c_str(), taintGroups.size());
+    SCAN_LOG_INFO("%sGrouped into %zu meaningful patterns", logMsg.c_str(), taintGroups.size());
     
     // 그룹화된 패턴을 Detection에 추가
     addTaintGroupsToDetection(detection, taintGroups, maxSeverity);
@@ -675,19 +683,19 @@ void ResponseGenerator::processTaintData(htmljs_scanner::Detection& detection, A
     
     // Taint 통계 수집
     auto taintStats = taintTracker->getStatistics();
-    core::Log_Debug("TaintTracker statistics: %zu items", taintStats.size());
+    SCAN_LOG_DEBUG("TaintTracker statistics: %zu items", taintStats.size());
     for (const auto& [key, value] : taintStats) {
         response.addTaintStatistic(key, value);
-        core::Log_Debug("  Taint stat: %s = %s", key.c_str(), JsValueToString(value).c_str());
+        SCAN_LOG_DEBUG("  Taint stat: %s = %s", key.c_str(), JsValueToString(value).c_str());
     }
 }
 
 void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, const std::vector<htmljs_scanner::Detection>& staticFindings, JSAnalyzerContext* a_ctx, int& orderCounter) {
-    core::Log_Warn("=== addDynamicAnalysisResults CALLED ===");
-    core::Log_Debug("Current Detections count: %zu", response.getDetections().size());
+    SCAN_LOG_DEBUG("=== addDynamicAnalysisResults CALLED ===");
+    SCAN_LOG_DEBUG("Current Detections count: %zu", response.getDetections().size());
     
     if (!a_ctx || !a_ctx->dynamicAnalyzer || !a_ctx->chainTrackerManager || !a_ctx->dynamicStringTracker) {
-        core::Log_Warn("=== addDynamicAnalysisResults EARLY RETURN (null context) ===");
+        SCAN_LOG_DEBUG("=== addDynamicAnalysisResults EARLY RETURN (null context) ===");
         return;
     }
 
@@ -706,17 +714,17 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
     const std::vector<AttackChain>& completedChains = a_ctx->chainTrackerManager->getChainDetector()->getCompletedChains();
     const std::vector<DynamicStringTracker::SensitiveStringEvent>& stringEvents = a_ctx->dynamicStringTracker->getDetectedEvents();
 
-    core::Log_Info("Dynamic analysis: staticFindings=%zu, events=%zu, chains=%zu, strings=%zu",
+    SCAN_LOG_INFO("Dynamic analysis: staticFindings=%zu, events=%zu, chains=%zu, strings=%zu",
                    staticFindings.size(), relevantHookEvents.size(), completedChains.size(), stringEvents.size());
 
     if (staticFindings.empty() && relevantHookEvents.empty() && completedChains.empty() && stringEvents.empty()) {
-        core::Log_Warn("=== addDynamicAnalysisResults EARLY RETURN (no data) ===");
+        SCAN_LOG_DEBUG("=== addDynamicAnalysisResults EARLY RETURN (no data) ===");
         return;
     }
 
     // 🔥 NEW: Crypto 작업을 독립적인 그룹으로 분리
     std::vector<CryptoGroup> cryptoGroups = groupConsecutiveCryptoOperations(allHookEvents);
-    core::Log_Info("Found %zu independent obfuscation chains", cryptoGroups.size());
+    SCAN_LOG_INFO("Found %zu independent obfuscation chains", cryptoGroups.size());
     
     // 🔥 모든 Crypto 그룹을 하나의 통합 Detection으로 생성
     if (!cryptoGroups.empty()) {
@@ -782,7 +790,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         
         unifiedDetection.severity = maxSeverity;
         
-        core::Log_Info("%sAdding unified obfuscation detection with %zu chains, severity %d", 
+        SCAN_LOG_INFO("%sAdding unified obfuscation detection with %zu chains, severity %d", 
                        logMsg.c_str(), cryptoGroups.size(), maxSeverity);
         addDetectionWithOrder(response, unifiedDetection, orderCounter);
     }
@@ -792,7 +800,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         TaintTracker* taintTracker = a_ctx->chainTrackerManager->getTaintTracker();
         std::vector<TaintedValue*> allTaints = taintTracker->getAllTaintedValues();
         
-        core::Log_Info("%sProcessing %zu tainted values for global summary", logMsg.c_str(), allTaints.size());
+        SCAN_LOG_INFO("%sProcessing %zu tainted values for global summary", logMsg.c_str(), allTaints.size());
         
         // 전체 Taint 통계만 추가
         for (auto* taint : allTaints) {
@@ -822,7 +830,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         }
         chainDetection.severity = chainSeverity;
         
-        core::Log_Info("%sAdding Attack Chain detection with severity %d", logMsg.c_str(), chainSeverity);
+        SCAN_LOG_INFO("%sAdding Attack Chain detection with severity %d", logMsg.c_str(), chainSeverity);
         addDetectionWithOrder(response, chainDetection, orderCounter);
     }
     
@@ -830,17 +838,17 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
     // 별도 Detection 생성하지 않음 (중복 방지)
     // FETCH_REQUEST, DATA_EXFILTRATION, 간접 호출, DOM_MANIPULATION 등 특수 이벤트만 별도 처리
     
-    core::Log_Info("%sChecking %zu relevant events for categorization", logMsg.c_str(), relevantHookEvents.size());
+    SCAN_LOG_INFO("%sChecking %zu relevant events for categorization", logMsg.c_str(), relevantHookEvents.size());
     
     // 🔥 이벤트 분류 (새로운 EventProcessor 사용)
     auto categorized = eventProcessor_->categorizeEvents(relevantHookEvents);
     
-    core::Log_Info("%sEvent categorization complete:", logMsg.c_str());
-    core::Log_Info("%s  - DOM Manipulation: %zu", logMsg.c_str(), categorized.domEvents.size());
-    core::Log_Info("%s  - Location Change: %zu", logMsg.c_str(), categorized.locationEvents.size());
-    core::Log_Info("%s  - Address Manipulation: %zu", logMsg.c_str(), categorized.addrEvents.size());
-    core::Log_Info("%s  - Environment Detection: %zu", logMsg.c_str(), categorized.environmentEvents.size());
-    core::Log_Info("%s  - Critical Events: %zu", logMsg.c_str(), categorized.criticalEvents.size());
+    SCAN_LOG_INFO("%sEvent categorization complete:", logMsg.c_str());
+    SCAN_LOG_INFO("%s  - DOM Manipulation: %zu", logMsg.c_str(), categorized.domEvents.size());
+    SCAN_LOG_INFO("%s  - Location Change: %zu", logMsg.c_str(), categorized.locationEvents.size());
+    SCAN_LOG_INFO("%s  - Address Manipulation: %zu", logMsg.c_str(), categorized.addrEvents.size());
+    SCAN_LOG_INFO("%s  - Environment Detection: %zu", logMsg.c_str(), categorized.environmentEvents.size());
+    SCAN_LOG_INFO("%s  - Critical Events: %zu", logMsg.c_str(), categorized.criticalEvents.size());
     
     // 🔥 DOM_MANIPULATION Detection 생성 (새로운 DetectionBuilder 사용)
     if (categorized.hasDom()) {
@@ -848,7 +856,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         std::string summary = summaryGenerator_->generateDomManipulationSummary(categorized.domEvents);
         htmljs_scanner::Detection domDetection = detectionBuilder_->buildDomManipulationDetection(
             categorized.domEvents, summary);
-        core::Log_Info("%sAdding DOM_MANIPULATION detection with severity %d", logMsg.c_str(), domDetection.severity);
+        SCAN_LOG_INFO("%sAdding DOM_MANIPULATION detection with severity %d", logMsg.c_str(), domDetection.severity);
         response.addDetection(domDetection);
     }
     
@@ -857,7 +865,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         std::string summary = summaryGenerator_->generateLocationChangeSummary(categorized.locationEvents);
         htmljs_scanner::Detection locationDetection = detectionBuilder_->buildLocationChangeDetection(
             categorized.locationEvents, summary);
-        core::Log_Info("%sAdding LOCATION_CHANGE detection with severity %d", logMsg.c_str(), locationDetection.severity);
+        SCAN_LOG_INFO("%sAdding LOCATION_CHANGE detection with severity %d", logMsg.c_str(), locationDetection.severity);
         response.addDetection(locationDetection);
     }
     
@@ -866,7 +874,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         std::string summary = summaryGenerator_->generateAddrManipulationSummary(categorized.addrEvents);
         htmljs_scanner::Detection addrDetection = detectionBuilder_->buildAddrManipulationDetection(
             categorized.addrEvents, summary);
-        core::Log_Info("%sAdding ADDR_MANIPULATION detection with severity %d", logMsg.c_str(), addrDetection.severity);
+        SCAN_LOG_INFO("%sAdding ADDR_MANIPULATION detection with severity %d", logMsg.c_str(), addrDetection.severity);
         response.addDetection(addrDetection);
     }
     
@@ -875,32 +883,35 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         std::string summary = summaryGenerator_->generateEnvironmentSummary(categorized.environmentEvents);
         htmljs_scanner::Detection envDetection = detectionBuilder_->buildEnvironmentDetection(
             categorized.environmentEvents, summary);
-        core::Log_Info("%sAdding ENVIRONMENT_DETECTION detection with severity %d", logMsg.c_str(), envDetection.severity);
+        SCAN_LOG_INFO("%sAdding ENVIRONMENT_DETECTION detection with severity %d", logMsg.c_str(), envDetection.severity);
         response.addDetection(envDetection);
     }
     
-    core::Log_Info("%sTotal critical events: %zu", logMsg.c_str(), categorized.criticalEvents.size());
+    SCAN_LOG_INFO("%sTotal critical events: %zu", logMsg.c_str(), categorized.criticalEvents.size());
     
     // 🔥🔥🔥 중요: staticFindings를 실제 Detection으로 변환
     if (!staticFindings.empty()) {
-        core::Log_Info("%sProcessing %zu static findings as detections", logMsg.c_str(), staticFindings.size());
+        SCAN_LOG_INFO("%sProcessing %zu static findings as detections", logMsg.c_str(), staticFindings.size());
         
         // 🔥 NEW: script_error는 제외 (실행 환경 문제이지 악성 행위가 아님)
+        // - worker 의 스크립트 오류 / 시간 초과도 같음 (jsscanner_workers_total 로 집계)
         std::vector<htmljs_scanner::Detection> filteredFindings;
         for (const auto& finding : staticFindings) {
             if (finding.reason != "script_error" && 
                 finding.reason != "script_complexity_warning" &&
-                finding.reason != "script_complexity_error") {
+                finding.reason != "script_complexity_error" &&
+                finding.reason != "worker_script_error" &&
+                finding.reason != "worker_time_budget_exceeded") {
                 filteredFindings.push_back(finding);
             } else {
-                core::Log_Info("%sSkipping %s detection (not malicious)", logMsg.c_str(), finding.reason.c_str());
+                SCAN_LOG_INFO("%sSkipping %s detection (not malicious)", logMsg.c_str(), finding.reason.c_str());
             }
         }
         
         if (filteredFindings.empty()) {
-            core::Log_Info("%sNo malicious static findings to report after filtering", logMsg.c_str());
+            SCAN_LOG_INFO("%sNo malicious static findings to report after filtering", logMsg.c_str());
         } else {
-            core::Log_Info("%sReporting %zu malicious static findings", logMsg.c_str(), filteredFindings.size());
+            SCAN_LOG_INFO("%sReporting %zu malicious static findings", logMsg.c_str(), filteredFindings.size());
         }
         
         // 같은 타입의 findings를 그룹화
@@ -921,7 +932,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
             
             // Unknown reason 경고
             if (detectionType == HookType::STATIC_FINDING && reason != "static_finding") {
-                core::Log_Warn("Unknown static finding reason: %s", reason.c_str());
+                SCAN_LOG_WARN("Unknown static finding reason: %s", reason.c_str());
             }
             
             // 🎯 상세한 패턴 분석
@@ -1022,7 +1033,7 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
             
             det.addFeature(HookTypeToString(HookType::SUMMARY), JsValue(detailedSummary.str()));
             
-            core::Log_Info("%sAdding static finding detection: severity %d", logMsg.c_str(), det.severity);
+            SCAN_LOG_INFO("%sAdding static finding detection: severity %d", logMsg.c_str(), det.severity);
             response.addDetection(det);
         }
     }
@@ -1175,14 +1186,14 @@ void ResponseGenerator::addDynamicAnalysisResults(AnalysisResponse& response, co
         
         // 🔥 FIX: Severity가 0이면 추가하지 않음 (노이즈 제거)
         if (criticalSeverity > 0) {
-            core::Log_Info("%sAdding critical events detection with severity %d", logMsg.c_str(), criticalSeverity);
+            SCAN_LOG_INFO("%sAdding critical events detection with severity %d", logMsg.c_str(), criticalSeverity);
             response.addDetection(criticalDetection);
         } else {
-            core::Log_Info("%sSkipping critical events detection with severity 0 (low risk)", logMsg.c_str());
+            SCAN_LOG_INFO("%sSkipping critical events detection with severity 0 (low risk)", logMsg.c_str());
         }
     }
 
-    core::Log_Warn("%s=== addDynamicAnalysisResults COMPLETED, Total detections now: %zu ===", logMsg.c_str(), response.getDetections().size());
+    SCAN_LOG_DEBUG("%s=== addDynamicAnalysisResults COMPLETED, Total detections now: %zu ===", logMsg.c_str(), response.getDetections().size());
 }
 
 void ResponseGenerator::addRouteHints(AnalysisResponse& response, const std::vector<htmljs_scanner::Detection>& staticFindings) {
@@ -1221,7 +1232,7 @@ std::string ResponseGenerator::generateAnalysisResponse(const std::string& taskI
     std::vector<std::string>& extractedUrls, long long executionTimeMs, JSAnalyzerContext* a_ctx) {
     AnalysisResponse response = generateAnalysisResponseObject(taskId, staticFindings, extractedUrls, executionTimeMs, a_ctx);
     try {
-        return response.toJson().dump(4); // Pretty print with 4 spaces
+        return response.toJsonString();
     }
     catch (const std::exception& e) {
         return createFallbackErrorResponse(taskId, e.what());
@@ -1268,7 +1279,7 @@ std::vector<ResponseGenerator::TaintGroup> ResponseGenerator::groupTaintedValues
                 }
                 
                 groups.push_back(group);
-                core::Log_Info("%s Grouped String: \"%s\" (%zu chars) - Threat: %s", 
+                SCAN_LOG_INFO("%s Grouped String: \"%s\" (%zu chars) - Threat: %s", 
                               logMsg.c_str(), accumulatedString.c_str(), currentGroup.size(), group.threat.c_str());
             }
             currentGroup.clear();
@@ -1306,7 +1317,7 @@ std::vector<ResponseGenerator::TaintGroup> ResponseGenerator::groupTaintedValues
             group.threat = evaluateThreat(group.combinedValue);
             
             groups.push_back(group);
-            core::Log_Info("%s  Decoded: \"%s\" - Threat: %s", logMsg.c_str(), group.combinedValue.c_str(), group.threat.c_str());
+            SCAN_LOG_INFO("%s  Decoded: \"%s\" - Threat: %s", logMsg.c_str(), group.combinedValue.c_str(), group.threat.c_str());
         }
     }
     
@@ -1387,7 +1398,7 @@ void ResponseGenerator::addTaintGroupsToDetection(htmljs_scanner::Detection& det
 std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveCryptoOperations(const std::vector<HookEvent>& allEvents) const {
     std::vector<CryptoGroup> groups;
     
-    core::Log_Debug("%sStarting crypto operation grouping from %zu events", logMsg.c_str(), allEvents.size());
+    SCAN_LOG_DEBUG("%sStarting crypto operation grouping from %zu events", logMsg.c_str(), allEvents.size());
     
     // 🔥 전략 변경: eval 호출을 기준으로 역추적하여 그룹 생성
     // 각 eval 호출 전에 나온 crypto 작업들을 하나의 그룹으로
@@ -1399,7 +1410,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         }
     }
     
-    core::Log_Debug("%sFound %zu eval calls", logMsg.c_str(), evalIndices.size());
+    SCAN_LOG_DEBUG("%sFound %zu eval calls", logMsg.c_str(), evalIndices.size());
     
     size_t currentCryptoStart = 0;
     
@@ -1409,7 +1420,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         group.events.push_back(allEvents[evalIdx]); // eval 자체 추가
         group.endTime = allEvents[evalIdx].timestamp;
         
-        core::Log_Debug("%s  Processing eval at index %zu", logMsg.c_str(), evalIdx);
+        SCAN_LOG_DEBUG("%s  Processing eval at index %zu", logMsg.c_str(), evalIdx);
         
         // eval 이전의 crypto 작업들을 역순으로 수집
         std::vector<HookEvent> cryptoBeforeEval;
@@ -1418,7 +1429,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         for (int i = static_cast<int>(evalIdx) - 1; i >= static_cast<int>(currentCryptoStart); --i) {
             // 🔥 최대 제한까지만 수집
             if (cryptoBeforeEval.size() >= AnalysisConstants::MAX_CRYPTO_CHAIN_SIZE) {
-                core::Log_Info("%s    Reached max crypto operations limit (%zu), stopping collection",
+                SCAN_LOG_INFO("%s    Reached max crypto operations limit (%zu), stopping collection",
                               logMsg.c_str(), static_cast<size_t>(AnalysisConstants::MAX_CRYPTO_CHAIN_SIZE));
                 break;
             }
@@ -1432,16 +1443,16 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
 
             if (isCryptoRelated) {
                 cryptoBeforeEval.push_back(event);
-                core::Log_Debug("%s    Found crypto: %s at index %d", logMsg.c_str(), event.name.c_str(), i);
+                SCAN_LOG_DEBUG("%s    Found crypto: %s at index %d", logMsg.c_str(), event.name.c_str(), i);
                 nonCryptoCount = 0; // 리셋
             } else {
                 nonCryptoCount++;
-                core::Log_Debug("%s    Skipping non-crypto: %s - %s", 
+                SCAN_LOG_DEBUG("%s    Skipping non-crypto: %s - %s", 
                                logMsg.c_str(), HookTypeToString(event.type).c_str(), event.name.c_str());
 
                 // 연속된 non-crypto 이벤트가 10개 이상이면 중단 (여유 증가)
                 if (nonCryptoCount >= 10) {
-                    core::Log_Debug("%s    Breaking: too many non-crypto events", logMsg.c_str());
+                    SCAN_LOG_DEBUG("%s    Breaking: too many non-crypto events", logMsg.c_str());
                     break;
                 }
             }
@@ -1456,7 +1467,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
             group.description = "Obfuscation + eval: " + std::to_string(cryptoBeforeEval.size()) + " operations";
             
             groups.push_back(group);
-            core::Log_Debug("%s  Group %zu: %zu crypto ops -> eval", 
+            SCAN_LOG_DEBUG("%s  Group %zu: %zu crypto ops -> eval", 
                           logMsg.c_str(), groups.size(), cryptoBeforeEval.size());
             
             // 다음 그룹은 이 eval 이후부터 시작
@@ -1476,7 +1487,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
     for (size_t i = currentCryptoStart; i < allEvents.size(); ++i) {
         // 🔥 최대 1000개까지만 수집
         if (remainingGroup.events.size() >= 1000) {
-            core::Log_Info("%sReached max crypto operations limit (1000) for remaining group, stopping collection", logMsg.c_str());
+            SCAN_LOG_INFO("%sReached max crypto operations limit (1000) for remaining group, stopping collection", logMsg.c_str());
             break;
         }
 
@@ -1498,7 +1509,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         remainingGroup.hasEval = false;
         remainingGroup.description = "Obfuscation chain: " + std::to_string(remainingGroup.events.size()) + " operations (no eval)";
         groups.push_back(remainingGroup);
-        core::Log_Debug("%s  Group %zu: %zu crypto ops (remaining, no eval)", 
+        SCAN_LOG_DEBUG("%s  Group %zu: %zu crypto ops (remaining, no eval)", 
                       logMsg.c_str(), groups.size(), remainingGroup.events.size());
     }
     
@@ -1509,7 +1520,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         for (size_t i = 0; i < evalIndices[0]; ++i) {
             // 🔥 최대 1000개까지만 수집
             if (firstGroup.events.size() >= 1000) {
-                core::Log_Info("%sReached max crypto operations limit (1000) for first group, stopping collection", logMsg.c_str());
+                SCAN_LOG_INFO("%sReached max crypto operations limit (1000) for first group, stopping collection", logMsg.c_str());
                 break;
             }
 
@@ -1526,7 +1537,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
             firstGroup.hasEval = false;
             firstGroup.description = "Obfuscation chain: " + std::to_string(firstGroup.events.size()) + " operations";
             groups.push_back(firstGroup);
-            core::Log_Debug("%s  Group %zu: %zu crypto ops (before first eval)", 
+            SCAN_LOG_DEBUG("%s  Group %zu: %zu crypto ops (before first eval)", 
                           logMsg.c_str(), groups.size(), firstGroup.events.size());
         }
     }
@@ -1550,7 +1561,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         // Array.join만 있고 10개 미만이면 그룹 제외
         int nonArrayJoinCount = totalObfuscationCount - arrayJoinCount;
         if (arrayJoinCount > 0 && arrayJoinCount < 10 && nonArrayJoinCount == 0) {
-            core::Log_Info("%sFiltering out crypto group: Array.join count (%d) below threshold (10) with no other obfuscation functions", 
+            SCAN_LOG_INFO("%sFiltering out crypto group: Array.join count (%d) below threshold (10) with no other obfuscation functions", 
                           logMsg.c_str(), arrayJoinCount);
             continue;
         }
@@ -1558,7 +1569,7 @@ std::vector<ResponseGenerator::CryptoGroup> ResponseGenerator::groupConsecutiveC
         filteredGroups.push_back(group);
     }
 
-    core::Log_Info("%sCrypto grouping result: %zu independent groups (filtered from %zu)", 
+    SCAN_LOG_INFO("%sCrypto grouping result: %zu independent groups (filtered from %zu)", 
                   logMsg.c_str(), filteredGroups.size(), groups.size());
     return filteredGroups;
 }
@@ -1594,7 +1605,7 @@ void ResponseGenerator::addCryptoGroupDetection(AnalysisResponse& response, cons
     // 🔥 Array.join이 10개 미만이고 다른 난독화 함수가 없으면 그룹 무효화
     int nonArrayJoinCount = static_cast<int>(cryptoChain.size()) - arrayJoinCount;
     if (arrayJoinCount > 0 && arrayJoinCount < 10 && nonArrayJoinCount == 0) {
-        core::Log_Info("%sSkipping crypto group: Array.join count (%d) below threshold (10) with no other obfuscation functions", 
+        SCAN_LOG_INFO("%sSkipping crypto group: Array.join count (%d) below threshold (10) with no other obfuscation functions", 
                       logMsg.c_str(), arrayJoinCount);
         return;  // 그룹을 추가하지 않음
     }
@@ -1623,7 +1634,7 @@ void ResponseGenerator::addCryptoGroupDetection(AnalysisResponse& response, cons
     
     detection.severity = maxSeverity;
     
-    core::Log_Info("%sAdding crypto group detection: %s with severity %d", 
+    SCAN_LOG_INFO("%sAdding crypto group detection: %s with severity %d", 
                   logMsg.c_str(), detection.name.c_str(), maxSeverity);
     addDetectionWithOrder(response, detection, orderCounter);
 }
@@ -1644,7 +1655,7 @@ void ResponseGenerator::collectDomUrls(const std::vector<HookEvent>& domEvents)
             
             if (!url.empty() && url != "null" && url != "undefined") {
                 domExtractedUrls_.push_back(url);
-                core::Log_Info("%sCollected URL from DOM manipulation: %s", logMsg.c_str(), url.c_str());
+                SCAN_LOG_INFO("%sCollected URL from DOM manipulation: %s", logMsg.c_str(), url.c_str());
             }
         }
     }
@@ -1809,3 +1820,52 @@ void ResponseGenerator::addExternalCommunicationDetection(
         response.addDetection(detection);
     }
 }
+
+void ResponseGenerator::addDroppedFileDetection(
+    AnalysisResponse& response,
+    const std::vector<VirtualFileSystem::Artifact>& artifacts,
+    int& orderCounter) {
+
+    auto isExecutable = [](const std::string& type) {
+        return type == "pe" || type == "elf" || type == "script" || type == "ole";
+    };
+
+    int executedCount = 0;
+    int executableCount = 0;
+    for (const auto& artifact : artifacts) {
+        if (artifact.executed) executedCount++;
+        if (isExecutable(artifact.type)) executableCount++;
+    }
+
+    // 실행까지 한 실행 파일 > 실행 파일 기록 > 그 외 파일 기록
+    htmljs_scanner::Detection detection;
+    detection.name = "JSScanner.DROPPED_FILE";
+    if (executedCount > 0 && executableCount > 0) {
+        detection.severity = 10;
+    } else if (executableCount > 0 || executedCount > 0) {
+        detection.severity = 8;
+    } else {
+        detection.severity = 5;
+    }
+
+    detection.features["file_count"] = JsValue(std::to_string(artifacts.size()));
+    detection.features["executed_count"] = JsValue(std::to_string(executedCount));
+
+    // 파일 목록 (최대 10개): "path (type, size bytes, sha256) [executed]"
+    size_t displayCount = std::min<size_t>(10, artifacts.size());
+    for (size_t i = 0; i < displayCount; ++i) {
+        const auto& artifact = artifacts[i];
+        std::string entry = artifact.path + " (" + artifact.type + ", " + std::to_string(artifact.size) +
+                            " bytes, " + artifact.sha256 + ")";
+        if (artifact.executed) entry += " [executed]";
+        if (artifact.truncated) entry += " [truncated]";
+        detection.features["file_" + std::to_string(i + 1)] = JsValue(entry);
+    }
+
+    std::string summary = "Script wrote " + std::to_string(artifacts.size()) + " file(s) to disk";
+    if (executedCount > 0) {
+        summary += " and executed " + std::to_string(executedCount) + " of them";
+    }
+    detection.features[HookTypeToString(HookType::SUMMARY)] = JsValue(summary);
+    addDetectionWithOrder(response, detection, orderCounter);
+}
@@ -18,6 +18,7 @@
 #include "metadata/RouteHint.h"
 #include "../chain/AttackChain.h"
 #include "../chain/ChainStep.h"
+#include "../core/VirtualFileSystem.h"
 #include "../core/ChainTrackerManager.h"
 #include "../core/DynamicStringTracker.h"
 #include "builders/DetectionBuilder.h"
@@ -61,6 +62,11 @@ private:
     void addExternalCommunicationDetection(AnalysisResponse& response, 
                                           const std::vector<UrlMetadata>& urlMetadataList,
                                           int& orderCounter);
+
+    // 🔥 NEW: ActiveX 가 가상 파일시스템에 떨어뜨린 파일
+    void addDroppedFileDetection(AnalysisResponse& response,
+                                 const std::vector<VirtualFileSystem::Artifact>& artifacts,
+                                 int& orderCounter);
     
     // ⚠️ REMOVED: generateAttackChainSummary - using SummaryGenerator::generateAttackChainSummary
     // Sub-methods for addDynamicAnalysisResults
@@ -15,6 +15,12 @@ namespace AnalysisConstants {
      */
     constexpr int MIN_RELEVANT_SEVERITY = 5;
 
+    /**
+     * 난독화 체인 그룹핑에 쓰이는 CRYPTO_OPERATION / FUNCTION_CALL 의 최소 severity
+     * (OBFUSCATION_FUNCTIONS 중 가장 낮은 Array.join 이 2)
+     */
+    constexpr int MIN_CHAIN_EVENT_SEVERITY = 2;
+
     /**
      * Taint 데이터가 보고서에 포함되는 최소 level
      */
@@ -8,6 +8,42 @@ Timing::Timing(long long tookMs)
 nlohmann::json Timing::toJson() const {
     nlohmann::json j;
     j["TookMs"] = tookMs;
+    if (!stages.empty() || !blocks.empty()) {
+        nlohmann::json breakdown = stagesToJson();
+        j["Stages"] = breakdown["Stages"];
+        j["Blocks"] = breakdown["Blocks"];
+    }
+    return j;
+}
+
+nlohmann::json Timing::stagesToJson() const {
+    nlohmann::json stages_json = nlohmann::json::array();
+    for (const auto& stage : stages) {
+        stages_json.push_back({
+            {"Stage", stage.path},
+            {"Depth", stage.depth},
+            {"Count", stage.count},
+            {"TotalMs", stage.totalMs},
+            {"MaxMs", stage.maxMs}
+        });
+    }
+
+    nlohmann::json blocks_json = nlohmann::json::array();
+    for (const auto& block : blocks) {
+        nlohmann::json block_stages = nlohmann::json::object();
+        for (const auto& [name, ms] : block.stages) {
+            block_stages[name] = ms;
+        }
+        blocks_json.push_back({
+            {"Block", block.index},
+            {"TotalMs", block.totalMs},
+            {"Stages", block_stages}
+        });
+    }
+
+    nlohmann::json j;
+    j["Stages"] = stages_json;
+    j["Blocks"] = blocks_json;
     return j;
 }
 
@@ -17,4 +53,32 @@ void to_json(nlohmann::json& j, const Timing& p) {
 
 void from_json(const nlohmann::json& j, Timing& p) {
     j.at("TookMs").get_to(p.tookMs);
+
+    p.stages.clear();
+    if (j.contains("Stages") && j["Stages"].is_array()) {
+        for (const auto& item : j["Stages"]) {
+            StageTiming stage;
+            item.at("Stage").get_to(stage.path);
+            stage.depth = item.value("Depth", 0);
+            stage.count = item.value("Count", 0LL);
+            stage.totalMs = item.value("TotalMs", 0.0);
+            stage.maxMs = item.value("MaxMs", 0.0);
+            p.stages.push_back(std::move(stage));
+        }
+    }
+
+    p.blocks.clear();
+    if (j.contains("Blocks") && j["Blocks"].is_array()) {
+        for (const auto& item : j["Blocks"]) {
+            BlockTiming block;
+            block.index = item.value("Block", 0);
+            block.totalMs = item.value("TotalMs", 0.0);
+            if (item.contains("Stages") && item["Stages"].is_object()) {
+                for (auto it = item["Stages"].begin(); it != item["Stages"].end(); ++it) {
+                    block.stages.emplace_back(it.key(), it.value().get<double>());
+                }
+            }
+            p.blocks.push_back(std::move(block));
+        }
+    }
 }
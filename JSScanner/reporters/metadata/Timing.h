@@ -1,25 +1,50 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <utility>
 
 // For JSON serialization (assuming nlohmann/json)
 #include "../../../../Getter/Resolver/ExternalLib_json.hpp"
 
+// 단계별 누적 시간 (StageProfiler 호출 트리의 한 노드)
+struct StageTiming {
+    std::string path;     // 예: "block/js_eval"
+    int depth = 0;
+    long long count = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+};
+
+// JavaScript 블록별 시간
+struct BlockTiming {
+    int index = 0;
+    double totalMs = 0.0;
+    std::vector<std::pair<std::string, double>> stages;
+};
+
 class Timing {
 public:
     long long tookMs = 0;
+    std::vector<StageTiming> stages;
+    std::vector<BlockTiming> blocks;
     
     Timing() = default;
     Timing(long long tookMs);
 
     // Getters
     long long getTookMs() const { return tookMs; }
+    const std::vector<StageTiming>& getStages() const { return stages; }
+    const std::vector<BlockTiming>& getBlocks() const { return blocks; }
 
     // Setters
     void setTookMs(long long tookMs) { this->tookMs = tookMs; }
+    void setStages(std::vector<StageTiming> stages) { this->stages = std::move(stages); }
+    void setBlocks(std::vector<BlockTiming> blocks) { this->blocks = std::move(blocks); }
 
     // JSON serialization
     nlohmann::json toJson() const;
+    nlohmann::json stagesToJson() const;
 };
 
 // nlohmann/json serialization for Timing
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <re2/re2.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "../builtin/helpers/Base64Utils.h"
+
+// ============================================================================
+// Base64Utils codec 정확성 (이전 구현과 동일한 결과) 및 처리량 비교
+// ============================================================================
+namespace {
+
+// 이전 Base64Utils::decode (문자마다 find 로 검색, 1바이트씩 append)
+std::string legacyDecode(const std::string& encoded_string) {
+    static const std::string base64_chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz"
+        "0123456789+/";
+    auto isBase64Char = [](unsigned char c) { return (isalnum(c) || (c == '+') || (c == '/')); };
+
+    int in_len = encoded_string.size();
+    int i = 0;
+    int j = 0;
+    int in_ = 0;
+    unsigned char char_array_4[4], char_array_3[3];
+    std::string ret;
+
+    while (in_len-- && (encoded_string[in_] != '=') && isBase64Char(encoded_string[in_])) {
+        char_array_4[i++] = encoded_string[in_]; in_++;
+        if (i == 4) {
+            for (i = 0; i < 4; i++)
+                char_array_4[i] = base64_chars.find(char_array_4[i]);
+
+            char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
+            char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
+            char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
+
+            for (i = 0; (i < 3); i++)
+                ret += char_array_3[i];
+            i = 0;
+        }
+    }
+
+    if (i) {
+        for (j = i; j < 4; j++)
+            char_array_4[j] = 0;
+
+        for (j = 0; j < 4; j++)
+            char_array_4[j] = base64_chars.find(char_array_4[j]);
+
+        char_array_3[0] = (char_array_4[0] << 2) + ((char_array_4[1] & 0x30) >> 4);
+        char_array_3[1] = ((char_array_4[1] & 0xf) << 4) + ((char_array_4[2] & 0x3c) >> 2);
+        char_array_3[2] = ((char_array_4[2] & 0x3) << 6) + char_array_4[3];
+
+        for (j = 0; (j < i - 1); j++) ret += char_array_3[j];
+    }
+
+    return ret;
+}
+
+std::string randomBytes(std::mt19937& rng, size_t len) {
+    std::string out(len, '\0');
+    for (char& c : out) c = static_cast<char>(rng() & 0xFF);
+    return out;
+}
+
+// 대부분 Base64 문자에 가끔 '=' / 공백 / 비 ASCII 가 섞인 입력
+std::string noisyBase64(std::mt19937& rng, size_t len) {
+    static const char kNoise[] = "= -_\x80\xff.";
+    std::string out = Base64Utils::encode(randomBytes(rng, len));
+    if (!out.empty() && rng() % 3 == 0) {
+        out[rng() % out.size()] = kNoise[rng() % (sizeof(kNoise) - 1)];
+    }
+    return out.substr(0, out.size() - rng() % 4);
+}
+
+} // namespace
+
+TEST(Base64UtilsTest, DecodeMatchesLegacyImplementation) {
+    std::mt19937 rng(1234);
+    for (int round = 0; round < 5000; ++round) {
+        std::string input = noisyBase64(rng, rng() % 64);
+        ASSERT_EQ(Base64Utils::decode(input), legacyDecode(input)) << "input: " << input;
+    }
+    EXPECT_EQ(Base64Utils::decode("aGVsbG8="), "hello");
+    EXPECT_EQ(Base64Utils::decode("aGVsbG8"), "hello");
+    EXPECT_EQ(Base64Utils::decode("aGVs bG8="), "hel");
+    EXPECT_EQ(Base64Utils::decode(""), "");
+}
+
+TEST(Base64UtilsTest, RoundTripsBothAlphabets) {
+    std::mt19937 rng(99);
+    for (int round = 0; round < 2000; ++round) {
+        std::string data = randomBytes(rng, rng() % 100);
+        std::string standard = Base64Utils::encode(data);
+        std::string url = Base64Utils::encode(data, Base64Utils::Alphabet::Url, false);
+
+        EXPECT_EQ(standard.size() % 4, 0u);
+        EXPECT_EQ(url.find_first_of("+/="), std::string::npos);
+        EXPECT_EQ(Base64Utils::decode(standard), data);
+        EXPECT_EQ(Base64Utils::decode(url, Base64Utils::Alphabet::Url), data);
+    }
+    EXPECT_EQ(Base64Utils::encode("\xfb\xff", Base64Utils::Alphabet::Standard), "+/8=");
+    EXPECT_EQ(Base64Utils::encode("\xfb\xff", Base64Utils::Alphabet::Url, false), "-_8");
+}
+
+TEST(Base64UtilsTest, ValidatorsMatchRegexChecks) {
+    RE2 anyPadding("[A-Za-z0-9+/]+=*");
+    RE2 twoPadding("[A-Za-z0-9+/]+={0,2}");
+    RE2 run50("[A-Za-z0-9+/]{50,}");
+
+    std::mt19937 rng(7);
+    for (int round = 0; round < 5000; ++round) {
+        std::string input = noisyBase64(rng, rng() % 80);
+        if (rng() % 4 == 0) input += std::string(rng() % 4, '=');
+
+        EXPECT_EQ(Base64Utils::isBase64(input), RE2::FullMatch(input, anyPadding)) << input;
+        EXPECT_EQ(Base64Utils::isBase64(input, 2), RE2::FullMatch(input, twoPadding)) << input;
+        EXPECT_EQ(Base64Utils::containsBase64Run(input, 50), RE2::PartialMatch(input, run50)) << input;
+    }
+}
+
+TEST(Base64UtilsBenchmark, DecodeVersusLegacy) {
+    std::mt19937 rng(42);
+    std::vector<std::string> inputs;
+    size_t totalBytes = 0;
+    for (int i = 0; i < 2000; ++i) {
+        inputs.push_back(Base64Utils::encode(randomBytes(rng, 16 + rng() % 2048)));
+        totalBytes += inputs.back().size();
+    }
+
+    auto timeMs = [&](auto&& fn) {
+        size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < 5; ++rep) {
+            for (const std::string& input : inputs) sink += fn(input).size();
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_GT(sink, 0u);
+        return ms;
+    };
+
+    double legacyMs = timeMs(legacyDecode);
+    double tableMs = timeMs([](const std::string& s) { return Base64Utils::decode(s); });
+
+    RE2 anyPadding("[A-Za-z0-9+/]+=*");
+    double regexMs = timeMs([&](const std::string& s) { return std::string(RE2::FullMatch(s, anyPadding), 'x'); });
+    double validatorMs = timeMs([](const std::string& s) { return std::string(Base64Utils::isBase64(s), 'x'); });
+
+    double mb = totalBytes * 5 / (1024.0 * 1024.0);
+    std::cout << "[ BENCH    ] decode legacy: " << legacyMs << " ms (" << mb / (legacyMs / 1000) << " MB/s), table: "
+              << tableMs << " ms (" << mb / (tableMs / 1000) << " MB/s), speedup: "
+              << (tableMs > 0 ? legacyMs / tableMs : 0.0) << "x" << std::endl;
+    std::cout << "[ BENCH    ] validate RE2: " << regexMs << " ms, table: " << validatorMs << " ms, speedup: "
+              << (validatorMs > 0 ? regexMs / validatorMs : 0.0) << "x" << std::endl;
+    RecordProperty("legacy_decode_ms", std::to_string(legacyMs));
+    RecordProperty("table_decode_ms", std::to_string(tableMs));
+    RecordProperty("re2_validate_ms", std::to_string(regexMs));
+    RecordProperty("table_validate_ms", std::to_string(validatorMs));
+}
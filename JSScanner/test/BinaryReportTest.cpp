@@ -0,0 +1,169 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../reporters/BinaryReport.h"
+#include "../reporters/AnalysisResponse.h"
+
+// ============================================================================
+// CBOR + LZ4 보고서 - 저장하는 보고서 JSON 으로 그대로 되돌아오는지 (round-trip)
+// ============================================================================
+
+namespace {
+
+AnalysisResponse makeResponse(int detections) {
+    AnalysisResponse response("task-7");
+    response.addExtractedUrl("https://cdn.example/x.js");
+    response.addExtractedFile("scan_report/task-7.files/00ff");
+
+    for (int i = 0; i < detections; ++i) {
+        htmljs_scanner::Detection detection;
+        detection.analysisCode = "DA";
+        detection.name = "JSScanner.Rule" + std::to_string(i);
+        detection.severity = i % 11;
+        detection.detectionOrder = detections - i;
+        detection.addFeature("count", i);
+        detection.addFeature("negative", -i - 0.5);
+        detection.addFeature("ratio", 1.0 / (i + 3));
+        detection.addFeature("small", 0.25);
+        detection.addFeature("flag", i % 2 == 0);
+        detection.addFeature("missing", JsValue());
+        detection.addFeature("text", std::string("line\n\"quoted\" \xED\x95\x9C\xEA\xB8\x80 ") + std::to_string(i));
+        detection.addFeature("list", std::vector<JsValue>{JsValue(1e300), JsValue(std::string("x")), JsValue(false)});
+        detection.addFeature("object", std::map<std::string, JsValue>{{"k", JsValue(65536)}, {"e", JsValue(std::vector<JsValue>{})}});
+        response.addDetection(detection);
+    }
+
+    RouteHint hint("DeobfuscationAnalyzer", "packed");
+    hint.addTrigger("eval");
+    response.addRouteHint(hint);
+
+    Timing timing(1234567890123LL);
+    timing.stages.push_back({"block/js_eval", 1, 4000000000LL, 0.001, 1e-7});
+    timing.blocks.push_back({2, 3.5, {{"js_eval", 2.0}}});
+    response.Timings.push_back(timing);
+
+    TaintedValue taint("taint_9", JsValue(std::string("v")), "atob", -3, "r");
+    taint.addParent("taint_1");
+    response.addTaintedValue(taint);
+    response.addTaintStatistic("ratio", 0.5);
+    response.ApiCallCounts["eval"] = 18446744073709551615ull;
+    response.version = htmljs_scanner::Version("1.0.0", "2026-10-19");
+    return response;
+}
+
+// SCANNER_REPORT 형식 (값은 대부분 문자열, feature 값은 JSON 문자열)
+const std::string SCANNER_REPORT_JSON =
+    R"({"Detections":[{"AnalysisCode":"DA","Name":"JSScanner.Eval","Severity":"7",)"
+    R"("features":{"key":["count","text"],"value":["3","\"a\\nb\""]}}],)"
+    R"("ExtractedFile":["scan_report/7.files/00ff"],"ExtractedURL":["https://cdn.example/x.js"],)"
+    R"("RouteHints":[],"Status":"OK","TaskId":"7","Timing":{"duration":-0.5,"start":1234567890123},)"
+    R"("Version":"1.0.0","Errors":null,"Ok":true,"Text":"\u0001\t한글 🔥"})";
+
+}  // namespace
+
+TEST(BinaryReportTest, RoundTripMatchesAnalysisJson) {
+    // 저장하는 보고서 JSON (한 줄) 은 key 순서까지 바이트 단위로 같음
+    for (const std::string& analysisJson : {SCANNER_REPORT_JSON, makeResponse(25).toJsonString()}) {
+        std::string encoded;
+        std::string error;
+        ASSERT_TRUE(BinaryReport::encode(analysisJson, encoded, &error)) << error;
+
+        std::string json;
+        ASSERT_TRUE(BinaryReport::decodeToJson(encoded, json, -1, &error)) << error;
+        EXPECT_EQ(json, analysisJson);
+
+        std::string pretty;
+        ASSERT_TRUE(BinaryReport::decodeToJson(encoded, pretty, 4, &error)) << error;
+        EXPECT_EQ(pretty, nlohmann::ordered_json::parse(analysisJson).dump(4));
+    }
+
+    // 들여쓴 JSON 은 같은 값 (공백만 다름)
+    const std::string indented = makeResponse(3).toJsonString(4);
+    std::string encoded;
+    std::string json;
+    ASSERT_TRUE(BinaryReport::encode(indented, encoded));
+    ASSERT_TRUE(BinaryReport::decodeToJson(encoded, json, 4));
+    EXPECT_EQ(json, indented);
+}
+
+TEST(BinaryReportTest, EmptyReportRoundTrips) {
+    for (const std::string analysisJson : {"{}", "[]", "null", "0"}) {
+        std::string encoded;
+        ASSERT_TRUE(BinaryReport::encode(analysisJson, encoded));
+        std::string json;
+        ASSERT_TRUE(BinaryReport::decodeToJson(encoded, json));
+        EXPECT_EQ(json, analysisJson);
+    }
+}
+
+TEST(BinaryReportTest, CborIsReadableByStandardDecoder) {
+    std::string cbor;
+    ASSERT_TRUE(BinaryReport::encodeCbor(SCANNER_REPORT_JSON, cbor));
+    ASSERT_GE(cbor.size(), 3u);
+    EXPECT_EQ(cbor.substr(0, 3), "\xD9\xD9\xF7");   // self-describe tag
+
+    nlohmann::ordered_json decoded = nlohmann::ordered_json::from_cbor(cbor, true, true, nlohmann::ordered_json::cbor_tag_handler_t::ignore);
+    EXPECT_EQ(decoded.dump(), SCANNER_REPORT_JSON);
+
+    // 압축 없는 CBOR 도 decodeToJson 으로 읽힘
+    std::string json;
+    ASSERT_TRUE(BinaryReport::decodeToJson(cbor, json));
+    EXPECT_EQ(json, SCANNER_REPORT_JSON);
+}
+
+TEST(BinaryReportTest, SmallerThanIndentedJson) {
+    AnalysisResponse response = makeResponse(500);
+    std::string encoded;
+    ASSERT_TRUE(BinaryReport::encode(response.toJsonString(), encoded));
+    EXPECT_LT(encoded.size() * 4, response.toJsonString(4).size());
+}
+
+TEST(BinaryReportTest, InvalidJsonFailsWithoutThrowing) {
+    std::string encoded = "stale";
+    std::string error;
+    EXPECT_FALSE(BinaryReport::encode("{\"a\":", encoded, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(encoded.empty());
+    EXPECT_FALSE(BinaryReport::encode("{} {}", encoded, &error));
+    EXPECT_FALSE(BinaryReport::encode("\"\xFF\"", encoded, &error));
+
+    // decodeToJson 이 다시 읽을 수 있는 깊이까지만
+    std::string deep = std::string(255, '[') + std::string(255, ']');
+    ASSERT_TRUE(BinaryReport::encode(deep, encoded, &error)) << error;
+    std::string json;
+    ASSERT_TRUE(BinaryReport::decodeToJson(encoded, json, -1, &error)) << error;
+    EXPECT_EQ(json, deep);
+    EXPECT_FALSE(BinaryReport::encode("[" + deep + "]", encoded, &error));
+}
+
+TEST(BinaryReportTest, CorruptInputFailsWithoutThrowing) {
+    const std::string analysisJson = makeResponse(5).toJsonString();
+    std::string encoded;
+    ASSERT_TRUE(BinaryReport::encode(analysisJson, encoded));
+
+    std::string json;
+    std::string error;
+    EXPECT_FALSE(BinaryReport::decodeToJson(encoded.substr(0, encoded.size() / 2), json, -1, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(json.empty());
+
+    std::string flipped = encoded;
+    flipped[flipped.size() / 2] ^= 0x5A;
+    EXPECT_FALSE(BinaryReport::decodeToJson(flipped, json, -1, &error));   // content checksum
+
+    std::string cbor;
+    ASSERT_TRUE(BinaryReport::encodeCbor(analysisJson, cbor));
+    EXPECT_FALSE(BinaryReport::decodeToJson(cbor.substr(0, cbor.size() - 1), json, -1, &error));
+    EXPECT_FALSE(BinaryReport::decodeToJson(cbor + "\x01", json, -1, &error));
+    EXPECT_FALSE(BinaryReport::decodeToJson(std::string("\x9B\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF", 9), json, -1, &error));
+    EXPECT_FALSE(BinaryReport::decodeToJson(std::string(1000, '\x9F'), json, -1, &error));   // 중첩 한도
+    EXPECT_FALSE(BinaryReport::decodeToJson("", json, -1, &error));
+    EXPECT_FALSE(BinaryReport::decodeToJson(std::string("\x1F", 1), json, -1, &error));   // 길이 미정 정수
+}
+
+TEST(BinaryReportTest, ParseFormat) {
+    EXPECT_EQ(BinaryReport::parseFormat(nullptr), ReportFormat::Json);
+    EXPECT_EQ(BinaryReport::parseFormat("json"), ReportFormat::Json);
+    EXPECT_EQ(BinaryReport::parseFormat("CBOR"), ReportFormat::CborLz4);
+    EXPECT_EQ(BinaryReport::parseFormat("cbor-lz4"), ReportFormat::CborLz4);
+    EXPECT_EQ(BinaryReport::parseFormat("msgpack"), ReportFormat::Json);
+}
@@ -0,0 +1,90 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/BrowserConfig.h"
+#include "../core/BrowserEnvShim.h"
+
+// ============================================================================
+// 브라우저 환경 shim - 컴파일 성공 (실패는 컨텍스트 생성 오류), BrowserConfig 값 반영
+// ============================================================================
+namespace {
+
+class ShimContext {
+public:
+    ShimContext() {
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+    }
+
+    ~ShimContext() {
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    std::string eval(const std::string& code) {
+        JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+        if (JS_IsException(result)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return "<exception>";
+        }
+        const char* str = JS_ToCString(ctx, result);
+        std::string out = str ? str : "";
+        JS_FreeCString(ctx, str);
+        JS_FreeValue(ctx, result);
+        return out;
+    }
+
+    JSRuntime* rt;
+    JSContext* ctx;
+};
+
+BrowserConfig testProfile() {
+    BrowserConfig config = BrowserConfig::getDefaultDesktopProfile();
+    config.userAgent = "TestAgent/1.0";
+    config.platform = "TestOS";
+    config.languages = "ko-KR,ko,en";
+    config.hardwareConcurrency = 3;
+    config.hasWebdriver = true;
+    config.documentURL = "https://example.test/path/page.html";
+    config.documentReadyState = "interactive";
+    config.screenWidth = 1234;
+    config.screenAvailHeight = 567;
+    return config;
+}
+
+} // namespace
+
+TEST(BrowserConfigTest, ShimCompiles) {
+    EXPECT_GT(BrowserEnvShim::bytecodeSize(), 0u);
+}
+
+TEST(BrowserConfigTest, InstallsNavigatorLocationScreenDocument) {
+    ShimContext js;
+    ASSERT_NO_THROW(testProfile().initializeJSEnvironment(js.ctx));
+
+    EXPECT_EQ(js.eval("[navigator.userAgent, navigator.platform, navigator.hardwareConcurrency, navigator.webdriver].join('|')"),
+              "TestAgent/1.0|TestOS|3|true");
+    EXPECT_EQ(js.eval("JSON.stringify(navigator.languages)"), "[\"ko-KR\",\"ko\",\"en\"]");
+    EXPECT_EQ(js.eval("[location.href, location.protocol, location.host, location.hostname, location.pathname].join('|')"),
+              "https://example.test/path/page.html|https:|example.test|example.test|/path/page.html");
+    EXPECT_EQ(js.eval("document.location === location && document.readyState"), "interactive");
+    EXPECT_EQ(js.eval("typeof document.createElement('div')"), "object");
+    EXPECT_EQ(js.eval("[screen.width, screen.availHeight].join('|')"), "1234|567");
+    // setter 를 우회해 정의한 일반 데이터 속성
+    EXPECT_EQ(js.eval("var d = Object.getOwnPropertyDescriptor(navigator, 'userAgent');"
+                      "[d.writable, d.enumerable, d.configurable].join('|')"),
+              "true|true|true");
+}
+
+TEST(BrowserConfigTest, KeepsExistingDocumentAndParsesBareUrls) {
+    ShimContext js;
+    js.eval("globalThis.document = { mine: true };");
+    BrowserConfig config = testProfile();
+    config.documentURL = "http://host.test";
+    config.initializeJSEnvironment(js.ctx);
+    EXPECT_EQ(js.eval("document.mine + '|' + document.location.pathname + '|' + location.host"), "true|/|host.test");
+
+    ShimContext blank;
+    config.documentURL = "about:blank";
+    config.initializeJSEnvironment(blank.ctx);
+    EXPECT_EQ(blank.eval("[location.protocol, location.host, location.pathname].join('|')"), "about:||blank");
+}
@@ -0,0 +1,141 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/BrowserStorage.h"
+
+// ============================================================================
+// Task 단위 브라우저 저장소 - 세대 기반 clear / 한도 / cookie 갱신 / reset
+// ============================================================================
+
+TEST(StorageAreaTest, SetGetRemoveKeepsInsertionOrder) {
+    StorageArea area(16, 1024);
+    EXPECT_TRUE(area.set("b", "2"));
+    EXPECT_TRUE(area.set("a", "1"));
+    EXPECT_TRUE(area.set("b", "22"));       // 덮어써도 순서 유지
+    ASSERT_NE(area.get("b"), nullptr);
+    EXPECT_EQ(*area.get("b"), "22");
+    EXPECT_EQ(area.size(), 2u);
+    EXPECT_EQ(area.bytes(), 5u);
+
+    auto items = area.items();
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_EQ(items[0].first, "b");
+    EXPECT_EQ(items[1].first, "a");
+
+    std::string removed;
+    EXPECT_TRUE(area.remove("b", &removed));
+    EXPECT_EQ(removed, "22");
+    EXPECT_FALSE(area.remove("b"));
+    EXPECT_EQ(area.get("b"), nullptr);
+    EXPECT_EQ(area.bytes(), 2u);
+}
+
+TEST(StorageAreaTest, ClearIsGenerationBumpAndEntriesAreReused) {
+    StorageArea area(1000, 1 << 20);
+    for (int i = 0; i < 500; ++i) {
+        area.set("k" + std::to_string(i), "v");
+    }
+    EXPECT_EQ(area.clear(), 500u);
+    EXPECT_EQ(area.size(), 0u);
+    EXPECT_EQ(area.bytes(), 0u);
+    EXPECT_EQ(area.get("k1"), nullptr);
+    EXPECT_TRUE(area.items().empty());
+    EXPECT_FALSE(area.remove("k1"));
+
+    // 이전 세대 key 를 다시 쓰면 새 항목으로 취급 (순서도 새로)
+    EXPECT_TRUE(area.set("k7", "x"));
+    EXPECT_TRUE(area.set("fresh", "y"));
+    auto items = area.items();
+    ASSERT_EQ(items.size(), 2u);
+    EXPECT_EQ(items[0].first, "k7");
+    EXPECT_EQ(area.size(), 2u);
+
+    // 새 key 가 계속 들어와도 이전 세대 항목은 정리되어 한도 계산에 영향 없음
+    for (int i = 0; i < 900; ++i) {
+        ASSERT_TRUE(area.set("n" + std::to_string(i), "v"));
+    }
+    EXPECT_EQ(area.size(), 902u);
+}
+
+TEST(StorageAreaTest, RepeatedClearDoesNotRetainStaleValues) {
+    StorageArea area(100, 1000);
+    const std::string big(400, 'x');
+
+    // 첫 clear 뒤에는 이전 세대 값이 남아 있음 (한도 이내)
+    area.set("a", big);
+    area.set("b", big);
+    area.clear();
+    EXPECT_EQ(area.staleBytes(), 802u);
+
+    // 이전 세대 key 재사용은 stale 바이트에서 빠짐
+    area.set("a", "1");
+    EXPECT_EQ(area.staleBytes(), 401u);
+
+    // 한도를 넘는 이전 세대 바이트는 clear 에서 해제
+    for (int round = 0; round < 50; ++round) {
+        ASSERT_TRUE(area.set("c" + std::to_string(round), big));
+        area.clear();
+        EXPECT_LE(area.staleBytes(), 1000u);
+    }
+    EXPECT_EQ(area.get("a"), nullptr);
+    EXPECT_TRUE(area.items().empty());
+    EXPECT_TRUE(area.set("a", big));
+    EXPECT_EQ(area.bytes(), 401u);
+}
+
+TEST(StorageAreaTest, LimitsRejectWithoutChangingState) {
+    StorageArea area(2, 10);
+    EXPECT_TRUE(area.set("a", "1234"));
+    EXPECT_FALSE(area.set("b", "123456"));     // 5 + 7 > 10
+    EXPECT_TRUE(area.limitReached());
+    EXPECT_EQ(area.get("b"), nullptr);
+    EXPECT_TRUE(area.set("a", "123456789"));   // 교체는 기존 크기를 빼고 계산
+    EXPECT_EQ(area.bytes(), 10u);
+
+    StorageArea few(2, 1024);
+    EXPECT_TRUE(few.set("a", ""));
+    EXPECT_TRUE(few.set("b", ""));
+    EXPECT_FALSE(few.set("c", ""));
+    EXPECT_TRUE(few.set("a", "again"));
+}
+
+TEST(BrowserStorageTest, CookieAssignmentsMergeAndExpire) {
+    BrowserStorage storage;
+    EXPECT_EQ(storage.cookieString(), "");
+    EXPECT_EQ(storage.setCookie("sid=abc; path=/; Secure"), BrowserStorage::CookieUpdate::Stored);
+    EXPECT_EQ(storage.setCookie(" theme = dark "), BrowserStorage::CookieUpdate::Stored);
+    EXPECT_EQ(storage.setCookie("sid=def"), BrowserStorage::CookieUpdate::Stored);
+    EXPECT_EQ(storage.cookieString(), "sid=def; theme=dark");
+
+    EXPECT_EQ(storage.setCookie("theme=; expires=Thu, 01 Jan 1970 00:00:00 GMT"),
+              BrowserStorage::CookieUpdate::Deleted);
+    EXPECT_EQ(storage.setCookie("sid=x; Max-Age=0"), BrowserStorage::CookieUpdate::Deleted);
+    EXPECT_EQ(storage.cookieString(), "");
+
+    EXPECT_EQ(storage.setCookie("keep=1; max-age=3600; expires=Fri, 31 Dec 9999 23:59:59 GMT"),
+              BrowserStorage::CookieUpdate::Stored);
+    EXPECT_EQ(storage.setCookie(";"), BrowserStorage::CookieUpdate::Rejected);
+    EXPECT_EQ(storage.setCookie("big=" + std::string(BrowserStorage::MAX_COOKIE_BYTES, 'x')),
+              BrowserStorage::CookieUpdate::Rejected);
+    EXPECT_EQ(storage.cookieString(), "keep=1");
+}
+
+TEST(BrowserStorageTest, ResetIsolatesTasksAndRestoresDefaults) {
+    BrowserStorage storage;
+    ASSERT_NE(storage.localStorage().get("username"), nullptr);
+
+    storage.setCookie("token=secret");
+    storage.localStorage().set("username", "attacker");
+    storage.sessionStorage().set("s", "1");
+    storage.indexedDb().set(BrowserStorage::indexedDbKey("db", "store", "1"), "{}");
+
+    storage.reset();
+    EXPECT_EQ(storage.cookieString(), "");
+    EXPECT_EQ(storage.sessionStorage().size(), 0u);
+    EXPECT_EQ(storage.indexedDb().size(), 0u);
+    ASSERT_NE(storage.localStorage().get("username"), nullptr);
+    EXPECT_EQ(*storage.localStorage().get("username"), "stored.user@example.com");
+    EXPECT_EQ(storage.localStorage().size(), 3u);
+
+    // IndexedDB key 는 db / store 경계가 섞이지 않음
+    EXPECT_NE(BrowserStorage::indexedDbKey("a", "bc", "d"), BrowserStorage::indexedDbKey("ab", "c", "d"));
+}
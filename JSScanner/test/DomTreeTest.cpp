@@ -0,0 +1,225 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/DomTree.h"
+#include <chrono>
+
+// ============================================================================
+// Task DOM - 트리 조작 / 선택자 / 직렬화 / document.write 조각 / script 대기열 / 한도
+// ============================================================================
+namespace {
+
+DomNode* element(DomTree& dom, DomNode* parent, const char* tag,
+                 std::initializer_list<std::pair<const char*, const char*>> attrs = {}) {
+    DomNode* node = dom.createElement(tag);
+    for (const auto& [name, value] : attrs) {
+        dom.setAttribute(node, name, value);
+    }
+    if (parent) {
+        dom.appendChild(parent, node);
+    }
+    return node;
+}
+
+DomNode* script(DomTree& dom, DomNode* parent, const char* code) {
+    DomNode* node = element(dom, parent, "script");
+    dom.setTextContent(node, code);
+    return node;
+}
+
+}  // namespace
+
+TEST(DomTreeTest, EmptyDocumentHasHtmlHeadBody) {
+    DomTree dom;
+    ASSERT_NE(dom.documentElement(), nullptr);
+    EXPECT_TRUE(dom.documentElement()->is("html"));
+    EXPECT_EQ(dom.head()->parent, dom.documentElement());
+    EXPECT_EQ(dom.body()->parent, dom.documentElement());
+    EXPECT_EQ(dom.head()->next, dom.body());
+    EXPECT_TRUE(DomTree::isConnected(dom.body()));
+    EXPECT_EQ(dom.node(dom.body()->serial), dom.body());
+}
+
+TEST(DomTreeTest, InsertMoveAndRemove) {
+    DomTree dom;
+    DomNode* a = element(dom, dom.body(), "div", {{"id", "a"}});
+    DomNode* b = element(dom, dom.body(), "div", {{"id", "b"}});
+    DomNode* c = dom.createElement("span");
+
+    EXPECT_FALSE(DomTree::isConnected(c));
+    ASSERT_TRUE(dom.insertBefore(dom.body(), c, b));
+    EXPECT_EQ(a->next, c);
+    EXPECT_EQ(c->next, b);
+
+    // 이미 연결된 노드는 기존 위치에서 떼어 옮김
+    ASSERT_TRUE(dom.appendChild(a, c));
+    EXPECT_EQ(a->next, b);
+    EXPECT_EQ(c->parent, a);
+
+    // 자기 조상 아래로는 옮길 수 없음 / ref 가 다른 부모의 자식이면 실패
+    EXPECT_FALSE(dom.appendChild(c, a));
+    EXPECT_FALSE(dom.insertBefore(dom.body(), dom.createElement("p"), c));
+
+    ASSERT_TRUE(dom.removeChild(dom.body(), a));
+    EXPECT_FALSE(DomTree::isConnected(c));
+    EXPECT_EQ(dom.body()->firstChild, b);
+    EXPECT_EQ(dom.getElementById("a"), nullptr);
+    EXPECT_EQ(dom.getElementById("b"), b);
+}
+
+TEST(DomTreeTest, AttributesKeepOrderAndLowercaseNames) {
+    DomTree dom;
+    DomNode* link = element(dom, dom.body(), "A", {{"HREF", "/x"}, {"id", "l"}});
+    EXPECT_TRUE(link->is("a"));
+    dom.setAttribute(link, "href", "/y");
+    ASSERT_TRUE(dom.getAttribute(link, "Href").has_value());
+    EXPECT_EQ(*dom.getAttribute(link, "href"), "/y");
+    EXPECT_EQ(dom.serialize(link, true), "<a href=\"/y\" id=\"l\"></a>");
+
+    EXPECT_TRUE(dom.removeAttribute(link, "href"));
+    EXPECT_FALSE(dom.removeAttribute(link, "href"));
+    EXPECT_FALSE(dom.getAttribute(link, "href").has_value());
+}
+
+TEST(DomTreeTest, SerializeEscapesTextButNotScriptSource) {
+    DomTree dom;
+    DomNode* p = element(dom, dom.body(), "p", {{"title", "a\"b&c"}});
+    dom.appendChild(p, dom.createText("1 < 2 & 3"));
+    element(dom, p, "br");
+    script(dom, dom.body(), "if (a < b && c) {}");
+
+    EXPECT_EQ(dom.serialize(p, true), "<p title=\"a&quot;b&amp;c\">1 &lt; 2 &amp; 3<br></p>");
+    EXPECT_EQ(dom.serialize(dom.body(), false),
+              "<p title=\"a&quot;b&amp;c\">1 &lt; 2 &amp; 3<br></p><script>if (a < b && c) {}</script>");
+    EXPECT_EQ(dom.textContent(p), "1 < 2 & 3");
+}
+
+TEST(DomTreeTest, QuerySelectorSubset) {
+    DomTree dom;
+    DomNode* form = element(dom, dom.body(), "form", {{"id", "login"}, {"class", "box main"}});
+    DomNode* user = element(dom, form, "input", {{"name", "user"}});
+    DomNode* pass = element(dom, form, "input", {{"name", "pass"}, {"type", "password"}});
+    DomNode* other = element(dom, dom.body(), "input", {{"type", "password"}});
+
+    EXPECT_EQ(dom.querySelector(dom.document(), "#login"), form);
+    EXPECT_EQ(dom.querySelector(dom.document(), "form.main.box"), form);
+    EXPECT_EQ(dom.querySelector(dom.document(), "input[type=password]"), pass);
+    EXPECT_EQ(dom.querySelector(dom.document(), "input[type='password']"), pass);
+    EXPECT_EQ(dom.querySelector(dom.document(), "#login > input"), user);
+    EXPECT_EQ(dom.querySelector(form, "[name]"), user);
+
+    auto inputs = dom.querySelectorAll(dom.document(), "input[type=password]");
+    ASSERT_EQ(inputs.size(), 2u);
+    EXPECT_EQ(inputs[0], pass);
+    EXPECT_EQ(inputs[1], other);
+
+    // ',' 목록은 문서 순서로 한 번씩
+    auto listed = dom.querySelectorAll(dom.document(), "input, form");
+    ASSERT_EQ(listed.size(), 4u);
+    EXPECT_EQ(listed[0], form);
+
+    EXPECT_EQ(dom.querySelectorAll(dom.document(), "*", 2).size(), 2u);
+    // 해석할 수 없는 선택자는 아무것도 찾지 않음
+    EXPECT_TRUE(dom.querySelectorAll(dom.document(), "input:first-child").empty());
+    EXPECT_TRUE(dom.querySelectorAll(dom.document(), "").empty());
+}
+
+TEST(DomTreeTest, TakeWritableHoldsBackUnclosedMarkup) {
+    DomTree dom;
+    EXPECT_EQ(dom.takeWritable("<p>hi</p><scr", false), "<p>hi</p>");
+    EXPECT_TRUE(dom.hasPendingWrite());
+    EXPECT_EQ(dom.takeWritable("ipt>var a = '</p>';", false), "");
+    EXPECT_EQ(dom.takeWritable("</script><b>x", false), "<script>var a = '</p>';</script><b>x");
+    EXPECT_FALSE(dom.hasPendingWrite());
+
+    EXPECT_EQ(dom.takeWritable("<!-- <script>", false), "");
+    EXPECT_EQ(dom.takeWritable("", true), "<!-- <script>");
+    EXPECT_FALSE(dom.hasPendingWrite());
+}
+
+TEST(DomTreeTest, TakeWritableSplitsAnywhere) {
+    const std::string html = "<p class=a>x</p><!-- c -- > --><SCRIPT>if (a < b) s = '</scrip';</ScRiPt ><style>p{}</style><i>";
+    std::string whole;
+    DomTree once;
+    whole = once.takeWritable(html, false);
+
+    // 한 글자씩 써도 같은 위치에서 같은 내용이 나옴
+    DomTree dom;
+    std::string joined;
+    for (char c : html) {
+        joined += dom.takeWritable(std::string_view(&c, 1), false);
+    }
+    EXPECT_EQ(joined, whole);
+    EXPECT_EQ(joined, html);
+    EXPECT_FALSE(dom.hasPendingWrite());
+}
+
+TEST(DomTreeTest, TakeWritableManySmallWritesStayLinear) {
+    // document.write 를 아주 많이 나눠 호출해도 닫히지 않은 script 를 처음부터 다시 검사하지 않음
+    DomTree dom;
+    const size_t writes = 200000;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(dom.takeWritable("<p>a</p><script>", false), "<p>a</p>");
+    for (size_t i = 0; i < writes; ++i) {
+        EXPECT_EQ(dom.takeWritable("x+=1;", false), "");
+    }
+    std::string out = dom.takeWritable("</script>", false);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(out.size(), std::string("<script></script>").size() + writes * 5);
+    EXPECT_FALSE(dom.hasPendingWrite());
+    EXPECT_LT(ms, 2000.0);
+    RecordProperty("take_writable_ms", std::to_string(ms));
+}
+
+TEST(DomTreeTest, QueueScriptsOnlyWhenConnectedAndOnce) {
+    DomTree dom;
+    DomNode* holder = dom.createElement("div");
+    script(dom, holder, "alert(1)");
+    element(dom, holder, "script", {{"type", "application/json"}});
+    DomNode* pendingSrc = element(dom, holder, "script");
+
+    EXPECT_EQ(dom.queueScripts(holder, "appendChild"), 0u);      // 아직 document 밖
+    dom.appendChild(dom.body(), holder);
+    EXPECT_EQ(dom.queueScripts(holder, "appendChild"), 1u);
+    EXPECT_EQ(dom.queueScripts(holder, "appendChild"), 0u);      // already started
+
+    // 내용 없이 붙은 script 는 src 가 채워지면 그때 대기열에 들어감
+    dom.setAttribute(pendingSrc, "src", "https://cdn.example/x.js");
+    EXPECT_EQ(dom.queueScripts(pendingSrc, "src"), 1u);
+
+    auto first = dom.nextScript();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->source, "alert(1)");
+    EXPECT_EQ(first->origin, "appendChild");
+    auto second = dom.nextScript();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->src, "https://cdn.example/x.js");
+    EXPECT_FALSE(dom.nextScript().has_value());
+}
+
+TEST(DomTreeTest, ScriptQueueIsCapped) {
+    DomTree dom;
+    for (size_t i = 0; i < DomTree::MAX_SCRIPTS + 10; ++i) {
+        dom.queueScripts(script(dom, dom.body(), "x++"), "document.write");
+    }
+    EXPECT_EQ(dom.pendingScripts(), DomTree::MAX_SCRIPTS);
+    EXPECT_EQ(dom.droppedScripts(), 10u);
+}
+
+TEST(DomTreeTest, NodeLimitStopsCreation) {
+    DomTree dom;
+    size_t created = dom.nodeCount();
+    while (dom.createText("x")) {
+        ++created;
+    }
+    EXPECT_TRUE(dom.exhausted());
+    EXPECT_EQ(created, DomTree::MAX_NODES);
+    EXPECT_EQ(dom.createElement("div"), nullptr);
+    EXPECT_FALSE(dom.appendChild(dom.body(), nullptr));
+    EXPECT_LE(dom.arenaBytes(), DomTree::MAX_ARENA_BYTES);
+
+    // reset 후에는 다시 사용 가능
+    dom.reset();
+    EXPECT_FALSE(dom.exhausted());
+    EXPECT_NE(dom.createElement("div"), nullptr);
+}
@@ -0,0 +1,82 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/JSAnalyzer.h"
+#include "../builtin/objects/DocumentObject.h"
+#include "../builtin/objects/ElementObject.h"
+
+// ============================================================================
+// DOM wrapper - 노드 serial 은 class opaque 에만 있고 스크립트에서 보이지 않음
+// ============================================================================
+
+namespace {
+    struct DomContext {
+        std::vector<htmljs_scanner::Detection> findings;
+        JSAnalyzerContext analyzerContext{&findings, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+        JSRuntime* rt = JS_NewRuntime();
+        JSContext* ctx = JS_NewContext(rt);
+
+        DomContext() {
+            JS_SetContextOpaque(ctx, &analyzerContext);
+            analyzerContext.atoms.init(ctx);
+            JSValue global = JS_GetGlobalObject(ctx);
+            DocumentObject::registerDocumentObject(ctx, global);
+            JS_FreeValue(ctx, global);
+        }
+
+        ~DomContext() {
+            analyzerContext.atoms.release(rt);
+            analyzerContext.domWrappers.release(rt);
+            JS_SetContextOpaque(ctx, nullptr);
+            JS_FreeContext(ctx);
+            JS_FreeRuntime(rt);
+        }
+
+        JSValue eval(const std::string& code) {
+            return JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+        }
+
+        bool evalBool(const std::string& code) {
+            JSValue result = eval(code);
+            bool value = !JS_IsException(result) && JS_ToBool(ctx, result) == 1;
+            JS_FreeValue(ctx, result);
+            return value;
+        }
+    };
+}
+
+TEST(ElementObjectTest, WrapperHasNoScriptVisibleNodeProperty) {
+    DomContext dom;
+    EXPECT_TRUE(dom.evalBool("var el = document.createElement('div'); !('_domNode' in el)"));
+    EXPECT_TRUE(dom.evalBool("Object.getOwnPropertyNames(el).indexOf('_domNode') < 0"));
+    EXPECT_TRUE(dom.evalBool("JSON.stringify(el).indexOf('_domNode') < 0"));
+}
+
+TEST(ElementObjectTest, WrapperResolvesToItsNode) {
+    DomContext dom;
+    JSValue el = dom.eval("var el = document.createElement('span'); el.id = 'x'; el");
+    ASSERT_FALSE(JS_IsException(el));
+    DomNode* node = ElementObject::nodeOf(dom.ctx, el);
+    ASSERT_NE(node, nullptr);
+    EXPECT_TRUE(node->is("span"));
+
+    // 같은 노드는 같은 wrapper
+    JSValue again = ElementObject::wrapNode(dom.ctx, node);
+    EXPECT_TRUE(JS_IsStrictEqual(dom.ctx, el, again));
+    JS_FreeValue(dom.ctx, again);
+    JS_FreeValue(dom.ctx, el);
+}
+
+TEST(ElementObjectTest, ForgedObjectIsNotANode) {
+    DomContext dom;
+    dom.evalBool("document.createElement('div'); true");
+    JSValue forged = dom.eval("({ _domNode: 1, __proto__: Object.getPrototypeOf(document.createElement('p')) })");
+    ASSERT_FALSE(JS_IsException(forged));
+    EXPECT_EQ(ElementObject::nodeOf(dom.ctx, forged), nullptr);
+    JS_FreeValue(dom.ctx, forged);
+
+    // 공용 prototype 의 DOM 메서드를 가짜 객체에 호출해도 노드를 건드리지 않음
+    EXPECT_TRUE(dom.evalBool(
+        "var fake = Object.create(Object.getPrototypeOf(document.createElement('p')));"
+        "try { fake.appendChild(document.createElement('i')); } catch (e) {}"
+        "fake.parentNode == null"));
+}
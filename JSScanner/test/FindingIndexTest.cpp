@@ -0,0 +1,71 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/FindingIndex.h"
+#include "../core/DynamicStringTracker.h"
+
+// ============================================================================
+// finding 중복 제거 인덱스 / DynamicStringTracker 이벤트 커서 (블록마다 새 이벤트만 처리)
+// ============================================================================
+
+TEST(FindingIndexTest, HitAndMiss) {
+    FindingIndex index;
+    EXPECT_TRUE(index.insert("url_in_variable", "URL stored in variable: a"));
+    EXPECT_FALSE(index.insert("url_in_variable", "URL stored in variable: a"));   // 같은 finding
+    EXPECT_TRUE(index.insert("url_in_variable", "URL stored in variable: b"));    // 메시지가 다름
+    EXPECT_TRUE(index.insert("suspicious_tracked_string", "URL stored in variable: a"));   // reason 이 다름
+    EXPECT_TRUE(index.contains("url_in_variable", "URL stored in variable: b"));
+    EXPECT_FALSE(index.contains("url_in_variable", "URL stored in variable: c"));
+    EXPECT_EQ(index.size(), 3u);
+
+    index.clear();
+    EXPECT_TRUE(index.insert("url_in_variable", "URL stored in variable: a"));
+}
+
+TEST(FindingIndexTest, ReasonAndMessageBoundaryDoesNotAlias) {
+    FindingIndex index;
+    EXPECT_TRUE(index.insert("ab", "c"));
+    EXPECT_TRUE(index.insert("a", "bc"));
+    EXPECT_TRUE(index.insert("a\x1f", "b"));
+    EXPECT_TRUE(index.insert("a", "\x1f" "b"));
+    EXPECT_TRUE(index.insert("1:a", ""));
+    EXPECT_TRUE(index.insert("", "1:a"));
+    EXPECT_TRUE(index.insert("", ""));
+    EXPECT_EQ(index.size(), 7u);
+}
+
+TEST(FindingIndexTest, ManyDistinctFindingsAreAllKept) {
+    FindingIndex index;
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_TRUE(index.insert("suspicious_variable_content", "var" + std::to_string(i)));
+    }
+    EXPECT_EQ(index.size(), 100000u);
+}
+
+TEST(StringEventCursorTest, ProcessesOnlyNewEventsAcrossReset) {
+    DynamicStringTracker tracker;
+    size_t cursor = tracker.getEventCursor();
+    EXPECT_EQ(cursor, 0u);
+
+    tracker.trackString("a", "https://example.com/a");
+    tracker.trackString("b", "https://example.com/b");
+    size_t end = tracker.getEventCursor();
+    ASSERT_GT(end, cursor);
+    std::vector<std::string> seen;
+    for (size_t i = (std::max)(cursor, tracker.getFirstEventCursor()); i < end; ++i) {
+        seen.push_back(tracker.getEventAt(i).varName);
+    }
+    cursor = end;
+    EXPECT_EQ(seen.front(), "a");
+    EXPECT_EQ(seen.back(), "b");
+
+    // 새 이벤트가 없으면 처리할 것이 없음
+    EXPECT_EQ(tracker.getEventCursor(), cursor);
+
+    // reset 후에도 커서는 줄지 않고, 이전 이벤트는 다시 보이지 않음
+    tracker.reset();
+    EXPECT_EQ(tracker.getFirstEventCursor(), cursor);
+    EXPECT_EQ(tracker.getEventCursor(), cursor);
+    tracker.trackString("c", "https://example.com/c");
+    ASSERT_GT(tracker.getEventCursor(), cursor);
+    EXPECT_EQ(tracker.getEventAt(cursor).varName, "c");
+}
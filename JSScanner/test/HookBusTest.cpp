@@ -0,0 +1,68 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/JSAnalyzer.h"
+
+// ============================================================================
+// HookBus - 구독 관심사 (type / severity) 에 따라 payload 생성 여부 결정
+// ============================================================================
+
+TEST(HookBusTest, SkipsPayloadWithoutSubscriber) {
+    HookBus bus;
+    int built = 0;
+    std::vector<HookEvent> received;
+
+    HookBus::Interest interest;
+    interest.atLeast(5).on(HookType::CRYPTO_OPERATION);
+    bus.subscribe("test", interest, [&](const HookEvent& event) { received.push_back(event); });
+
+    auto payload = [&] {
+        built++;
+        return HookPayload{"probe", {}, JsValue(std::monostate()), {}};
+    };
+    EXPECT_FALSE(bus.emit(HookType::DOM_MANIPULATION, 3, payload));
+    EXPECT_TRUE(bus.emit(HookType::DOM_MANIPULATION, 7, payload));
+    EXPECT_TRUE(bus.emit(HookType::CRYPTO_OPERATION, 1, payload));
+
+    EXPECT_EQ(built, 2);
+    ASSERT_EQ(received.size(), 2u);
+    EXPECT_EQ(received[0].type, HookType::DOM_MANIPULATION);
+    EXPECT_EQ(received[0].severity, 7);
+    EXPECT_EQ(received[1].hookType, HookType::CRYPTO_OPERATION);
+    EXPECT_EQ(bus.stats(HookType::DOM_MANIPULATION).skipped, 1u);
+    EXPECT_EQ(bus.stats(HookType::DOM_MANIPULATION).emitted, 1u);
+}
+
+TEST(HookBusTest, PrebuiltEventTakesEmitTypeAndSeverity) {
+    HookBus bus;
+    HookEvent last;
+    bus.subscribe("test", HookBus::Interest().atLeast(0), [&](const HookEvent& event) { last = event; });
+
+    bus.emit(HookType::CLIPBOARD_READ, 9, [&] {
+        HookEvent event;
+        event.reason = "clipboard.readText";
+        return event;
+    });
+    EXPECT_EQ(last.type, HookType::CLIPBOARD_READ);
+    EXPECT_EQ(last.hookType, HookType::CLIPBOARD_READ);
+    EXPECT_EQ(last.severity, 9);
+    EXPECT_EQ(last.reason, "clipboard.readText");
+}
+
+TEST(HookBusTest, DynamicAnalyzerSkipsLowSeverityCalls) {
+    HookBus bus;
+    DynamicAnalyzer analyzer;
+    analyzer.subscribe(bus);
+
+    int built = 0;
+    auto payload = [&] {
+        built++;
+        return HookPayload{"probe", {}, JsValue(std::monostate()), {}};
+    };
+    EXPECT_FALSE(bus.emit(HookType::FUNCTION_CALL, 1, payload));      // Math.*
+    EXPECT_TRUE(bus.emit(HookType::FUNCTION_CALL, 2, payload));       // Array.join
+    EXPECT_TRUE(bus.emit(HookType::CRYPTO_OPERATION, 4, payload));    // parseInt
+    EXPECT_FALSE(bus.emit(HookType::DOM_MANIPULATION, 3, payload));
+
+    EXPECT_EQ(built, 2);
+    EXPECT_EQ(analyzer.getHookEvents().size(), 2u);
+}
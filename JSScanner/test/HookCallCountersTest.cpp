@@ -0,0 +1,94 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <type_traits>
+#include "../core/HookCallCounters.h"
+#include "../core/JSAnalyzer.h"
+#include "../builtin/objects/DocumentObject.h"
+
+// ============================================================================
+// API 별 호출 카운터 - 제한 / 샘플링 판단, 제한을 넘어도 페이지 동작은 그대로
+// ============================================================================
+
+TEST(HookCallCountersTest, AdmitsUntilLimitThenRejects) {
+    HookCallCounters counters;
+    const uint32_t limit = hookApiPolicy(HookApiId::ATOB).maxCalls;
+    ASSERT_GT(limit, 0u);
+
+    for (uint32_t i = 0; i < limit; ++i) {
+        ASSERT_EQ(counters.onCall(HookApiId::ATOB), HookCallDecision::Record);
+    }
+    EXPECT_EQ(counters.onCall(HookApiId::ATOB), HookCallDecision::LimitReached);   // 처음 넘을 때 1회
+    EXPECT_EQ(counters.onCall(HookApiId::ATOB), HookCallDecision::Skip);
+    EXPECT_EQ(counters.onCall(HookApiId::ATOB), HookCallDecision::Skip);
+    EXPECT_EQ(counters.count(HookApiId::ATOB), uint64_t{limit} + 3);    // 건너뛴 호출도 셈
+    EXPECT_EQ(counters.activityCount(), uint64_t{limit} + 3);
+}
+
+TEST(HookCallCountersTest, SamplesAfterThreshold) {
+    HookCallCounters counters;
+    const HookApiPolicy& policy = hookApiPolicy(HookApiId::ARRAY_JOIN);
+    ASSERT_GT(policy.sampleEvery, 1u);
+
+    uint32_t recorded = 0;
+    const uint32_t total = policy.sampleAfter + policy.sampleEvery * 10;
+    for (uint32_t i = 0; i < total; ++i) {
+        if (counters.onCall(HookApiId::ARRAY_JOIN) == HookCallDecision::Record) {
+            recorded++;
+        }
+    }
+    EXPECT_EQ(recorded, policy.sampleAfter + 10);
+    EXPECT_EQ(counters.count(HookApiId::ARRAY_JOIN), total);
+    EXPECT_EQ(counters.activityCount(), 0u);   // countsAsActivity 가 아님
+}
+
+TEST(HookCallCountersTest, SnapshotListsCalledApisAndResetClears) {
+    HookCallCounters counters;
+    static_assert(std::is_same_v<decltype(counters.count(HookApiId::EVAL)), uint64_t>, "counters must not wrap on long runs");
+
+    counters.onCall(HookApiId::EVAL);
+    counters.onCall(HookApiId::EVAL);
+    counters.onCall(HookApiId::FETCH);
+    auto snapshot = counters.snapshot();
+    EXPECT_EQ(snapshot.size(), 2u);
+    EXPECT_EQ(snapshot["eval"], 2u);
+    EXPECT_EQ(snapshot["fetch"], 1u);
+
+    counters.reset();
+    EXPECT_TRUE(counters.snapshot().empty());
+    EXPECT_EQ(counters.activityCount(), 0u);
+}
+
+TEST(HookCallCountersTest, DocumentWriteLandsAfterLimit) {
+    std::vector<htmljs_scanner::Detection> findings;
+    JSAnalyzerContext analyzerContext{&findings, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    JSRuntime* rt = JS_NewRuntime();
+    JSContext* ctx = JS_NewContext(rt);
+    JS_SetContextOpaque(ctx, &analyzerContext);
+    analyzerContext.atoms.init(ctx);
+    JSValue global = JS_GetGlobalObject(ctx);
+    DocumentObject::registerDocumentObject(ctx, global);
+    JS_FreeValue(ctx, global);
+
+    const uint32_t limit = hookApiPolicy(HookApiId::DOCUMENT_WRITE).maxCalls;
+    ASSERT_GT(limit, 0u);
+    std::string code = "for (var i = 0; i < " + std::to_string(limit + 5) + "; i++) document.write('<b></b>');"
+                       "document.write('<p id=\"after\"></p>');";
+    JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+    EXPECT_FALSE(JS_IsException(result));
+    JS_FreeValue(ctx, result);
+    DocumentObject::flushPendingWrites(ctx);
+
+    // 분석은 limit 번까지만, 쓰기는 모두 반영
+    EXPECT_EQ(analyzerContext.callCounters.count(HookApiId::DOCUMENT_WRITE), uint64_t{limit} + 6);
+    size_t analysed = 0;
+    for (const auto& finding : findings) {
+        analysed += finding.reason == "document_write_detected";
+    }
+    EXPECT_EQ(analysed, limit);
+    EXPECT_NE(analyzerContext.dom.getElementById("after"), nullptr);
+
+    analyzerContext.atoms.release(rt);
+    JS_SetContextOpaque(ctx, nullptr);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/JSAnalyzer.h"
+#include "../builtin/objects/ArrayObject.h"
+#include "../builtin/objects/StringObject.h"
+
+// ============================================================================
+// Array.join / String.fromCharCode hook 정확성 및 오버헤드 측정 (push 는 엔진 구현 그대로)
+// HookBus 자체는 HookBusTest.cpp
+// ============================================================================
+namespace {
+
+const char* kWorkload = R"JS(
+var total = 0;
+for (var i = 0; i < 20000; i++) {
+    var parts = [];
+    for (var j = 0; j < 16; j++) {
+        parts.push(String.fromCharCode(97 + ((i + j) % 26)));
+    }
+    total += parts.join(j % 2 ? '-' : ',').length;
+}
+total;
+)JS";
+
+class HookedContext {
+public:
+    explicit HookedContext(bool hooked, JSAnalyzerContext* analyzerContext = nullptr) {
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+        if (hooked) {
+            JSValue global = JS_GetGlobalObject(ctx);
+            StringObject::registerStringFunctions(ctx, global);
+            ArrayObject::registerArrayFunctions(ctx, global);
+            JS_FreeValue(ctx, global);
+        }
+        JS_SetContextOpaque(ctx, analyzerContext);
+    }
+    ~HookedContext() {
+        JS_SetContextOpaque(ctx, nullptr);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    std::string evalToString(const char* code) {
+        JSValue val = JS_Eval(ctx, code, strlen(code), "<test>", JS_EVAL_TYPE_GLOBAL);
+        std::string out;
+        if (JS_IsException(val)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            out = "<exception>";
+        } else {
+            size_t len = 0;
+            const char* str = JS_ToCStringLen(ctx, &len, val);
+            if (str) {
+                out.assign(str, len);
+                JS_FreeCString(ctx, str);
+            }
+        }
+        JS_FreeValue(ctx, val);
+        return out;
+    }
+
+    double timeMs(const char* code, std::string& result) {
+        auto start = std::chrono::steady_clock::now();
+        result = evalToString(code);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    JSRuntime* rt;
+    JSContext* ctx;
+};
+
+} // namespace
+
+TEST(ArrayStringHookTest, JoinPreservesEmbeddedNul) {
+    HookedContext hooked(true);
+    EXPECT_EQ(hooked.evalToString("['a', '\\0', 'b'].join('').length"), "3");
+    EXPECT_EQ(hooked.evalToString("[1, [2, 3], null, undefined].join()"), "1,2,3,,");
+    EXPECT_EQ(hooked.evalToString("Array.prototype.join.name"), "join");
+}
+
+TEST(ArrayStringHookTest, PushMatchesEngineSemantics) {
+    HookedContext hooked(true);
+    EXPECT_EQ(hooked.evalToString("var a = [1]; a.push(2, 3) + ':' + a.join('|')"), "3:1|2|3");
+    EXPECT_EQ(hooked.evalToString("var o = {length: 1}; Array.prototype.push.call(o, 'x'); o.length + o[1]"), "2x");
+}
+
+TEST(ArrayStringHookTest, FromCharCodeHandlesNonAscii) {
+    HookedContext hooked(true);
+    EXPECT_EQ(hooked.evalToString("String.fromCharCode(0xAC00, 0x41).length"), "2");
+    EXPECT_EQ(hooked.evalToString("String.fromCharCode(0xAC00)"), "\xEA\xB0\x80");
+    EXPECT_EQ(hooked.evalToString("String.fromCharCode(0x10041)"), "A");
+}
+
+TEST(ArrayStringHookTest, RecordsOnlyInterestingJoins) {
+    std::vector<htmljs_scanner::Detection> findings;
+    DynamicAnalyzer analyzer;
+    JSAnalyzerContext analyzerContext{&findings, &analyzer, nullptr, nullptr, nullptr, nullptr, nullptr};
+    analyzer.subscribe(analyzerContext.hookBus);
+    HookedContext hooked(true, &analyzerContext);
+
+    hooked.evalToString("['a', 'b'].join(' '); ['e', 'v', 'a', 'l'].join('');");
+
+    size_t joinEvents = 0;
+    for (const auto& event : analyzer.getHookEvents()) {
+        if (event.name == "Array.join") {
+            joinEvents++;
+            EXPECT_EQ(JsValueToString(event.result), "eval");
+        }
+    }
+    EXPECT_EQ(joinEvents, 1u);
+}
+
+TEST(ArrayStringHookTest, JoinConvertsSeparatorOnce) {
+    HookedContext hooked(true);
+    EXPECT_EQ(hooked.evalToString("var n = 0; var sep = {toString() { n++; return '+'; }};"
+                                  "[1, 2, 3].join(sep) + ':' + n"), "1+2+3:1");
+    EXPECT_EQ(hooked.evalToString("try { [1].join({toString() { throw 'boom'; }}); } catch (e) { e; }"), "boom");
+}
+
+TEST(ArrayStringHookTest, CountsEveryJoinCall) {
+    std::vector<htmljs_scanner::Detection> findings;
+    DynamicAnalyzer analyzer;
+    JSAnalyzerContext analyzerContext{&findings, &analyzer, nullptr, nullptr, nullptr, nullptr, nullptr};
+    analyzer.subscribe(analyzerContext.hookBus);
+    HookedContext hooked(true, &analyzerContext);
+
+    hooked.evalToString("for (var i = 0; i < 10; i++) { ['a', 'b'].join(' '); } ['e', 'v', 'a', 'l'].join('');");
+    EXPECT_EQ(analyzerContext.callCounters.count(HookApiId::ARRAY_JOIN), 11u);
+    EXPECT_EQ(analyzerContext.callCounters.snapshot()["Array.join"], 11u);
+}
+
+TEST(ArrayStringHookBenchmark, OverheadVersusUnhookedEngine) {
+    HookedContext plain(false);
+    HookedContext hooked(true);
+
+    std::vector<htmljs_scanner::Detection> findings;
+    DynamicAnalyzer analyzer;
+    JSAnalyzerContext analyzerContext{&findings, &analyzer, nullptr, nullptr, nullptr, nullptr, nullptr};
+    analyzer.subscribe(analyzerContext.hookBus);
+    HookedContext observed(true, &analyzerContext);
+
+    std::string plainResult, hookedResult, observedResult;
+    // 워밍업 후 측정
+    plain.timeMs(kWorkload, plainResult);
+    double plainMs = plain.timeMs(kWorkload, plainResult);
+    double hookedMs = hooked.timeMs(kWorkload, hookedResult);
+    double observedMs = observed.timeMs(kWorkload, observedResult);
+
+    EXPECT_EQ(plainResult, hookedResult);
+    EXPECT_EQ(plainResult, observedResult);
+
+    std::cout << "[ BENCH    ] unhooked: " << plainMs << " ms, hooked (no context): " << hookedMs
+              << " ms, hooked (analyzer context): " << observedMs << " ms, overhead: "
+              << (plainMs > 0 ? hookedMs / plainMs : 0.0) << "x / "
+              << (plainMs > 0 ? observedMs / plainMs : 0.0) << "x" << std::endl;
+    RecordProperty("unhooked_ms", std::to_string(plainMs));
+    RecordProperty("hooked_ms", std::to_string(hookedMs));
+    RecordProperty("observed_ms", std::to_string(observedMs));
+}
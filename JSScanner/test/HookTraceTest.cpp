@@ -0,0 +1,66 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/HookTrace.h"
+
+namespace {
+int g_evaluated = 0;
+
+std::string expensiveField() {
+    g_evaluated++;
+    return "value";
+}
+}
+
+TEST(HookTraceTest, DisabledTraceSkipsArgumentEvaluation) {
+    g_evaluated = 0;
+    ASSERT_EQ(HookTrace::current(), nullptr);
+    HOOK_TRACE("fetch", "sensitive_body", {"url", expensiveField()});
+    EXPECT_EQ(g_evaluated, 0);
+
+    HookTrace trace;
+    {
+        HookTrace::Activation activation(&trace);
+        HOOK_TRACE("fetch", "sensitive_body", {"url", expensiveField()});
+    }
+    EXPECT_EQ(g_evaluated, 1);
+    EXPECT_EQ(HookTrace::current(), nullptr);
+    EXPECT_EQ(trace.records().size(), 1u);
+}
+
+TEST(HookTraceTest, WritesOneJsonObjectPerLine) {
+    HookTrace trace;
+    HookTrace::Activation activation(&trace);
+    HOOK_TRACE("proxy_fallback", "install_start");
+    HOOK_TRACE("xhr", "high_risk", {"url", std::string("http://a.ru/\"x\"\n")}, {"score", 9}, {"sensitive", true});
+
+    std::string ndjson = trace.toNdjson("task-1");
+    std::vector<std::string> lines;
+    std::istringstream in(ndjson);
+    for (std::string line; std::getline(in, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(lines.size(), 3u);
+
+    auto first = nlohmann::json::parse(lines[0]);
+    EXPECT_EQ(first["ch"], "proxy_fallback");
+    EXPECT_EQ(first["ev"], "install_start");
+
+    auto second = nlohmann::json::parse(lines[1]);
+    EXPECT_EQ(second["url"], "http://a.ru/\"x\"\n");
+    EXPECT_EQ(second["score"], 9);
+    EXPECT_EQ(second["sensitive"], true);
+    EXPECT_GE(second["ts"].get<int64_t>(), first["ts"].get<int64_t>());
+
+    auto summary = nlohmann::json::parse(lines[2]);
+    EXPECT_EQ(summary["task"], "task-1");
+    EXPECT_EQ(summary["records"], 2);
+}
+
+TEST(HookTraceTest, DropsRecordsOverLimit) {
+    HookTrace trace(2);
+    for (int i = 0; i < 5; ++i) {
+        trace.record("fetch", "excessive_calls", {{"count", i}});
+    }
+    EXPECT_EQ(trace.records().size(), 2u);
+    EXPECT_EQ(trace.dropped(), 3u);
+}
@@ -0,0 +1,155 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "../reporters/JsonStreamWriter.h"
+#include "../reporters/AnalysisResponse.h"
+
+// ============================================================================
+// 스트리밍 JSON 출력 - nlohmann::json::dump() 와 바이트 단위로 같은지 확인 (잘못된 UTF-8 은 replace 모드와 비교)
+// ============================================================================
+
+namespace {
+
+AnalysisResponse makeResponse() {
+    AnalysisResponse response("task-42");
+    response.addExtractedUrl("http://evil.example/a?b=\"c\"");
+    response.addExtractedFile("scan_report/task-42.files/abc");
+
+    htmljs_scanner::Detection late;
+    late.analysisCode = "DA";
+    late.name = "JSScanner.Late";
+    late.severity = 3;
+    late.addFeature("note", std::string("line\nbreak\ttab \x01 \xE2\x9C\x93"));
+    response.addDetection(late);
+
+    htmljs_scanner::Detection first;
+    first.analysisCode = "DA";
+    first.name = "JSScanner.First";
+    first.severity = 9;
+    first.detectionOrder = 1;
+    first.addFeature("count", 12);
+    first.addFeature("ratio", 0.125);
+    first.addFeature("flag", true);
+    first.addFeature("missing", JsValue());
+    first.addFeature("list", std::vector<JsValue>{JsValue(1), JsValue(std::string("x")), JsValue(1e21)});
+    first.addFeature("nested", std::map<std::string, JsValue>{{"z", JsValue(-0.0001)}, {"a", JsValue(123456789.5)}});
+    response.addDetection(first);
+
+    RouteHint hint("WasmAnalyzer", "miner");
+    hint.addTrigger("wasm");
+    hint.addTrigger("crypto");
+    response.addRouteHint(hint);
+
+    Timing timing(57);
+    timing.stages.push_back({"block/js_eval", 1, 3, 12.5, 7.25});
+    timing.blocks.push_back({0, 40.0, {{"js_eval", 12.5}, {"compile", 1.0}, {"js_eval", 13.5}}});
+    response.Timings.push_back(timing);
+
+    TaintedValue taint("taint_1", JsValue(std::string("payload")), "atob", 8, "decoded");
+    taint.addParent("taint_0");
+    taint.propagateTo("b");
+    taint.propagateTo("a");
+    response.addTaintedValue(taint);
+    response.addTaintStatistic("total", 1);
+    response.ApiCallCounts["eval"] = 3;
+    response.ApiCallCounts["atob"] = 12;
+    response.version = htmljs_scanner::Version("1.0.0", "2026-10-19");
+    response.errors = "none";
+    return response;
+}
+
+}  // namespace
+
+TEST(JsonStreamWriterTest, NumbersAndStringsMatchNlohmann) {
+    std::vector<JsValue> values = {
+        JsValue(0.0), JsValue(-0.0), JsValue(1.0), JsValue(-3.0), JsValue(0.1), JsValue(1.0 / 3.0),
+        JsValue(1e15), JsValue(1e16), JsValue(123456789012345678.0), JsValue(1e-4), JsValue(1e-5),
+        JsValue(5e-324), JsValue(1.7976931348623157e308), JsValue(2.5e-7),
+        JsValue(std::string("q\"b\\s/\b\f\n\r\t\x1f\x7f")), JsValue(std::string("\xED\x95\x9C\xEA\xB8\x80 \xF0\x9F\x94\xA5")),
+        JsValue(true), JsValue(false), JsValue(),
+        JsValue(std::vector<JsValue>{}), JsValue(std::map<std::string, JsValue>{}),
+    };
+    for (const auto& value : values) {
+        EXPECT_EQ(JsonStreamWriter::toString(value), JsValueToJson(value).dump());
+    }
+}
+
+TEST(JsonStreamWriterTest, InvalidUtf8IsReplacedInsteadOfThrowing) {
+    std::string text = "a\xC3(b\xFF" "c\xE2\x82";
+    std::string out = JsonStreamWriter::toString(JsValue(text));
+    EXPECT_EQ(out, "\"a\xEF\xBF\xBD(b\xEF\xBF\xBD" "c\xEF\xBF\xBD\"");   // 잘린 시퀀스는 U+FFFD 하나
+    EXPECT_THROW(JsValueToJson(JsValue(text)).dump(), nlohmann::json::type_error);
+}
+
+TEST(JsonStreamWriterTest, InvalidUtf8MatchesNlohmannReplace) {
+    const std::vector<std::string> texts = {
+        "\xE2\x82", "\xF0\x9F\x94", "x\xF0\x9F\x94", "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+        "\xC0\xAF", "\x80\x80", "\xE2\x82(\xE2\x82\xAC", "\xF0\x9F\x94\xF0\x9F\x94\xA5", "\xF5\xC3",
+    };
+    for (const auto& text : texts) {
+        std::string expected = nlohmann::json(text).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+        EXPECT_EQ(JsonStreamWriter::toString(JsValue(text)), expected);
+        EXPECT_EQ("\"" + JsonStreamWriter::replaceInvalidUtf8(text) + "\"", expected);
+    }
+}
+
+TEST(JsonStreamWriterTest, ShortestDoublesMatchNlohmann) {
+    // to_chars 최단 표기와 grisu2 가 자릿수를 다르게 고르는 값 포함
+    std::vector<double> values = {-3.556169393814842e-26, 9007199254740993.0, 0.3, 2.0 / 3.0, 1e23, 4.35e-10};
+    uint64_t bits = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < 20000; ++i) {
+        bits ^= bits << 13;
+        bits ^= bits >> 7;
+        bits ^= bits << 17;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        values.push_back(value);
+    }
+    for (double value : values) {
+        if (!std::isfinite(value)) continue;
+        std::string out;
+        JsonStreamWriter(out).number(value);
+        ASSERT_EQ(out, nlohmann::json(value).dump()) << std::hexfloat << value;
+    }
+}
+
+TEST(JsonStreamWriterTest, AnalysisResponseMatchesToJsonDump) {
+    AnalysisResponse response = makeResponse();
+    EXPECT_EQ(response.toJsonString(), response.toJson().dump());
+    EXPECT_EQ(response.toJsonString(4), response.toJson().dump(4));
+
+    AnalysisResponse empty("task-0");
+    empty.version = htmljs_scanner::Version("1.0.0", "2026-10-19");
+    EXPECT_EQ(empty.toJsonString(), empty.toJson().dump());
+    EXPECT_EQ(empty.toJsonString(4), empty.toJson().dump(4));
+}
+
+TEST(JsonStreamWriterTest, FileSinkFlushesInChunks) {
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+
+    std::string expected;
+    {
+        JsonStreamWriter buffered(expected);
+        JsonStreamWriter streamed(file);
+        buffered.beginArray();
+        streamed.beginArray();
+        for (int i = 0; i < 20000; ++i) {
+            std::string item = "item-" + std::to_string(i);
+            buffered.string(item);
+            streamed.string(item);
+        }
+        buffered.endArray();
+        streamed.endArray();
+        EXPECT_TRUE(streamed.flush());
+    }
+
+    std::string actual(static_cast<size_t>(std::ftell(file)), '\0');
+    std::rewind(file);
+    ASSERT_EQ(std::fread(actual.data(), 1, actual.size(), file), actual.size());
+    std::fclose(file);
+    EXPECT_GT(expected.size(), 64u * 1024u);
+    EXPECT_EQ(actual, expected);
+}
@@ -0,0 +1,184 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include "../core/JSAnalyzer.h"
+#include "../builtin/BuiltinObject.h"
+#include "../builtin/LazyGlobals.h"
+
+// ============================================================================
+// 지연 등록 전역 - 첫 접근 시 묶음 전체 등록, 스크립트 대입 유지, eager 등록과 같은 typeof / in
+// ============================================================================
+namespace {
+
+// LazyGlobals.cpp 의 묶음과 같은 순서 (eager 비교 컨텍스트용)
+void (*const kGroupInstallers[])(JSContext*, JSValue) = {
+    JQueryObject::registerJQueryObject,
+    WebSocketObject::registerWebSocketObject,
+    WebAssemblyObject::registerWebAssemblyObject,
+    WorkerObject::registerWorkerObject,
+    IndexedDBObject::registerIndexedDBObject,
+    MediumPriorityAPIs::registerMediumPriorityAPIs,
+    LowPriorityAPIs::registerLowPriorityAPIs,
+};
+
+const char* kLazyNames = "['$', 'jQuery', 'WebSocket', 'WebAssembly', 'Worker', 'SharedWorker', 'indexedDB',"
+                         " 'Element', 'MutationObserver', 'sessionStorage',"
+                         " 'Notification', 'RTCPeerConnection', 'requestAnimationFrame']";
+
+class GlobalsContext {
+public:
+    enum class Mode { Lazy, Eager };
+
+    explicit GlobalsContext(Mode mode) {
+        auto start = std::chrono::steady_clock::now();
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+        JS_SetContextOpaque(ctx, &analyzerContext);
+        analyzerContext.atoms.init(ctx);
+        JSValue global = JS_GetGlobalObject(ctx);
+        if (mode == Mode::Lazy) {
+            LazyGlobals::install(ctx, global);
+        } else {
+            for (auto installer : kGroupInstallers) {
+                installer(ctx, global);
+            }
+        }
+        JS_FreeValue(ctx, global);
+        setupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    ~GlobalsContext() {
+        analyzerContext.atoms.release(rt);
+        JS_SetContextOpaque(ctx, nullptr);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    std::string eval(const std::string& code) {
+        JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+        if (JS_IsException(result)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            return "<exception>";
+        }
+        const char* str = JS_ToCString(ctx, result);
+        std::string out = str ? str : "";
+        JS_FreeCString(ctx, str);
+        JS_FreeValue(ctx, result);
+        return out;
+    }
+
+    int64_t memoryUsed() {
+        JSMemoryUsage usage;
+        JS_ComputeMemoryUsage(rt, &usage);
+        return usage.memory_used_size;
+    }
+
+    double setupSeconds = 0;
+
+private:
+    std::vector<htmljs_scanner::Detection> findings;
+    JSAnalyzerContext analyzerContext{&findings, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+    JSRuntime* rt = nullptr;
+    JSContext* ctx = nullptr;
+};
+
+// 아직 getter 로 남아 있으면 "lazy", 아니면 "ready"
+const char* kStateOf =
+    "function stateOf(name) {"
+    "  var d = Object.getOwnPropertyDescriptor(globalThis, name);"
+    "  return !d ? 'absent' : (d.get ? 'lazy' : 'ready');"
+    "}";
+
+} // namespace
+
+TEST(LazyGlobalsTest, NamesStartAsGettersAndInDoesNotMaterialize) {
+    if (LazyGlobals::eagerMode()) GTEST_SKIP() << "JSSCANNER_EAGER_GLOBALS is set";
+    GlobalsContext js(GlobalsContext::Mode::Lazy);
+    js.eval(kStateOf);
+    EXPECT_EQ(js.eval("stateOf('Worker') + ',' + ('Worker' in globalThis) + ',' + stateOf('Worker')"),
+              "lazy,true,lazy");
+    // 열거되지 않음 (전역 순회가 getter 를 실행하지 않도록)
+    EXPECT_EQ(js.eval("Object.keys(globalThis).indexOf('Worker')"), "-1");
+}
+
+TEST(LazyGlobalsTest, FirstAccessMaterializesWholeGroup) {
+    if (LazyGlobals::eagerMode()) GTEST_SKIP() << "JSSCANNER_EAGER_GLOBALS is set";
+    GlobalsContext js(GlobalsContext::Mode::Lazy);
+    js.eval(kStateOf);
+    EXPECT_EQ(js.eval("typeof Worker"), "function");
+    EXPECT_EQ(js.eval("stateOf('Worker') + ',' + stateOf('SharedWorker')"), "ready,ready");
+    EXPECT_EQ(js.eval("typeof SharedWorker"), "function");
+    // 다른 묶음은 그대로
+    EXPECT_EQ(js.eval("stateOf('WebSocket') + ',' + stateOf('indexedDB')"), "lazy,lazy");
+
+    // 묶음 안 두 번째 이름으로 처음 접근해도 묶음 전체 등록
+    EXPECT_EQ(js.eval("typeof requestAnimationFrame"), "function");
+    EXPECT_EQ(js.eval("stateOf('Notification') + ',' + stateOf('RTCPeerConnection') + ',' + typeof navigator.geolocation"),
+              "ready,ready,object");
+
+    // 꺼내 둔 getter 를 다시 불러도 같은 객체 (두 번 등록하지 않음)
+    EXPECT_EQ(js.eval(
+        "var d = Object.getOwnPropertyDescriptor(globalThis, 'WebSocket');"
+        "var first = d.get.call(globalThis); d.get.call(globalThis) === first && WebSocket === first"),
+        "true");
+}
+
+TEST(LazyGlobalsTest, AssignmentBeforeAccessSurvives) {
+    if (LazyGlobals::eagerMode()) GTEST_SKIP() << "JSSCANNER_EAGER_GLOBALS is set";
+    GlobalsContext js(GlobalsContext::Mode::Lazy);
+    js.eval(kStateOf);
+    // 대입한 이름만 일반 속성, 묶음은 아직 생성되지 않음
+    EXPECT_EQ(js.eval("SharedWorker = 7; stateOf('SharedWorker') + ',' + stateOf('Worker')"), "ready,lazy");
+    EXPECT_EQ(js.eval("typeof Worker + ',' + SharedWorker"), "function,7");
+
+    // defineProperty / delete 도 등록 후 그대로
+    EXPECT_EQ(js.eval(
+        "Object.defineProperty(globalThis, 'jQuery', { value: 'mine', configurable: true });"
+        "typeof $ + ',' + jQuery"),
+        "function,mine");
+    EXPECT_EQ(js.eval("delete globalThis.MutationObserver; typeof Element + ',' + ('MutationObserver' in globalThis)"),
+              "function,false");
+}
+
+TEST(LazyGlobalsTest, TypeofAndInMatchEagerGlobals) {
+    if (LazyGlobals::eagerMode()) GTEST_SKIP() << "JSSCANNER_EAGER_GLOBALS is set";
+    // in 을 typeof 보다 먼저 확인 (in 은 getter 를 실행하지 않음)
+    const std::string probe = std::string("var names = ") + kLazyNames + ";"
+        "JSON.stringify(names.map(function (n) {"
+        "  var has = n in globalThis;"
+        "  return [n, has, eval('typeof ' + n), typeof globalThis[n], n in globalThis];"
+        "}))";
+
+    GlobalsContext lazy(GlobalsContext::Mode::Lazy);
+    GlobalsContext eager(GlobalsContext::Mode::Eager);
+    std::string expected = eager.eval(probe);
+    ASSERT_NE(expected, "<exception>");
+    EXPECT_EQ(lazy.eval(probe), expected);
+}
+
+// jsscanner_context_setup_seconds / jsscanner_context_baseline_memory_bytes 의 lazy / eager 차이 측정
+TEST(LazyGlobalsBenchmark, SetupCostVersusEager) {
+    if (LazyGlobals::eagerMode()) GTEST_SKIP() << "JSSCANNER_EAGER_GLOBALS is set";
+    constexpr int kRounds = 50;
+    double lazySeconds = 0;
+    double eagerSeconds = 0;
+    int64_t lazyBytes = 0;
+    int64_t eagerBytes = 0;
+    for (int i = 0; i < kRounds; ++i) {
+        GlobalsContext lazy(GlobalsContext::Mode::Lazy);
+        GlobalsContext eager(GlobalsContext::Mode::Eager);
+        lazySeconds += lazy.setupSeconds;
+        eagerSeconds += eager.setupSeconds;
+        lazyBytes = lazy.memoryUsed();
+        eagerBytes = eager.memoryUsed();
+    }
+
+    std::cout << "[ BENCH    ] deferred groups setup: lazy " << lazySeconds * 1000.0 / kRounds << " ms, eager "
+              << eagerSeconds * 1000.0 / kRounds << " ms; heap lazy " << lazyBytes << " bytes, eager "
+              << eagerBytes << " bytes" << std::endl;
+    RecordProperty("lazy_setup_us", std::to_string(static_cast<int64_t>(lazySeconds * 1e6 / kRounds)));
+    RecordProperty("eager_setup_us", std::to_string(static_cast<int64_t>(eagerSeconds * 1e6 / kRounds)));
+    RecordProperty("lazy_heap_bytes", std::to_string(lazyBytes));
+    RecordProperty("eager_heap_bytes", std::to_string(eagerBytes));
+    EXPECT_LT(lazyBytes, eagerBytes);
+}
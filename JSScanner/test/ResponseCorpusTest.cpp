@@ -0,0 +1,116 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "../core/ResponseCorpus.h"
+
+// ============================================================================
+// 오프라인 응답 저장소: HAR 매니페스트 / 경로 suffix 색인 조회
+// ============================================================================
+namespace {
+
+std::string writeTempFile(const std::string& name, const std::string& content) {
+    std::string path = testing::TempDir() + name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << content;
+    return path;
+}
+
+const char* kHar = R"JSON({
+  "log": {
+    "entries": [
+      {
+        "request": { "method": "GET", "url": "https://Evil.example/stage2.js?v=1" },
+        "response": { "status": 200, "content": { "mimeType": "application/javascript", "text": "var stage = 2;" } }
+      },
+      {
+        "request": { "method": "POST", "url": "https://evil.example/api/key" },
+        "response": { "status": 201, "content": { "text": "eyJrIjoxfQ==", "encoding": "base64" } }
+      },
+      {
+        "request": { "method": "GET", "url": "https://evil.example/big.bin" },
+        "response": { "status": 200, "content": { "_file": "rc_big.bin" } }
+      }
+    ]
+  }
+})JSON";
+
+} // namespace
+
+TEST(ResponseCorpusTest, NormalizesUrlsAndPaths) {
+    EXPECT_EQ(ResponseCorpus::normalizeUrl("HTTPS://Evil.Example/A.js#x"), "https://evil.example/A.js");
+    EXPECT_EQ(ResponseCorpus::normalizeUrl("https://evil.example?q=1"), "https://evil.example/?q=1");
+    EXPECT_EQ(ResponseCorpus::normalizeUrl("js/a.js#top"), "js/a.js");
+
+    std::vector<std::string> expected = {"cdn.example", "js", "a b.js"};
+    EXPECT_EQ(ResponseCorpus::pathSegments("//CDN.example:8080/js/x/../A%20B.js?x=1#f"), expected);
+    expected = {"js", "index.html"};
+    EXPECT_EQ(ResponseCorpus::pathSegments("./js/"), expected);
+}
+
+TEST(ResponseCorpusTest, ServesHarEntriesByMethodAndUrl) {
+    std::string bigPath = writeTempFile("rc_big.bin", std::string("\0\x01payload", 9));
+    std::string baseDir = bigPath.substr(0, bigPath.find_last_of('/'));
+
+    ResponseCorpus corpus;
+    ASSERT_EQ(corpus.loadHar(kHar, baseDir), 3u);
+
+    auto stage2 = corpus.lookup("get", "https://evil.example/stage2.js?v=1");
+    ASSERT_TRUE(stage2);
+    EXPECT_EQ(stage2->body, "var stage = 2;");
+    EXPECT_EQ(stage2->contentType, "application/javascript");
+
+    // 다른 query / 상대 URL 도 host 를 뺀 경로로 적중
+    ASSERT_TRUE(corpus.lookup("GET", "/stage2.js?v=2"));
+    ASSERT_TRUE(corpus.lookup("GET", "stage2.js"));
+
+    auto key = corpus.lookup("POST", "https://evil.example/api/key");
+    ASSERT_TRUE(key);
+    EXPECT_EQ(key->status, 201);
+    EXPECT_EQ(key->body, "{\"k\":1}");
+    EXPECT_FALSE(corpus.lookup("GET", "https://evil.example/api/key"));
+
+    auto big = corpus.lookup("GET", "https://evil.example/big.bin");
+    ASSERT_TRUE(big);
+    EXPECT_EQ(big->body, std::string("\0\x01payload", 9));
+
+    EXPECT_EQ(corpus.hits(), 5u);
+    EXPECT_EQ(corpus.misses(), 1u);
+    std::remove(bigPath.c_str());
+}
+
+TEST(ResponseCorpusTest, ResolvesStoredFilesByLongestPathSuffix) {
+    std::string loaderPath = writeTempFile("rc_loader.js", "stage('a');");
+    std::string otherPath = writeTempFile("rc_loader_b.js", "stage('b');");
+
+    ResponseCorpus corpus;
+    corpus.addFile("cdn.example/js/loader.js", loaderPath);
+    corpus.addFile("mirror.example/js/loader.js", otherPath);
+    EXPECT_EQ(corpus.indexedFiles(), 2u);
+
+    auto a = corpus.lookup("GET", "https://cdn.example/js/loader.js?cb=123");
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->body, "stage('a');");
+    EXPECT_EQ(a->source, "file");
+
+    auto b = corpus.lookup("GET", "//MIRROR.example/js/loader.js");
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->body, "stage('b');");
+
+    // "js/loader.js" 는 두 파일에 모두 해당 - 모호하므로 응답하지 않음
+    EXPECT_FALSE(corpus.lookup("GET", "/js/loader.js"));
+    // 파일 색인은 GET 계열만
+    EXPECT_FALSE(corpus.lookup("POST", "https://cdn.example/js/loader.js"));
+
+    std::remove(loaderPath.c_str());
+    std::remove(otherPath.c_str());
+}
+
+TEST(ResponseCorpusTest, RejectsMalformedManifest) {
+    ResponseCorpus corpus;
+    EXPECT_EQ(corpus.loadHar("{not json"), 0u);
+    EXPECT_EQ(corpus.loadHar(R"({"log": {"entries": [{"request": {}}]}})"), 0u);
+    EXPECT_EQ(corpus.loadHar(R"({"log": {"entries": [{"request": {"url": "https://a.example/"}, "response": {"status": "200"}}]}})"), 0u);
+    EXPECT_TRUE(corpus.empty());
+    EXPECT_FALSE(corpus.lookup("GET", "https://evil.example/"));
+}
@@ -0,0 +1,83 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/StageProfiler.h"
+
+// ============================================================================
+// 단계별 실행 시간 - 호출 트리 / 블록별 집계
+// ============================================================================
+
+namespace {
+
+// executeJavaScriptBlock 과 같은 순서 (ScopedStageBlock → "block" → 하위 단계)
+void runBlock(bool nested = false) {
+    ScopedStageBlock stage_block;
+    STAGE_SCOPE("block");
+    {
+        STAGE_SCOPE("js_eval");
+        STAGE_SCOPE("dom_flush");
+    }
+    {
+        STAGE_SCOPE("hook_dispatch");
+    }
+    if (nested) {
+        runBlock();
+    }
+}
+
+const StageProfiler::BlockRecord& onlyBlock(const StageProfiler& profiler) {
+    EXPECT_EQ(profiler.getBlocks().size(), 1u);
+    return profiler.getBlocks().front();
+}
+
+std::vector<std::string> stageNames(const StageProfiler::BlockRecord& block) {
+    std::vector<std::string> names;
+    for (const auto& [name, us] : block.stages) {
+        names.emplace_back(name);
+    }
+    return names;
+}
+
+}  // namespace
+
+TEST(StageProfilerTest, ChildStagesAppearInBlockBreakdown) {
+    StageProfiler profiler;
+    StageProfiler::Activation activation(&profiler);
+    runBlock();
+
+    // 블록 바로 아래 단계만 (손자 단계 dom_flush 와 "block" 자신은 제외)
+    EXPECT_EQ(stageNames(onlyBlock(profiler)),
+              (std::vector<std::string>{"js_eval", "hook_dispatch"}));
+}
+
+TEST(StageProfilerTest, NestedBlockIsMergedIntoOuterBlock) {
+    StageProfiler profiler;
+    StageProfiler::Activation activation(&profiler);
+    runBlock(true);
+
+    // 재귀 실행의 단계는 바깥 블록 아래 "block" 으로 한 번만 합산
+    EXPECT_EQ(stageNames(onlyBlock(profiler)),
+              (std::vector<std::string>{"js_eval", "hook_dispatch", "block"}));
+
+    bool foundNestedEval = false;
+    for (size_t i = 0; i < profiler.getNodes().size(); ++i) {
+        if (profiler.getPath(static_cast<int>(i)) == "block/block/js_eval") {
+            foundNestedEval = profiler.getNodes()[i].count == 1;
+        }
+    }
+    EXPECT_TRUE(foundNestedEval);
+}
+
+TEST(StageProfilerTest, StagesOutsideBlockAreNotAttributed) {
+    StageProfiler profiler;
+    StageProfiler::Activation activation(&profiler);
+    {
+        STAGE_SCOPE("parse");
+    }
+    runBlock();
+    {
+        STAGE_SCOPE("report");
+    }
+
+    EXPECT_EQ(stageNames(onlyBlock(profiler)),
+              (std::vector<std::string>{"js_eval", "hook_dispatch"}));
+}
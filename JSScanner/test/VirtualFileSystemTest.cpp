@@ -0,0 +1,136 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/Sha256.h"
+#include "../core/VirtualFileSystem.h"
+
+// ============================================================================
+// SHA-256 벡터 / VFS 경로 정규화 / 공유 버퍼 / 한도 / 형식 판별 / 실행 명령 매칭
+// ============================================================================
+
+TEST(Sha256Test, KnownVectors) {
+    EXPECT_EQ(Sha256::hex(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(Sha256::hex("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    EXPECT_EQ(Sha256::hex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(Sha256Test, IncrementalMatchesOneShot) {
+    std::string data(1000, 'a');
+    Sha256 hasher;
+    for (size_t pos = 0; pos < data.size(); pos += 37) {
+        hasher.update(std::string_view(data).substr(pos, 37));
+    }
+    EXPECT_EQ(Sha256::toHex(hasher.finish()), Sha256::hex(data));
+    EXPECT_EQ(Sha256::hex(std::string(1000000, 'a')),
+              "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(VirtualFileSystemTest, NormalizePath) {
+    EXPECT_EQ(VirtualFileSystem::normalizePath("C:/Users/User/AppData/Local/Temp/A.EXE"),
+              "c:\\users\\user\\appdata\\local\\temp\\a.exe");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("%TEMP%\\a.exe"),
+              "c:\\users\\user\\appdata\\local\\temp\\a.exe");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("\"c:\\x\\\\.\\y\\..\\z.js\""), "c:\\x\\z.js");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("drop.vbs"), "c:\\users\\user\\drop.vbs");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("\\windows\\x.dll"), "c:\\windows\\x.dll");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("\\\\server\\share\\p.exe"), "\\\\server\\share\\p.exe");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("c:\\..\\.."), "c:\\");
+    EXPECT_EQ(VirtualFileSystem::normalizePath("  "), "");
+
+    EXPECT_EQ(VirtualFileSystem::expandEnvironment("%windir%\\%unknown%\\%AppData%"),
+              "C:\\Windows\\%unknown%\\C:\\Users\\user\\AppData\\Roaming");
+}
+
+TEST(VirtualFileSystemTest, ReadsAndCopiesShareTheBuffer) {
+    VirtualFileSystem vfs;
+    auto payload = VirtualFileSystem::makeBuffer("MZ\x90\x00 payload");
+    ASSERT_TRUE(vfs.writeFile("%TEMP%\\a.exe", payload, "ADODB.Stream.SaveToFile"));
+    EXPECT_EQ(vfs.readFile("c:/users/user/appdata/local/temp/A.exe").get(), payload.get());
+
+    ASSERT_TRUE(vfs.copyFile("%TEMP%\\a.exe", "c:\\b.exe", false));
+    EXPECT_EQ(vfs.readFile("c:\\b.exe").get(), payload.get());
+    EXPECT_FALSE(vfs.copyFile("%TEMP%\\a.exe", "c:\\b.exe", false));
+
+    // 공유 중인 버퍼에 추가하면 분리되고 원본은 그대로
+    ASSERT_TRUE(vfs.appendFile("c:\\b.exe", "!", "TextStream.Write"));
+    EXPECT_NE(vfs.readFile("c:\\b.exe").get(), payload.get());
+    EXPECT_EQ(*vfs.readFile("%temp%\\a.exe"), *payload);
+    EXPECT_EQ(vfs.readFile("c:\\b.exe")->size(), payload->size() + 1);
+    EXPECT_EQ(vfs.totalBytes(), payload->size() * 2 + 1);
+
+    ASSERT_TRUE(vfs.moveFile("c:\\b.exe", "c:\\c.exe"));
+    EXPECT_FALSE(vfs.exists("c:\\b.exe"));
+    EXPECT_TRUE(vfs.deleteFile("c:\\c.exe"));
+    EXPECT_EQ(vfs.fileCount(), 1u);
+    EXPECT_EQ(vfs.totalBytes(), payload->size());
+    EXPECT_EQ(vfs.readFile("c:\\missing"), nullptr);
+}
+
+TEST(VirtualFileSystemTest, AppendToIsInPlaceWhenUnshared) {
+    auto buffer = VirtualFileSystem::makeBuffer("ab");
+    const std::string* before = buffer.get();
+    VirtualFileSystem::appendTo(buffer, "cd");
+    EXPECT_EQ(buffer.get(), before);
+    EXPECT_EQ(*buffer, "abcd");
+
+    auto alias = buffer;
+    VirtualFileSystem::appendTo(buffer, "e");
+    EXPECT_NE(buffer.get(), alias.get());
+    EXPECT_EQ(*alias, "abcd");
+    EXPECT_EQ(*buffer, "abcde");
+}
+
+TEST(VirtualFileSystemTest, LimitsTruncateAndRefuse) {
+    VirtualFileSystem vfs;
+    auto big = VirtualFileSystem::makeBuffer(std::string(VirtualFileSystem::MAX_FILE_BYTES + 10, 'x'));
+    ASSERT_TRUE(vfs.writeFile("c:\\big.bin", big, "test"));
+    EXPECT_EQ(vfs.readFile("c:\\big.bin")->size(), VirtualFileSystem::MAX_FILE_BYTES);
+    EXPECT_TRUE(vfs.limitReached());
+
+    auto artifacts = vfs.artifacts();
+    ASSERT_EQ(artifacts.size(), 1u);
+    EXPECT_TRUE(artifacts[0].truncated);
+
+    VirtualFileSystem many;
+    for (size_t i = 0; i < VirtualFileSystem::MAX_FILES; ++i) {
+        ASSERT_TRUE(many.writeFile("c:\\f" + std::to_string(i), nullptr, "test"));
+    }
+    EXPECT_FALSE(many.writeFile("c:\\one-more", nullptr, "test"));
+    // 이미 있는 파일은 계속 쓸 수 있음
+    EXPECT_TRUE(many.appendFile("c:\\f0", "x", "test"));
+}
+
+TEST(VirtualFileSystemTest, SniffType) {
+    EXPECT_EQ(VirtualFileSystem::sniffType(""), "empty");
+    EXPECT_EQ(VirtualFileSystem::sniffType(std::string_view("MZ\x90\x00", 4)), "pe");
+    EXPECT_EQ(VirtualFileSystem::sniffType("PK\x03\x04rest"), "zip");
+    EXPECT_EQ(VirtualFileSystem::sniffType("\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1"), "ole");
+    EXPECT_EQ(VirtualFileSystem::sniffType("%PDF-1.7"), "pdf");
+    EXPECT_EQ(VirtualFileSystem::sniffType("{\\rtf1"), "rtf");
+    EXPECT_EQ(VirtualFileSystem::sniffType("Set sh = CreateObject(\"WScript.Shell\")"), "script");
+    EXPECT_EQ(VirtualFileSystem::sniffType("hello world\r\n"), "text");
+    EXPECT_EQ(VirtualFileSystem::sniffType(std::string_view("ab\0cd", 5)), "binary");
+}
+
+TEST(VirtualFileSystemTest, RecordCommandResolvesDroppedFiles) {
+    VirtualFileSystem vfs;
+    vfs.writeFile("%TEMP%\\Update.exe", VirtualFileSystem::makeBuffer("MZ"), "test");
+    vfs.writeFile("%APPDATA%\\run.vbs", VirtualFileSystem::makeBuffer("WScript.Echo 1"), "test");
+
+    auto direct = vfs.recordCommand("WScript.Shell.Run", "\"%TEMP%\\update.exe\" /silent");
+    ASSERT_EQ(direct.size(), 1u);
+    EXPECT_EQ(direct[0], "c:\\users\\user\\appdata\\local\\temp\\update.exe");
+
+    // 셸을 거치거나 파일 이름만 쓴 경우
+    auto viaShell = vfs.recordCommand("WScript.Shell.Exec", "cmd /c start RUN.VBS&&exit");
+    ASSERT_EQ(viaShell.size(), 1u);
+    EXPECT_EQ(viaShell[0], "c:\\users\\user\\appdata\\roaming\\run.vbs");
+
+    EXPECT_TRUE(vfs.recordCommand("WScript.Shell.Run", "calc.exe").empty());
+    ASSERT_EQ(vfs.commands().size(), 3u);
+    EXPECT_EQ(vfs.commands()[1].api, "WScript.Shell.Exec");
+
+    for (const auto& artifact : vfs.artifacts()) {
+        EXPECT_TRUE(artifact.executed) << artifact.path;
+    }
+}
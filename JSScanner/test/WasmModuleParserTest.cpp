@@ -0,0 +1,256 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "../core/WasmModuleParser.h"
+
+// ============================================================================
+// WebAssembly 바이너리 파서 - 섹션 / LEB128 / opcode 히스토그램 / 스트리밍 / 변조 입력
+// ============================================================================
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+void leb(Bytes& out, uint64_t value) {
+    do {
+        uint8_t b = value & 0x7F;
+        value >>= 7;
+        out.push_back(value ? (b | 0x80) : b);
+    } while (value);
+}
+
+void name(Bytes& out, const std::string& text) {
+    leb(out, text.size());
+    out.insert(out.end(), text.begin(), text.end());
+}
+
+void section(Bytes& module, uint8_t id, const Bytes& payload) {
+    module.push_back(id);
+    leb(module, payload.size());
+    module.insert(module.end(), payload.begin(), payload.end());
+}
+
+Bytes header() {
+    return {0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00};
+}
+
+// 함수 본문들(명령어 바이트, 끝의 end 포함)로 모듈 구성 - import: env.fetch, memory 1 page, export "run"
+Bytes buildModule(const std::vector<Bytes>& bodies, const std::string& exportName = "run") {
+    Bytes module = header();
+
+    Bytes types;
+    leb(types, 1);
+    types.insert(types.end(), {0x60, 0x01, 0x7F, 0x01, 0x7F});     // (i32) -> i32
+    section(module, 1, types);
+
+    Bytes imports;
+    leb(imports, 2);
+    name(imports, "env");
+    name(imports, "fetch");
+    imports.insert(imports.end(), {0x00, 0x00});                   // func type 0
+    name(imports, "env");
+    name(imports, "memory");
+    imports.insert(imports.end(), {0x02, 0x01, 0x01, 0x10});       // memory min 1 max 16
+    section(module, 2, imports);
+
+    Bytes functions;
+    leb(functions, bodies.size());
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        functions.push_back(0x00);
+    }
+    section(module, 3, functions);
+
+    Bytes exports;
+    leb(exports, 1);
+    name(exports, exportName);
+    exports.insert(exports.end(), {0x00, 0x01});                   // func 1 (첫 정의 함수)
+    section(module, 7, exports);
+
+    Bytes code;
+    leb(code, bodies.size());
+    for (const auto& body : bodies) {
+        Bytes entry = {0x01, 0x02, 0x7F};                           // locals: 2 x i32
+        entry.insert(entry.end(), body.begin(), body.end());
+        leb(code, entry.size());
+        code.insert(code.end(), entry.begin(), entry.end());
+    }
+    section(module, 10, code);
+
+    Bytes data;                                                     // 건너뛰는 섹션
+    leb(data, 1);
+    data.insert(data.end(), {0x00, 0x41, 0x00, 0x0B, 0x03, 'a', 'b', 'c'});
+    section(module, 11, data);
+    return module;
+}
+
+// 해시 라운드 흉내: x = rotl(x ^ k, 7) + x (반복)
+Bytes hashRoundBody(int rounds) {
+    Bytes body;
+    for (int i = 0; i < rounds; ++i) {
+        body.insert(body.end(), {0x20, 0x00, 0x41, 0xB3, 0xE6, 0x01, 0x73,    // local.get 0, i32.const, i32.xor
+                                 0x41, 0x07, 0x77,                            // i32.const 7, i32.rotl
+                                 0x20, 0x00, 0x6A, 0x21, 0x00});              // local.get 0, i32.add, local.set 0
+    }
+    body.insert(body.end(), {0x20, 0x00, 0x0B});
+    return body;
+}
+
+// 일반 코드: 메모리 load / store, 호출, 분기
+Bytes plainBody(int repeats) {
+    Bytes body;
+    for (int i = 0; i < repeats; ++i) {
+        body.insert(body.end(), {0x02, 0x40,                                  // block
+                                 0x20, 0x00, 0x28, 0x02, 0x80, 0x01,          // local.get 0, i32.load align=2 offset=128
+                                 0x10, 0x00, 0x21, 0x01,                      // call 0, local.set 1
+                                 0x20, 0x00, 0x20, 0x01, 0x36, 0x02, 0x04,    // i32.store
+                                 0x20, 0x01, 0x0D, 0x00, 0x0B});              // br_if 0, end
+    }
+    body.insert(body.end(), {0x20, 0x00, 0x0B});
+    return body;
+}
+
+void expectSameSummary(const WasmModuleParser::Summary& a, const WasmModuleParser::Summary& b) {
+    EXPECT_EQ(a.valid, b.valid);
+    EXPECT_EQ(a.error, b.error);
+    EXPECT_EQ(a.byteSize, b.byteSize);
+    EXPECT_EQ(a.importCount, b.importCount);
+    EXPECT_EQ(a.functionCount, b.functionCount);
+    EXPECT_EQ(a.codeBodyCount, b.codeBodyCount);
+    EXPECT_EQ(a.instructionCount, b.instructionCount);
+    EXPECT_EQ(a.opcodeHistogram, b.opcodeHistogram);
+}
+
+} // namespace
+
+TEST(WasmModuleParserTest, DecodesSectionsWithMultiByteSizes) {
+    Bytes module = buildModule({hashRoundBody(20), plainBody(1)});     // code 섹션 크기 > 127 (2바이트 LEB)
+    auto summary = WasmModuleParser::parse(module.data(), module.size());
+
+    ASSERT_TRUE(summary.valid) << summary.error;
+    EXPECT_EQ(summary.byteSize, module.size());
+    EXPECT_EQ(summary.typeCount, 1u);
+    EXPECT_EQ(summary.importCount, 2u);
+    EXPECT_EQ(summary.importedFunctionCount, 1u);
+    EXPECT_EQ(summary.functionCount, 2u);
+    EXPECT_EQ(summary.totalFunctionCount(), 3u);
+    EXPECT_EQ(summary.codeBodyCount, 2u);
+    EXPECT_TRUE(summary.hasMemory);
+    EXPECT_EQ(summary.initialMemoryPages, 1u);
+
+    ASSERT_EQ(summary.imports.size(), 2u);
+    EXPECT_EQ(summary.imports[0].module, "env");
+    EXPECT_EQ(summary.imports[0].name, "fetch");
+    EXPECT_EQ(summary.imports[1].kind, WasmModuleParser::KIND_MEMORY);
+    ASSERT_EQ(summary.exports.size(), 1u);
+    EXPECT_EQ(summary.exports[0].name, "run");
+    EXPECT_EQ(summary.exports[0].index, 1u);
+}
+
+TEST(WasmModuleParserTest, HistogramSkipsImmediates) {
+    // i32.const 의 immediate 0x73 / 0x77 은 xor / rotl 로 세면 안 됨
+    Bytes body = {0x41, 0xF3, 0x00, 0x41, 0x77, 0x6A, 0x1A,         // i32.const 115, i32.const -9, i32.add, drop
+                  0x44, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x1A,   // f64.const, drop
+                  0x20, 0x00, 0x0B};
+    Bytes module = buildModule({body});
+    auto summary = WasmModuleParser::parse(module.data(), module.size());
+
+    ASSERT_TRUE(summary.valid) << summary.error;
+    EXPECT_EQ(summary.instructionCount, 8u);
+    EXPECT_EQ(summary.count(0x41), 2u);
+    EXPECT_EQ(summary.count(0x44), 1u);
+    EXPECT_EQ(summary.count(0x73), 0u);
+    EXPECT_EQ(summary.count(0x77), 0u);
+    EXPECT_EQ(summary.undecodedBytes, 0u);
+}
+
+TEST(WasmModuleParserTest, ChunkedFeedMatchesSingleParse) {
+    Bytes module = buildModule({hashRoundBody(50), plainBody(30), hashRoundBody(3)});
+    auto whole = WasmModuleParser::parse(module.data(), module.size());
+    ASSERT_TRUE(whole.valid) << whole.error;
+
+    for (size_t chunk : {1u, 3u, 7u, 64u, 1000u}) {
+        WasmModuleParser parser;
+        for (size_t offset = 0; offset < module.size(); offset += chunk) {
+            parser.feed(module.data() + offset, std::min(chunk, module.size() - offset));
+        }
+        expectSameSummary(parser.finish(), whole);
+    }
+}
+
+TEST(WasmModuleParserTest, RejectsTruncatedAndMalformedModules) {
+    Bytes module = buildModule({plainBody(4)});
+
+    for (size_t cut : {size_t(0), size_t(4), size_t(9), module.size() / 2, module.size() - 1}) {
+        auto summary = WasmModuleParser::parse(module.data(), cut);
+        EXPECT_FALSE(summary.valid) << "cut at " << cut;
+        EXPECT_FALSE(summary.error.empty());
+    }
+
+    Bytes badMagic = module;
+    badMagic[1] = 'x';
+    EXPECT_EQ(WasmModuleParser::parse(badMagic.data(), badMagic.size()).error, "bad magic");
+
+    // 섹션 크기가 모듈 끝을 넘음
+    Bytes oversized = header();
+    oversized.insert(oversized.end(), {0x01, 0xFF, 0xFF, 0x03, 0x01, 0x60});
+    EXPECT_FALSE(WasmModuleParser::parse(oversized.data(), oversized.size()).valid);
+
+    // 5바이트를 넘는 LEB
+    Bytes overlong = header();
+    overlong.insert(overlong.end(), {0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01});
+    EXPECT_EQ(WasmModuleParser::parse(overlong.data(), overlong.size()).error, "malformed section size");
+
+    // 함수 본문 크기가 code 섹션을 넘음
+    Bytes bodyOverrun = header();
+    bodyOverrun.insert(bodyOverrun.end(), {0x0A, 0x04, 0x01, 0x7F, 0x00, 0x0B});
+    EXPECT_EQ(WasmModuleParser::parse(bodyOverrun.data(), bodyOverrun.size()).error, "function body exceeds code section");
+}
+
+TEST(WasmModuleParserTest, SurvivesRandomMutations) {
+    Bytes module = buildModule({hashRoundBody(10), plainBody(10)});
+    std::mt19937 rng(1234);
+    for (int i = 0; i < 2000; ++i) {
+        Bytes mutated = module;
+        int flips = 1 + static_cast<int>(rng() % 4);
+        for (int f = 0; f < flips; ++f) {
+            mutated[8 + rng() % (mutated.size() - 8)] = static_cast<uint8_t>(rng());
+        }
+        auto summary = WasmModuleParser::parse(mutated.data(), mutated.size());
+        EXPECT_LE(summary.instructionCount, mutated.size());
+    }
+}
+
+TEST(WasmModuleParserTest, HashLoopProfileFlagsMinerLikeCode) {
+    Bytes miner = buildModule({hashRoundBody(300)});
+    auto minerProfile = WasmModuleParser::profile(WasmModuleParser::parse(miner.data(), miner.size()));
+    EXPECT_TRUE(minerProfile.looksLikeMiner);
+    EXPECT_FALSE(minerProfile.minerExport);
+    EXPECT_GT(minerProfile.rotateDensity, 0.05);
+
+    Bytes plain = buildModule({plainBody(300)});
+    auto plainProfile = WasmModuleParser::profile(WasmModuleParser::parse(plain.data(), plain.size()));
+    EXPECT_FALSE(plainProfile.looksLikeMiner);
+    EXPECT_EQ(plainProfile.rotate, 0u);
+
+    // 작은 모듈이라도 export 이름이 알려진 채굴 함수면 표시
+    Bytes named = buildModule({plainBody(1)}, "_cryptonight_hash");
+    auto namedProfile = WasmModuleParser::profile(WasmModuleParser::parse(named.data(), named.size()));
+    EXPECT_TRUE(namedProfile.minerExport);
+    EXPECT_TRUE(namedProfile.looksLikeMiner);
+}
+
+TEST(WasmModuleParserTest, ParsesLargeModuleThroughput) {
+    std::vector<Bytes> bodies(512, hashRoundBody(1000));        // 약 7.5MB code 섹션
+    Bytes module = buildModule(bodies);
+
+    auto start = std::chrono::steady_clock::now();
+    auto summary = WasmModuleParser::parse(module.data(), module.size());
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_TRUE(summary.valid) << summary.error;
+    EXPECT_EQ(summary.codeBodyCount, 512u);
+    EXPECT_EQ(summary.count(0x77), 512u * 1000u);
+    std::cout << "[wasm] " << module.size() / 1024 << " KB, " << summary.instructionCount
+              << " instructions in " << elapsed << " ms" << std::endl;
+}
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "../core/JSAnalyzer.h"
+#include "../builtin/objects/WindowObject.h"
+
+// ============================================================================
+// window Proxy get 트랩 정확성 (self 참조, 캐시 무효화) 및 property 조회 처리량 측정
+// ============================================================================
+namespace {
+
+// 기능 탐지 스크립트 패턴: 없는 이름 반복 조회 + 있는 이름 조회
+const char* kWorkload = R"JS(
+var hits = 0;
+for (var i = 0; i < 200000; i++) {
+    if (window.chrome) hits++;
+    if (window.opera) hits++;
+    if (window._phantom) hits++;
+    if (window.callPhantom) hits++;
+    if (window.location) hits++;
+    if (window.navigator) hits++;
+}
+hits;
+)JS";
+
+// Proxy 없이 같은 모양의 일반 객체
+const char* kPlainWindow = "globalThis.window = { location: {}, navigator: {} };";
+
+class WindowContext {
+public:
+    enum class Mode { Plain, Proxy, ProxyWithContext };
+
+    explicit WindowContext(Mode mode) {
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+        if (mode == Mode::ProxyWithContext) {
+            analyzerContext.reset(new JSAnalyzerContext{&findings, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr});
+            JS_SetContextOpaque(ctx, analyzerContext.get());
+            analyzerContext->atoms.init(ctx);
+        }
+        if (mode == Mode::Plain) {
+            evalToString(kPlainWindow);
+        } else {
+            JSValue global = JS_GetGlobalObject(ctx);
+            WindowObject::registerWindowObject(ctx, global);
+            JS_FreeValue(ctx, global);
+        }
+    }
+    ~WindowContext() {
+        if (analyzerContext) {
+            analyzerContext->windowPropertyCache.release(rt);
+            analyzerContext->atoms.release(rt);
+        }
+        JS_SetContextOpaque(ctx, nullptr);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    std::string evalToString(const char* code) {
+        JSValue val = JS_Eval(ctx, code, strlen(code), "<test>", JS_EVAL_TYPE_GLOBAL);
+        std::string out;
+        if (JS_IsException(val)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+            out = "<exception>";
+        } else {
+            size_t len = 0;
+            const char* str = JS_ToCStringLen(ctx, &len, val);
+            if (str) {
+                out.assign(str, len);
+                JS_FreeCString(ctx, str);
+            }
+        }
+        JS_FreeValue(ctx, val);
+        return out;
+    }
+
+    double timeMs(const char* code, std::string& result) {
+        auto start = std::chrono::steady_clock::now();
+        result = evalToString(code);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::vector<htmljs_scanner::Detection> findings;
+    std::unique_ptr<JSAnalyzerContext> analyzerContext;
+    JSRuntime* rt;
+    JSContext* ctx;
+};
+
+} // namespace
+
+TEST(WindowProxyTest, SelfReferencesResolveToProxy) {
+    WindowContext window(WindowContext::Mode::ProxyWithContext);
+    EXPECT_EQ(window.evalToString("window.window === window && window.self === window && window.top === window"), "true");
+    EXPECT_EQ(window.evalToString("typeof window.fetch + ':' + typeof window.location.replace"), "function:function");
+    EXPECT_EQ(window.evalToString("typeof window.noSuchApi"), "undefined");
+}
+
+TEST(WindowProxyTest, MissingCacheInvalidatedByDefinitions) {
+    WindowContext window(WindowContext::Mode::ProxyWithContext);
+    EXPECT_EQ(window.evalToString("window.foo; window.foo; window.foo = 1; window.foo"), "1");
+    EXPECT_EQ(window.evalToString("window.bar; Object.defineProperty(window, 'bar', {value: 2}); window.bar"), "2");
+    EXPECT_EQ(window.evalToString("delete window.foo; typeof window.foo"), "undefined");
+    EXPECT_EQ(window.evalToString("window.baz; Object.prototype.baz = 3; window.baz"), "3");
+    EXPECT_EQ(window.evalToString("window.qux = undefined; 'qux' in window"), "true");
+
+    const WindowPropertyCache& cache = window.analyzerContext->windowPropertyCache;
+    EXPECT_GT(cache.hits(), 0u);
+    EXPECT_GE(cache.invalidations(), 3u);
+}
+
+TEST(WindowProxyBenchmark, PropertyAccessThroughput) {
+    WindowContext plain(WindowContext::Mode::Plain);
+    WindowContext proxy(WindowContext::Mode::Proxy);
+    WindowContext cached(WindowContext::Mode::ProxyWithContext);
+
+    std::string plainResult, proxyResult, cachedResult;
+    // 워밍업 후 측정
+    plain.timeMs(kWorkload, plainResult);
+    double plainMs = plain.timeMs(kWorkload, plainResult);
+    double proxyMs = proxy.timeMs(kWorkload, proxyResult);
+    double cachedMs = cached.timeMs(kWorkload, cachedResult);
+
+    EXPECT_EQ(plainResult, "400000");
+    EXPECT_EQ(plainResult, proxyResult);
+    EXPECT_EQ(plainResult, cachedResult);
+
+    std::cout << "[ BENCH    ] plain object: " << plainMs << " ms, Proxy (no context): " << proxyMs
+              << " ms, Proxy (atom cache): " << cachedMs << " ms, overhead: "
+              << (plainMs > 0 ? proxyMs / plainMs : 0.0) << "x / "
+              << (plainMs > 0 ? cachedMs / plainMs : 0.0) << "x" << std::endl;
+    RecordProperty("plain_ms", std::to_string(plainMs));
+    RecordProperty("proxy_ms", std::to_string(proxyMs));
+    RecordProperty("cached_ms", std::to_string(cachedMs));
+}
@@ -0,0 +1,169 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "../core/WorkerMessageQueue.h"
+#include "../core/JSAnalyzer.h"
+#include "../builtin/helpers/JSValueConverter.h"
+#include "../builtin/objects/BlobObject.h"
+#include "../builtin/objects/WorkerObject.h"
+
+// ============================================================================
+// Worker 메시지 큐 / data: URL 해석 / 별도 컨텍스트 실행과 병합
+// ============================================================================
+namespace {
+
+class ParentContext {
+public:
+    ParentContext() : host(nullptr, nullptr) {
+        rt = JS_NewRuntime();
+        ctx = JS_NewContext(rt);
+        analyzerContext.reset(new JSAnalyzerContext{&findings, &analyzer, nullptr, nullptr, nullptr, nullptr, nullptr});
+        analyzerContext->workerHost = &host;
+        analyzer.subscribe(analyzerContext->hookBus);
+        JS_SetContextOpaque(ctx, analyzerContext.get());
+        analyzerContext->atoms.init(ctx);
+
+        JSValue global = JS_GetGlobalObject(ctx);
+        BlobObject::registerBlobObject(ctx, global);
+        WorkerObject::registerWorkerObject(ctx, global);
+        JS_FreeValue(ctx, global);
+    }
+    ~ParentContext() {
+        host.finish(ctx, analyzerContext.get());
+        analyzerContext->atoms.release(rt);
+        JS_SetContextOpaque(ctx, nullptr);
+        JS_FreeContext(ctx);
+        JS_FreeRuntime(rt);
+    }
+
+    std::string eval(const char* code) {
+        JSValue val = JS_Eval(ctx, code, strlen(code), "<test>", JS_EVAL_TYPE_GLOBAL);
+        std::string out = JS_IsException(val) ? "<exception>" : JSValueConverter::toString(ctx, val);
+        if (JS_IsException(val)) {
+            JS_FreeValue(ctx, JS_GetException(ctx));
+        }
+        JS_FreeValue(ctx, val);
+        return out;
+    }
+
+    // 조건이 참이 될 때까지 Worker 메시지 전달 (최대 2초)
+    bool pumpUntil(const char* condition) {
+        for (int i = 0; i < 200; ++i) {
+            host.deliverMessages(ctx);
+            if (eval(condition) == "true") {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return false;
+    }
+
+    std::vector<htmljs_scanner::Detection> findings;
+    DynamicAnalyzer analyzer;
+    WorkerHost host;
+    std::unique_ptr<JSAnalyzerContext> analyzerContext;
+    JSRuntime* rt;
+    JSContext* ctx;
+};
+
+} // namespace
+
+TEST(WorkerMessageQueueTest, DropsWhenFullOrClosed) {
+    WorkerMessageQueue queue(2);
+    EXPECT_TRUE(queue.push("a"));
+    EXPECT_TRUE(queue.push("b"));
+    EXPECT_FALSE(queue.push("c"));
+    EXPECT_EQ(queue.dropped(), 1u);
+
+    EXPECT_EQ(queue.tryPop(), "a");
+    queue.close();
+    EXPECT_FALSE(queue.push("d"));
+    EXPECT_EQ(queue.pop(), "b");            // 닫힌 뒤에도 남은 메시지는 꺼냄
+    EXPECT_FALSE(queue.pop().has_value());
+    EXPECT_EQ(queue.dropped(), 2u);
+
+    queue.recordDropped();                  // 크기 초과로 넣지 않은 메시지
+    EXPECT_EQ(queue.dropped(), 3u);
+}
+
+TEST(WorkerMessageQueueTest, CloseWakesWaitingReceiver) {
+    WorkerMessageQueue queue(4);
+    std::optional<std::string> received = std::string("unset");
+    std::thread receiver([&] { received = queue.pop(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    queue.close();
+    receiver.join();
+    EXPECT_FALSE(received.has_value());
+}
+
+TEST(WorkerHostTest, DecodesDataUrls) {
+    std::string body;
+    ASSERT_TRUE(WorkerHost::decodeDataUrl("data:text/javascript;base64,cG9zdE1lc3NhZ2UoMSk=", body));
+    EXPECT_EQ(body, "postMessage(1)");
+    ASSERT_TRUE(WorkerHost::decodeDataUrl("data:,var%20a%3D1;", body));
+    EXPECT_EQ(body, "var a=1;");
+    EXPECT_FALSE(WorkerHost::decodeDataUrl("https://example.com/w.js", body));
+    EXPECT_FALSE(WorkerHost::decodeDataUrl("data:text/javascript", body));
+}
+
+TEST(WorkerHostTest, RunsBlobWorkerAndRoutesMessages) {
+    ParentContext parent;
+    EXPECT_EQ(parent.eval(R"JS(
+        var got = [];
+        var src = "onmessage = function (e) { postMessage({ sum: e.data.a + e.data.b, worker: typeof window }); };";
+        var w = new Worker(URL.createObjectURL(new Blob([src], { type: 'text/javascript' })));
+        w.onmessage = function (e) { got.push(e.data); };
+        w.postMessage({ a: 40, b: 2 });
+        typeof w.terminate;
+    )JS"), "function");
+
+    ASSERT_TRUE(parent.pumpUntil("got.length === 1"));
+    EXPECT_EQ(parent.eval("got[0].sum + ':' + got[0].worker"), "42:undefined");
+
+    parent.host.finish(parent.ctx, parent.analyzerContext.get());
+    bool merged = false;
+    for (const auto& event : parent.analyzer.getHookEvents()) {
+        if (event.type == HookType::WORKER_POST_MESSAGE && event.tags.count("worker") &&
+            event.features.count("worker_url")) {
+            merged = true;
+        }
+    }
+    EXPECT_TRUE(merged);
+}
+
+TEST(WorkerHostTest, SharedWorkerConnectsThroughPort) {
+    ParentContext parent;
+    parent.eval(R"JS(
+        var reply = null;
+        var sw = new SharedWorker("data:text/javascript,onconnect%20%3D%20function%20(e)%20%7B%20var%20p%20%3D%20e.ports%5B0%5D%3B%20p.onmessage%20%3D%20function%20(m)%20%7B%20p.postMessage('pong%3A'%20%2B%20m.data)%3B%20%7D%3B%20%7D%3B");
+        sw.port.addEventListener('message', function (e) { reply = e.data; });
+        sw.port.postMessage('ping');
+    )JS");
+    ASSERT_TRUE(parent.pumpUntil("reply !== null"));
+    EXPECT_EQ(parent.eval("reply"), "pong:ping");
+}
+
+TEST(WorkerHostTest, BusyWorkerIsStoppedByTimeBudget) {
+    ParentContext parent;
+    parent.eval("new Worker('data:,for(;;){}');");
+    std::this_thread::sleep_for(WorkerHost::TIME_BUDGET + std::chrono::milliseconds(250));
+    parent.host.finish(parent.ctx, parent.analyzerContext.get());
+
+    bool timedOut = false;
+    for (const auto& finding : parent.findings) {
+        timedOut |= finding.reason == "worker_time_budget_exceeded";
+    }
+    EXPECT_TRUE(timedOut);
+}
+
+TEST(WorkerHostTest, ShutdownInterruptIsNotReportedAsTimeout) {
+    ParentContext parent;
+    parent.eval("new Worker('data:,for(;;){}');");
+    auto start = std::chrono::steady_clock::now();
+    parent.host.finish(parent.ctx, parent.analyzerContext.get());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, WorkerHost::TIME_BUDGET);
+
+    for (const auto& finding : parent.findings) {
+        EXPECT_NE(finding.reason, "worker_time_budget_exceeded");
+    }
+}